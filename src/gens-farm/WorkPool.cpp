@@ -0,0 +1,202 @@
+/***************************************************************************
+ * gens-farm: Gens/GS II ROM compatibility farm.                           *
+ * WorkPool.cpp: Work-stealing thread pool.                                *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "WorkPool.hpp"
+
+// C includes.
+#include <stdint.h>
+
+// C++ includes.
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+using std::deque;
+using std::vector;
+
+namespace GensFarm {
+
+/** WorkPoolPrivate **/
+
+class WorkPoolPrivate
+{
+	public:
+		WorkPoolPrivate(int threads);
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		WorkPoolPrivate(const WorkPoolPrivate &);
+		WorkPoolPrivate &operator=(const WorkPoolPrivate &);
+
+	public:
+		int threads;
+		std::atomic<int> steals;
+
+		// Job queue for each worker.
+		struct Queue {
+			std::mutex mtx;
+			deque<int> jobs;
+		};
+		vector<Queue> queues;
+
+		/**
+		 * Get the next job for a worker.
+		 * @param worker Worker number.
+		 * @return Job number, or -1 if there are no jobs left.
+		 */
+		int nextJob(int worker);
+
+		/**
+		 * Worker thread function.
+		 * @param func Job function.
+		 * @param worker Worker number.
+		 */
+		void workerMain(const WorkPool::JobFunc &func, int worker);
+};
+
+WorkPoolPrivate::WorkPoolPrivate(int threads)
+	: threads(threads)
+	, steals(0)
+	, queues(threads)
+{ }
+
+/**
+ * Get the next job for a worker.
+ * @param worker Worker number.
+ * @return Job number, or -1 if there are no jobs left.
+ */
+int WorkPoolPrivate::nextJob(int worker)
+{
+	// Own queue first. Jobs are taken from the front.
+	{
+		Queue &q = queues[worker];
+		std::lock_guard<std::mutex> lock(q.mtx);
+		if (!q.jobs.empty()) {
+			const int job = q.jobs.front();
+			q.jobs.pop_front();
+			return job;
+		}
+	}
+
+	// Steal from the back of another worker's queue.
+	// Jobs are never added while running, so if all
+	// queues are empty, everything has been started.
+	for (int i = 1; i < threads; i++) {
+		Queue &q = queues[(worker + i) % threads];
+		std::lock_guard<std::mutex> lock(q.mtx);
+		if (!q.jobs.empty()) {
+			const int job = q.jobs.back();
+			q.jobs.pop_back();
+			steals++;
+			return job;
+		}
+	}
+
+	return -1;
+}
+
+/**
+ * Worker thread function.
+ * @param func Job function.
+ * @param worker Worker number.
+ */
+void WorkPoolPrivate::workerMain(const WorkPool::JobFunc &func, int worker)
+{
+	int job;
+	while ((job = nextJob(worker)) >= 0) {
+		func(job, worker);
+	}
+}
+
+/** WorkPool **/
+
+/**
+ * Create a work pool.
+ * @param threads Number of worker threads. (0 for one per CPU)
+ */
+WorkPool::WorkPool(int threads)
+	: d(new WorkPoolPrivate(threads > 0 ? threads
+		: (std::thread::hardware_concurrency() > 0
+			? (int)std::thread::hardware_concurrency() : 1)))
+{ }
+
+WorkPool::~WorkPool()
+{
+	delete d;
+}
+
+/**
+ * Run jobs on the worker threads.
+ * This function returns once all jobs have finished.
+ * @param jobCount Number of jobs.
+ * @param func Job function. Must be thread-safe.
+ */
+void WorkPool::run(int jobCount, const JobFunc &func)
+{
+	// Split the jobs into contiguous blocks so each
+	// worker starts with roughly the same amount of work.
+	d->steals = 0;
+	for (int i = 0; i < d->threads; i++) {
+		d->queues[i].jobs.clear();
+	}
+	for (int job = 0; job < jobCount; job++) {
+		const int worker = (int)(((int64_t)job * d->threads) / jobCount);
+		d->queues[worker].jobs.push_back(job);
+	}
+
+	if (d->threads == 1) {
+		// Run the jobs on this thread.
+		d->workerMain(func, 0);
+		return;
+	}
+
+	vector<std::thread> workers;
+	workers.reserve(d->threads);
+	for (int i = 0; i < d->threads; i++) {
+		workers.push_back(std::thread(&WorkPoolPrivate::workerMain, d, std::cref(func), i));
+	}
+	for (int i = 0; i < d->threads; i++) {
+		workers[i].join();
+	}
+}
+
+/**
+ * Get the number of worker threads.
+ * @return Number of worker threads.
+ */
+int WorkPool::threads(void) const
+{
+	return d->threads;
+}
+
+/**
+ * Get the number of jobs stolen from other workers
+ * during the last run().
+ * @return Number of stolen jobs.
+ */
+int WorkPool::steals(void) const
+{
+	return d->steals;
+}
+
+}
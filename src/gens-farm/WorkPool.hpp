@@ -0,0 +1,91 @@
+/***************************************************************************
+ * gens-farm: Gens/GS II ROM compatibility farm.                           *
+ * WorkPool.hpp: Work-stealing thread pool.                                *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __GENS_FARM_WORKPOOL_HPP__
+#define __GENS_FARM_WORKPOOL_HPP__
+
+// C++ includes.
+#include <functional>
+
+namespace GensFarm {
+
+/**
+ * Work-stealing thread pool.
+ *
+ * Jobs are numbered 0 to jobCount-1 and split evenly between
+ * the workers' queues. Each worker runs jobs from the front of
+ * its own queue; when it runs out, it steals jobs from the back
+ * of the other workers' queues. Jobs that take much longer than
+ * others (e.g. large ROMs) therefore don't leave workers idle.
+ */
+class WorkPoolPrivate;
+class WorkPool
+{
+	public:
+		/**
+		 * Create a work pool.
+		 * @param threads Number of worker threads. (0 for one per CPU)
+		 */
+		explicit WorkPool(int threads = 0);
+		~WorkPool();
+
+	protected:
+		friend class WorkPoolPrivate;
+		WorkPoolPrivate *const d;
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		WorkPool(const WorkPool &);
+		WorkPool &operator=(const WorkPool &);
+
+	public:
+		/**
+		 * Job function.
+		 * @param job Job number.
+		 * @param worker Worker number. (0 to threads()-1)
+		 */
+		typedef std::function<void(int job, int worker)> JobFunc;
+
+		/**
+		 * Run jobs on the worker threads.
+		 * This function returns once all jobs have finished.
+		 * @param jobCount Number of jobs.
+		 * @param func Job function. Must be thread-safe.
+		 */
+		void run(int jobCount, const JobFunc &func);
+
+		/**
+		 * Get the number of worker threads.
+		 * @return Number of worker threads.
+		 */
+		int threads(void) const;
+
+		/**
+		 * Get the number of jobs stolen from other workers
+		 * during the last run().
+		 * @return Number of stolen jobs.
+		 */
+		int steals(void) const;
+};
+
+}
+
+#endif /* __GENS_FARM_WORKPOOL_HPP__ */
@@ -0,0 +1,632 @@
+/***************************************************************************
+ * gens-farm: Gens/GS II ROM compatibility farm.                           *
+ * gens-farm.cpp: Entry point.                                             *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * gens-farm boots every ROM in a directory for a fixed number of
+ * frames, using one emulation context per worker thread. ROMs are
+ * spread over the workers with a work-stealing pool, so there's
+ * no per-ROM process startup, video/audio initialization, or
+ * frame pacing.
+ *
+ * Results are written to stdout, one line per ROM, sorted by filename:
+ *   "status<TAB>frames<TAB>fps<TAB>video_crc32<TAB>audio_crc32<TAB>illegal_frame<TAB>filename"
+ *
+ * status is one of:
+ * - ok: The ROM ran for all frames.
+ * - illegal: The 68K took an illegal instruction exception.
+ *   illegal_frame is the first frame where this happened.
+ * - crash: The 68K jumped into unmapped memory. The ROM is
+ *   stopped after that frame, so frames may be less than requested.
+ * - load-error: The file couldn't be opened.
+ * - unsupported: The ROM format or system isn't supported.
+ * - init-error: The emulation context couldn't be initialized.
+ *
+ * Only the final frame is rendered. Its screenshot is saved to the
+ * screenshot directory, if specified. The audio CRC32 covers all frames.
+ *
+ * NOTE: All ROMs run in one process, so a host crash in the
+ * emulator stops the entire farm.
+ */
+
+// LibGens
+#include "libgens/lg_main.hpp"
+#include "libgens/Rom.hpp"
+#include "libgens/EmuContext/EmuContext.hpp"
+#include "libgens/EmuContext/EmuContextFactory.hpp"
+#include "libgens/EmuContext/SysVersion.hpp"
+#include "libgens/cpu/M68K.hpp"
+#include "libgens/Vdp/Vdp.hpp"
+#include "libgens/sound/SoundMgr.hpp"
+#include "libgens/Util/MdFb.hpp"
+#include "libgens/Util/Screenshot.hpp"
+#include "libgens/Util/Timing.hpp"
+using LibGens::EmuContext;
+using LibGens::EmuContextFactory;
+using LibGens::MdFb;
+using LibGens::Rom;
+using LibGens::Screenshot;
+using LibGens::SoundMgr;
+using LibGens::SysVersion;
+using LibGens::Timing;
+
+// Work-stealing thread pool.
+#include "WorkPool.hpp"
+
+// aligned_malloc()
+#include "libcompat/aligned_malloc.h"
+
+// zlib: crc32()
+#include <zlib.h>
+
+// popt
+#include <popt.h>
+
+#ifdef _WIN32
+// Win32 Unicode Translation Layer.
+// Needed for proper Unicode filename support on Windows.
+#include "libcompat/W32U/W32U_mini.h"
+#include "libcompat/W32U/W32U_argv.h"
+#include <windows.h>
+#else
+#include <dirent.h>
+#include <sys/stat.h>
+#endif
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <clocale>
+
+// C++ includes.
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+using std::string;
+using std::vector;
+
+namespace GensFarm {
+
+struct Options {
+	const char *rom_dir;		// Directory containing the ROMs.
+	const char *tmss_rom_filename;	// TMSS ROM image.
+	const char *screenshot_dir;	// Screenshot directory.
+
+	int frames;			// Number of frames to run.
+	int threads;			// Number of worker threads. (0 for one per CPU)
+
+	// Emulation options.
+	int sprite_limits;		// Enable sprite limits?
+	int auto_fix_checksum;		// Auto fix checksum?
+	SysVersion::RegionCode_t region;	// Region code.
+};
+
+/**
+ * ROM status.
+ */
+enum RomStatus {
+	STATUS_OK = 0,
+	STATUS_ILLEGAL,
+	STATUS_CRASH,
+	STATUS_LOAD_ERROR,
+	STATUS_UNSUPPORTED,
+	STATUS_INIT_ERROR,
+
+	STATUS_MAX
+};
+
+static const char *const status_names[STATUS_MAX] = {
+	"ok", "illegal", "crash", "load-error", "unsupported", "init-error"
+};
+
+/**
+ * Results for a single ROM.
+ */
+struct RomResult {
+	string filename;	// ROM filename.
+	RomStatus status;
+	int frames;		// Number of frames run.
+	int illegal_frame;	// First frame with an illegal instruction. (-1 if none)
+	uint32_t video_crc;	// CRC32 of the final frame.
+	uint32_t audio_crc;	// CRC32 of the audio for all frames.
+	uint64_t time_emu;	// Emulation time, in microseconds.
+};
+
+static void print_prg_info(void)
+{
+	fprintf(stderr, "gens-farm: Gens/GS II ROM compatibility farm.\n");
+}
+
+/**
+ * Parse a region code string.
+ * @param str Region code string.
+ * @param region Region code. (output)
+ * @return 0 on success; non-zero if the region code is invalid.
+ */
+static int parse_region(const char *str, SysVersion::RegionCode_t *region)
+{
+	if (!strcasecmp(str, "u") || !strcasecmp(str, "usa")) {
+		*region = SysVersion::REGION_US_NTSC;
+	} else if (!strcasecmp(str, "j") || !strcasecmp(str, "jp") ||
+		   !strcasecmp(str, "jpn") || !strcasecmp(str, "japan")) {
+		*region = SysVersion::REGION_JP_NTSC;
+	} else if (!strcasecmp(str, "e") || !strcasecmp(str, "eu") ||
+		   !strcasecmp(str, "europe") || !strcasecmp(str, "pal")) {
+		*region = SysVersion::REGION_EU_PAL;
+	} else if (!strcasecmp(str, "asia")) {
+		*region = SysVersion::REGION_ASIA_PAL;
+	} else if (!strcasecmp(str, "auto")) {
+		*region = SysVersion::REGION_AUTO;
+	} else {
+		return -EINVAL;
+	}
+	return 0;
+}
+
+/**
+ * Parse command line arguments using popt.
+ * @param opts Options struct to store arguments in.
+ * @param argc
+ * @param argv
+ * @return 0 if parsed successfully; non-zero on error.
+ */
+static int parse_options(Options *opts, int argc, const char *argv[])
+{
+	memset(opts, 0, sizeof(*opts));
+	opts->frames = 600;
+	opts->sprite_limits = 1;
+	opts->region = SysVersion::REGION_AUTO;
+
+	const char *region = nullptr;
+
+	struct poptOption helpOptionsTable[] = {
+		{"help", '?', POPT_ARG_NONE, NULL, '?', "Show this help message", NULL},
+		{"usage", '\0', POPT_ARG_NONE, NULL, 'u', "Display brief usage message", NULL},
+		POPT_TABLEEND
+	};
+
+	struct poptOption runOptionsTable[] = {
+		{"frames", 'n', POPT_ARG_INT, &opts->frames, 0,
+			"  Number of frames to run each ROM for. (default is 600)", "N"},
+		{"jobs", 'j', POPT_ARG_INT, &opts->threads, 0,
+			"  Number of worker threads. (default is one per CPU)", "N"},
+		{"screenshot-dir", '\0', POPT_ARG_STRING, &opts->screenshot_dir, 0,
+			"  Save a PNG screenshot of each ROM's final frame to DIR.", "DIR"},
+		POPT_TABLEEND
+	};
+
+	struct poptOption emulationOptionsTable[] = {
+		{"sprite-limits", '\0', POPT_ARG_VAL, &opts->sprite_limits, 1,
+			"* Enable sprite limits.", NULL},
+		{"no-sprite-limits", '\0', POPT_ARG_VAL, &opts->sprite_limits, 0,
+			"  Disable sprite limits.", NULL},
+		{"auto-fix-checksum", '\0', POPT_ARG_VAL, &opts->auto_fix_checksum, 1,
+			"  Automatically fix checksums.", NULL},
+		{"no-auto-fix-checksum", '\0', POPT_ARG_VAL, &opts->auto_fix_checksum, 0,
+			"* Don't automatically fix checksums.", NULL},
+		{"region", '\0', POPT_ARG_STRING, &region, 0,
+			"  Set the region code: J,U,E,Asia,Auto (default is auto)", "REGION"},
+		{"tmss-rom", '\0', POPT_ARG_STRING, &opts->tmss_rom_filename, 0,
+			"  TMSS ROM filename.", "FILENAME"},
+		POPT_TABLEEND
+	};
+
+	struct poptOption optionsTable[] = {
+		{NULL, '\0', POPT_ARG_INCLUDE_TABLE, runOptionsTable, 0,
+			"Run options:", NULL},
+		{NULL, '\0', POPT_ARG_INCLUDE_TABLE, emulationOptionsTable, 0,
+			"Emulation options: (* indicates default)", NULL},
+		{NULL, '\0', POPT_ARG_INCLUDE_TABLE, helpOptionsTable, 0,
+			"Help options:", NULL},
+		POPT_TABLEEND
+	};
+
+	poptContext optCon = poptGetContext(NULL, argc, argv, optionsTable, 0);
+	poptSetOtherOptionHelp(optCon, "rom_directory");
+	if (argc < 2) {
+		poptPrintUsage(optCon, stderr, 0);
+		poptFreeContext(optCon);
+		return -EINVAL;
+	}
+
+	int c;
+	while ((c = poptGetNextOpt(optCon)) >= 0) {
+		switch (c) {
+			case '?':
+				print_prg_info();
+				fputc('\n', stderr);
+				poptPrintHelp(optCon, stderr, 0);
+				poptFreeContext(optCon);
+				return -ECANCELED;
+
+			case 'u':
+				poptPrintUsage(optCon, stderr, 0);
+				poptFreeContext(optCon);
+				return -ECANCELED;
+
+			default:
+				break;
+		}
+	}
+
+	if (c < -1) {
+		fprintf(stderr, "%s: '%s': %s\n"
+			"Try `%s --help` for more information.\n",
+			argv[0], poptBadOption(optCon, POPT_BADOPTION_NOALIAS),
+			poptStrerror(c), argv[0]);
+		poptFreeContext(optCon);
+		return -EINVAL;
+	}
+
+	int ret = 0;
+	if (region != nullptr && parse_region(region, &opts->region) != 0) {
+		fprintf(stderr, "%s: '--region=%s': invalid region code\n"
+			"Valid options are J, U, E, Asia, and Auto.\n",
+			argv[0], region);
+		ret = -EINVAL;
+	}
+
+	if (ret == 0 && (opts->frames <= 0 || opts->threads < 0)) {
+		fprintf(stderr, "%s: frame and thread counts must be positive\n", argv[0]);
+		ret = -EINVAL;
+	}
+
+	if (ret == 0) {
+		// NOTE: The directory name is owned by optCon, so strdup() it.
+		const char *rom_dir = poptGetArg(optCon);
+		if (rom_dir) {
+			opts->rom_dir = strdup(rom_dir);
+		} else {
+			fprintf(stderr, "%s: no ROM directory specified\n"
+				"Try `%s --help` for more information.\n",
+				argv[0], argv[0]);
+			ret = -EINVAL;
+		}
+	}
+
+	poptFreeContext(optCon);
+	return ret;
+}
+
+/**
+ * Get the files in a directory.
+ * Subdirectories and hidden files are skipped.
+ * @param dir Directory.
+ * @param files Filenames, including the directory. (output)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+static int list_files(const string &dir, vector<string> &files)
+{
+	files.clear();
+#ifdef _WIN32
+	const string pattern = dir + "\\*";
+	wchar_t *const wpattern = W32U_mbs_to_UTF16(pattern.c_str(), CP_UTF8);
+	if (!wpattern)
+		return -ENOMEM;
+	WIN32_FIND_DATAW fd;
+	HANDLE hFind = FindFirstFileW(wpattern, &fd);
+	free(wpattern);
+	if (hFind == INVALID_HANDLE_VALUE)
+		return -ENOENT;
+	do {
+		if ((fd.dwFileAttributes & (FILE_ATTRIBUTE_DIRECTORY | FILE_ATTRIBUTE_HIDDEN)) ||
+		    fd.cFileName[0] == L'.')
+		{
+			continue;
+		}
+		char *const name = W32U_UTF16_to_mbs(fd.cFileName, CP_UTF8);
+		if (name) {
+			files.push_back(dir + "\\" + name);
+			free(name);
+		}
+	} while (FindNextFileW(hFind, &fd));
+	FindClose(hFind);
+#else /* !_WIN32 */
+	DIR *pDir = opendir(dir.c_str());
+	if (!pDir)
+		return -errno;
+	struct dirent *ent;
+	while ((ent = readdir(pDir)) != nullptr) {
+		if (ent->d_name[0] == '.')
+			continue;
+		const string filename = dir + "/" + ent->d_name;
+		struct stat st;
+		if (stat(filename.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+			continue;
+		files.push_back(filename);
+	}
+	closedir(pDir);
+#endif /* _WIN32 */
+
+	std::sort(files.begin(), files.end());
+	return 0;
+}
+
+/**
+ * Calculate the CRC32 of the visible area of a framebuffer.
+ * @param fb MD framebuffer.
+ * @return CRC32.
+ */
+static uint32_t crc32_fb(const MdFb *fb)
+{
+	const unsigned int lineBytes = fb->pxPerLine() *
+		(fb->bpp() == MdFb::BPP_32 ? sizeof(uint32_t) : sizeof(uint16_t));
+
+	uLong crc = crc32(0, nullptr, 0);
+	for (int line = 0; line < fb->numLines(); line++) {
+		const Bytef *buf = (fb->bpp() == MdFb::BPP_32
+			? reinterpret_cast<const Bytef*>(fb->lineBuf32(line))
+			: reinterpret_cast<const Bytef*>(fb->lineBuf16(line)));
+		crc = crc32(crc, buf, lineBytes);
+	}
+	return (uint32_t)crc;
+}
+
+/**
+ * Run a ROM.
+ * This function is called on the worker threads.
+ * @param opts Options.
+ * @param audioBuf Audio buffer for this worker.
+ * @param result ROM result. (filename must be set)
+ */
+static void run_rom(const Options *opts, int16_t *audioBuf, RomResult *result)
+{
+	result->status = STATUS_OK;
+	result->frames = 0;
+	result->illegal_frame = -1;
+	result->video_crc = 0;
+	result->audio_crc = 0;
+	result->time_emu = 0;
+
+	Rom *rom = new Rom(result->filename.c_str());
+	if (!rom->isOpen()) {
+		result->status = STATUS_LOAD_ERROR;
+		delete rom;
+		return;
+	}
+
+	if (rom->isMultiFile()) {
+		// Select the first file.
+		rom->select_z_entry(rom->get_z_entry_list());
+	}
+
+	if (!EmuContextFactory::isRomFormatSupported(rom) ||
+	    !EmuContextFactory::isRomSystemSupported(rom))
+	{
+		result->status = STATUS_UNSUPPORTED;
+		delete rom;
+		return;
+	}
+
+	// Detect the ROM region.
+	SysVersion::RegionCode_t region = opts->region;
+	if (region == SysVersion::REGION_AUTO) {
+		// Using region code order 0x4812. (US, Europe, Japan, Asia)
+		region = SysVersion::DetectRegion(rom->regionCode(), 0x4812);
+		if (region == SysVersion::REGION_AUTO) {
+			// Detection failed. Default to US/NTSC.
+			region = SysVersion::REGION_US_NTSC;
+		}
+	}
+
+	// Create the emulation context.
+	EmuContext *context = EmuContextFactory::createContext(rom, region);
+	if (!context || !context->isRomOpened()) {
+		result->status = STATUS_INIT_ERROR;
+		delete context;
+		delete rom;
+		return;
+	}
+
+	context->m_vdp->options.spriteLimits = !!opts->sprite_limits;
+	MdFb *fb = context->m_vdp->MD_Screen->ref();
+	fb->setBpp(MdFb::BPP_32);
+	SoundMgr *soundMgr = context->m_soundMgr;
+	soundMgr->setRate(44100, false);
+
+	// Only the final frame is rendered.
+	Timing timing;
+	uLong audio_crc = crc32(0, nullptr, 0);
+	const uint64_t time_start = timing.getTime();
+	int frame;
+	for (frame = 0; frame < opts->frames; frame++) {
+		if (frame == opts->frames - 1) {
+			context->execFrame();
+		} else {
+			context->execFrameFast();
+		}
+
+		// Audio must be read every frame to reset the segment buffers.
+		const int samples = soundMgr->writeStereo(audioBuf, soundMgr->segLength());
+		audio_crc = crc32(audio_crc, reinterpret_cast<const Bytef*>(audioBuf), samples * 4);
+
+		if (result->illegal_frame < 0 && context->m_m68k->illegalCount() > 0) {
+			result->status = STATUS_ILLEGAL;
+			result->illegal_frame = frame;
+		}
+		if (context->m_m68k->isPcUnmapped()) {
+			// Crashed. If this frame wasn't rendered,
+			// render one more for the screenshot.
+			result->status = STATUS_CRASH;
+			if (frame != opts->frames - 1) {
+				context->execFrame();
+				soundMgr->writeStereo(audioBuf, soundMgr->segLength());
+			}
+			frame++;
+			break;
+		}
+	}
+	result->time_emu = (timing.getTime() - time_start);
+	result->frames = frame;
+	result->video_crc = crc32_fb(fb);
+	result->audio_crc = (uint32_t)audio_crc;
+
+	if (opts->screenshot_dir) {
+		const string filename = string(opts->screenshot_dir) + "/" +
+					rom->filename_base() + ".png";
+		int ret = Screenshot::toFile(filename.c_str(), fb, rom);
+		if (ret != 0) {
+			fprintf(stderr, "Error saving screenshot %s: %s\n",
+				filename.c_str(), strerror(-ret));
+		}
+	}
+
+	fb->unref();
+	delete context;
+	delete rom;
+}
+
+/**
+ * Run the farm.
+ * @param opts Options.
+ * @return Exit code.
+ */
+static int run(const Options *opts)
+{
+	vector<string> files;
+	int ret = list_files(opts->rom_dir, files);
+	if (ret != 0) {
+		fprintf(stderr, "Error reading ROM directory %s: %s\n",
+			opts->rom_dir, strerror(-ret));
+		return EXIT_FAILURE;
+	}
+	if (files.empty()) {
+		fprintf(stderr, "No files found in ROM directory %s.\n", opts->rom_dir);
+		return EXIT_FAILURE;
+	}
+
+	// Set some static EmuContext properties.
+	// These must be set before the workers are started.
+	EmuContext::SetAutoFixChecksum(!!opts->auto_fix_checksum);
+	if (opts->tmss_rom_filename) {
+		EmuContext::SetTmssRomFilename(opts->tmss_rom_filename);
+		EmuContext::SetTmssEnabled(true);
+	}
+
+	vector<RomResult> results(files.size());
+	for (size_t i = 0; i < files.size(); i++) {
+		results[i].filename = files[i];
+	}
+
+	// Audio buffer for each worker.
+	// NOTE: SoundMgr::writeStereo() requires a 16-byte
+	// aligned destination buffer for SSE2.
+	WorkPool pool(opts->threads);
+	vector<int16_t*> audioBufs(pool.threads());
+	for (int i = 0; i < pool.threads(); i++) {
+		audioBufs[i] = (int16_t*)aligned_malloc(16, SoundMgr::MAX_SEGMENT_SIZE * 4);
+	}
+
+	// Progress is printed as each ROM finishes.
+	std::mutex progressMutex;
+	int done = 0;
+
+	Timing timing;
+	const uint64_t time_start = timing.getTime();
+	pool.run((int)results.size(), [&](int job, int worker) {
+		RomResult *const result = &results[job];
+		run_rom(opts, audioBufs[worker], result);
+
+		std::lock_guard<std::mutex> lock(progressMutex);
+		done++;
+		fprintf(stderr, "[%d/%d] %s: %s\n", done, (int)results.size(),
+			result->filename.c_str(), status_names[result->status]);
+	});
+	const uint64_t time_total = (timing.getTime() - time_start);
+
+	for (int i = 0; i < pool.threads(); i++) {
+		aligned_free(audioBufs[i]);
+	}
+
+	// Results.
+	int counts[STATUS_MAX] = {0};
+	uint64_t frames_total = 0;
+	for (size_t i = 0; i < results.size(); i++) {
+		const RomResult *const result = &results[i];
+		counts[result->status]++;
+		frames_total += result->frames;
+
+		if (result->status <= STATUS_CRASH) {
+			const double fps = (result->time_emu > 0
+				? (double)result->frames * 1000000.0 / (double)result->time_emu : 0);
+			printf("%s\t%d\t%.1f\t%08X\t%08X\t%d\t%s\n",
+				status_names[result->status], result->frames, fps,
+				result->video_crc, result->audio_crc,
+				result->illegal_frame, result->filename.c_str());
+		} else {
+			printf("%s\t0\t0.0\t--------\t--------\t-1\t%s\n",
+				status_names[result->status], result->filename.c_str());
+		}
+	}
+
+	// Summary.
+	const double secs = (double)time_total / 1000000.0;
+	fprintf(stderr, "\n");
+	fprintf(stderr, "roms=%d\n", (int)results.size());
+	for (int i = 0; i < STATUS_MAX; i++) {
+		fprintf(stderr, "%s=%d\n", status_names[i], counts[i]);
+	}
+	fprintf(stderr, "threads=%d\n", pool.threads());
+	fprintf(stderr, "steals=%d\n", pool.steals());
+	fprintf(stderr, "time_total_us=%llu\n", (unsigned long long)time_total);
+	fprintf(stderr, "roms_per_sec=%.2f\n", (secs > 0 ? (double)results.size() / secs : 0));
+	fprintf(stderr, "fps=%.2f\n", (secs > 0 ? (double)frames_total / secs : 0));
+	return EXIT_SUCCESS;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+#ifdef _WIN32
+	// Convert command line parameters to UTF-8.
+	if (W32U_GetArgvU(&argc, &argv, nullptr) != 0) {
+		// ERROR!
+		return EXIT_FAILURE;
+	}
+#endif /* _WIN32 */
+
+	// Initialize locale settings.
+	// NOTE: LC_NUMERIC is left as "C" so the
+	// results are machine-readable.
+	setlocale(LC_ALL, "");
+	setlocale(LC_NUMERIC, "C");
+
+	// Parse command line options.
+	GensFarm::Options opts;
+	int ret = GensFarm::parse_options(&opts, argc, (const char**)argv);
+	if (ret != 0) {
+		// parse_options() already printed an error message.
+		return (ret == -ECANCELED ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
+	// Initialize LibGens.
+	// NOTE: This must be done before starting the workers,
+	// since it initializes static tables.
+	LibGens::Init();
+	ret = GensFarm::run(&opts);
+	LibGens::End();
+
+	free((void*)opts.rom_dir);
+	return ret;
+}
@@ -0,0 +1,609 @@
+/***************************************************************************
+ * gens-headless: Gens/GS II headless batch runner.                        *
+ * gens-headless.cpp: Entry point.                                         *
+ *                                                                         *
+ * Copyright (c) 2015 by David Korth.                                      *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * gens-headless runs a ROM for a fixed number of frames without
+ * any video or audio output device. Frames are run as fast as the
+ * host allows, and the results are written as machine-readable text:
+ *
+ * - Hash log: one line per frame:
+ *   "frame<TAB>video_crc32<TAB>audio_crc32"
+ *   video_crc32 is "--------" for frames that weren't rendered.
+ * - Statistics: "key=value" lines on stdout.
+ * - Screenshot: PNG of the final frame.
+ *
+ * Input movies can be recorded and played back. Playback verifies
+ * the movie's state hashes, so a movie recorded with a known-good
+ * build can be used as a regression test.
+ */
+
+// LibGens
+#include "libgens/lg_main.hpp"
+#include "libgens/Rom.hpp"
+#include "libgens/EmuContext/EmuContext.hpp"
+#include "libgens/EmuContext/EmuContextFactory.hpp"
+#include "libgens/EmuContext/SysVersion.hpp"
+#include "libgens/Vdp/Vdp.hpp"
+#include "libgens/sound/SoundMgr.hpp"
+#include "libgens/Util/MdFb.hpp"
+#include "libgens/Util/Movie.hpp"
+#include "libgens/Util/RunAhead.hpp"
+#include "libgens/Util/Screenshot.hpp"
+#include "libgens/Util/Timing.hpp"
+using LibGens::EmuContext;
+using LibGens::EmuContextFactory;
+using LibGens::MdFb;
+using LibGens::Movie;
+using LibGens::Rom;
+using LibGens::RunAhead;
+using LibGens::Screenshot;
+using LibGens::SoundMgr;
+using LibGens::SysVersion;
+using LibGens::Timing;
+
+// aligned_malloc()
+#include "libcompat/aligned_malloc.h"
+
+// zlib: crc32()
+#include <zlib.h>
+
+// popt
+#include <popt.h>
+
+#ifdef _WIN32
+// Win32 Unicode Translation Layer.
+// Needed for proper Unicode filename support on Windows.
+#include "libcompat/W32U/W32U_mini.h"
+#include "libcompat/W32U/W32U_argv.h"
+#endif
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <clocale>
+#ifndef ECANCELED
+#define ECANCELED 158
+#endif
+
+namespace GensHeadless {
+
+/** Command line parameters. **/
+struct Options {
+	const char *rom_filename;	// ROM to load.
+	const char *tmss_rom_filename;	// TMSS ROM image.
+	const char *hash_log;		// Hash log filename. ("-" for stdout)
+	const char *screenshot;		// Final screenshot filename.
+	const char *record_movie;	// Movie to record.
+	const char *play_movie;		// Movie to play back.
+
+	int frames;			// Number of frames to run. (0 for default)
+	int frameskip;			// Frames to skip between rendered frames.
+	int run_ahead;			// Frames to run ahead for rendered frames.
+	int hash_interval;		// Movie hash interval.
+
+	// Audio options.
+	int sound_freq;			// Sound frequency.
+	int stereo;			// Stereo audio?
+
+	// Emulation options.
+	int sprite_limits;		// Enable sprite limits?
+	int auto_fix_checksum;		// Auto fix checksum?
+	int idle_skip;			// Skip 68000 idle loops?
+	SysVersion::RegionCode_t region;	// Region code.
+	MdFb::ColorDepth bpp;		// Color depth. (15, 16, 32)
+};
+
+static void print_prg_info(void)
+{
+	fprintf(stderr, "gens-headless: Gens/GS II headless batch runner.\n");
+}
+
+/**
+ * Parse a region code string.
+ * @param str Region code string.
+ * @param region Region code. (output)
+ * @return 0 on success; non-zero if the region code is invalid.
+ */
+static int parse_region(const char *str, SysVersion::RegionCode_t *region)
+{
+	if (!strcasecmp(str, "u") || !strcasecmp(str, "usa")) {
+		*region = SysVersion::REGION_US_NTSC;
+	} else if (!strcasecmp(str, "j") || !strcasecmp(str, "jp") ||
+		   !strcasecmp(str, "jpn") || !strcasecmp(str, "japan")) {
+		*region = SysVersion::REGION_JP_NTSC;
+	} else if (!strcasecmp(str, "e") || !strcasecmp(str, "eu") ||
+		   !strcasecmp(str, "europe") || !strcasecmp(str, "pal")) {
+		*region = SysVersion::REGION_EU_PAL;
+	} else if (!strcasecmp(str, "asia")) {
+		*region = SysVersion::REGION_ASIA_PAL;
+	} else if (!strcasecmp(str, "auto")) {
+		*region = SysVersion::REGION_AUTO;
+	} else {
+		return -EINVAL;
+	}
+	return 0;
+}
+
+/**
+ * Parse command line arguments using popt.
+ * @param opts Options struct to store arguments in.
+ * @param argc
+ * @param argv
+ * @return 0 if parsed successfully; non-zero on error.
+ */
+static int parse_options(Options *opts, int argc, const char *argv[])
+{
+	memset(opts, 0, sizeof(*opts));
+	opts->hash_interval = 60;
+	opts->sound_freq = 44100;
+	opts->stereo = 1;
+	opts->sprite_limits = 1;
+	opts->idle_skip = 1;
+	opts->region = SysVersion::REGION_AUTO;
+
+	const char *region = nullptr;
+	int bpp = 32;
+
+	struct poptOption helpOptionsTable[] = {
+		{"help", '?', POPT_ARG_NONE, NULL, '?', "Show this help message", NULL},
+		{"usage", '\0', POPT_ARG_NONE, NULL, 'u', "Display brief usage message", NULL},
+		POPT_TABLEEND
+	};
+
+	struct poptOption runOptionsTable[] = {
+		{"frames", 'n', POPT_ARG_INT, &opts->frames, 0,
+			"  Number of frames to run. (default is 600, or the movie length)", "N"},
+		{"frameskip", '\0', POPT_ARG_INT, &opts->frameskip, 0,
+			"  Frames to run without rendering between rendered frames.", "N"},
+		{"run-ahead", '\0', POPT_ARG_INT, &opts->run_ahead, 0,
+			"  Run N frames ahead for each rendered frame.", "N"},
+		{"hash-log", '\0', POPT_ARG_STRING, &opts->hash_log, 0,
+			"  Write per-frame video/audio CRC32s to FILE. (- for stdout)", "FILE"},
+		{"screenshot", '\0', POPT_ARG_STRING, &opts->screenshot, 0,
+			"  Save a PNG screenshot of the final frame to FILE.", "FILE"},
+		{"record-movie", '\0', POPT_ARG_STRING, &opts->record_movie, 0,
+			"  Record an input movie to FILE.", "FILE"},
+		{"play-movie", '\0', POPT_ARG_STRING, &opts->play_movie, 0,
+			"  Play back and verify an input movie from FILE.", "FILE"},
+		{"hash-interval", '\0', POPT_ARG_INT, &opts->hash_interval, 0,
+			"  Hash the state every N frames when recording a movie. (default is 60)", "N"},
+		POPT_TABLEEND
+	};
+
+	struct poptOption audioOptionsTable[] = {
+		{"frequency", '\0', POPT_ARG_INT, &opts->sound_freq, 0,
+			"  Audio frequency.", "FREQ"},
+		{"mono", '\0', POPT_ARG_VAL, &opts->stereo, 0,
+			"  Use monaural audio.", NULL},
+		{"stereo", '\0', POPT_ARG_VAL, &opts->stereo, 1,
+			"* Use stereo audio.", NULL},
+		POPT_TABLEEND
+	};
+
+	struct poptOption emulationOptionsTable[] = {
+		{"sprite-limits", '\0', POPT_ARG_VAL, &opts->sprite_limits, 1,
+			"* Enable sprite limits.", NULL},
+		{"no-sprite-limits", '\0', POPT_ARG_VAL, &opts->sprite_limits, 0,
+			"  Disable sprite limits.", NULL},
+		{"auto-fix-checksum", '\0', POPT_ARG_VAL, &opts->auto_fix_checksum, 1,
+			"  Automatically fix checksums.", NULL},
+		{"no-auto-fix-checksum", '\0', POPT_ARG_VAL, &opts->auto_fix_checksum, 0,
+			"* Don't automatically fix checksums.", NULL},
+		{"idle-skip", '\0', POPT_ARG_VAL, &opts->idle_skip, 1,
+			"* Skip 68000 idle loops.", NULL},
+		{"no-idle-skip", '\0', POPT_ARG_VAL, &opts->idle_skip, 0,
+			"  Always emulate 68000 idle loops.", NULL},
+		{"region", '\0', POPT_ARG_STRING, &region, 0,
+			"  Set the region code: J,U,E,Asia,Auto (default is auto)", "REGION"},
+		{"bpp", '\0', POPT_ARG_INT, &bpp, 0,
+			"  Set the internal color depth. (15, 16, 32)", "BPP"},
+		{"tmss-rom", '\0', POPT_ARG_STRING, &opts->tmss_rom_filename, 0,
+			"  TMSS ROM filename.", "FILENAME"},
+		POPT_TABLEEND
+	};
+
+	struct poptOption optionsTable[] = {
+		{NULL, '\0', POPT_ARG_INCLUDE_TABLE, runOptionsTable, 0,
+			"Run options:", NULL},
+		{NULL, '\0', POPT_ARG_INCLUDE_TABLE, audioOptionsTable, 0,
+			"Audio options: (* indicates default)", NULL},
+		{NULL, '\0', POPT_ARG_INCLUDE_TABLE, emulationOptionsTable, 0,
+			"Emulation options: (* indicates default)", NULL},
+		{NULL, '\0', POPT_ARG_INCLUDE_TABLE, helpOptionsTable, 0,
+			"Help options:", NULL},
+		POPT_TABLEEND
+	};
+
+	poptContext optCon = poptGetContext(NULL, argc, argv, optionsTable, 0);
+	poptSetOtherOptionHelp(optCon, "rom_file");
+	if (argc < 2) {
+		poptPrintUsage(optCon, stderr, 0);
+		poptFreeContext(optCon);
+		return -EINVAL;
+	}
+
+	int c;
+	while ((c = poptGetNextOpt(optCon)) >= 0) {
+		switch (c) {
+			case '?':
+				print_prg_info();
+				fputc('\n', stderr);
+				poptPrintHelp(optCon, stderr, 0);
+				poptFreeContext(optCon);
+				return -ECANCELED;
+
+			case 'u':
+				poptPrintUsage(optCon, stderr, 0);
+				poptFreeContext(optCon);
+				return -ECANCELED;
+
+			default:
+				break;
+		}
+	}
+
+	if (c < -1) {
+		fprintf(stderr, "%s: '%s': %s\n"
+			"Try `%s --help` for more information.\n",
+			argv[0], poptBadOption(optCon, POPT_BADOPTION_NOALIAS),
+			poptStrerror(c), argv[0]);
+		poptFreeContext(optCon);
+		return -EINVAL;
+	}
+
+	int ret = 0;
+	if (region != nullptr && parse_region(region, &opts->region) != 0) {
+		fprintf(stderr, "%s: '--region=%s': invalid region code\n"
+			"Valid options are J, U, E, Asia, and Auto.\n",
+			argv[0], region);
+		ret = -EINVAL;
+	}
+
+	opts->bpp = MdFb::bppToColorDepth(bpp);
+	if (ret == 0 && (opts->bpp < 0 || opts->bpp >= MdFb::BPP_MAX)) {
+		fprintf(stderr, "%s: '--bpp=%d': invalid color depth\n"
+			"Valid options are 15, 16, and 32.\n",
+			argv[0], bpp);
+		ret = -EINVAL;
+	}
+
+	if (ret == 0 && (opts->frames < 0 || opts->frameskip < 0 ||
+	    opts->run_ahead < 0 || opts->hash_interval <= 0))
+	{
+		fprintf(stderr, "%s: frame counts must be positive\n", argv[0]);
+		ret = -EINVAL;
+	}
+
+	if (ret == 0 && opts->record_movie && opts->play_movie) {
+		fprintf(stderr, "%s: '--record-movie' and '--play-movie' can't be used together\n", argv[0]);
+		ret = -EINVAL;
+	}
+
+	if (ret == 0) {
+		// NOTE: The filename is owned by optCon, so strdup() it.
+		const char *rom_filename = poptGetArg(optCon);
+		if (rom_filename) {
+			opts->rom_filename = strdup(rom_filename);
+		} else {
+			fprintf(stderr, "%s: no ROM filename specified\n"
+				"Try `%s --help` for more information.\n",
+				argv[0], argv[0]);
+			ret = -EINVAL;
+		}
+	}
+
+	poptFreeContext(optCon);
+	return ret;
+}
+
+/**
+ * Calculate the CRC32 of the visible area of a framebuffer.
+ * @param fb MD framebuffer.
+ * @return CRC32.
+ */
+static uint32_t crc32_fb(const MdFb *fb)
+{
+	const unsigned int lineBytes = fb->pxPerLine() *
+		(fb->bpp() == MdFb::BPP_32 ? sizeof(uint32_t) : sizeof(uint16_t));
+
+	uLong crc = crc32(0, nullptr, 0);
+	for (int line = 0; line < fb->numLines(); line++) {
+		const Bytef *buf = (fb->bpp() == MdFb::BPP_32
+			? reinterpret_cast<const Bytef*>(fb->lineBuf32(line))
+			: reinterpret_cast<const Bytef*>(fb->lineBuf16(line)));
+		crc = crc32(crc, buf, lineBytes);
+	}
+	return (uint32_t)crc;
+}
+
+/**
+ * Run the emulator.
+ * @param opts Options.
+ * @return Exit code.
+ */
+static int run(const Options *opts)
+{
+	Rom *rom = new Rom(opts->rom_filename);
+	if (!rom->isOpen()) {
+		fprintf(stderr, "Error opening ROM file %s: %s\n",
+			opts->rom_filename, strerror(-rom->lastError()));
+		delete rom;
+		return EXIT_FAILURE;
+	}
+
+	if (rom->isMultiFile()) {
+		// Select the first file.
+		rom->select_z_entry(rom->get_z_entry_list());
+	}
+
+	if (!EmuContextFactory::isRomFormatSupported(rom) ||
+	    !EmuContextFactory::isRomSystemSupported(rom))
+	{
+		fprintf(stderr, "Error loading ROM file %s: ROM format or system is not supported.\n",
+			opts->rom_filename);
+		delete rom;
+		return EXIT_FAILURE;
+	}
+
+	// Set some static EmuContext properties.
+	EmuContext::SetAutoFixChecksum(!!opts->auto_fix_checksum);
+	EmuContext::SetIdleSkip(!!opts->idle_skip);
+	if (opts->tmss_rom_filename) {
+		EmuContext::SetTmssRomFilename(opts->tmss_rom_filename);
+		EmuContext::SetTmssEnabled(true);
+	}
+
+	// Detect the ROM region.
+	SysVersion::RegionCode_t region = opts->region;
+	if (region == SysVersion::REGION_AUTO) {
+		// Using region code order 0x4812. (US, Europe, Japan, Asia)
+		region = SysVersion::DetectRegion(rom->regionCode(), 0x4812);
+		if (region == SysVersion::REGION_AUTO) {
+			// Detection failed. Default to US/NTSC.
+			region = SysVersion::REGION_US_NTSC;
+		}
+	}
+
+	// Create the emulation context.
+	EmuContext *context = EmuContextFactory::createContext(rom, region);
+	if (!context) {
+		// The factory only fails if the system isn't supported.
+		fprintf(stderr, "Error initializing EmuContext for %s: System %d is not supported.\n",
+			opts->rom_filename, (int)rom->sysId());
+		delete rom;
+		return EXIT_FAILURE;
+	} else if (!context->isRomOpened()) {
+		// The ROM image couldn't be loaded into the cartridge.
+		fprintf(stderr, "Error initializing EmuContext for %s: ROM image could not be loaded. (%d bytes)\n",
+			opts->rom_filename, rom->romSize());
+		delete context;
+		delete rom;
+		return EXIT_FAILURE;
+	}
+
+	context->m_vdp->options.spriteLimits = !!opts->sprite_limits;
+	MdFb *fb = context->m_vdp->MD_Screen->ref();
+	fb->setBpp(opts->bpp);
+
+	// Audio segment buffer.
+	// NOTE: SoundMgr::writeStereo() requires a 16-byte
+	// aligned destination buffer for SSE2.
+	SoundMgr *soundMgr = context->m_soundMgr;
+	soundMgr->setRate(opts->sound_freq, false);
+	const int sampleSize = (opts->stereo ? 4 : 2);
+	int16_t *audioBuf = (int16_t*)aligned_malloc(16, SoundMgr::MAX_SEGMENT_SIZE * 4);
+
+	FILE *f_hash = nullptr;
+	if (opts->hash_log) {
+		if (!strcmp(opts->hash_log, "-")) {
+			f_hash = stdout;
+		} else {
+			f_hash = fopen(opts->hash_log, "w");
+			if (!f_hash) {
+				fprintf(stderr, "Error opening hash log %s: %s\n",
+					opts->hash_log, strerror(errno));
+			}
+		}
+	}
+
+	// Input movie.
+	Movie movie;
+	int frames = opts->frames;
+	if (opts->play_movie) {
+		int mret = movie.load(opts->play_movie);
+		if (mret == 0) {
+			mret = movie.startPlayback(context);
+		}
+		if (mret != 0) {
+			fprintf(stderr, "Error playing movie %s: %s\n",
+				opts->play_movie, strerror(-mret));
+			if (f_hash && f_hash != stdout) {
+				fclose(f_hash);
+			}
+			aligned_free(audioBuf);
+			fb->unref();
+			delete context;
+			delete rom;
+			return EXIT_FAILURE;
+		}
+		if (frames == 0 || frames > movie.frameCount()) {
+			frames = movie.frameCount();
+		}
+	} else if (opts->record_movie) {
+		movie.startRecording(context, opts->hash_interval);
+	}
+	if (frames == 0) {
+		frames = 600;
+	}
+
+	// Run-ahead frame runner.
+	// Only rendered frames are run ahead.
+	RunAhead runAhead(opts->run_ahead);
+
+	// Run the frames.
+	Timing timing;
+	uint64_t time_emu = 0;	// Time spent in execFrame(), in microseconds.
+	int rendered = 0;
+	const uint64_t time_start = timing.getTime();
+	for (int frame = 0; frame < frames; frame++) {
+		// Always render the final frame so the screenshot is valid.
+		const bool render = ((frame % (opts->frameskip + 1)) == opts->frameskip ||
+				     frame == (frames - 1));
+
+		if (opts->play_movie) {
+			movie.playFrame(context);
+		}
+
+		const uint64_t time_frame = timing.getTime();
+		if (render) {
+			runAhead.execFrame(context);
+			rendered++;
+		} else {
+			context->execFrameFast();
+		}
+		time_emu += (timing.getTime() - time_frame);
+
+		if (opts->play_movie) {
+			movie.verifyFrame(context);
+		} else if (opts->record_movie) {
+			movie.recordFrame(context);
+		}
+
+		// Audio must be read every frame to reset the segment buffers.
+		int samples;
+		if (opts->stereo) {
+			samples = soundMgr->writeStereo(audioBuf, soundMgr->segLength());
+		} else {
+			samples = soundMgr->writeMono(audioBuf, soundMgr->segLength());
+		}
+
+		if (f_hash) {
+			const uint32_t audio_crc = (uint32_t)crc32(0,
+				reinterpret_cast<const Bytef*>(audioBuf), samples * sampleSize);
+			if (render) {
+				fprintf(f_hash, "%d\t%08X\t%08X\n", frame, crc32_fb(fb), audio_crc);
+			} else {
+				fprintf(f_hash, "%d\t--------\t%08X\n", frame, audio_crc);
+			}
+		}
+	}
+	const uint64_t time_total = (timing.getTime() - time_start);
+
+	if (f_hash && f_hash != stdout) {
+		fclose(f_hash);
+	}
+
+	int ret = EXIT_SUCCESS;
+	if (opts->record_movie) {
+		int mret = movie.save(opts->record_movie);
+		if (mret != 0) {
+			fprintf(stderr, "Error saving movie %s: %s\n",
+				opts->record_movie, strerror(-mret));
+			ret = EXIT_FAILURE;
+		}
+	}
+
+	if (opts->screenshot) {
+		int sret = Screenshot::toFile(opts->screenshot, fb, rom);
+		if (sret != 0) {
+			fprintf(stderr, "Error saving screenshot %s: %s\n",
+				opts->screenshot, strerror(-sret));
+			ret = EXIT_FAILURE;
+		}
+	}
+
+	// Timing statistics.
+	const bool isPal = context->versionRegisterObject()->isPal();
+	const double secs = (double)time_total / 1000000.0;
+	const double fps = (secs > 0 ? (double)frames / secs : 0);
+	printf("rom=%s\n", opts->rom_filename);
+	printf("region=%s\n", (isPal ? "PAL" : "NTSC"));
+	printf("frames=%d\n", frames);
+	printf("rendered=%d\n", rendered);
+	printf("time_total_us=%llu\n", (unsigned long long)time_total);
+	printf("time_emu_us=%llu\n", (unsigned long long)time_emu);
+	printf("fps=%.2f\n", fps);
+	printf("speed=%.2f\n", fps / (isPal ? 50.0 : 60.0));
+	printf("final_video_crc32=%08X\n", crc32_fb(fb));
+	printf("run_ahead=%d\n", runAhead.frames());
+	if (runAhead.frames() > 0) {
+		// Run-ahead cost, per rendered frame.
+		// cost is the ratio of total emulation time to real frame time.
+		const unsigned int n = (runAhead.totalFrames() > 0 ? runAhead.totalFrames() : 1);
+		const double frame_us = (double)runAhead.totalFrameTime() / n / 1000.0;
+		const double ahead_us = (double)runAhead.totalRunAheadTime() / n / 1000.0;
+		printf("run_ahead_frame_us=%.1f\n", frame_us);
+		printf("run_ahead_us=%.1f\n", ahead_us);
+		printf("run_ahead_cost=%.2f\n", (frame_us > 0 ? (frame_us + ahead_us) / frame_us : 0));
+	}
+
+	if (opts->record_movie || opts->play_movie) {
+		printf("movie_frames=%d\n", movie.frameCount());
+		printf("movie_desync_frame=%d\n", movie.desyncFrame());
+		if (movie.desyncFrame() >= 0) {
+			fprintf(stderr, "Movie desync at frame %d.\n", movie.desyncFrame());
+			ret = EXIT_FAILURE;
+		}
+	}
+
+	aligned_free(audioBuf);
+	fb->unref();
+	delete context;
+	delete rom;
+	return ret;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+#ifdef _WIN32
+	// Convert command line parameters to UTF-8.
+	if (W32U_GetArgvU(&argc, &argv, nullptr) != 0) {
+		// ERROR!
+		return EXIT_FAILURE;
+	}
+#endif /* _WIN32 */
+
+	// Initialize locale settings.
+	// NOTE: LC_NUMERIC is left as "C" so the
+	// statistics output is machine-readable.
+	setlocale(LC_ALL, "");
+	setlocale(LC_NUMERIC, "C");
+
+	// Parse command line options.
+	GensHeadless::Options opts;
+	int ret = GensHeadless::parse_options(&opts, argc, (const char**)argv);
+	if (ret != 0) {
+		// parse_options() already printed an error message.
+		return (ret == -ECANCELED ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
+	// Initialize LibGens.
+	LibGens::Init();
+	ret = GensHeadless::run(&opts);
+	LibGens::End();
+
+	free((void*)opts.rom_filename);
+	return ret;
+}
@@ -43,6 +43,9 @@ ABackend::ABackend()
 	// TODO: Allow user customization.
 	m_rate = 44100;
 	m_stereo = true;
+
+	// No Sound Manager until a ROM is loaded.
+	m_soundMgr = nullptr;
 }
 
 ABackend::~ABackend()
@@ -50,4 +53,19 @@ ABackend::~ABackend()
 	// NOTE: close() can't be called from here.
 }
 
+/**
+ * Set the Sound Manager to read audio from.
+ * The current sampling rate is applied to the Sound Manager.
+ * @param soundMgr Sound Manager. (May be nullptr.)
+ */
+void ABackend::setSoundMgr(LibGens::SoundMgr *soundMgr)
+{
+	m_soundMgr = soundMgr;
+	if (m_soundMgr) {
+		// PSG/YM state doesn't need to be saved,
+		// since the emulation context was just created.
+		m_soundMgr->setRate(m_rate, false);
+	}
+}
+
 }
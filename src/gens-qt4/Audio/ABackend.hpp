@@ -33,6 +33,10 @@
 // Qt includes.
 #include <QtCore/QMutex>
 
+namespace LibGens {
+	class SoundMgr;
+}
+
 namespace GensQt4 {
 
 class ABackend
@@ -55,6 +59,13 @@ class ABackend
 		inline bool isStereo(void) const { return m_stereo; }
 		virtual void setStereo(bool newStereo) = 0;
 
+		/**
+		 * Set the Sound Manager to read audio from.
+		 * The current sampling rate is applied to the Sound Manager.
+		 * @param soundMgr Sound Manager. (May be nullptr.)
+		 */
+		void setSoundMgr(LibGens::SoundMgr *soundMgr);
+
 		/**
 		 * Write the current segment to the audio buffer.
 		 * @return 0 on success; non-zero on error.
@@ -73,6 +84,9 @@ class ABackend
 		// Audio settings.
 		int m_rate;
 		bool m_stereo;
+
+		// Sound Manager. (Owned by the emulation context.)
+		LibGens::SoundMgr *m_soundMgr;
 };
 
 }
@@ -204,13 +204,15 @@ void GensPortAudio::setRate(int newRate)
 		// TODO: Insert a pause between close() and open() to prevent stuttering?
 		close();
 		m_rate = newRate;
-		SoundMgr::SetRate(newRate, true);
+		if (m_soundMgr)
+			m_soundMgr->setRate(newRate, true);
 		open();
 	} else {
 		// Audio isn't open. Save the new audio rate.
 		// PSG/YM state doesn't need to be saved.
 		m_rate = newRate;
-		SoundMgr::SetRate(newRate, false);
+		if (m_soundMgr)
+			m_soundMgr->setRate(newRate, false);
 	}
 }
 
@@ -287,12 +289,12 @@ int GensPortAudio::write(void)
 {
 	QMutexLocker locker(&m_mtxBuffer);
 
-	if (!m_open)
+	if (!m_open || !m_soundMgr)
 		return 1;
 
 	// TODO: Lock the buffer for writing.
 	// TODO: Use the segment size.
-	const int segLength = SoundMgr::GetSegLength();
+	const int segLength = m_soundMgr->segLength();
 	const int cbSegSize = segLength * m_sampleSize;
 	if ((m_bufferPos + cbSegSize) > sizeof(m_buffer)) {
 		fprintf(stderr, "GensPortAudio::%s(): Internal buffer overflow.\n", __func__);
@@ -301,9 +303,9 @@ int GensPortAudio::write(void)
 
 	int written;	// Number of samples written.
 	if (m_stereo) {
-		written = SoundMgr::writeStereo(m_tmpWriteBuf, segLength);
+		written = m_soundMgr->writeStereo(m_tmpWriteBuf, segLength);
 	} else {
-		written = SoundMgr::writeMono(m_tmpWriteBuf, segLength);
+		written = m_soundMgr->writeMono(m_tmpWriteBuf, segLength);
 	}
 	
 	written *= m_sampleSize;
@@ -47,6 +47,7 @@ const ConfigDefaults::DefaultSetting ConfigDefaults::DefaultSettings[] =
 	/** General settings. **/
 	{"autoFixChecksum",		"false", 0, 0,		DefaultSetting::VT_BOOL, 0, 0},
 	{"autoPause",			"false", 0, 0,		DefaultSetting::VT_BOOL, 0, 0},
+	{"idleSkip",			"true", 0, 0,		DefaultSetting::VT_BOOL, 0, 0},
 	{"pauseTint",			"true", 0, 0,		DefaultSetting::VT_BOOL, 0, 0},
 
 	/** Onscreen display. **/
@@ -97,6 +98,11 @@ const ConfigDefaults::DefaultSetting ConfigDefaults::DefaultSettings[] =
 	/** Savestates. **/
 	{"Savestates/saveSlot", "0", 0, DefaultSetting::DEF_ALLOW_SAME_VALUE, DefaultSetting::VT_RANGE, 0, 9},
 
+	/** Rewind. **/
+	// bufferSize is in MB. (0 disables rewind)
+	{"Rewind/bufferSize",	"32", 0, 0,		DefaultSetting::VT_RANGE, 0, 1024},
+	{"Rewind/interval",	"1", 0, 0,		DefaultSetting::VT_RANGE, 1, 60},
+
 	/** GensWindow configuration. **/
 	{"GensWindow/showMenuBar", "true", 0, 0, DefaultSetting::VT_BOOL, 0, 0},
 
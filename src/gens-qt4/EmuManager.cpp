@@ -28,6 +28,8 @@
 
 // LibGens includes.
 #include "libgens/Util/Timing.hpp"
+#include "libgens/Util/RewindBuffer.hpp"
+#include "libgens/Util/MdFbRing.hpp"
 #include "libgens/Rom.hpp"
 using LibGens::Rom;
 
@@ -58,6 +60,10 @@ using LibGens::SysVersion;
 // libzomg. Needed for savestate preview images.
 #include "libzomg/Zomg.hpp"
 
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstring>
+
 // Qt includes.
 #include <QtCore/QTimer>
 #include <QtGui/QApplication>
@@ -80,6 +86,9 @@ namespace GensQt4 {
 
 EmuManager::EmuManager(QObject *parent, VBackend *vBackend)
 	: super(parent)
+	, m_rewindBuffer(nullptr)
+	, m_rewinding(false)
+	, m_fbRing(nullptr)
 	, m_keyManager(nullptr)
 	, m_vBackend(vBackend)
 	, m_romClosedFb(nullptr)
@@ -115,6 +124,8 @@ EmuManager::EmuManager(QObject *parent, VBackend *vBackend)
 					this, SLOT(saveSlot_changed_slot(QVariant)));
 	gqt4_cfg->registerChangeNotification(QLatin1String("autoFixChecksum"),
 					this, SLOT(autoFixChecksum_changed_slot(QVariant)));
+	gqt4_cfg->registerChangeNotification(QLatin1String("idleSkip"),
+					this, SLOT(idleSkip_changed_slot(QVariant)));
 
 	// Graphics settings.
 	gqt4_cfg->registerChangeNotification(QLatin1String("Graphics/interlacedMode"),
@@ -145,6 +156,12 @@ EmuManager::EmuManager(QObject *parent, VBackend *vBackend)
 	// Emulation options. (Options menu)
 	gqt4_cfg->registerChangeNotification(QLatin1String("Options/enableSRam"),
 					this, SLOT(enableSRam_changed_slot(QVariant)));
+
+	// Rewind buffer.
+	gqt4_cfg->registerChangeNotification(QLatin1String("Rewind/bufferSize"),
+					this, SLOT(rewindConfig_changed_slot(QVariant)));
+	gqt4_cfg->registerChangeNotification(QLatin1String("Rewind/interval"),
+					this, SLOT(rewindConfig_changed_slot(QVariant)));
 }
 
 EmuManager::~EmuManager()
@@ -157,6 +174,16 @@ EmuManager::~EmuManager()
 	// Delete the ROM.
 	// TODO
 	
+	// Delete the rewind buffer.
+	delete m_rewindBuffer;
+	m_rewindBuffer = nullptr;
+
+	// Delete the framebuffer ring.
+	if (gqt4_emuContext)
+		gqt4_emuContext->m_vdp->setFbRing(nullptr);
+	delete m_fbRing;
+	m_fbRing = nullptr;
+
 	// TODO: Do we really need to clear this?
 	m_paused.data = 0;
 	
@@ -428,10 +455,17 @@ int EmuManager::loadRom_int(LibGens::Rom *rom)
 	EmuContext::SetAutoFixChecksum(
 			gqt4_cfg->get(QLatin1String("autoFixChecksum")).toBool());
 
+	// Idle loop skipping.
+	EmuContext::SetIdleSkip(
+			gqt4_cfg->get(QLatin1String("idleSkip")).toBool());
+
 	// Delete any existing emulation context.
 	// FIXME: Delete gqt4_emuContext after VBackend is finished using it. (MEMORY LEAK)
 	m_vBackend->setEmuContext(nullptr);
 	delete gqt4_emuContext;
+	gqt4_emuContext = nullptr;
+	delete m_fbRing;
+	m_fbRing = nullptr;
 
 	// Create the emulation context.
 	// TODO: Move the emuContext to GensWindow.
@@ -449,6 +483,12 @@ int EmuManager::loadRom_int(LibGens::Rom *rom)
 		return 5;
 	}
 
+	// Render into a framebuffer ring so the emulation thread
+	// can start the next frame while the VBackend is still
+	// using the previous one.
+	m_fbRing = new LibGens::MdFbRing();
+	gqt4_emuContext->m_vdp->setFbRing(m_fbRing);
+
 	// Set the VBackend's emulation context.
 	m_vBackend->setEmuContext(gqt4_emuContext);
 
@@ -460,6 +500,7 @@ int EmuManager::loadRom_int(LibGens::Rom *rom)
 	// TODO: Use gqt4_emuContext instead?
 
 	// Open audio.
+	m_audio->setSoundMgr(gqt4_emuContext->m_soundMgr);
 	m_audio->open();
 
 	// Initialize timing information.
@@ -475,6 +516,9 @@ int EmuManager::loadRom_int(LibGens::Rom *rom)
 	// TODO: Load these in EmuContext directly?
 	gqt4_emuContext->setSaveDataEnable(gqt4_cfg->get(QLatin1String("Options/enableSRam")).toBool());
 
+	// Create the rewind buffer.
+	doRewindConfig();
+
 	// TODO: The following should be set in the specific EmuContext.
 
 	// Initialize the VDP settings.
@@ -558,7 +602,10 @@ int EmuManager::closeRom(bool emitStateChanged)
 			if (introStyle != 0) {
 				// Intro Effect is enabled.
 				// Save the previous source framebuffer.
-				m_romClosedFb = gqt4_emuContext->m_vdp->MD_Screen->ref();
+				// With a framebuffer ring, MD_Screen is the back buffer,
+				// so use the frame that's currently being displayed.
+				m_romClosedFb = (m_fbRing ? m_fbRing->readFb()
+						: gqt4_emuContext->m_vdp->MD_Screen)->ref();
 			}
 
 			// Unreference the last previous source framebuffer.
@@ -570,12 +617,22 @@ int EmuManager::closeRom(bool emitStateChanged)
 		// (SaveData() will call the LibGens OSD handler if necessary.)
 		gqt4_emuContext->saveData();
 
+		// Delete the rewind buffer.
+		delete m_rewindBuffer;
+		m_rewindBuffer = nullptr;
+
 		// Delete the emulation context.
 		// FIXME: Delete gqt4_emuContext after VBackend is finished using it. (MEMORY LEAK)
 		m_vBackend->setEmuContext(nullptr);
+		m_audio->setSoundMgr(nullptr);
 		delete gqt4_emuContext;
 		gqt4_emuContext = nullptr;
 
+		// Delete the framebuffer ring.
+		// (The last frame may still be referenced by m_romClosedFb.)
+		delete m_fbRing;
+		m_fbRing = nullptr;
+
 		// Delete the Rom instance.
 		// TODO: Handle this in gqt4_emuContext.
 		delete m_rom;
@@ -722,6 +779,13 @@ void EmuManager::emuFrameDone(bool wasFastFrame)
 			double fps = ((double)m_frames / (timeDiff_fps / 1000000.0));
 			emit updateFps(fps);
 
+			// Push the profiling counters, if available.
+			if (LibGens::Profiler::IsEnabled) {
+				char buf[512];
+				gqt4_emuContext->profiler()->format(buf, sizeof(buf));
+				emit updateProfiler(QString::fromLatin1(buf));
+			}
+
 			// Reset the timer and frame counter.
 			m_lastTime_fps = thisTime;
 			m_frames = 0;
@@ -741,6 +805,10 @@ void EmuManager::emuFrameDone(bool wasFastFrame)
 		m_keyManager->updateIoManager(gqt4_emuContext->m_ioManager);
 	}
 
+	// Rewind, or save a rewind snapshot.
+	if (m_rewindBuffer)
+		doRewind();
+
 	// Update the Video Backend.
 	if (!wasFastFrame)
 		updateVBackend();
@@ -797,6 +865,46 @@ void EmuManager::emuFrameDone(bool wasFastFrame)
 		gqt4_emuThread->resume(doFastFrame);
 }
 
+/**
+ * Rewind or capture a rewind snapshot.
+ * Called from emuFrameDone() while the emulation thread is waiting.
+ */
+void EmuManager::doRewind(void)
+{
+	int ret;
+	if (m_rewinding) {
+		// Restore the previous snapshot.
+		// The next frame will be run from the restored state
+		// so the screen is updated.
+		ret = m_rewindBuffer->step(gqt4_emuContext);
+		if (ret == -ENOENT) {
+			// Rewind buffer is empty.
+			ret = 0;
+		}
+	} else {
+		ret = m_rewindBuffer->capture(gqt4_emuContext);
+	}
+
+	if (ret < 0) {
+		// Error. Disable rewinding.
+		//: OSD message indicating rewinding was disabled due to an error.
+		QString osdMsg = tr("Rewind disabled: %1").arg(QLatin1String(strerror(-ret)));
+		emit osdPrintMsg(1500, osdMsg);
+		delete m_rewindBuffer;
+		m_rewindBuffer = nullptr;
+	}
+}
+
+/**
+ * Start or stop rewinding.
+ * Connected to the rewind hold key.
+ * @param rewinding True to rewind; false to resume capturing snapshots.
+ */
+void EmuManager::setRewinding(bool rewinding)
+{
+	m_rewinding = rewinding;
+}
+
 /** Video Backend. **/
 
 /**
@@ -842,7 +950,10 @@ void EmuManager::updateVBackend(void)
 	m_vBackend->setMdScreenDirty();
 	m_vBackend->setVbDirty();
 
-	if (gqt4_emuContext) {
+	if (m_fbRing) {
+		// Use the most recently published frame.
+		m_vBackend->vbUpdate(m_fbRing->acquire());
+	} else if (gqt4_emuContext) {
 		const LibGens::Vdp *vdp = gqt4_emuContext->m_vdp;
 		m_vBackend->vbUpdate(vdp->MD_Screen);
 	} else {
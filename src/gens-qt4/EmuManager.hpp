@@ -32,6 +32,10 @@
 // LibGens includes.
 #include "libgens/Rom.hpp"
 #include "libgens/IO/IoManager.hpp"
+namespace LibGens {
+	class RewindBuffer;
+	class MdFbRing;
+}
 
 // LibGensKeys: Key Manager
 #include "libgenskeys/KeyManager.hpp"
@@ -106,6 +110,13 @@ class EmuManager : public QObject
 
 	signals:
 		void updateFps(double fps);
+
+		/**
+		 * Update the profiler overlay.
+		 * Only emitted if libgens was built with ENABLE_LIBGENS_PROFILER.
+		 * @param stats Formatted profiling counters for the last frame.
+		 */
+		void updateProfiler(const QString &stats);
 		void stateChanged(void);		// Emulation state changed. Update the Gens title.
 
 		/**
@@ -161,6 +172,21 @@ class EmuManager : public QObject
 		// Paused state.
 		paused_t m_paused;
 
+		// Rewind buffer. (nullptr if rewind is disabled)
+		LibGens::RewindBuffer *m_rewindBuffer;
+		bool m_rewinding;	// True while the rewind key is held.
+
+		// Framebuffer ring.
+		// The emulation thread renders into the back buffer
+		// while the VBackend uses the front buffer.
+		LibGens::MdFbRing *m_fbRing;
+
+		/**
+		 * Rewind or capture a rewind snapshot.
+		 * Called from emuFrameDone() while the emulation thread is waiting.
+		 */
+		void doRewind(void);
+
 		/** Savestates. **/
 		int m_saveSlot;
 
@@ -306,6 +332,8 @@ class EmuManager : public QObject
 				RQT_RESET_CPU,
 				RQT_REGION_CODE,
 				RQT_ENABLE_SRAM,
+				RQT_IDLE_SKIP,
+				RQT_REWIND_CONFIG,
 			};
 
 			// RQT_PALETTE_SETTING types.
@@ -354,6 +382,9 @@ class EmuManager : public QObject
 				// Auto Fix Checksum.
 				bool autoFixChecksum;
 
+				// Idle Skip.
+				bool idleSkip;
+
 				// Palette Settings.
 				struct
 				{
@@ -397,6 +428,13 @@ class EmuManager : public QObject
 		void pauseRequest(paused_t newPaused);
 		void pauseRequest(paused_t paused_set, paused_t paused_clear);
 
+		/**
+		 * Start or stop rewinding.
+		 * Connected to the rewind hold key.
+		 * @param rewinding True to rewind; false to resume capturing snapshots.
+		 */
+		void setRewinding(bool rewinding);
+
 	protected slots:
 		/**
 		 * Set the save slot number.
@@ -410,6 +448,18 @@ class EmuManager : public QObject
 		 */
 		void autoFixChecksum_changed_slot(const QVariant &autoFixChecksum);
 
+		/**
+		 * Change the Idle Skip setting.
+		 * @param idleSkip (bool) New Idle Skip setting.
+		 */
+		void idleSkip_changed_slot(const QVariant &idleSkip);
+
+		/**
+		 * Rewind buffer size or interval has changed.
+		 * @param value (int) New setting. (ignored; both settings are reloaded)
+		 */
+		void rewindConfig_changed_slot(const QVariant &value);
+
 		/**
 		 * Region code has changed.
 		 * @param regionCode (int) New region code setting.
@@ -480,6 +530,8 @@ class EmuManager : public QObject
 		void doRegionCode(LibGens::SysVersion::RegionCode_t region);
 
 		void doEnableSRam(bool enableSRam);
+
+		void doRewindConfig(void);
 };
 
 /**
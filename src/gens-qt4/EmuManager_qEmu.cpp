@@ -37,6 +37,8 @@ using LibGens::EmuContext;
 // LibGens video includes.
 #include "libgens/Vdp/Vdp.hpp"
 #include "libgens/Util/MdFb.hpp"
+#include "libgens/Util/MdFbRing.hpp"
+#include "libgens/Util/RewindBuffer.hpp"
 #include "libgens/Util/Screenshot.hpp"
 using LibGens::Vdp;
 using LibGens::MdFb;
@@ -288,6 +290,39 @@ void EmuManager::autoFixChecksum_changed_slot(const QVariant &autoFixChecksum)
 		processQEmuRequest();
 }
 
+/**
+ * Change the Idle Skip setting.
+ * @param idleSkip (bool) New Idle Skip setting.
+ */
+void EmuManager::idleSkip_changed_slot(const QVariant &idleSkip)
+{
+	// Queue the idle skip change request.
+	EmuRequest_t rq;
+	rq.rqType = EmuRequest_t::RQT_IDLE_SKIP;
+	rq.idleSkip = idleSkip.toBool();
+	m_qEmuRequest.enqueue(rq);
+
+	if (!m_rom || m_paused.data)
+		processQEmuRequest();
+}
+
+/**
+ * Rewind buffer size or interval has changed.
+ * @param value (int) New setting. (ignored; both settings are reloaded)
+ */
+void EmuManager::rewindConfig_changed_slot(const QVariant &value)
+{
+	Q_UNUSED(value);
+
+	// Queue the rewind configuration request.
+	EmuRequest_t rq;
+	rq.rqType = EmuRequest_t::RQT_REWIND_CONFIG;
+	m_qEmuRequest.enqueue(rq);
+
+	if (!m_rom || m_paused.data)
+		processQEmuRequest();
+}
+
 /**
  * Region code has changed.
  * @param regionCode (int) New region code setting.
@@ -456,6 +491,19 @@ void EmuManager::processQEmuRequest(void)
 				EmuContext::SetAutoFixChecksum(rq.autoFixChecksum);
 				break;
 
+			case EmuRequest_t::RQT_IDLE_SKIP:
+				// Set the Idle Skip setting.
+				// This takes effect immediately.
+				EmuContext::SetIdleSkip(rq.idleSkip);
+				if (gqt4_emuContext)
+					gqt4_emuContext->updateIdleSkip();
+				break;
+
+			case EmuRequest_t::RQT_REWIND_CONFIG:
+				// Rebuild the rewind buffer.
+				doRewindConfig();
+				break;
+
 			case EmuRequest_t::RQT_PALETTE_SETTING:
 				// Set a palette setting.
 				doChangePaletteSetting(rq.PaletteSettings.ps_type, rq.PaletteSettings.ps_val);
@@ -511,9 +559,10 @@ void EmuManager::doScreenShot(void)
 	} while (QFile::exists(scrFilename));
 
 	// Take the screenshot.
-	MdFb *fb = gqt4_emuContext->m_vdp->MD_Screen->ref();
+	// With a framebuffer ring, MD_Screen is the back buffer,
+	// so use the frame that's currently being displayed.
+	MdFb *fb = (m_fbRing ? m_fbRing->readFb() : gqt4_emuContext->m_vdp->MD_Screen)->ref();
 	int ret = Screenshot::toFile(scrFilename.toUtf8().constData(), fb, m_rom);
-	fb->unref();
 
 	// Done using the framebuffer.
 	fb->unref();
@@ -840,7 +889,7 @@ void EmuManager::doResetCpu(EmuManager::ResetCpuIndex cpu_idx)
 	QString msg;
 	switch (cpu_idx) {
 		case RQT_CPU_M68K:
-			LibGens::M68K::Reset();
+			gqt4_emuContext->m_m68k->reset();
 			//: OSD message indicating the 68000 CPU was reset.
 			msg = tr("68000 reset.", "osd");
 			break;
@@ -932,4 +981,23 @@ void EmuManager::doEnableSRam(bool enableSRam)
 	emit osdPrintMsg(1500, msg);
 }
 
+/**
+ * Rebuild the rewind buffer using the current configuration.
+ * Existing snapshots are discarded.
+ */
+void EmuManager::doRewindConfig(void)
+{
+	delete m_rewindBuffer;
+	m_rewindBuffer = nullptr;
+	if (!gqt4_emuContext)
+		return;
+
+	const int rewindSize = gqt4_cfg->getInt(QLatin1String("Rewind/bufferSize"));
+	if (rewindSize > 0) {
+		m_rewindBuffer = new LibGens::RewindBuffer(
+			(size_t)rewindSize * 1024 * 1024,
+			gqt4_cfg->getInt(QLatin1String("Rewind/interval")));
+	}
+}
+
 }
@@ -88,7 +88,15 @@ void KeyHandlerQt::keyPressEvent(QKeyEvent *event)
 	QAction *action = gqt4_cfg->gensMenuShortcuts()->keyToAction(gensKeyMod);
 	if (action != nullptr) {
 		// Key is an event key.
-		action->trigger();
+		if (action->property("holdKey").toBool()) {
+			// Hold action. It stays checked until the key is released.
+			// NOTE: Indexed by the unmodified key, since the modifiers
+			// might be released before the key is.
+			m_heldActions.insert(gensKey, action);
+			action->setChecked(true);
+		} else {
+			action->trigger();
+		}
 		return;
 	}
 
@@ -109,6 +117,14 @@ void KeyHandlerQt::keyReleaseEvent(QKeyEvent *event)
 		return;
 
 	int gensKey = QKeyEventToKeyVal(event);
+
+	// If this key is holding an action, release it.
+	QPointer<QAction> action = m_heldActions.take(gensKey);
+	if (action) {
+		action->setChecked(false);
+		return;
+	}
+
 	if (m_keyManager) {
 		m_keyManager->keyUp(gensKey);
 	}
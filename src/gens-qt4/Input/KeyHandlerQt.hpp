@@ -26,6 +26,9 @@
 
 // Qt includes and classes.
 #include <QtCore/QObject>
+#include <QtCore/QHash>
+#include <QtCore/QPointer>
+class QAction;
 class QKeyEvent;
 class QMouseEvent;
 
@@ -80,6 +83,10 @@ class KeyHandlerQt : public QObject
 		// Key Manager.
 		LibGensKeys::KeyManager *m_keyManager;
 
+		// Held actions. (actions with the "holdKey" property)
+		// These are checked while the key is held down.
+		QHash<GensKey_t, QPointer<QAction> > m_heldActions;
+
 #if 0
 		// TODO
 		// Last mouse position.
@@ -62,6 +62,7 @@ GLBackend::GLBackend(QWidget *parent, KeyHandlerQt *keyHandler)
 	, m_winSize(320, 240)
 
 	, m_tex(0)
+	, m_texSrc(TEXSRC_NONE)
 	, m_texOsd(0)
 	, m_glListOsd(0)
 	, m_texPreview(nullptr)
@@ -150,6 +151,9 @@ void GLBackend::reallocTexture(void)
 	if (m_tex > 0)
 		glDeleteTextures(1, &m_tex);
 
+	// The new texture must be fully uploaded.
+	m_texSrc = TEXSRC_NONE;
+
 	// If we don't have an emulation context, don't allocate a texture for now.
 	// TODO: Intro effects.
 	if (!isRunning()) {
@@ -542,6 +546,26 @@ void GLBackend::glb_paintGL(void)
 			 */
 			bool bFromMD = true;
 
+			// Determine which software effects should be applied.
+			// NOTE: Fast Blur shader is only used if we're not paused manually.
+			const bool bSwFastBlur = (isRunning() && fastBlur() &&
+				(bDoPausedEffect || !m_shaderMgr.hasFastBlur()));
+			const bool bSwPaused = (isRunning() && bDoPausedEffect &&
+				!m_shaderMgr.hasPaused());
+			TexSrc_t texSrc = TEXSRC_MD;
+			if (bSwPaused)
+				texSrc = TEXSRC_OTHER;
+			else if (bSwFastBlur)
+				texSrc = TEXSRC_FASTBLUR;
+
+			// Check which lines changed since the last upload.
+			// If the texture was updated differently last time,
+			// all lines have to be updated.
+			if (texSrc != m_texSrc || texSrc == TEXSRC_OTHER)
+				m_lineDiff.reset();
+			m_lineDiff.update(m_srcFb);
+			m_texSrc = texSrc;
+
 			// Source framebuffer is specified.
 			if (isRunning()) {
 				// Emulation is running. Check if any effects should be applied.
@@ -550,14 +574,13 @@ void GLBackend::glb_paintGL(void)
 				// TODO: These need to specify the source framebuffer...
 
 				// If Fast Blur is enabled, update the Fast Blur effect.
-				// NOTE: Shader version is only used if we're not paused manually.
-				if (fastBlur() && (bDoPausedEffect || !m_shaderMgr.hasFastBlur())) {
-					updateFastBlur(bFromMD);
+				if (bSwFastBlur) {
+					updateFastBlur(bFromMD, &m_lineDiff);
 					bFromMD = false;
 				}
 
 				// If emulation is manually paused, update the pause effect.
-				if (bDoPausedEffect && !m_shaderMgr.hasPaused()) {
+				if (bSwPaused) {
 					// Paused, but no shader is available.
 					// Apply the effect in software.
 					updatePausedEffect(bFromMD);
@@ -573,13 +596,6 @@ void GLBackend::glb_paintGL(void)
 
 		/** END: Apply effects. **/
 
-		// Get the screen buffer from the LibGens::MdFb.
-		const GLvoid *screen;
-		if (m_srcFb->bpp() != MdFb::BPP_32)
-			screen = src_fb->fb16();
-		else
-			screen = src_fb->fb32();
-
 		// Bind the texture.
 		glEnable(GL_TEXTURE_2D);
 		glBindTexture(GL_TEXTURE_2D, m_tex);
@@ -592,10 +608,22 @@ void GLBackend::glb_paintGL(void)
 		glPixelStorei(GL_UNPACK_SKIP_PIXELS, 0);
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 8); // TODO: 16 on amd64?
 
-		glTexSubImage2D(GL_TEXTURE_2D, 0,
-				0, 0,						// x/y offset
-				m_texVisSize.width(), m_texVisSize.height(),	// width/height
-				m_texFormat, m_texType, screen);
+		// Only lines that changed since the last upload are uploaded.
+		int line = 0, count;
+		while ((count = m_lineDiff.nextRun(&line)) > 0) {
+			// Get the screen buffer from the LibGens::MdFb.
+			const GLvoid *screen;
+			if (m_srcFb->bpp() != MdFb::BPP_32)
+				screen = src_fb->lineBuf16(line);
+			else
+				screen = src_fb->lineBuf32(line);
+
+			glTexSubImage2D(GL_TEXTURE_2D, 0,
+					0, line,				// x/y offset
+					m_texVisSize.width(), count,		// width/height
+					m_texFormat, m_texType, screen);
+			line += count;
+		}
 
 		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
 		glPixelStorei(GL_UNPACK_ALIGNMENT, 0);
@@ -835,6 +863,16 @@ void GLBackend::printOsdText(void)
 		printOsdLine(ms_Osd_chrW+1, y+1, sFps);
 		glb_setColor(osdFpsColor());
 		printOsdLine(ms_Osd_chrW, y, sFps);
+
+		// Statistics overlay.
+		// Printed at the upper-left of the screen.
+		int statsY = ms_Osd_chrH;
+		for (int i = 0; i < m_osdStats.size(); i++, statsY += ms_Osd_chrH) {
+			glb_setColor(clShadow);
+			printOsdLine(ms_Osd_chrW+1, statsY+1, m_osdStats[i]);
+			glb_setColor(osdFpsColor());
+			printOsdLine(ms_Osd_chrW, statsY, m_osdStats[i]);
+		}
 	}
 
 	// If messages are enabled, print them on the screen.
@@ -153,6 +153,20 @@ class GLBackend : public VBackend
 		QSize m_texSize;	// Texture size. (1x == 512x256 for power-of-two textures.)
 		QSize m_texVisSize;	// Texture visible size. (1x == 320x240)
 
+		// Texture contents.
+		// Only changed lines are uploaded if the texture
+		// was updated the same way on the previous frame.
+		enum TexSrc_t {
+			TEXSRC_NONE,		// Unknown.
+			TEXSRC_MD,		// MD screen.
+			TEXSRC_FASTBLUR,	// MD screen with software Fast Blur.
+			TEXSRC_OTHER,		// Other software effects.
+		};
+		TexSrc_t m_texSrc;
+
+		// Lines that changed since the last texture upload.
+		LibGens::MdFbLineDiff m_lineDiff;
+
 		// Stretch mode.
 		GLdouble m_stretchRectF[4][2];	// Current stretch coordinates.
 		QSize m_stretchLastRes;		// Last MD screen resolution.
@@ -361,12 +361,21 @@ void VBackend::updatePausedEffect(bool fromMdScreen)
 /**
  * Update the Fast Blur effect.
  * @param fromMdScreen If true, copies MD_Screen[] to m_intScreen.
+ * @param lineDiff If specified, only changed lines are blurred. (fromMdScreen only)
  */
-void VBackend::updateFastBlur(bool fromMdScreen)
+void VBackend::updateFastBlur(bool fromMdScreen, const LibGens::MdFbLineDiff *lineDiff)
 {
 	// Use LibGens' software paused effect function.
 	// TODO: Eliminate fromMdScreen; use separate functions instead.
-	if (fromMdScreen) {
+	if (fromMdScreen && lineDiff) {
+		// Only blur lines that changed since the last update.
+		// The other lines in m_intScreen are still valid.
+		int line = 0, count;
+		while ((count = lineDiff->nextRun(&line)) > 0) {
+			LibGens::FastBlur::DoFastBlur(m_intScreen, m_srcFb, line, count);
+			line += count;
+		}
+	} else if (fromMdScreen) {
 		LibGens::FastBlur::DoFastBlur(m_intScreen, m_srcFb);
 	} else {
 		LibGens::FastBlur::DoFastBlur(m_intScreen);
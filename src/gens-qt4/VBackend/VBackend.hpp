@@ -30,6 +30,7 @@
 // Qt includes.
 #include <QtCore/QString>
 #include <QtCore/QList>
+#include <QtCore/QStringList>
 #include <QtCore/QVariant>
 #include <QtCore/QMutex>
 #include <QtCore/QTimer>
@@ -38,6 +39,7 @@
 
 // LibGens includes.
 #include "libgens/Util/MdFb.hpp"
+#include "libgens/Util/MdFbLineDiff.hpp"
 #include "libgens/Util/Timing.hpp"
 
 // paused_t, StretchMode_t
@@ -147,7 +149,8 @@ class VBackend : public QWidget
 
 		// Effects.
 		void updatePausedEffect(bool fromMdScreen = true);
-		void updateFastBlur(bool fromMdScreen = true);
+		void updateFastBlur(bool fromMdScreen = true,
+				    const LibGens::MdFbLineDiff *lineDiff = nullptr);
 
 		// Internal rendering buffer used for software effects.
 		// NOTE: This takes up (336*240*4) == 322,560 bytes!
@@ -229,6 +232,13 @@ class VBackend : public QWidget
 		void fpsReset(void);
 		void fpsPush(double fps);
 
+		/**
+		 * Set the statistics overlay.
+		 * This is shown along with the FPS counter.
+		 * @param stats Statistics text. (may contain newlines)
+		 */
+		void osdSetStats(const QString &stats);
+
 		// Recording OSD.
 		int recSetStatus(const QString &component, bool isRecording);
 		int recSetDuration(const QString &component, int duration);
@@ -259,6 +269,9 @@ class VBackend : public QWidget
 		// FPS manager.
 		FpsManager m_fpsManager;
 
+		// Statistics overlay, split into lines.
+		QStringList m_osdStats;
+
 		// Timing manager.
 		LibGens::Timing m_timing;
 
@@ -210,6 +210,18 @@ void VBackend::fpsPush(double fps)
 		setOsdListDirty();
 }
 
+/**
+ * Set the statistics overlay.
+ * This is shown along with the FPS counter.
+ * @param stats Statistics text. (may contain newlines)
+ */
+void VBackend::osdSetStats(const QString &stats)
+{
+	m_osdStats = stats.split(QChar(L'\n'), QString::SkipEmptyParts);
+	if (osdFpsEnabled() && isRunning() && !isPaused())
+		setOsdListDirty();
+}
+
 /*! Recording status. **/
 
 /**
@@ -220,6 +220,8 @@ GensWindow::GensWindow(QWidget *parent, Qt::WindowFlags flags)
 	// Connect Emulation Manager signals to GensWindow.
 	QObject::connect(d->emuManager, SIGNAL(updateFps(double)),
 		this, SLOT(updateFps(double)));
+	QObject::connect(d->emuManager, SIGNAL(updateProfiler(QString)),
+		this, SLOT(updateProfiler(QString)));
 	QObject::connect(d->emuManager, SIGNAL(stateChanged(void)),
 		this, SLOT(stateChanged(void)));
 	QObject::connect(d->emuManager, SIGNAL(osdPrintMsg(int,QString)),
@@ -517,6 +519,16 @@ void GensWindow::updateFps(double fps)
 	d->vBackend->fpsPush(fps);
 }
 
+/**
+ * Update the profiler overlay.
+ * @param stats Formatted profiling counters.
+ */
+void GensWindow::updateProfiler(const QString &stats)
+{
+	Q_D(GensWindow);
+	d->vBackend->osdSetStats(stats);
+}
+
 /**
  * Emulation state changed.
  * - Update the video backend properties.
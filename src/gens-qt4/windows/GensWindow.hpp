@@ -99,6 +99,12 @@ class GensWindow : public QMainWindow
 		 */
 		void updateFps(double fps);
 
+		/**
+		 * Update the profiler overlay.
+		 * @param stats Formatted profiling counters.
+		 */
+		void updateProfiler(const QString &stats);
+
 		/**
 		 * Emulation state changed.
 		 * - Update the video backend "running" state.
@@ -211,6 +217,7 @@ class GensWindow : public QMainWindow
 
 		// Non-Menu Actions
 		void on_actionNoMenuFastBlur_triggered(bool checked);
+		void on_actionNoMenuRewind_toggled(bool checked);
 		void map_actionNoMenuSaveSlot_triggered(int saveSlot);
 		void on_actionNoMenuSaveSlotPrev_triggered(void);
 		void on_actionNoMenuSaveSlotNext_triggered(void);
@@ -264,6 +264,17 @@ void GensWindow::on_actionNoMenuFastBlur_triggered(bool checked)
 	d->vBackend->setFastBlur(checked);
 }
 
+/**
+ * Rewind key was pressed or released.
+ * KeyHandlerQt checks this action while its key is held.
+ * @param checked True if the rewind key is held.
+ */
+void GensWindow::on_actionNoMenuRewind_toggled(bool checked)
+{
+	Q_D(GensWindow);
+	d->emuManager->setRewinding(checked);
+}
+
 void GensWindow::map_actionNoMenuSaveSlot_triggered(int saveSlot)
 {
 	assert(saveSlot >= 0 && saveSlot <= 9);
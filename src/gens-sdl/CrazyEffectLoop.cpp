@@ -110,7 +110,7 @@ int CrazyEffectLoop::run(const Options *options)
 	if (d->sdlHandler->init_video() < 0)
 		return EXIT_FAILURE;
 	// No audio here.
-	//if (d->sdlHandler->init_audio(options->sound_freq(), options->stereo()) < 0)
+	//if (d->sdlHandler->init_audio(nullptr, options->sound_freq(), options->stereo()) < 0)
 	//	return EXIT_FAILURE;
 	d->vBackend = d->sdlHandler->vBackend();
 
@@ -43,8 +43,14 @@ using GensSdl::VBackend;
 #include "libgens/Util/MdFb.hpp"
 #include "libgens/Vdp/Vdp.hpp"
 #include "libgens/EmuContext/SysVersion.hpp"
+#include "libgens/Util/Movie.hpp"
+#include "libgens/Util/RewindBuffer.hpp"
+#include "libgens/Util/RunAhead.hpp"
 using LibGens::Rom;
 using LibGens::MdFb;
+using LibGens::Movie;
+using LibGens::RewindBuffer;
+using LibGens::RunAhead;
 using LibGens::Vdp;
 using LibGens::SysVersion;
 
@@ -53,6 +59,7 @@ using LibGens::SysVersion;
 #include "libgens/EmuContext/EmuContextFactory.hpp"
 using LibGens::EmuContext;
 using LibGens::EmuContextFactory;
+using LibGens::Profiler;
 
 // LibGensKeys
 #include "libgens/IO/IoManager.hpp"
@@ -145,12 +152,65 @@ class EmuLoopPrivate : public EventLoopPrivate
 		 */
 		void doScreenShot(void);
 
+		// Profiler overlay.
+		bool profilerOverlay;
+		int profilerFrames;
+		// Update the overlay every 15 frames.
+		static const int PROFILER_UPDATE_FRAMES = 15;
+
+		/**
+		 * Toggle the profiler overlay.
+		 */
+		void doProfilerOverlay(void);
+
+		/**
+		 * Update the profiler overlay.
+		 * Called after each full frame.
+		 */
+		void updateProfilerOverlay(void);
+
 		/**
 		 * Update the window title information.
 		 * This uses the system abbreviation
 		 * and the ROM name.
 		 */
 		void updateWinTitleInfo(void);
+
+		// Rewind buffer. (nullptr if rewind is disabled)
+		RewindBuffer *rewindBuffer;
+		// Set while the rewind key is held.
+		bool rewinding;
+
+		/**
+		 * Step back one rewind snapshot, if rewinding.
+		 * Called before each frame.
+		 * @return True if the frame should be run; false to hold the current frame.
+		 */
+		bool rewindStep(void);
+
+		/**
+		 * Capture a rewind snapshot, if not rewinding.
+		 * Called after each frame.
+		 */
+		void rewindCapture(void);
+
+		// Run-ahead frame runner. (nullptr if run-ahead is disabled)
+		RunAhead *runAhead;
+
+		// Input movie being recorded. (nullptr if not recording)
+		Movie *movie;
+		string movieFilename;
+
+		/**
+		 * Record the frame that was just run, if recording a movie.
+		 * Called after each frame.
+		 */
+		void movieRecordFrame(void);
+
+		/**
+		 * Stop recording the movie and save it.
+		 */
+		void stopMovieRecording(void);
 };
 
 /** EmuLoopPrivate **/
@@ -175,12 +235,21 @@ EmuLoopPrivate::EmuLoopPrivate()
 	, emuContext(nullptr)
 	, keyManager(nullptr)
 	, saveSlot_selected(0)
+	, profilerOverlay(false)
+	, profilerFrames(0)
+	, rewindBuffer(nullptr)
+	, rewinding(false)
+	, runAhead(nullptr)
+	, movie(nullptr)
 {
 	last_paused.data = 0;
 }
 
 EmuLoopPrivate::~EmuLoopPrivate()
 {
+	delete movie;
+	delete runAhead;
+	delete rewindBuffer;
 	delete rom;
 	delete emuContext;
 	delete keyManager;
@@ -316,6 +385,9 @@ void EmuLoopPrivate::doLoadState(void)
 	if (ret == 0) {
 		// State loaded.
 		vBackend->osd_printf(1500, "Slot %d loaded.", saveSlot_selected);
+		// The movie can't be played back past this point.
+		// TODO: Movie branches?
+		stopMovieRecording();
 	} else {
 		// Error loading state.
 		if (ret == -ENOENT) {
@@ -403,6 +475,53 @@ void EmuLoopPrivate::doScreenShot(void)
 	}
 }
 
+/**
+ * Toggle the profiler overlay.
+ */
+void EmuLoopPrivate::doProfilerOverlay(void)
+{
+	if (!Profiler::IsEnabled && !runAhead) {
+		vBackend->osd_print(1500, "Profiler overlay is not available.\n"
+			"Rebuild with ENABLE_LIBGENS_PROFILER.");
+		return;
+	}
+
+	profilerOverlay = !profilerOverlay;
+	if (profilerOverlay) {
+		// Update the overlay on the next frame.
+		profilerFrames = PROFILER_UPDATE_FRAMES;
+	} else {
+		// Hide the overlay.
+		vBackend->osd_stats(nullptr);
+	}
+}
+
+/**
+ * Update the profiler overlay.
+ * Called after each full frame.
+ */
+void EmuLoopPrivate::updateProfilerOverlay(void)
+{
+	if (!profilerOverlay || ++profilerFrames < PROFILER_UPDATE_FRAMES)
+		return;
+	profilerFrames = 0;
+
+	char buf[512];
+	int len = 0;
+	if (Profiler::IsEnabled) {
+		len = emuContext->profiler()->format(buf, sizeof(buf));
+	}
+	if (runAhead) {
+		// Run-ahead cost since the last update.
+		if (len > 0 && len < (int)sizeof(buf) - 1) {
+			buf[len++] = '\n';
+		}
+		runAhead->format(&buf[len], sizeof(buf) - len);
+		runAhead->resetStats();
+	}
+	vBackend->osd_stats(buf);
+}
+
 /**
  * Update the window title information.
  * This uses the system abbreviation
@@ -484,6 +603,85 @@ void EmuLoopPrivate::updateWinTitleInfo(void)
 	updateWindowTitle(winTitle.c_str());
 }
 
+/**
+ * Step back one rewind snapshot, if rewinding.
+ * Called before each frame.
+ * @return True if the frame should be run; false to hold the current frame.
+ */
+bool EmuLoopPrivate::rewindStep(void)
+{
+	if (!rewinding)
+		return true;
+
+	int ret = rewindBuffer->step(emuContext);
+	if (ret == 0) {
+		// Snapshot restored. Run the frame
+		// after it so the screen is updated.
+		return true;
+	} else if (ret == -ENOENT) {
+		// No snapshots yet. Hold the current frame.
+		return false;
+	}
+
+	// Error restoring the snapshot.
+	vBackend->osd_printf(1500, "Error rewinding:\n* %s", strerror(-ret));
+	rewinding = false;
+	return true;
+}
+
+/**
+ * Capture a rewind snapshot, if not rewinding.
+ * Called after each frame.
+ */
+void EmuLoopPrivate::rewindCapture(void)
+{
+	if (!rewindBuffer || rewinding)
+		return;
+
+	int ret = rewindBuffer->capture(emuContext);
+	if (ret < 0) {
+		// Rewind buffer is too small for this ROM.
+		vBackend->osd_printf(1500, "Rewind disabled:\n* %s", strerror(-ret));
+		delete rewindBuffer;
+		rewindBuffer = nullptr;
+	}
+}
+
+/**
+ * Record the frame that was just run, if recording a movie.
+ * Called after each frame.
+ */
+void EmuLoopPrivate::movieRecordFrame(void)
+{
+	if (!movie)
+		return;
+
+	int ret = movie->recordFrame(emuContext);
+	if (ret != 0) {
+		vBackend->osd_printf(1500, "Movie recording stopped:\n* %s", strerror(-ret));
+		stopMovieRecording();
+	}
+}
+
+/**
+ * Stop recording the movie and save it.
+ */
+void EmuLoopPrivate::stopMovieRecording(void)
+{
+	if (!movie)
+		return;
+
+	int ret = movie->save(movieFilename.c_str());
+	if (ret == 0) {
+		vBackend->osd_printf(1500, "Movie saved: %d frames.", movie->frameCount());
+	} else {
+		fprintf(stderr, "Error saving movie %s: %s\n",
+			movieFilename.c_str(), strerror(-ret));
+	}
+	delete movie;
+	movie = nullptr;
+}
+
 /** EmuLoop **/
 
 EmuLoop::EmuLoop()
@@ -518,12 +716,20 @@ int EmuLoop::processSdlEvent(const SDL_Event *event) {
 						d->emuContext->softReset();
 						d->vBackend->osd_print(1500, "Soft Reset.");
 					}
+					// Resets aren't recorded in movies.
+					// TODO: Record resets?
+					d->stopMovieRecording();
 					break;
 
 				case SDLK_BACKSPACE:
 					if (event->key.keysym.mod & (KMOD_LSHIFT | KMOD_RSHIFT)) {
 						// Take a screenshot.
 						d->doScreenShot();
+					} else if (d->rewindBuffer) {
+						// Rewind while the key is held.
+						d->rewinding = true;
+					} else if (!event->key.repeat) {
+						d->vBackend->osd_print(1500, "Rewind is disabled.");
 					}
 					break;
 
@@ -573,6 +779,11 @@ int EmuLoop::processSdlEvent(const SDL_Event *event) {
 					d->doLoadState();
 					break;
 
+				case SDLK_F10:
+					// Toggle the profiler overlay.
+					d->doProfilerOverlay();
+					break;
+
 				default: {
 					// Check if the base class event handler will handle this.
 					int ret = EventLoop::processSdlEvent(event);
@@ -588,6 +799,10 @@ int EmuLoop::processSdlEvent(const SDL_Event *event) {
 			break;
 
 		case SDL_KEYUP:
+			if (event->key.keysym.sym == SDLK_BACKSPACE) {
+				// Stop rewinding.
+				d->rewinding = false;
+			}
 			// SDL keycodes nearly match GensKey.
 			d->keyManager->keyUp(SdlHandler::scancodeToGensKey(event->key.keysym.scancode));
 			break;
@@ -672,6 +887,7 @@ int EmuLoop::run(const Options *options)
 	// Set some static EmuContext properties.
 	// TODO: Make these non-static?
 	EmuContext::SetAutoFixChecksum(options->auto_fix_checksum());
+	EmuContext::SetIdleSkip(options->idle_skip());
 	if (options->is_tmss_enabled()) {
 		EmuContext::SetTmssRomFilename(options->tmss_rom_filename());
 		EmuContext::SetTmssEnabled(true);
@@ -708,12 +924,43 @@ int EmuLoop::run(const Options *options)
 	// TODO: More properties?
 	Vdp *vdp = d->emuContext->m_vdp;
 	vdp->options.spriteLimits = options->sprite_limits();
+	vdp->options.midLineWrites = options->mid_line_writes();
+	vdp->setDeferredRender(options->deferred_render());
+
+	// Start recording the input movie.
+	// Movies are recorded from power-on.
+	if (!options->record_movie().empty()) {
+		d->movie = new Movie();
+		d->movieFilename = options->record_movie();
+		int ret = d->movie->startRecording(d->emuContext);
+		if (ret != 0) {
+			fprintf(stderr, "Error recording movie %s: %s\n",
+				d->movieFilename.c_str(), strerror(-ret));
+			delete d->movie;
+			d->movie = nullptr;
+		}
+	}
+
+	// Create the rewind buffer.
+	// Rewinding would break the movie, so it's
+	// disabled while recording.
+	if (options->rewind_size() > 0 && !d->movie) {
+		d->rewindBuffer = new RewindBuffer(
+			(size_t)options->rewind_size() * 1024 * 1024,
+			options->rewind_interval());
+	}
+	d->rewinding = false;
+
+	// Create the run-ahead frame runner.
+	if (options->run_ahead() > 0) {
+		d->runAhead = new RunAhead(options->run_ahead());
+	}
 
 	// Initialize the SDL handlers.
 	d->sdlHandler = new SdlHandler();
 	if (d->sdlHandler->init_video() < 0)
 		return EXIT_FAILURE;
-	if (d->sdlHandler->init_audio(options->sound_freq(), options->stereo()) < 0)
+	if (d->sdlHandler->init_audio(d->emuContext->m_soundMgr, options->sound_freq(), options->stereo()) < 0)
 		return EXIT_FAILURE;
 	d->vBackend = d->sdlHandler->vBackend();
 
@@ -834,7 +1081,14 @@ int EmuLoop::run(const Options *options)
 	// TODO: Move to EmuContext::~EmuContext()?
 	d->emuContext->saveData();
 
+	// Save the input movie.
+	d->stopMovieRecording();
+
 	// Shut down LibGens.
+	delete d->runAhead;
+	d->runAhead = nullptr;
+	delete d->rewindBuffer;
+	d->rewindBuffer = nullptr;
 	delete d->keyManager;
 	d->keyManager = nullptr;
 	delete d->emuContext;
@@ -867,7 +1121,23 @@ int EmuLoop::run(const Options *options)
 void EmuLoop::runFullFrame(void)
 {
 	EmuLoopPrivate *const d = d_func();
-	d->emuContext->execFrame();
+	if (!d->rewindStep())
+		return;
+	if (d->runAhead && !d->rewinding) {
+		// Display a frame from the future.
+		int ret = d->runAhead->execFrame(d->emuContext);
+		if (ret != 0) {
+			// The real frame was still run.
+			d->vBackend->osd_printf(1500, "Run-ahead disabled:\n* %s", strerror(-ret));
+			delete d->runAhead;
+			d->runAhead = nullptr;
+		}
+	} else {
+		d->emuContext->execFrame();
+	}
+	d->movieRecordFrame();
+	d->rewindCapture();
+	d->updateProfilerOverlay();
 }
 
 /**
@@ -879,7 +1149,11 @@ void EmuLoop::runFullFrame(void)
 void EmuLoop::runFastFrame(void)
 {
 	EmuLoopPrivate *const d = d_func();
+	if (!d->rewindStep())
+		return;
 	d->emuContext->execFrameFast();
+	d->movieRecordFrame();
+	d->rewindCapture();
 }
 
 }
@@ -619,6 +619,17 @@ void GLBackend::osd_print(int duration, const char *msg)
 	setDirty();
 }
 
+/**
+ * Set the statistics overlay on the Onscreen Display.
+ * @param msg Statistics text. (UTF-8; may contain newlines) If nullptr or empty, hide the overlay.
+ */
+void GLBackend::osd_stats(const char *msg)
+{
+	d->osd->setStats(msg);
+	// VBackend is dirty.
+	setDirty();
+}
+
 /**
  * Display a preview image on the Onscreen Display.
  * @param duration Duration for the preview image to appear, in milliseconds.
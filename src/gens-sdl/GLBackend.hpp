@@ -90,6 +90,12 @@ class GLBackend : public VBackend {
 		 */
 		virtual void osd_print(int duration, const char *msg) final;
 
+		/**
+		 * Set the statistics overlay on the Onscreen Display.
+		 * @param msg Statistics text. (UTF-8; may contain newlines) If nullptr or empty, hide the overlay.
+		 */
+		virtual void osd_stats(const char *msg) final;
+
 		/**
 		 * Display a preview image on the Onscreen Display.
 		 * @param duration Duration for the preview image to appear, in milliseconds.
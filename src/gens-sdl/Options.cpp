@@ -77,8 +77,15 @@ class OptionsPrivate
 
 		// Emulation options.
 		int sprite_limits;		// Enable sprite limits?
+		int deferred_render;		// Render lines on a separate thread?
+		int mid_line_writes;		// Split lines at mid-line VDP writes?
 		int auto_fix_checksum;		// Auto fix checksum?
+		int idle_skip;			// Skip 68000 idle loops?
 		SysVersion::RegionCode_t region;	// Region code.
+		int rewind_size;		// Rewind buffer size, in MB. (0 to disable)
+		int rewind_interval;		// Rewind snapshot interval, in frames.
+		int run_ahead;			// Number of frames to run ahead. (0 to disable)
+		string record_movie;		// Input movie to record. (empty to disable)
 
 		// UI options.
 		int fps_counter;		// Enable FPS counter?
@@ -115,8 +122,15 @@ void OptionsPrivate::reset(void)
 
 	// Emulation options.
 	sprite_limits = true;
+	deferred_render = false;
+	mid_line_writes = false;
 	auto_fix_checksum = false;
+	idle_skip = true;
 	region = SysVersion::REGION_AUTO;
+	rewind_size = 32;
+	rewind_interval = 1;
+	run_ahead = 0;
+	record_movie.clear();
 
 	// UI options.
 	fps_counter = true;
@@ -208,6 +222,7 @@ int Options::parse(int argc, const char *argv[])
 		const char *rom_filename;
 		const char *tmss_rom_filename;
 		const char *region;
+		const char *record_movie;
 		int bpp;
 	} tmp;
 	memset(&tmp, 0, sizeof(tmp));
@@ -241,12 +256,32 @@ int Options::parse(int argc, const char *argv[])
 			"* Enable sprite limits.", NULL},
 		{"no-sprite-limits", '\0', POPT_ARG_VAL, &d->sprite_limits, 0,
 			"  Disable sprite limits.", NULL},
+		{"deferred-render", '\0', POPT_ARG_VAL, &d->deferred_render, 1,
+			"  Render lines on a separate thread.", NULL},
+		{"no-deferred-render", '\0', POPT_ARG_VAL, &d->deferred_render, 0,
+			"* Render lines on the emulation thread.", NULL},
+		{"mid-line-writes", '\0', POPT_ARG_VAL, &d->mid_line_writes, 1,
+			"  Split lines at mid-line VDP writes.", NULL},
+		{"no-mid-line-writes", '\0', POPT_ARG_VAL, &d->mid_line_writes, 0,
+			"* Apply VDP writes at the start of the next line.", NULL},
 		{"auto-fix-checksum", '\0', POPT_ARG_VAL, &d->auto_fix_checksum, 1,
 			"  Automatically fix checksums.", NULL},
 		{"no-auto-fix-checksum", '\0', POPT_ARG_VAL, &d->auto_fix_checksum, 0,
 			"* Don't automatically fix checksums.", NULL},
+		{"idle-skip", '\0', POPT_ARG_VAL, &d->idle_skip, 1,
+			"* Skip 68000 idle loops.", NULL},
+		{"no-idle-skip", '\0', POPT_ARG_VAL, &d->idle_skip, 0,
+			"  Always emulate 68000 idle loops.", NULL},
 		{"region", '\0', POPT_ARG_STRING, &tmp.region, 0,
 			"  Set the region code: J,U,E,Asia,Auto (default is auto)", "REGION"},
+		{"rewind", '\0', POPT_ARG_INT, &d->rewind_size, 0,
+			"  Rewind buffer size, in MB. 0 disables rewind. (default is 32)", "MB"},
+		{"rewind-interval", '\0', POPT_ARG_INT, &d->rewind_interval, 0,
+			"  Take a rewind snapshot every N frames. (default is 1)", "N"},
+		{"run-ahead", '\0', POPT_ARG_INT, &d->run_ahead, 0,
+			"  Run N frames ahead to reduce input latency. (default is 0)", "N"},
+		{"record-movie", '\0', POPT_ARG_STRING, &tmp.record_movie, 0,
+			"  Record an input movie to FILE.", "FILE"},
 		POPT_TABLEEND
 	};
 
@@ -379,6 +414,11 @@ int Options::parse(int argc, const char *argv[])
 		d->tmss_rom_filename = string(tmp.tmss_rom_filename);
 	}
 
+	// Input movie filename.
+	if (tmp.record_movie != nullptr) {
+		d->record_movie = string(tmp.record_movie);
+	}
+
 	// Region code.
 	if (tmp.region != nullptr) {
 		// Region code specified.
@@ -529,8 +569,15 @@ ACCESSOR_BOOL(stereo)
 
 /** Emulation options. **/
 ACCESSOR_BOOL(sprite_limits)
+ACCESSOR_BOOL(deferred_render)
+ACCESSOR_BOOL(mid_line_writes)
 ACCESSOR_BOOL(auto_fix_checksum)
+ACCESSOR_BOOL(idle_skip)
 ACCESSOR(SysVersion::RegionCode_t, region);
+ACCESSOR(int, rewind_size)
+ACCESSOR(int, rewind_interval)
+ACCESSOR(int, run_ahead)
+ACCESSOR(string, record_movie)
 
 /** UI options. **/
 ACCESSOR_BOOL(fps_counter)
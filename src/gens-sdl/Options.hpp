@@ -118,18 +118,60 @@ class Options
 		 */
 		bool sprite_limits(void) const;
 
+		/**
+		 * Render lines on a separate thread?
+		 * @return True to enable; false to disable.
+		 */
+		bool deferred_render(void) const;
+
+		/**
+		 * Split lines at mid-line VDP writes?
+		 * @return True to enable; false to disable.
+		 */
+		bool mid_line_writes(void) const;
+
 		/**
 		 * Automatically fix checksums?
 		 * @return True to auto-fix; false to not.
 		 */
 		bool auto_fix_checksum(void) const;
 
+		/**
+		 * Skip 68000 idle loops?
+		 * @return True to skip; false to always emulate them.
+		 */
+		bool idle_skip(void) const;
+
 		/**
 		 * Region code.
 		 * @return Region code.
 		 */
 		LibGens::SysVersion::RegionCode_t region(void) const;
 
+		/**
+		 * Rewind buffer size.
+		 * @return Rewind buffer size, in MB. (0 if rewind is disabled)
+		 */
+		int rewind_size(void) const;
+
+		/**
+		 * Rewind snapshot interval.
+		 * @return Number of frames between rewind snapshots.
+		 */
+		int rewind_interval(void) const;
+
+		/**
+		 * Run-ahead frames.
+		 * @return Number of frames to run ahead. (0 if run-ahead is disabled)
+		 */
+		int run_ahead(void) const;
+
+		/**
+		 * Get the filename of the input movie to record.
+		 * @return Movie filename. (empty if movie recording is disabled)
+		 */
+		std::string record_movie(void) const;
+
 		/** UI options. **/
 
 		/**
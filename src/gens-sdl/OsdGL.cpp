@@ -97,6 +97,10 @@ class OsdGLPrivate {
 		};
 		vector<OsdMessage*> osdList;
 
+		// Statistics overlay. (Converted to internal 8-bit charset.)
+		// Shown at the top of the screen until cleared.
+		vector<string> statsLines;
+
 		// OSD fade-out time, in microseconds.
 		// TODO: Make this customizable.
 		static const int fadeOutTime = 250000;
@@ -537,7 +541,7 @@ void OsdGL::end(void)
  */
 void OsdGL::draw(void)
 {
-	if (d->osdList.empty()) {
+	if (d->osdList.empty() && d->statsLines.empty()) {
 		// No OSD messages.
 		// TODO: Check for FPS and "enabled" values.
 		return;
@@ -641,6 +645,18 @@ void OsdGL::draw(void)
 	const uint8_t chrH = d->font->h;
 	int y = (240 - chrH);
 
+	// Statistics overlay.
+	// Printed at the top of the screen using the FPS color.
+	int statsY = chrH;
+	for (vector<string>::const_iterator iter = d->statsLines.begin();
+	     iter != d->statsLines.end(); ++iter, statsY += chrH)
+	{
+		glColor4f(0.0f, 0.0f, 0.0f, 1.0f);
+		d->printLine(chrW+1, statsY+1, *iter);
+		d->setGLColor(d->fpsColor);
+		d->printLine(chrW, statsY, *iter);
+	}
+
 	// Print from top to bottom to avoid collisions
 	// with the drop shadow. (C64 font)
 	// In order to do that, we first have to check how many
@@ -747,7 +763,7 @@ void OsdGL::setDisplayOffset(double x, double y)
  */
 bool OsdGL::hasMessages(void) const
 {
-	return !d->osdList.empty() || d->preview.visible;
+	return !d->osdList.empty() || !d->statsLines.empty() || d->preview.visible;
 }
 
 /**
@@ -841,6 +857,30 @@ void OsdGL::print(unsigned int duration, const char *msg)
 	d->dirty = true;
 }
 
+/**
+ * Set the statistics overlay text.
+ * The text is shown at the top of the screen until cleared.
+ * @param msg Statistics text. (UTF-8; may contain newlines) If nullptr or empty, hide the overlay.
+ */
+void OsdGL::setStats(const char *msg)
+{
+	d->statsLines.clear();
+	if (msg) {
+		const char *start = msg;
+		while (*start != 0) {
+			const char *nl = strchr(start, '\n');
+			const size_t len = (nl ? (size_t)(nl - start) : strlen(start));
+			d->statsLines.push_back(d->utf8ToInternal(start, len));
+			if (!nl)
+				break;
+			start = nl + 1;
+		}
+	}
+
+	// OSD is dirty.
+	d->dirty = true;
+}
+
 /**
  * Display a preview image.
  * @param duration Duration for the preview image to appear, in milliseconds.
@@ -107,6 +107,13 @@ class OsdGL {
 		 */
 		void print(unsigned int duration, const char16_t *msg);
 
+		/**
+		 * Set the statistics overlay text.
+		 * The text is shown at the top of the screen until cleared.
+		 * @param msg Statistics text. (UTF-8; may contain newlines) If nullptr or empty, hide the overlay.
+		 */
+		void setStats(const char *msg);
+
 		/**
 		 * Display a preview image.
 		 * @param duration Duration for the preview image to appear, in milliseconds.
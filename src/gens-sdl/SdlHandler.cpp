@@ -43,6 +43,7 @@ namespace GensSdl {
 SdlHandler::SdlHandler()
 	: m_vBackend(nullptr)
 	, m_framesRendered(0)
+	, m_soundMgr(nullptr)
 	, m_audioDevice(0)
 	, m_audioBuffer(nullptr)
 	, m_sampleSize(0)
@@ -184,11 +185,12 @@ VBackend *SdlHandler::vBackend(void) const
 
 /**
  * Initialize SDL audio.
+ * @param soundMgr Sound Manager to read audio from.
  * @param freq Frequency.
  * @param stereo If true, use stereo.
  * @return 0 on success; non-zero on error.
  */
-int SdlHandler::init_audio(int freq, bool stereo)
+int SdlHandler::init_audio(SoundMgr *soundMgr, int freq, bool stereo)
 {
 	SDL_AudioSpec wanted_spec, actual_spec;
 
@@ -221,8 +223,9 @@ int SdlHandler::init_audio(int freq, bool stereo)
 	}
 
 	// Initialize SoundMgr.
-	// TODO: NTSC/PAL setting.
-	SoundMgr::ReInit(actual_spec.freq, false, true);
+	// NOTE: The NTSC/PAL setting is set by the emulation context.
+	m_soundMgr = soundMgr;
+	m_soundMgr->setRate(actual_spec.freq, true);
 
 	// TODO: Verify the actual spec has the correct
 	// number of channels and the right format.
@@ -236,12 +239,12 @@ int SdlHandler::init_audio(int freq, bool stereo)
 	m_sampleSize = (stereo ? 4 : 2);
 
 	// Buffer should be: (SegLength * m_sampleSize) + actual samples.
-	int samples = (SoundMgr::GetSegLength() * m_sampleSize) + actual_spec.samples;
+	int samples = (m_soundMgr->segLength() * m_sampleSize) + actual_spec.samples;
 	m_audioBuffer = new RingBuffer(samples);
 
 	// Segment buffer.
 	// Needed to convert "int32_t" to int16_t.
-	m_segBufferSamples = SoundMgr::GetSegLength();
+	m_segBufferSamples = m_soundMgr->segLength();
 	m_segBufferLen = m_segBufferSamples * m_sampleSize;
 	m_segBuffer = (int16_t*)aligned_malloc(16, m_segBufferLen);
 	memset(m_segBuffer, 0, m_segBufferLen);
@@ -289,6 +292,7 @@ void SdlHandler::end_audio(void)
 	SDL_PauseAudioDevice(m_audioDevice, 1);
 	SDL_CloseAudioDevice(m_audioDevice);
 	m_audioDevice = 0;
+	m_soundMgr = nullptr;
 
 	// Free the buffers.
 	delete m_audioBuffer;
@@ -330,13 +334,16 @@ void SdlHandler::update_audio(void)
 	// TODO: If !m_audioDevice, just clear the internal
 	// audio buffer instead of writing it.
 
+	if (!m_soundMgr)
+		return;
+
 	// FIXME: If our buffer is too small, we'll lose
 	// some of the audio.
 	int samples;
 	if (m_stereo) {
-		samples = SoundMgr::writeStereo(m_segBuffer, m_segBufferSamples);
+		samples = m_soundMgr->writeStereo(m_segBuffer, m_segBufferSamples);
 	} else {
-		samples = SoundMgr::writeMono(m_segBuffer, m_segBufferSamples);
+		samples = m_soundMgr->writeMono(m_segBuffer, m_segBufferSamples);
 	}
 
 	// Write to the ringbuffer.
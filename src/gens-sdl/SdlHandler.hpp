@@ -43,6 +43,10 @@
 #define ATTR_FORMAT_PRINTF(fmt, varargs)
 #endif
 
+namespace LibGens {
+	class SoundMgr;
+}
+
 namespace GensSdl {
 
 class RingBuffer;
@@ -120,11 +124,12 @@ class SdlHandler {
 
 		/**
 		 * Initialize SDL audio.
+		 * @param soundMgr Sound Manager to read audio from.
 		 * @param freq Frequency.
 		 * @param stereo If true, use stereo.
 		 * @return 0 on success; non-zero on error.
 		 */
-		int init_audio(int freq, bool stereo);
+		int init_audio(LibGens::SoundMgr *soundMgr, int freq, bool stereo);
 
 		/**
 		 * Shut down SDL audio.
@@ -167,6 +172,7 @@ class SdlHandler {
 		int m_framesRendered;
 
 		// Audio.
+		LibGens::SoundMgr *m_soundMgr;
 		SDL_AudioDeviceID m_audioDevice;
 		RingBuffer *m_audioBuffer;
 		int m_sampleSize;
@@ -22,7 +22,9 @@
 #include "SdlSWBackend.hpp"
 
 #include "libgens/Util/MdFb.hpp"
+#include "libgens/Util/MdFbLineDiff.hpp"
 using LibGens::MdFb;
+using LibGens::MdFbLineDiff;
 
 // C includes. (C++ namespace)
 #include <cassert>
@@ -62,6 +64,9 @@ class SdlSWBackendPrivate
 		// Last color depth.
 		MdFb::ColorDepth lastBpp;
 
+		// Lines that changed since the last texture update.
+		MdFbLineDiff lineDiff;
+
 	public:
 		/**
 		 * (Re-)Initialize the texture.
@@ -137,6 +142,9 @@ void SdlSWBackendPrivate::reinitTexture(void)
 			320, 240);
 	// Save the last color depth.
 	lastBpp = bpp;
+
+	// The new texture must be fully updated.
+	lineDiff.reset();
 }
 
 /** SdlSWBackend **/
@@ -235,12 +243,23 @@ void SdlSWBackend::update(bool fb_dirty)
 		}
 
 		// Update the texture.
-		if (bpp == MdFb::BPP_32) {
-			SDL_UpdateTexture(d->texture, nullptr,
-				m_fb->fb32(), m_fb->pxPitch() * sizeof(uint32_t));
-		} else {
-			SDL_UpdateTexture(d->texture, nullptr,
-				m_fb->fb16(), m_fb->pxPitch() * sizeof(uint16_t));
+		// Only lines that changed since the last update are uploaded.
+		if (d->lineDiff.update(m_fb) > 0) {
+			const int pitch = (bpp == MdFb::BPP_32
+				? (m_fb->pxPitch() * sizeof(uint32_t))
+				: (m_fb->pxPitch() * sizeof(uint16_t)));
+			int line = 0, count;
+			while ((count = d->lineDiff.nextRun(&line)) > 0) {
+				const SDL_Rect rect = {0, line, m_fb->pxPerLine(), count};
+				if (bpp == MdFb::BPP_32) {
+					SDL_UpdateTexture(d->texture, &rect,
+						m_fb->lineBuf32(line), pitch);
+				} else {
+					SDL_UpdateTexture(d->texture, &rect,
+						m_fb->lineBuf16(line), pitch);
+				}
+				line += count;
+			}
 		}
 		SDL_RenderCopy(d->renderer, d->texture, nullptr, nullptr);
 	}
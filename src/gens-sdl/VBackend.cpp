@@ -154,6 +154,17 @@ void VBackend::osd_print(int duration, const char *msg)
 	puts(msg);
 }
 
+/**
+ * Set the statistics overlay on the Onscreen Display.
+ * @param msg Statistics text. (UTF-8; may contain newlines) If nullptr or empty, hide the overlay.
+ */
+void VBackend::osd_stats(const char *msg)
+{
+	// Default implementation doesn't support OSD.
+	((void)msg);
+	return;
+}
+
 /**
  * Display a preview image on the Onscreen Display.
  * @param duration Duration for the preview image to appear, in milliseconds.
@@ -135,6 +135,30 @@
 #error Missing 'cpuid' asm implementation for this compiler.
 #endif
 
+// XCR0: Extended Control Register 0.
+// The OS must enable both SSE and AVX state saving for AVX to be usable.
+#define IA32_XCR0_SSE		(1U << 1)
+#define IA32_XCR0_AVX		(1U << 2)
+
+#if defined(__GNUC__)
+// XGETBV macro.
+// NOTE: Encoded as bytes for older assemblers.
+#define XGETBV(index, lo, hi) do {				\
+	__asm__ (						\
+		".byte 0x0F, 0x01, 0xD0\n"			\
+		: "=a" (lo), "=d" (hi)				\
+		: "c" (index)					\
+		);						\
+	} while (0)
+#elif defined(_MSC_VER) && _MSC_FULL_VER >= 160040219
+// _xgetbv() was added in MSVC 2010 SP1.
+#define XGETBV(index, lo, hi) do {				\
+	unsigned __int64 xcr = _xgetbv(index);			\
+	(lo) = (unsigned int)(xcr & 0xFFFFFFFF);		\
+	(hi) = (unsigned int)(xcr >> 32);			\
+} while (0)
+#endif
+
 /**
  * Force a function to be marked as inline.
  * FORCE_INLINE: Release builds only.
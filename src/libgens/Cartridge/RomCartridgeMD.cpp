@@ -124,6 +124,13 @@ class RomCartridgeMDPrivate
 				uint32_t addr[4];	// Register addresses.
 				uint16_t reg[4];	// Register values.
 			} registers_ro;
+
+			// Disable 68000 idle loop skipping.
+			// Used if a game polls memory that changes
+			// in ways the emulator doesn't know about.
+			// NOTE: No entries need this yet. It can also be
+			// disabled for all ROMs with EmuContext::SetIdleSkip().
+			bool noIdleSkip;
 		};
 
 		static const MD_RomFixup_t MD_RomFixups[];
@@ -339,8 +346,14 @@ RomCartridgeMDPrivate::~RomCartridgeMDPrivate()
  * RomCartridgeMD functions. *
  *****************************/
 
-RomCartridgeMD::RomCartridgeMD(Rom *rom)
+/**
+ * Initialize an MD ROM cartridge.
+ * @param rom ROM.
+ * @param context Emulation context that owns this cartridge.
+ */
+RomCartridgeMD::RomCartridgeMD(Rom *rom, EmuContext *context)
 	: d(new RomCartridgeMDPrivate(this, rom))
+	, m_context(context)
 	, m_romData(nullptr)
 	, m_romData_size(0)
 	, m_mars(false)
@@ -487,14 +500,26 @@ bool RomCartridgeMD::isRomLoaded(void) const
 	return (m_romData != nullptr);
 }
 
+/**
+ * Can the 68000 skip idle loops in this ROM?
+ * This is disabled for ROMs with the noIdleSkip fixup.
+ * @return True if idle loops can be skipped; false if not.
+ */
+bool RomCartridgeMD::isIdleSkipAllowed(void) const
+{
+	if (d->romFixup < 0)
+		return true;
+	return !RomCartridgeMDPrivate::MD_RomFixups[d->romFixup].noIdleSkip;
+}
+
 /**
  * Update M68K CPU program access structs for bankswitching purposes.
- * @param M68K_Fetch Pointer to first STARSCREAM_PROGRAMREGION to update.
  * @param banks Maximum number of banks to update.
  * @return Number of banks updated.
  */
 int RomCartridgeMD::updateSysBanking(int banks)
 {
+	M68K *const m68k = m_context->m_m68k;
 	int banksUpdated = 0;
 	if (banks > ARRAY_SIZE(m_cartBanks))
 		banks = ARRAY_SIZE(m_cartBanks);
@@ -508,7 +533,7 @@ int RomCartridgeMD::updateSysBanking(int banks)
 			const uint32_t romAddrStart = (0x80000 * (m_cartBanks[i] - BANK_ROM_00));
 			if (romAddrStart < m_romData_size) {
 				// Valid bank. Map it.
-				M68K::SetFetch(romAddrStart, romAddrStart + 0x7FFFF, m_romData + romAddrStart);
+				m68k->setFetch(romAddrStart, romAddrStart + 0x7FFFF, m_romData + romAddrStart);
 				banksUpdated++;
 			}
 		}
@@ -883,7 +908,7 @@ uint8_t RomCartridgeMD::readByte(uint32_t address)
 	// Check for save data access.
 	// TODO: Determine the physical banks for SRAM/EEPROM and
 	// check that in order to optimize this.
-	if (EmuContext::GetSaveDataEnable()) {
+	if (m_context->saveDataEnable()) {
 		if (m_EEPRom.isEEPRomTypeSet()) {
 			// EEPRom is enabled.
 			if (m_EEPRom.isReadBytePort(address)) {
@@ -989,7 +1014,7 @@ uint16_t RomCartridgeMD::readWord(uint32_t address)
 	// Check for save data access.
 	// TODO: Determine the physical banks for SRAM/EEPROM and
 	// check that in order to optimize this.
-	if (EmuContext::GetSaveDataEnable()) {
+	if (m_context->saveDataEnable()) {
 		if (m_EEPRom.isEEPRomTypeSet()) {
 			// EEPRom is enabled.
 			if (m_EEPRom.isReadWordPort(address)) {
@@ -1083,6 +1108,54 @@ uint16_t RomCartridgeMD::readWord(uint32_t address)
 	}
 }
 
+/**
+ * Get a direct pointer to ROM data.
+ * Used for bulk transfers, e.g. DMA.
+ * The range must be plain ROM: it can't cross a 512 KB
+ * bank boundary or overlap SRam, EEPRom, or unused banks.
+ * @param address Cartridge address. (Must be even.)
+ * @param words Number of words.
+ * @return Pointer to ROM data, or nullptr if the range isn't plain ROM.
+ */
+const uint16_t *RomCartridgeMD::romWordPtr(uint32_t address, uint32_t words) const
+{
+	address &= 0xFFFFFF;
+	if (words == 0 || (address & 1))
+		return nullptr;
+	const uint32_t end = address + (words * 2) - 1;
+	if ((address >> 19) != (end >> 19)) {
+		// Range crosses a bank boundary.
+		return nullptr;
+	}
+
+	// Check for save data access.
+	if (m_context->saveDataEnable()) {
+		if (m_EEPRom.isEEPRomTypeSet()) {
+			// EEPRom ports can be anywhere.
+			return nullptr;
+		} else if (m_SRam.canRead() &&
+			   address <= m_SRam.end() && end >= m_SRam.start())
+		{
+			// Range overlaps SRam.
+			return nullptr;
+		}
+	}
+
+	const uint8_t bank = m_cartBanks[(address >> 19) & 0x1F];
+	if (bank > BANK_ROM_3F) {
+		// Not a ROM bank.
+		return nullptr;
+	}
+
+	const uint32_t romAddr = (address & 0x7FFFF) | ((bank - BANK_ROM_00) << 19);
+	if (romAddr + (words * 2) > m_romData_size) {
+		// Range is past the end of the ROM.
+		return nullptr;
+	}
+
+	return &(reinterpret_cast<const uint16_t*>(m_romData))[romAddr >> 1];
+}
+
 /**
  * Write a byte to the standard cartridge area. ($000000-$9FFFFF)
  * @param address Cartridge address.
@@ -1091,7 +1164,7 @@ uint16_t RomCartridgeMD::readWord(uint32_t address)
  */
 void RomCartridgeMD::writeByte(uint32_t address, uint8_t data)
 {
-	if (!EmuContext::GetSaveDataEnable()) {
+	if (!m_context->saveDataEnable()) {
 		// Save data is disabled.
 		return;
 	}
@@ -1124,7 +1197,7 @@ void RomCartridgeMD::writeByte(uint32_t address, uint8_t data)
  */
 void RomCartridgeMD::writeWord(uint32_t address, uint16_t data)
 {
-	if (!EmuContext::GetSaveDataEnable()) {
+	if (!m_context->saveDataEnable()) {
 		// Save data is disabled.
 		return;
 	}
@@ -1227,7 +1300,7 @@ void RomCartridgeMD::writeByte_TIME(uint8_t address, uint8_t data)
 			if (m_mars)
 				updateMarsBanking();
 			// TODO: Better way to update Starscream?
-			M68K::UpdateSysBanking();
+			m_context->m_m68k->updateSysBanking();
 			return;
 		}
 	}
@@ -1270,7 +1343,7 @@ void RomCartridgeMD::writeWord_TIME(uint8_t address, uint16_t data)
 			if (m_mars)
 				updateMarsBanking();
 			// TODO: Better way to update Starscream?
-			M68K::UpdateSysBanking();
+			m_context->m_m68k->updateSysBanking();
 			return;
 		}
 	}
@@ -1492,7 +1565,7 @@ void RomCartridgeMD::zomgRestore(LibZomg::Zomg *zomg, bool loadSaveData)
 			if (m_mars)
 				updateMarsBanking();
 			// TODO: Better way to update Starscream?
-			M68K::UpdateSysBanking();
+			m_context->m_m68k->updateSysBanking();
 			break;
 		}
 
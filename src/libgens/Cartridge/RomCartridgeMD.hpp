@@ -38,13 +38,14 @@ namespace LibZomg {
 namespace LibGens {
 
 class Rom;
+class EmuContext;
 
 class RomCartridgeMDPrivate;
 
 class RomCartridgeMD
 {
 	public:
-		RomCartridgeMD(Rom *rom);
+		RomCartridgeMD(Rom *rom, EmuContext *context);
 		~RomCartridgeMD();
 
 	private:
@@ -76,9 +77,16 @@ class RomCartridgeMD
 		 */
 		bool isRomLoaded(void) const;
 
+		/**
+		 * Can the 68000 skip idle loops in this ROM?
+		 * This is disabled for ROMs with the noIdleSkip fixup.
+		 * NOTE: Only valid after the ROM is loaded.
+		 * @return True if idle loops can be skipped; false if not.
+		 */
+		bool isIdleSkipAllowed(void) const;
+
 		/**
 		 * Update M68K CPU program access structs for bankswitching purposes.
-		 * @param M68K_Fetch Pointer to first STARSCREAM_PROGRAMREGION to update.
 		 * @param banks Maximum number of banks to update.
 		 * @return Number of banks updated.
 		 */
@@ -156,6 +164,17 @@ class RomCartridgeMD
 		void writeByte(uint32_t address, uint8_t data);
 		void writeWord(uint32_t address, uint16_t data);
 
+		/**
+		 * Get a direct pointer to ROM data.
+		 * Used for bulk transfers, e.g. DMA.
+		 * The range must be plain ROM: it can't cross a 512 KB
+		 * bank boundary or overlap SRam, EEPRom, or unused banks.
+		 * @param address Cartridge address. (Must be even.)
+		 * @param words Number of words.
+		 * @return Pointer to ROM data, or nullptr if the range isn't plain ROM.
+		 */
+		const uint16_t *romWordPtr(uint32_t address, uint32_t words) const;
+
 		// /TIME register access functions. ($A130xx)
 		// Only the low byte of the address is needed here.
 		uint8_t readByte_TIME(uint8_t address);
@@ -169,6 +188,9 @@ class RomCartridgeMD
 		 * for performance reasons.
 		 */
 
+		// Emulation context that owns this cartridge.
+		EmuContext *const m_context;
+
 		// ROM data. (Should be allocated in 512 KB blocks.)
 		// (Use malloc() and free() for this pointer.)
 		void *m_romData;
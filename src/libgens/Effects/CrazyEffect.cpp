@@ -299,6 +299,9 @@ void CrazyEffect::run(MdFb *fb)
 				fb->fb32(), pxCount, fb->pxPitch());
 			break;
 	}
+
+	// Line hashes no longer match the framebuffer.
+	fb->invalidateLineHashes();
 }
 
 }
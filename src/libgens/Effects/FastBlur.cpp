@@ -195,6 +195,9 @@ void FastBlur::DoFastBlur(MdFb* RESTRICT outScreen)
 			break;
 	}
 
+	// Line hashes no longer match the framebuffer.
+	outScreen->invalidateLineHashes();
+
 	// Unreference the framebuffer.
 	outScreen->unref();
 }
@@ -206,6 +209,24 @@ void FastBlur::DoFastBlur(MdFb* RESTRICT outScreen)
  */
 void FastBlur::DoFastBlur(MdFb* RESTRICT outScreen, const MdFb* RESTRICT mdScreen)
 {
+	DoFastBlur(outScreen, mdScreen, 0, mdScreen->numLines());
+}
+
+/**
+ * Apply a Fast Blur effect to some lines of the screen buffer.
+ * Fast Blur only blends horizontally, so lines that haven't
+ * changed since the previous call can be skipped.
+ * @param outScreen Destination screen.
+ * @param mdScreen Source screen.
+ * @param line First line.
+ * @param count Number of lines.
+ */
+void FastBlur::DoFastBlur(MdFb* RESTRICT outScreen, const MdFb* RESTRICT mdScreen, int line, int count)
+{
+	assert(line >= 0 && count >= 0 && (line + count) <= mdScreen->numLines());
+	if (count <= 0)
+		return;
+
 	// Reference the framebuffers.
 	outScreen->ref();
 	mdScreen->ref();
@@ -215,20 +236,20 @@ void FastBlur::DoFastBlur(MdFb* RESTRICT outScreen, const MdFb* RESTRICT mdScree
 
 	// Pixel count.
 	// TODO: Verify that both framebuffers are the same.
-	const unsigned int pxCount = (outScreen->pxPitch() * outScreen->numLines());
+	const unsigned int pxCount = (outScreen->pxPitch() * count);
 
 	switch (outScreen->bpp()) {
 		case MdFb::BPP_15:
 #ifdef HAVE_MMX
 			if (CPU_Flags & MDP_CPUFLAG_X86_MMX) {
 				FastBlurPrivate::DoFastBlur_16_MMX(
-					outScreen->fb16(), mdScreen->fb16(), pxCount,
+					outScreen->lineBuf16(line), mdScreen->lineBuf16(line), pxCount,
 					FastBlurPrivate::MASK_DIV2_15_MMX);
 			} else
 #endif /* HAVE_MMX */
 			{
 				FastBlurPrivate::DoFastBlur_16(
-					outScreen->fb16(), mdScreen->fb16(),
+					outScreen->lineBuf16(line), mdScreen->lineBuf16(line),
 					pxCount, FastBlurPrivate::MASK_DIV2_15);
 			}
 			break;
@@ -237,13 +258,13 @@ void FastBlur::DoFastBlur(MdFb* RESTRICT outScreen, const MdFb* RESTRICT mdScree
 #ifdef HAVE_MMX
 			if (CPU_Flags & MDP_CPUFLAG_X86_MMX) {
 				FastBlurPrivate::DoFastBlur_16_MMX(
-					outScreen->fb16(), mdScreen->fb16(), pxCount,
+					outScreen->lineBuf16(line), mdScreen->lineBuf16(line), pxCount,
 					FastBlurPrivate::MASK_DIV2_16_MMX);
 			} else
 #endif /* HAVE_MMX */
 			{
 				FastBlurPrivate::DoFastBlur_16(
-					outScreen->fb16(), mdScreen->fb16(),
+					outScreen->lineBuf16(line), mdScreen->lineBuf16(line),
 					pxCount, FastBlurPrivate::MASK_DIV2_16);
 			}
 			break;
@@ -253,16 +274,19 @@ void FastBlur::DoFastBlur(MdFb* RESTRICT outScreen, const MdFb* RESTRICT mdScree
 #ifdef HAVE_MMX
 			if (CPU_Flags & MDP_CPUFLAG_X86_MMX) {
 				FastBlurPrivate::DoFastBlur_32_MMX(
-					outScreen->fb32(), mdScreen->fb32(), pxCount);
+					outScreen->lineBuf32(line), mdScreen->lineBuf32(line), pxCount);
 			}
 #endif /* HAVE_MMX */
 			{
 				FastBlurPrivate::DoFastBlur_32(
-					outScreen->fb32(), mdScreen->fb32(), pxCount);
+					outScreen->lineBuf32(line), mdScreen->lineBuf32(line), pxCount);
 			}
 			break;
 	}
 
+	// Line hashes no longer match the framebuffer.
+	outScreen->invalidateLineHashes();
+
 	// Unreference the framebuffers.
 	outScreen->unref();
 	mdScreen->unref();
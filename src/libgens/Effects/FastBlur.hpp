@@ -49,6 +49,17 @@ class FastBlur
 	public:
 		static void DoFastBlur(MdFb* RESTRICT outScreen);
 		static void DoFastBlur(MdFb* RESTRICT outScreen, const MdFb* RESTRICT mdScreen);
+
+		/**
+		 * Apply a Fast Blur effect to some lines of the screen buffer.
+		 * Fast Blur only blends horizontally, so lines that haven't
+		 * changed since the previous call can be skipped.
+		 * @param outScreen Destination screen.
+		 * @param mdScreen Source screen.
+		 * @param line First line.
+		 * @param count Number of lines.
+		 */
+		static void DoFastBlur(MdFb* RESTRICT outScreen, const MdFb* RESTRICT mdScreen, int line, int count);
 	
 	private:
 		FastBlur() { }
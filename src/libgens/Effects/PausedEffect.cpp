@@ -266,6 +266,9 @@ void PausedEffect::DoPausedEffect(MdFb *outScreen)
 			break;
 	}
 
+	// Line hashes no longer match the framebuffer.
+	outScreen->invalidateLineHashes();
+
 	// Unreference the framebuffer.
 	outScreen->unref();
 }
@@ -316,6 +319,9 @@ void PausedEffect::DoPausedEffect(MdFb* RESTRICT outScreen, const MdFb* RESTRICT
 			break;
 	}
 
+	// Line hashes no longer match the framebuffer.
+	outScreen->invalidateLineHashes();
+
 	// Unreference the framebuffers.
 	outScreen->unref();
 	mdScreen->unref();
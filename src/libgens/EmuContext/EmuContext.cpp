@@ -23,10 +23,8 @@
 
 #include "EmuContext.hpp"
 
-#ifdef NDEBUG
-#undef NDEBUG
-#endif
-#include <assert.h>
+// C includes. (C++ namespace)
+#include <cerrno>
 
 // C++ includes.
 #include <string>
@@ -36,31 +34,22 @@ using std::string;
 
 // Objects.
 #include "Vdp/Vdp.hpp"
+#include "cpu/M68K.hpp"
+#include "cpu/M68K_Mem.hpp"
+#include "Cartridge/RomCartridgeMD.hpp"
 #include "cpu/Z80.hpp"
+#include "sound/SoundMgr.hpp"
 
-// ROM data access.
-// TODO: Move ROM data to a cartridge class?
-// NOTE: Currently only needed for fixChecksum() / restoreChecksum().
-// Maybe fixChecksum() / restoreChecksum() should be moved to EmuMD.
-#include "cpu/M68K_Mem.hpp"
+// ZOMG savestates.
+#include "libzomg/Zomg.hpp"
 
 namespace LibGens {
 
-// Reference counter.
-// We're only allowing one emulation context at the moment.
-int EmuContext::ms_RefCount = 0;
-
-// Controller I/O manager.
-// TODO: Make this non-static!
-IoManager *EmuContext::m_ioManager;
-
-// Static pointer. Temporarily needed for SRam/EEPRom.
-EmuContext *EmuContext::m_instance = nullptr;
-
 /**
  * Global settings.
  */
 bool EmuContext::ms_AutoFixChecksum = false;
+bool EmuContext::ms_IdleSkip = true;
 string EmuContext::ms_PathSRam;
 string EmuContext::ms_TmssRomFilename;
 bool EmuContext::ms_TmssEnabled = false;
@@ -101,22 +90,28 @@ void EmuContext::init(MdFb *fb, Rom *rom, SysVersion::RegionCode_t region)
 	// This may change later on.
 	((void)region);
 
-	ms_RefCount++;
-	assert(ms_RefCount == 1);
-	m_instance = this;
-
 	// Initialize variables.
 	m_rom = rom;
 	m_saveDataEnable = true;	// Enabled by default. (TODO: Config setting.)
 
 	// Create the Controller I/O manager.
-	// TODO: For now, we'll treat them as static.
-	if (!m_ioManager)
-		m_ioManager = new IoManager();
+	m_ioManager = new IoManager();
+
+	// Create the Sound Manager.
+	// NOTE: The PSG and YM2612 are initialized
+	// when the subclass sets the region.
+	m_soundMgr = new SoundMgr(this);
+
+	// Create the M68K and its memory handler.
+	// These must exist before the VDP is created,
+	// since resetting the VDP updates the IRQ line.
+	// TODO: Move to the subclasses once a non-M68K system is added.
+	m_m68kMem = new M68K_Mem(this);
+	m_m68k = new M68K(this);
 
 	// Initialize the VDP.
 	// TODO: Apply user-specified VDP options.
-	m_vdp = new Vdp(fb);
+	m_vdp = new Vdp(fb, this);
 
 	// NOTE: Z80 is NOT initialized here.
 	// It is initialized by the subclass if it's needed.
@@ -124,18 +119,13 @@ void EmuContext::init(MdFb *fb, Rom *rom, SysVersion::RegionCode_t region)
 
 EmuContext::~EmuContext()
 {
-	ms_RefCount--;
-	assert(ms_RefCount == 0);
-	m_instance = nullptr;
-
-	// TODO: Delete the IoManager?
-	//delete m_ioManager;
-	//m_ioManager = nullptr;
-
 	// Delete any allocated objects.
 	delete m_vdp;
 	delete m_z80;
-	M68K_Mem::ms_Z80 = nullptr;
+	delete m_m68k;
+	delete m_m68kMem;
+	delete m_soundMgr;
+	delete m_ioManager;
 }
 
 /**
@@ -149,4 +139,60 @@ void EmuContext::SetPathSRam(const std::string &newPathSRam)
 	// TODO: Update SRam/EEPRom classes in active contexts.
 }
 
+/**
+ * Save the current state to a memory buffer.
+ * @param buf	[out] Memory buffer. (If nullptr, only calculate the size.)
+ * @param size	[in] Size of buf.
+ * @return Number of bytes used on success; negative errno on error.
+ * (-ENOSPC if the buffer is too small.)
+ */
+int EmuContext::saveStateToBuffer(void *buf, size_t size) const
+{
+	LibZomg::Zomg zomg(buf, size, LibZomg::Zomg::ZOMG_SAVE);
+	if (!zomg.isOpen())
+		return zomg.lastError();
+
+	zomgSaveSections(&zomg);
+	const size_t used = zomg.bufferUsed();
+	zomg.close();
+
+	if (buf && used > size) {
+		// Buffer is too small.
+		return -ENOSPC;
+	}
+	return (int)used;
+}
+
+/**
+ * Load the current state from a memory buffer.
+ * The buffer must have been created by saveStateToBuffer().
+ * @param buf	[in] Memory buffer.
+ * @param size	[in] Size of buf.
+ * @return 0 on success; negative errno on error.
+ */
+int EmuContext::loadStateFromBuffer(const void *buf, size_t size)
+{
+	// NOTE: Zomg doesn't write to the buffer in ZOMG_LOAD mode.
+	LibZomg::Zomg zomg(const_cast<void*>(buf), size, LibZomg::Zomg::ZOMG_LOAD);
+	if (!zomg.isOpen())
+		return zomg.lastError();
+
+	// Snapshots always include save data. Otherwise, restoring
+	// a snapshot wouldn't undo SRAM writes made after it.
+	zomgLoadSections(&zomg, true);
+	zomg.close();
+	return 0;
+}
+
+/**
+ * Apply the IdleSkip() setting to this context's 68000.
+ * NOTE: Don't call this while a frame is being emulated.
+ */
+void EmuContext::updateIdleSkip(void)
+{
+	const bool allowed = (m_m68kMem->m_romCartridge &&
+			      m_m68kMem->m_romCartridge->isIdleSkipAllowed());
+	m_m68k->setIdleSkip(ms_IdleSkip && allowed);
+}
+
 }
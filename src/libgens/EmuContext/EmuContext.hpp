@@ -31,15 +31,25 @@
 // TODO: Make the region code non-console-specific.
 #include "SysVersion.hpp"
 
+// Profiling counters.
+#include "../Util/Profiler.hpp"
+
 // C++ includes.
 #include <string>
 
+namespace LibZomg {
+	class Zomg;
+}
+
 namespace LibGens {
 
 class Rom;
 class MdFb;
 class Vdp;
+class M68K;
+class M68K_Mem;
 class Z80;
+class SoundMgr;
 
 class EmuContext
 {
@@ -57,10 +67,7 @@ class EmuContext
 	private:
 		void init(MdFb *fb, Rom *rom, SysVersion::RegionCode_t region);
 
-	public:	
-		// Get the current EmuContext instance.
-		static EmuContext *Instance(void);
-
+	public:
 		/**
 		 * Save SRam/EEPRom.
 		 * @return 1 if SRam was saved; 2 if EEPRom was saved; 0 if nothing was saved. (TODO: Enum?)
@@ -102,8 +109,7 @@ class EmuContext
 			{ return (m_rom != nullptr); }
 
 		// Controller I/O manager.
-		// TODO: Make this non-static!
-		static IoManager *m_ioManager;
+		IoManager *m_ioManager;
 
 		/**
 		 * Read the system version register. (MD)
@@ -120,12 +126,9 @@ class EmuContext
 		// TODO: Add isPal(), isNtsc(), regionCode(), etc. wrapper functions/
 
 		// Save data enable bit.
-		bool saveDataEnable(void);
+		bool saveDataEnable(void) const;
 		void setSaveDataEnable(bool newSaveDataEnable);
 
-		// Static functions. Temporarily needed for SRam/EEPRom.
-		static inline bool GetSaveDataEnable(void) { return m_instance->m_saveDataEnable; }
-
 		/**
 		 * Load the current state from a ZOMG file.
 		 * @param filename	[in] ZOMG file.
@@ -140,6 +143,33 @@ class EmuContext
 		 */
 		virtual int zomgSave(const char *filename) const = 0;
 
+		/**
+		 * Save the current state to a memory buffer.
+		 * This uses the same sections as zomgSave(), but the
+		 * sections are stored uncompressed, and ZOMG.ini and
+		 * the preview image are omitted. Intended for rewind,
+		 * run-ahead, and other per-frame snapshots.
+		 *
+		 * The required size is constant for a given ROM;
+		 * call with buf == nullptr to determine it.
+		 *
+		 * @param buf	[out] Memory buffer. (If nullptr, only calculate the size.)
+		 * @param size	[in] Size of buf.
+		 * @return Number of bytes used on success; negative errno on error.
+		 * (-ENOSPC if the buffer is too small.)
+		 */
+		int saveStateToBuffer(void *buf, size_t size) const;
+
+		/**
+		 * Load the current state from a memory buffer.
+		 * The buffer must have been created by saveStateToBuffer().
+		 * Unlike zomgLoad(), SRAM and EEPROM are always loaded.
+		 * @param buf	[in] Memory buffer.
+		 * @param size	[in] Size of buf.
+		 * @return 0 on success; negative errno on error.
+		 */
+		int loadStateFromBuffer(const void *buf, size_t size);
+
 		/**
 		 * Global settings.
 		 */
@@ -149,6 +179,24 @@ class EmuContext
 		static inline void SetAutoFixChecksum(bool newAutoFixChecksum)
 			{ ms_AutoFixChecksum = newAutoFixChecksum; }
 
+		/**
+		 * Skip 68000 idle loops?
+		 * This is enabled by default. ROMs with the noIdleSkip
+		 * fixup never skip idle loops.
+		 * New contexts use this setting; call updateIdleSkip()
+		 * to apply it to an existing context.
+		 */
+		static inline bool IdleSkip(void)
+			{ return ms_IdleSkip; }
+		static inline void SetIdleSkip(bool newIdleSkip)
+			{ ms_IdleSkip = newIdleSkip; }
+
+		/**
+		 * Apply the IdleSkip() setting to this context's 68000.
+		 * NOTE: Don't call this while a frame is being emulated.
+		 */
+		void updateIdleSkip(void);
+
 		/**
 		 * Pathnames.
 		 */
@@ -168,15 +216,50 @@ class EmuContext
 		/** VDP (TODO: Make this non-public?) **/
 		Vdp *m_vdp;
 
+		/** M68K (TODO: Make this non-public?) **/
+		M68K *m_m68k;
+		M68K_Mem *m_m68kMem;
+
 		/** Z80 (TODO: Make this non-public?) **/
 		Z80 *m_z80;
 
+		/** Sound Manager (TODO: Make this non-public?) **/
+		SoundMgr *m_soundMgr;
+
+		/**
+		 * Get the profiling counters.
+		 * Values are for the last frame executed.
+		 * Counters are only updated if LIBGENS_ENABLE_PROFILER is set;
+		 * otherwise, Profiler is a no-op and all values are 0.
+		 * @return Profiling counters.
+		 */
+		inline Profiler *profiler(void)
+			{ return &m_profiler; }
+		inline const Profiler *profiler(void) const
+			{ return &m_profiler; }
+
 		/**
 		 * Get the Rom class being used by this emulator context.
 		 * @return Rom class.
 		 */
 		const Rom *rom(void) const;
 
+	protected:
+		/**
+		 * Save the emulation state sections to a ZOMG savestate.
+		 * Used by both zomgSave() and saveStateToBuffer().
+		 * @param zomg	[in] ZOMG savestate, opened for saving.
+		 */
+		virtual void zomgSaveSections(LibZomg::Zomg *zomg) const = 0;
+
+		/**
+		 * Load the emulation state sections from a ZOMG savestate.
+		 * Used by both zomgLoad() and loadStateFromBuffer().
+		 * @param zomg		[in] ZOMG savestate, opened for loading.
+		 * @param loadSaveData	[in] If true, load SRAM and EEPROM data.
+		 */
+		virtual void zomgLoadSections(LibZomg::Zomg *zomg, bool loadSaveData) = 0;
+
 	protected:
 		Rom *m_rom;
 		bool m_saveDataEnable;
@@ -186,25 +269,21 @@ class EmuContext
 		 */
 		SysVersion m_sysVersion;
 
-		// Static pointer. Temporarily needed for SRam/EEPRom.
-		static EmuContext *m_instance;
+		/**
+		 * Profiling counters.
+		 */
+		Profiler m_profiler;
 
 		/**
 		 * Global settings.
 		 */
 		static bool ms_AutoFixChecksum;
+		static bool ms_IdleSkip;
 		static std::string ms_PathSRam;
 		static std::string ms_TmssRomFilename;
 		static bool ms_TmssEnabled;
-
-	private:
-		static int ms_RefCount;
 };
 
-// Get the current EmuContext instance.
-inline EmuContext *EmuContext::Instance(void)
-	{ return m_instance; }
-
 /**
  * Read the system version register. (MD)
  * @return MD version register.
@@ -219,7 +298,7 @@ inline uint8_t EmuContext::readVersionRegister_MD(void) const
 inline const SysVersion *EmuContext::versionRegisterObject(void) const
 	{ return &m_sysVersion; }
 
-inline bool EmuContext::saveDataEnable(void)
+inline bool EmuContext::saveDataEnable(void) const
 	{ return m_saveDataEnable; }
 inline void EmuContext::setSaveDataEnable(bool newSaveDataEnable)
 	{ m_saveDataEnable = newSaveDataEnable; }
@@ -74,20 +74,20 @@ EmuMD::EmuMD(Rom *rom, SysVersion::RegionCode_t region )
 	}
 
 	// Load the ROM into memory.
-	M68K_Mem::ms_RomCartridge = new RomCartridgeMD(rom);
-	M68K_Mem::ms_RomCartridge->loadRom();
-	if (!M68K_Mem::ms_RomCartridge->isRomLoaded()) {
+	m_m68kMem->m_romCartridge = new RomCartridgeMD(rom, this);
+	m_m68kMem->m_romCartridge->loadRom();
+	if (!m_m68kMem->m_romCartridge->isRomLoaded()) {
 		// Error loading the ROM.
 		// TODO: Set an error code.
-		delete M68K_Mem::ms_RomCartridge;
-		M68K_Mem::ms_RomCartridge = nullptr;
+		delete m_m68kMem->m_romCartridge;
+		m_m68kMem->m_romCartridge = nullptr;
 		m_rom = nullptr;
 		return;
 	}
 
 	// Autofix the ROM checksum, if enabled.
 	if (AutoFixChecksum())
-		M68K_Mem::ms_RomCartridge->fixChecksum();
+		m_m68kMem->m_romCartridge->fixChecksum();
 
 	// Initialize TMSS.
 	// NOTE: This must be done *before* calling InitSys(), since
@@ -95,20 +95,20 @@ EmuMD::EmuMD(Rom *rom, SysVersion::RegionCode_t region )
 	initTmss();
 
 	// Initialize the M68K.
-	M68K::InitSys(M68K::SYSID_MD);
+	m_m68k->initSys(M68K::SYSID_MD);
+	updateIdleSkip();
 
 	// Initialize the Z80.
 	// Z80's initial state is RESET.
-	M68K_Mem::Z80_State = (Z80_STATE_ENABLED | Z80_STATE_RESET);	// TODO: "Sound, Z80" setting.
-	m_z80 = new Z80();
-	M68K_Mem::ms_Z80 = m_z80;	// TODO: Better way to cross-reference CPUs.
+	m_m68kMem->Z80_State = (Z80_STATE_ENABLED | Z80_STATE_RESET);	// TODO: "Sound, Z80" setting.
+	m_z80 = new Z80(this);
 
 	// Initialize the system status.
 	// TODO: Move Vdp::SysStatus to EmuContext.
 	m_vdp->SysStatus.data = 0;
 	m_vdp->SysStatus.Genesis = 1;
 	// If TMSS is disabled, initialize the VDP registers.
-	if (!M68K_Mem::tmss_reg.isTmssEnabled()) {
+	if (!m_m68kMem->tmss_reg.isTmssEnabled()) {
 		m_vdp->doFakeBootRomInit();
 	}
 
@@ -126,11 +126,11 @@ EmuMD::EmuMD(Rom *rom, SysVersion::RegionCode_t region )
 EmuMD::~EmuMD()
 {
 	// TODO: Other stuff?
-	M68K::EndSys();
+	m_m68k->endSys();
 
 	// Delete the RomCartridgeMD.
-	delete M68K_Mem::ms_RomCartridge;
-	M68K_Mem::ms_RomCartridge = nullptr;
+	delete m_m68kMem->m_romCartridge;
+	m_m68kMem->m_romCartridge = nullptr;
 }
 
 /**
@@ -143,18 +143,18 @@ int EmuMD::softReset(void)
 	// - If autofix is enabled, fix the checksum.
 	// - If autofix is disabled, restore the checksum.
 	if (AutoFixChecksum())
-		M68K_Mem::ms_RomCartridge->fixChecksum();
+		m_m68kMem->m_romCartridge->fixChecksum();
 	else
-		M68K_Mem::ms_RomCartridge->restoreChecksum();
+		m_m68kMem->m_romCartridge->restoreChecksum();
 
 	// Reset the M68K, Z80, and YM2612.
-	M68K::Reset();
+	m_m68k->reset();
 	m_z80->softReset();
-	SoundMgr::ms_Ym2612.reset();
+	m_soundMgr->m_ym2612.reset();
 
 	// Z80 state should be reset to the default value.
 	// Z80's initial state is RESET.
-	M68K_Mem::Z80_State = (Z80_STATE_ENABLED | Z80_STATE_RESET);	// TODO: "Sound, Z80" setting.
+	m_m68kMem->Z80_State = (Z80_STATE_ENABLED | Z80_STATE_RESET);	// TODO: "Sound, Z80" setting.
 
 	// TODO: Genesis Plus randomizes the restart line.
 	// See genesis.c:176.
@@ -179,21 +179,21 @@ int EmuMD::hardReset(void)
 	// - If autofix is enabled, fix the checksum.
 	// - If autofix is disabled, restore the checksum.
 	if (AutoFixChecksum())
-		M68K_Mem::ms_RomCartridge->fixChecksum();
+		m_m68kMem->m_romCartridge->fixChecksum();
 	else
-		M68K_Mem::ms_RomCartridge->restoreChecksum();
+		m_m68kMem->m_romCartridge->restoreChecksum();
 
 	// Hard-Reset the M68K, Z80, VDP, PSG, and YM2612.
 	// This includes clearing RAM.
-	M68K::InitSys(M68K::SYSID_MD);
+	m_m68k->initSys(M68K::SYSID_MD);
 	m_z80->reinit();
-	SoundMgr::ms_Psg.reset();
-	SoundMgr::ms_Ym2612.reset();
+	m_soundMgr->m_psg.reset();
+	m_soundMgr->m_ym2612.reset();
 
 	// Reset the VDP.
 	m_vdp->reset();
 	// If TMSS is disabled, initialize the VDP registers.
-	if (!M68K_Mem::tmss_reg.isTmssEnabled()) {
+	if (!m_m68kMem->tmss_reg.isTmssEnabled()) {
 		m_vdp->doFakeBootRomInit();
 	}
 	// Make sure the VDP's video mode bit is set properly.
@@ -258,16 +258,16 @@ int EmuMD::setRegion_int(SysVersion::RegionCode_t region, bool preserveState)
 	 * [Round_Double() rounds 0.5 to 0 and 1.5 to 1.] */
 	// TODO: Jorge says CPL is always 3420 master clock cycles...
 	if (m_sysVersion.isPal()) {
-		M68K_Mem::CPL_M68K = Round_Double((((double)CLOCK_PAL / 7.0) / 50.0) / 312.0);
-		M68K_Mem::CPL_Z80 = Round_Double((((double)CLOCK_PAL / 15.0) / 50.0) / 312.0);
+		m_m68kMem->CPL_M68K = Round_Double((((double)CLOCK_PAL / 7.0) / 50.0) / 312.0);
+		m_m68kMem->CPL_Z80 = Round_Double((((double)CLOCK_PAL / 15.0) / 50.0) / 312.0);
 	} else {
-		M68K_Mem::CPL_M68K = Round_Double((((double)CLOCK_NTSC / 7.0) / 60.0) / 262.0);
-		M68K_Mem::CPL_Z80 = Round_Double((((double)CLOCK_NTSC / 15.0) / 60.0) / 262.0);
+		m_m68kMem->CPL_M68K = Round_Double((((double)CLOCK_NTSC / 7.0) / 60.0) / 262.0);
+		m_m68kMem->CPL_Z80 = Round_Double((((double)CLOCK_NTSC / 15.0) / 60.0) / 262.0);
 	}
 
 	// Initialize audio.
 	// NOTE: Only set the region. Sound rate is set by the UI.
-	SoundMgr::SetRegion(m_sysVersion.isPal(), preserveState);
+	m_soundMgr->setRegion(m_sysVersion.isPal(), preserveState);
 
 	// Region set successfully.
 	return 0;
@@ -280,8 +280,8 @@ int EmuMD::setRegion_int(SysVersion::RegionCode_t region, bool preserveState)
 int EmuMD::saveData(void)
 {
 	// TODO: Call lg_osd here instead of in RomCartridgeMD().
-	if (M68K_Mem::ms_RomCartridge)
-		return M68K_Mem::ms_RomCartridge->saveData();
+	if (m_m68kMem->m_romCartridge)
+		return m_m68kMem->m_romCartridge->saveData();
 
 	// Nothing was saved.
 	return 0;
@@ -295,8 +295,8 @@ int EmuMD::saveData(void)
 int EmuMD::autoSaveData(int framesElapsed)
 {
 	// TODO: Call lg_osd here instead of in RomCartridgeMD().
-	if (M68K_Mem::ms_RomCartridge)
-		return M68K_Mem::ms_RomCartridge->autoSaveData(framesElapsed);
+	if (m_m68kMem->m_romCartridge)
+		return m_m68kMem->m_romCartridge->autoSaveData(framesElapsed);
 
 	// Nothing was saved.
 	return 0;
@@ -312,13 +312,13 @@ void EmuMD::initTmss(void)
 	// TODO: Update TMSS settings when loading a savestate?
 	// TODO: Save TMSS settings to the savestate.
 	m_sysVersion.setVersion(0);
-	if (!M68K_Mem::tmss_reg.loadTmssRom()) {
+	if (!m_m68kMem->tmss_reg.loadTmssRom()) {
 		// TMSS ROM initialized.
 		m_sysVersion.setVersion(1);
 	}
 
 	// Update the TMSS mapping.
-	M68K_Mem::UpdateTmssMapping();
+	m_m68kMem->updateTmssMapping();
 }
 
 /**
@@ -329,40 +329,52 @@ void EmuMD::initTmss(void)
 template<EmuMD::LineType_t LineType, bool VDP>
 FORCE_INLINE void EmuMD::T_execLine(void)
 {
-	int writePos = SoundMgr::GetWritePos(m_vdp->VDP_Lines.currentLine);
-	int32_t *bufL = &SoundMgr::ms_SegBufL[writePos];
-	int32_t *bufR = &SoundMgr::ms_SegBufR[writePos];
+	int writePos = m_soundMgr->writePos(m_vdp->VDP_Lines.currentLine);
+	int32_t *bufL = &m_soundMgr->m_segBufL[writePos];
+	int32_t *bufR = &m_soundMgr->m_segBufR[writePos];
 
 	// Update the sound chips.
-	int writeLen = SoundMgr::GetWriteLen(m_vdp->VDP_Lines.currentLine);
-	SoundMgr::ms_Ym2612.updateDacAndTimers(bufL, bufR, writeLen);
-	SoundMgr::ms_Ym2612.addWriteLen(writeLen);
-	SoundMgr::ms_Psg.addWriteLen(writeLen);
+	int writeLen = m_soundMgr->writeLen(m_vdp->VDP_Lines.currentLine);
+	m_profiler.enter(Profiler::PROF_YM2612);
+	m_soundMgr->m_ym2612.updateDacAndTimers(bufL, bufR, writeLen);
+	m_profiler.leave();
+	m_soundMgr->m_ym2612.addWriteLen(writeLen);
+	m_soundMgr->m_psg.addWriteLen(writeLen);
 
 	// Notify controllers that a new scanline is being drawn.
+	m_profiler.enter(Profiler::PROF_IO);
 	m_ioManager->doScanline();
+	m_profiler.leave();
 
 	// Increment the cycles counter.
 	// These values are the "last cycle to execute".
 	// e.g. if Cycles_M68K is 5000, then we'll execute instructions
 	// until the 68000's "odometer" reaches 5000.
-	M68K_Mem::Cycles_M68K += M68K_Mem::CPL_M68K;
-	M68K_Mem::Cycles_Z80 += M68K_Mem::CPL_Z80;
+	m_m68kMem->Cycles_M68K += m_m68kMem->CPL_M68K;
+	m_m68kMem->Cycles_Z80 += m_m68kMem->CPL_Z80;
 
-	if (m_vdp->DMAT_Length)
-		M68K::AddCycles(m_vdp->updateDMA());
+	if (m_vdp->DMAT_Length) {
+		const int dmaCycles = m_vdp->updateDMA();
+		m_profiler.add(Profiler::CNT_DMA_CYCLES, dmaCycles);
+		m_m68k->addCycles(dmaCycles);
+	}
 
 	switch (LineType) {
 		case LINETYPE_ACTIVEDISPLAY:
 			// In visible area.
 			m_vdp->setStatusBit(VdpStatus::VDP_STATUS_HBLANK, true);	// HBlank = 1
-			M68K::Exec(M68K_Mem::Cycles_M68K - 404);
+			m_profiler.enter(Profiler::PROF_M68K);
+			m_m68k->exec(m_m68kMem->Cycles_M68K - 404);
+			m_profiler.leave();
 			m_vdp->setStatusBit(VdpStatus::VDP_STATUS_HBLANK, false);	// HBlank = 0
 
 			// Decrement the HInt counter.
 			// If it goes below 0, an HBLANK interrupt will occur.
 			// The counter will then be reloaded.
-			m_vdp->decrementHIntCounter(true);
+			// NOTE: If mid-line writes are enabled, this is
+			// done at the end of the active display instead.
+			if (!m_vdp->options.midLineWrites)
+				m_vdp->decrementHIntCounter(true);
 			break;
 
 		case LINETYPE_VBLANKLINE: {
@@ -384,8 +396,12 @@ FORCE_INLINE void EmuMD::T_execLine(void)
 			if (m_vdp->VDP_Lines.NTSC_V30.VBlank_Div != 0)
 				m_vdp->setStatusBit(VdpStatus::VDP_STATUS_VBLANK, false);
 
-			M68K::Exec(M68K_Mem::Cycles_M68K - 360);
+			m_profiler.enter(Profiler::PROF_M68K);
+			m_m68k->exec(m_m68kMem->Cycles_M68K - 360);
+			m_profiler.leave();
+			m_profiler.enter(Profiler::PROF_Z80);
 			m_z80->exec(168);
+			m_profiler.leave();
 #if 0
 			// TODO: Congratulations! (LibGens)
 			CONGRATULATIONS_POSTCHECK();
@@ -412,11 +428,35 @@ FORCE_INLINE void EmuMD::T_execLine(void)
 
 	if (VDP) {
 		// VDP needs to be updated.
+		m_profiler.enter(Profiler::PROF_VDP);
 		m_vdp->renderLine();
+		m_profiler.leave();
+		m_profiler.add(Profiler::CNT_LINES_RENDERED, 1);
+	} else {
+		// Frame is being skipped.
+		// The VDP still needs some per-line updates.
+		m_vdp->skipLine();
+	}
+
+	if (LineType == LINETYPE_ACTIVEDISPLAY && m_vdp->options.midLineWrites) {
+		// Run the active display. VDP writes are logged
+		// and applied at the pixel column where they happened.
+		m_profiler.enter(Profiler::PROF_M68K);
+		m_m68k->exec(m_m68kMem->Cycles_M68K - m_m68kMem->CPL_M68K +
+			     m_vdp->activeDisplayEnd());
+		m_profiler.leave();
+		m_vdp->finishLine();
+
+		// HBLANK interrupt.
+		m_vdp->decrementHIntCounter(true);
 	}
 
-	M68K::Exec(M68K_Mem::Cycles_M68K);
+	m_profiler.enter(Profiler::PROF_M68K);
+	m_m68k->exec(m_m68kMem->Cycles_M68K);
+	m_profiler.leave();
+	m_profiler.enter(Profiler::PROF_Z80);
 	m_z80->exec(0);
+	m_profiler.leave();
 }
 
 /**
@@ -426,6 +466,9 @@ FORCE_INLINE void EmuMD::T_execLine(void)
 template<bool VDP>
 FORCE_INLINE void EmuMD::T_execFrame(void)
 {
+	// Start the profiling counters for this frame.
+	m_profiler.startFrame();
+
 	// Initialize Vdp::VDP_Lines.
 	// Reset the current VDP line variables for the new frame.
 	m_vdp->updateVdpLines(true);
@@ -437,13 +480,13 @@ FORCE_INLINE void EmuMD::T_execFrame(void)
 	//m_ioManager->update();
 
 	// Reset the sound chip buffer pointers and write length.
-	SoundMgr::ResetPtrsAndLens();
+	m_soundMgr->resetPtrsAndLens();
 
 	// Clear all of the cycle counters.
-	M68K_Mem::Cycles_M68K = 0;
-	M68K_Mem::Cycles_Z80 = 0;
-	M68K_Mem::Last_BUS_REQ_Cnt = -1000;
-	M68K::TripOdometer();
+	m_m68kMem->Cycles_M68K = 0;
+	m_m68kMem->Cycles_Z80 = 0;
+	m_m68kMem->Last_BUS_REQ_Cnt = -1000;
+	m_m68k->tripOdometer();
 	m_z80->clearOdometer();
 
 	// TODO: MDP. (LibGens)
@@ -460,6 +503,10 @@ FORCE_INLINE void EmuMD::T_execFrame(void)
 	// This initializes the "Interlaced" flag as well as
 	// the HINT counter, and clears the VBLANK flag.
 	m_vdp->startFrame();
+	if (VDP) {
+		// Switch to the next framebuffer, if necessary.
+		m_vdp->startRender();
+	}
 
 	/** Main execution loops. **/
 
@@ -487,7 +534,19 @@ FORCE_INLINE void EmuMD::T_execFrame(void)
 	} while (m_vdp->VDP_Lines.currentLine < m_vdp->VDP_Lines.totalDisplayLines);
 
 	// Update the PSG and YM2612 output.
-	SoundMgr::SpecialUpdate();
+	m_soundMgr->specialUpdate();
+
+	if (VDP) {
+		// Publish the framebuffer, if necessary.
+		m_vdp->finishRender();
+	}
+
+	// Frame is finished.
+	m_profiler.set(Profiler::CNT_M68K_CYCLES, m_m68k->readOdometer());
+	m_profiler.set(Profiler::CNT_M68K_BUDGET, m_m68kMem->Cycles_M68K);
+	m_profiler.set(Profiler::CNT_Z80_CYCLES, m_z80->readOdometer());
+	m_profiler.set(Profiler::CNT_Z80_BUDGET, m_m68kMem->Cycles_Z80);
+	m_profiler.endFrame();
 
 #if 0
 	// If WAV or GYM is being dumped, update the WAV or GYM.
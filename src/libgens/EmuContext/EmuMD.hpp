@@ -97,6 +97,19 @@ class EmuMD : public EmuContext
 		virtual int zomgSave(const char *filename) const final;
 
 	protected:
+		/**
+		 * Save the emulation state sections to a ZOMG savestate.
+		 * @param zomg	[in] ZOMG savestate, opened for saving.
+		 */
+		virtual void zomgSaveSections(LibZomg::Zomg *zomg) const final;
+
+		/**
+		 * Load the emulation state sections from a ZOMG savestate.
+		 * @param zomg		[in] ZOMG savestate, opened for loading.
+		 * @param loadSaveData	[in] If true, load SRAM and EEPROM data.
+		 */
+		virtual void zomgLoadSections(LibZomg::Zomg *zomg, bool loadSaveData) final;
+
 		/**
 		 * Line types.
 		 */
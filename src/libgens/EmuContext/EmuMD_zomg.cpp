@@ -104,53 +104,126 @@ int EmuMD::zomgLoad(const char *filename)
 	if (!zomg.isOpen())
 		return -EIO;
 
+	// Load the emulation state.
+	// TODO: Make the 'loadSaveData' parameter user-configurable.
+	zomgLoadSections(&zomg, false);
+
+	// Close the savestate.
+	zomg.close();
+
+	// Savestate loaded.
+	return 0;
+}
+
+
+/**
+ * Save the current state to a ZOMG file.
+ * @param filename	[in] ZOMG file.
+ * @return 0 on success; negative errno on error.
+ */
+int EmuMD::zomgSave(const char *filename) const
+{
+	// TODO: More comprehensive error reporting.
+	LibZomg::Zomg zomg(filename, LibZomg::Zomg::ZOMG_SAVE);
+	if (!zomg.isOpen())
+		return -ENOENT;
+
+	// Rom object has some useful ROM information.
+	if (!m_rom)
+		return -EINVAL;
+
+	// Create ZOMG.ini.
+	LibZomg::Metadata metadata;
+	metadata.setSystemId("MD");
+	// TODO: System metadata flags, e.g. save author name.
+
+	// ROM information.
+	metadata.setRomFilename(m_rom->filename_base());
+	metadata.setRomCrc32(m_rom->rom_crc32());
+
+	// Additional metadata.
+	metadata.setDescription("Some description; should probably\nbe left\\blank.");
+	// TODO: Remove these fake extensions before release.
+	metadata.setExtensions("EXT,THAT,DOESNT,EXIST,LOL");
+
+	// Save ZOMG.ini.
+	int ret = zomg.saveZomgIni(&metadata);
+	if (ret != 0) {
+		// Error saving ZOMG.ini.
+		return ret;
+	}
+
+	// Create the preview image.
+	// TODO: Use the existing metadata?
+	// TODO: Check the return value?
+	MdFb *fb = m_vdp->MD_Screen->ref();
+	Screenshot::toZomg(&zomg, fb, m_rom);
+	fb->unref();
+
+	// Save the emulation state.
+	zomgSaveSections(&zomg);
+
+	// Close the savestate.
+	zomg.close();
+	
+	// Savestate saved.
+	return 0;
+}
+
+/**
+ * Load the emulation state sections from a ZOMG savestate.
+ * @param zomg		[in] ZOMG savestate, opened for loading.
+ * @param loadSaveData	[in] If true, load SRAM and EEPROM data.
+ */
+void EmuMD::zomgLoadSections(LibZomg::Zomg *zomg, bool loadSaveData)
+{
 	// TODO: Check error codes from the ZOMG functions.
 	// TODO: Load everything first, *then* copy it to LibGens.
 
 	/** VDP **/
-	m_vdp->zomgRestoreMD(&zomg);
+	m_vdp->zomgRestoreMD(zomg);
 
 	/** Audio **/
 
 	// Load the PSG state.
 	Zomg_PsgSave_t psg_save;
-	zomg.loadPsgReg(&psg_save);
-	SoundMgr::ms_Psg.zomgRestore(&psg_save);
+	zomg->loadPsgReg(&psg_save);
+	m_soundMgr->m_psg.zomgRestore(&psg_save);
 
 	/** Audio: MD-specific **/
 
 	// Load the YM2612 register state.
 	Zomg_Ym2612Save_t ym2612_save;
-	zomg.loadMD_YM2612_reg(&ym2612_save);
-	SoundMgr::ms_Ym2612.zomgRestore(&ym2612_save);
+	zomg->loadMD_YM2612_reg(&ym2612_save);
+	m_soundMgr->m_ym2612.zomgRestore(&ym2612_save);
 
 	/** Z80 **/
 
 	// Load the Z80 memory.
 	// TODO: Use the correct size based on system.
-	zomg.loadZ80Mem(m_z80->m_ramZ80, 8192);
+	zomg->loadZ80Mem(m_z80->m_ramZ80, 8192);
 
 	// Load the Z80 registers.
 	Zomg_Z80RegSave_t z80_reg_save;
-	zomg.loadZ80Reg(&z80_reg_save);
+	zomg->loadZ80Reg(&z80_reg_save);
 	m_z80->zomgRestoreReg(&z80_reg_save);
 
 	/** MD: M68K **/
 
 	// Load the M68K memory.
-	zomg.loadM68KMem(Ram_68k.u16, sizeof(Ram_68k.u16), ZOMG_BYTEORDER_16H);
+	zomg->loadM68KMem(m_m68kMem->Ram_68k.u16, sizeof(m_m68kMem->Ram_68k.u16), ZOMG_BYTEORDER_16H);
 
 	// Load the M68K registers.
 	Zomg_M68KRegSave_t m68k_reg_save;
-	zomg.loadM68KReg(&m68k_reg_save);
-	M68K::ZomgRestoreReg(&m68k_reg_save);
+	zomg->loadM68KReg(&m68k_reg_save);
+	m_m68k->zomgRestoreReg(&m68k_reg_save);
 
 	/** MD: Other **/
 
 	// Load the I/O registers. ($A10001-$A1001F, odd bytes)
 	// TODO: Create/use the version register function in M68K_Mem.cpp.
 	Zomg_MD_IoSave_t md_io_save;
-	zomg.loadMD_IO(&md_io_save);
+	zomg->loadMD_IO(&md_io_save);
 	m_ioManager->zomgRestoreMD(&md_io_save);
 
 	// TODO: Set MD version register.
@@ -159,13 +232,13 @@ int EmuMD::zomgLoad(const char *filename)
 
 	// Load the Z80 control registers.
 	Zomg_MD_Z80CtrlSave_t md_z80_ctrl_save;
-	zomg.loadMD_Z80Ctrl(&md_z80_ctrl_save);
+	zomg->loadMD_Z80Ctrl(&md_z80_ctrl_save);
 
-	M68K_Mem::Z80_State &= Z80_STATE_ENABLED;
+	m_m68kMem->Z80_State &= Z80_STATE_ENABLED;
 	if (!md_z80_ctrl_save.busreq)
-		M68K_Mem::Z80_State |= Z80_STATE_BUSREQ;
+		m_m68kMem->Z80_State |= Z80_STATE_BUSREQ;
 	if (!md_z80_ctrl_save.reset)
-		M68K_Mem::Z80_State |= Z80_STATE_RESET;
+		m_m68kMem->Z80_State |= Z80_STATE_RESET;
 	m_z80->m_bankZ80 = ((md_z80_ctrl_save.m68k_bank & 0x1FF) << 15);
 
 	// Load the cartridge data.
@@ -173,124 +246,78 @@ int EmuMD::zomgLoad(const char *filename)
 	// - MD /TIME registers. (SRAM control, etc.)
 	// - SRAM data.
 	// - EEPROM control and data.
-	// TODO: Make the 'loadSaveData' parameter user-configurable.
-	M68K_Mem::ms_RomCartridge->zomgRestore(&zomg, false);
+	m_m68kMem->m_romCartridge->zomgRestore(zomg, loadSaveData);
 
 	// TODO: Does this need to be loaded before
 	// M68K registers are restored?
-	if (M68K_Mem::tmss_reg.isTmssEnabled()) {
+	if (m_m68kMem->tmss_reg.isTmssEnabled()) {
 		// TMSS is enabled.
 		// Load the MD TMSS registers.
 		Zomg_MD_TMSS_reg_t tmss;
-		int ret = zomg.loadMD_TMSS_reg(&tmss);
+		int ret = zomg->loadMD_TMSS_reg(&tmss);
 		if (ret <= 0) {
 			// This savestate doesn't have the TMSS registers.
 			// Assume TMSS is set up properly.
-			M68K_Mem::tmss_reg.a14000.d = 0x53454741; // 'SEGA'
-			M68K_Mem::tmss_reg.n_cart_ce = 1;
+			m_m68kMem->tmss_reg.a14000.d = 0x53454741; // 'SEGA'
+			m_m68kMem->tmss_reg.n_cart_ce = 1;
 		} else {
 			// Loaded the TMSS registers.
 			// TODO: Wordswapping.
-			M68K_Mem::tmss_reg.a14000.d = tmss.a14000;
-			M68K_Mem::tmss_reg.n_cart_ce = (tmss.n_cart_ce & 1);
+			m_m68kMem->tmss_reg.a14000.d = tmss.a14000;
+			m_m68kMem->tmss_reg.n_cart_ce = (tmss.n_cart_ce & 1);
 		}
 		// TODO: Only if cart_ce has changed?
-		M68K_Mem::UpdateTmssMapping();
+		m_m68kMem->updateTmssMapping();
 	}
-
-	// Close the savestate.
-	zomg.close();
-
-	// Savestate loaded.
-	return 0;
 }
 
-
 /**
- * Save the current state to a ZOMG file.
- * @param filename	[in] ZOMG file.
- * @return 0 on success; negative errno on error.
+ * Save the emulation state sections to a ZOMG savestate.
+ * @param zomg	[in] ZOMG savestate, opened for saving.
  */
-int EmuMD::zomgSave(const char *filename) const
+void EmuMD::zomgSaveSections(LibZomg::Zomg *zomg) const
 {
-	// TODO: More comprehensive error reporting.
-	LibZomg::Zomg zomg(filename, LibZomg::Zomg::ZOMG_SAVE);
-	if (!zomg.isOpen())
-		return -ENOENT;
-
-	// Rom object has some useful ROM information.
-	if (!m_rom)
-		return -EINVAL;
-
-	// Create ZOMG.ini.
-	LibZomg::Metadata metadata;
-	metadata.setSystemId("MD");
-	// TODO: System metadata flags, e.g. save author name.
-
-	// ROM information.
-	metadata.setRomFilename(m_rom->filename_base());
-	metadata.setRomCrc32(m_rom->rom_crc32());
-
-	// Additional metadata.
-	metadata.setDescription("Some description; should probably\nbe left\\blank.");
-	// TODO: Remove these fake extensions before release.
-	metadata.setExtensions("EXT,THAT,DOESNT,EXIST,LOL");
-
-	// Save ZOMG.ini.
-	int ret = zomg.saveZomgIni(&metadata);
-	if (ret != 0) {
-		// Error saving ZOMG.ini.
-		return ret;
-	}
-
-	// Create the preview image.
-	// TODO: Use the existing metadata?
-	// TODO: Check the return value?
-	MdFb *fb = m_vdp->MD_Screen->ref();
-	Screenshot::toZomg(&zomg, fb, m_rom);
-	fb->unref();
-
 	// TODO: This is MD only!
 	// TODO: Check error codes from the ZOMG functions.
 	// TODO: Load everything first, *then* copy it to LibGens.
 	
 	/** VDP **/
-	m_vdp->zomgSaveMD(&zomg);
+	m_vdp->zomgSaveMD(zomg);
 	
 	/** Audio **/
 	
 	// Save the PSG state.
 	Zomg_PsgSave_t psg_save;
-	SoundMgr::ms_Psg.zomgSave(&psg_save);
-	zomg.savePsgReg(&psg_save);
+	m_soundMgr->m_psg.zomgSave(&psg_save);
+	zomg->savePsgReg(&psg_save);
 	
 	/** Audio: MD-specific **/
 	
 	// Save the YM2612 register state.
 	Zomg_Ym2612Save_t ym2612_save;
-	SoundMgr::ms_Ym2612.zomgSave(&ym2612_save);
-	zomg.saveMD_YM2612_reg(&ym2612_save);
+	m_soundMgr->m_ym2612.zomgSave(&ym2612_save);
+	zomg->saveMD_YM2612_reg(&ym2612_save);
 	
 	/** Z80 **/
 	
 	// Save the Z80 memory.
 	// TODO: Use the correct size based on system.
-	zomg.saveZ80Mem(m_z80->m_ramZ80, 8192);
+	zomg->saveZ80Mem(m_z80->m_ramZ80, 8192);
 	
 	// Save the Z80 registers.
 	Zomg_Z80RegSave_t z80_reg_save;
 	m_z80->zomgSaveReg(&z80_reg_save);
-	zomg.saveZ80Reg(&z80_reg_save);
+	zomg->saveZ80Reg(&z80_reg_save);
 	
 	/** MD: M68K **/
 	
 	// Save the M68K memory.
-	zomg.saveM68KMem(Ram_68k.u16, sizeof(Ram_68k.u16), ZOMG_BYTEORDER_16H);
+	zomg->saveM68KMem(m_m68kMem->Ram_68k.u16, sizeof(m_m68kMem->Ram_68k.u16), ZOMG_BYTEORDER_16H);
 	
 	// Save the M68K registers.
 	Zomg_M68KRegSave_t m68k_reg_save;
-	M68K::ZomgSaveReg(&m68k_reg_save);
-	zomg.saveM68KReg(&m68k_reg_save);
+	m_m68k->zomgSaveReg(&m68k_reg_save);
+	zomg->saveM68KReg(&m68k_reg_save);
 	
 	/** MD: Other **/
 	
@@ -299,40 +326,34 @@ int EmuMD::zomgSave(const char *filename) const
 	Zomg_MD_IoSave_t md_io_save;
 	m_ioManager->zomgSaveMD(&md_io_save);
 	md_io_save.version_reg = readVersionRegister_MD();
-	zomg.saveMD_IO(&md_io_save);
+	zomg->saveMD_IO(&md_io_save);
 
 	// Save the Z80 control registers.
 	Zomg_MD_Z80CtrlSave_t md_z80_ctrl_save;
-	md_z80_ctrl_save.busreq    = !(M68K_Mem::Z80_State & Z80_STATE_BUSREQ);
-	md_z80_ctrl_save.reset     = !(M68K_Mem::Z80_State & Z80_STATE_RESET);
+	md_z80_ctrl_save.busreq    = !(m_m68kMem->Z80_State & Z80_STATE_BUSREQ);
+	md_z80_ctrl_save.reset     = !(m_m68kMem->Z80_State & Z80_STATE_RESET);
 	md_z80_ctrl_save.m68k_bank = ((m_z80->m_bankZ80 >> 15) & 0x1FF);
-	zomg.saveMD_Z80Ctrl(&md_z80_ctrl_save);
+	zomg->saveMD_Z80Ctrl(&md_z80_ctrl_save);
 	
 	// Save the cartridge data.
 	// This includes:
 	// - MD /TIME registers. (SRAM control, etc.)
 	// - SRAM data.
 	// - EEPROM control and data.
-	M68K_Mem::ms_RomCartridge->zomgSave(&zomg);
+	m_m68kMem->m_romCartridge->zomgSave(zomg);
 
-	if (M68K_Mem::tmss_reg.isTmssEnabled()) {
+	if (m_m68kMem->tmss_reg.isTmssEnabled()) {
 		// TMSS is enabled.
 		// Save the MD TMSS registers.
 		Zomg_MD_TMSS_reg_t tmss;
 		// TODO: Wordswapping.
 		tmss.header = ZOMG_MD_TMSS_REG_HEADER;
-		tmss.a14000 = M68K_Mem::tmss_reg.a14000.d;
-		tmss.n_cart_ce = M68K_Mem::tmss_reg.n_cart_ce & 1;
-		zomg.saveMD_TMSS_reg(&tmss);
+		tmss.a14000 = m_m68kMem->tmss_reg.a14000.d;
+		tmss.n_cart_ce = m_m68kMem->tmss_reg.n_cart_ce & 1;
+		zomg->saveMD_TMSS_reg(&tmss);
 	} else {
 		// TODO: Delete MD/TMSS_reg.bin from the savestate?
 	}
-
-	// Close the savestate.
-	zomg.close();
-	
-	// Savestate saved.
-	return 0;
 }
 
 }
@@ -98,41 +98,9 @@ int EmuPico::zomgLoad(const char *filename)
 	if (!zomg.isOpen())
 		return -EIO;
 
-	// TODO: Check error codes from the ZOMG functions.
-	// TODO: Load everything first, *then* copy it to LibGens.
-
-	/** VDP **/
-	m_vdp->zomgRestoreMD(&zomg);
-
-	/** Audio **/
-
-	// Load the PSG state.
-	Zomg_PsgSave_t psg_save;
-	zomg.loadPsgReg(&psg_save);
-	SoundMgr::ms_Psg.zomgRestore(&psg_save);
-
-	/** MD: M68K **/
-
-	// Load the M68K memory.
-	zomg.loadM68KMem(Ram_68k.u16, sizeof(Ram_68k.u16), ZOMG_BYTEORDER_16H);
-
-	// Load the M68K registers.
-	Zomg_M68KRegSave_t m68k_reg_save;
-	zomg.loadM68KReg(&m68k_reg_save);
-	M68K::ZomgRestoreReg(&m68k_reg_save);
-
-	/* TODO: Pico-specific registers. ($800000) */
-
-	// Load the cartridge data.
-	// This includes:
-	// - MD /TIME registers. (SRAM control, etc.)
-	// - SRAM data.
-	// - EEPROM control and data.
+	// Load the emulation state.
 	// TODO: Make the 'loadSaveData' parameter user-configurable.
-	M68K_Mem::ms_RomCartridge->zomgRestore(&zomg, false);
-
-	// TODO: Load TMSS.
-	// Pico TMSS only has one register, the 'SEGA' register.
+	zomgLoadSections(&zomg, false);
 
 	// Close the savestate.
 	zomg.close();
@@ -187,28 +155,87 @@ int EmuPico::zomgSave(const char *filename) const
 	Screenshot::toZomg(&zomg, fb, m_rom);
 	fb->unref();
 
+	// Save the emulation state.
+	zomgSaveSections(&zomg);
+
+	// Close the savestate.
+	zomg.close();
+	
+	// Savestate saved.
+	return 0;
+}
+
+/**
+ * Load the emulation state sections from a ZOMG savestate.
+ * @param zomg		[in] ZOMG savestate, opened for loading.
+ * @param loadSaveData	[in] If true, load SRAM and EEPROM data.
+ */
+void EmuPico::zomgLoadSections(LibZomg::Zomg *zomg, bool loadSaveData)
+{
+	// TODO: Check error codes from the ZOMG functions.
+	// TODO: Load everything first, *then* copy it to LibGens.
+
+	/** VDP **/
+	m_vdp->zomgRestoreMD(zomg);
+
+	/** Audio **/
+
+	// Load the PSG state.
+	Zomg_PsgSave_t psg_save;
+	zomg->loadPsgReg(&psg_save);
+	m_soundMgr->m_psg.zomgRestore(&psg_save);
+
+	/** MD: M68K **/
+
+	// Load the M68K memory.
+	zomg->loadM68KMem(m_m68kMem->Ram_68k.u16, sizeof(m_m68kMem->Ram_68k.u16), ZOMG_BYTEORDER_16H);
+
+	// Load the M68K registers.
+	Zomg_M68KRegSave_t m68k_reg_save;
+	zomg->loadM68KReg(&m68k_reg_save);
+	m_m68k->zomgRestoreReg(&m68k_reg_save);
+
+	/* TODO: Pico-specific registers. ($800000) */
+
+	// Load the cartridge data.
+	// This includes:
+	// - MD /TIME registers. (SRAM control, etc.)
+	// - SRAM data.
+	// - EEPROM control and data.
+	m_m68kMem->m_romCartridge->zomgRestore(zomg, loadSaveData);
+
+	// TODO: Load TMSS.
+	// Pico TMSS only has one register, the 'SEGA' register.
+}
+
+/**
+ * Save the emulation state sections to a ZOMG savestate.
+ * @param zomg	[in] ZOMG savestate, opened for saving.
+ */
+void EmuPico::zomgSaveSections(LibZomg::Zomg *zomg) const
+{
 	// TODO: Check error codes from the ZOMG functions.
 	// TODO: Load everything first, *then* copy it to LibGens.
 
 	/** VDP **/
-	m_vdp->zomgSaveMD(&zomg);
+	m_vdp->zomgSaveMD(zomg);
 
 	/** Audio **/
 
 	// Save the PSG state.
 	Zomg_PsgSave_t psg_save;
-	SoundMgr::ms_Psg.zomgSave(&psg_save);
-	zomg.savePsgReg(&psg_save);
+	m_soundMgr->m_psg.zomgSave(&psg_save);
+	zomg->savePsgReg(&psg_save);
 
 	/** MD: M68K **/
 
 	// Save the M68K memory.
-	zomg.saveM68KMem(Ram_68k.u16, sizeof(Ram_68k.u16), ZOMG_BYTEORDER_16H);
+	zomg->saveM68KMem(m_m68kMem->Ram_68k.u16, sizeof(m_m68kMem->Ram_68k.u16), ZOMG_BYTEORDER_16H);
 
 	// Save the M68K registers.
 	Zomg_M68KRegSave_t m68k_reg_save;
-	M68K::ZomgSaveReg(&m68k_reg_save);
-	zomg.saveM68KReg(&m68k_reg_save);
+	m_m68k->zomgSaveReg(&m68k_reg_save);
+	zomg->saveM68KReg(&m68k_reg_save);
 
 	/* TODO: Pico-specific registers. ($800000) */
 
@@ -217,16 +244,10 @@ int EmuPico::zomgSave(const char *filename) const
 	// - MD /TIME registers. (SRAM control, etc.)
 	// - SRAM data.
 	// - EEPROM control and data.
-	M68K_Mem::ms_RomCartridge->zomgSave(&zomg);
+	m_m68kMem->m_romCartridge->zomgSave(zomg);
 
 	// TODO: Save TMSS.
 	// Pico TMSS only has one register, the 'SEGA' register.
-
-	// Close the savestate.
-	zomg.close();
-	
-	// Savestate saved.
-	return 0;
 }
 
 }
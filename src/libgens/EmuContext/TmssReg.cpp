@@ -186,14 +186,14 @@ uint16_t TmssReg::readWord(uint32_t address) const
 
 /**
  * Update M68K CPU program access structs for bankswitching purposes.
- * @param M68K_Fetch Pointer to first STARSCREAM_PROGRAMREGION to update.
+ * @param m68k M68K to update.
  * @param banks Maximum number of banks to update.
  * @return Number of banks updated.
  */
-int TmssReg::updateSysBanking(int banks)
+int TmssReg::updateSysBanking(M68K *m68k, int banks)
 {
 	((void)banks);	// unused
-	M68K::SetFetch(0x000000, m_tmssRom_mask, m_tmssRom);
+	m68k->setFetch(0x000000, m_tmssRom_mask, m_tmssRom);
 	return 1;
 }
 
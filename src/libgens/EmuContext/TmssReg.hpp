@@ -32,6 +32,8 @@
 
 namespace LibGens {
 
+class M68K;
+
 class TmssReg
 {
 	public:
@@ -107,11 +109,11 @@ class TmssReg
 
 		/**
 		 * Update M68K CPU program access structs for bankswitching purposes.
-		 * @param M68K_Fetch Pointer to first STARSCREAM_PROGRAMREGION to update.
+		 * @param m68k M68K to update.
 		 * @param banks Maximum number of banks to update.
 		 * @return Number of banks updated.
 		 */
-		int updateSysBanking(int banks);
+		int updateSysBanking(M68K *m68k, int banks);
 
 	private:
 		// TMSS ROM data. (Should be a power of two.)
@@ -831,6 +831,18 @@ void IoManager::update(int virtPort, uint32_t buttons)
 	}
 }
 
+/**
+ * Get an I/O device's button state.
+ * @param virtPort Virtual port.
+ * @return Button state. (0xFFFFFFFF if no device is connected)
+ */
+uint32_t IoManager::buttons(int virtPort) const
+{
+	assert(virtPort >= VIRTPORT_1 && virtPort < VIRTPORT_MAX);
+	const IO::Device *const dev = d->ioDevices[virtPort];
+	return (dev != nullptr ? dev->getButtons() : ~0U);
+}
+
 /**
  * Update an I/O device's absolute tablet coordinates.
  * Coordinates must be scaled to 1280x240.
@@ -122,6 +122,13 @@ class IoManager
 		 */
 		void update(int virtPort, uint32_t buttons);
 
+		/**
+		 * Get an I/O device's button state.
+		 * @param virtPort Virtual port.
+		 * @return Button state. (0xFFFFFFFF if no device is connected)
+		 */
+		uint32_t buttons(int virtPort) const;
+
 		/**
 		 * Update an I/O device's absolute tablet coordinates.
 		 * Coordinates must be scaled to 1280x240.
@@ -32,6 +32,7 @@ using LibGensFile::ArchiveFactory;
 using LibGensFile::MemFake;
 
 // C includes. (C++ namespace)
+#include <cerrno>
 #include <cstring>
 #include <cctype>
 #include <cstdio>
@@ -180,6 +181,9 @@ class RomPrivate
 		MD_RomHeader m_mdHeader;
 
 		uint32_t rom_crc32;	// ROM CRC32.
+
+		// Last error. (negative POSIX error code)
+		int lastError;
 };
 
 /**
@@ -204,6 +208,7 @@ RomPrivate::RomPrivate(Rom *q, const char *filename,
 	, romSize(0)
 	, regionCode(0)
 	, rom_crc32(0)
+	, lastError(0)
 {
 	// If filename is nullptr, don't do anything else.
 	if (!filename)
@@ -218,15 +223,17 @@ RomPrivate::RomPrivate(Rom *q, const char *filename,
 
 	// Open the ROM file.
 	file = fopen(filename, "rb");
-	if (!file)
+	if (!file) {
+		lastError = -errno;
 		return;
+	}
 
 	// Open the ROM file as an archive.
 	// TODO: Open from FILE*? (use dup2 or similar)
 	archive = ArchiveFactory::openArchive(filename);
 	if (!archive) {
 		// Couldn't open the ROM file as an archive.
-		// TODO: Indicate that the archive couldn't be opened.
+		lastError = -EIO;
 		fclose(file);
 		file = nullptr;
 		return;
@@ -237,6 +244,7 @@ RomPrivate::RomPrivate(Rom *q, const char *filename,
 	if (ret != 0) { // TODO: MDP_ERR_OK
 		// Error getting the list of files.
 		z_entry_list = nullptr;
+		lastError = -EIO;
 
 		// Delete the archive handler.
 		delete archive;
@@ -283,12 +291,15 @@ RomPrivate::RomPrivate(Rom *q, const uint8_t *rom_data, unsigned int rom_size,
 	, romSize(0)
 	, regionCode(0)
 	, rom_crc32(0)
+	, lastError(0)
 {
 	// TODO: Support decompression from RAM.
 	// For now, use a fake decompressor that provides the same
 	// interface, but just reads from memory.
-	if (!rom_data || rom_size == 0)
+	if (!rom_data || rom_size == 0) {
+		lastError = -EINVAL;
 		return;
+	}
 
 	// "Open" the file using the fake decompressor.
 	archive = new MemFake(rom_data, rom_size);
@@ -298,6 +309,7 @@ RomPrivate::RomPrivate(Rom *q, const uint8_t *rom_data, unsigned int rom_size,
 	if (ret != 0) { // TODO: MDP_ERR_OK
 		// Error getting the list of files.
 		z_entry_list = nullptr;
+		lastError = -EIO;
 
 		// Delete the archive handler.
 		delete archive;
@@ -598,7 +610,7 @@ int RomPrivate::loadRomHeader(Rom::MDP_SYSTEM_ID sysOverride, Rom::RomFormat fmt
 	// If the header size is smaller than the header buffer,
 	// clear the rest of the header buffer.
 	size_t header_size = (size_t)header_size_fo;
-	if (header_size < sizeof(header)) {
+	if (header_size < ROM_HEADER_SIZE) {
 		memset(&header[header_size], 0x00, (ROM_HEADER_SIZE - header_size));
 	}
 
@@ -850,6 +862,15 @@ bool Rom::isOpen(void) const
 	return (d->archive != nullptr);
 }
 
+/**
+ * Get the last error that occurred while opening the ROM.
+ * @return 0 if no error occurred; negative POSIX error code on error.
+ */
+int Rom::lastError(void) const
+{
+	return d->lastError;
+}
+
 /**
  * Close the opened ROM file.
  */
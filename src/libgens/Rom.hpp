@@ -97,6 +97,12 @@ class Rom
 		 */
 		bool isOpen(void) const;
 
+		/**
+		 * Get the last error that occurred while opening the ROM.
+		 * @return 0 if no error occurred; negative POSIX error code on error.
+		 */
+		int lastError(void) const;
+
 		/**
 		 * Close the opened ROM file.
 		 */
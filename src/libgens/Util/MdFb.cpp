@@ -35,6 +35,8 @@ using std::vector;
 
 namespace LibGens {
 
+const uint64_t MdFb::LINE_HASH_INVALID;
+
 MdFb::MdFb()
 	: m_refcnt(1)
 	// Framebuffer parameters.
@@ -84,6 +86,79 @@ void MdFb::reinitFb(void) {
 	for (int y = 0, px = 0; y < m_numLines; y++, px += m_pxPitch) {
 		m_lineNumTable[y] = px;
 	}
+
+	// Line hashes are unknown.
+	m_lineHash.assign(m_numLines, LINE_HASH_INVALID);
+}
+
+/** Line change detection. **/
+
+/**
+ * Rotate a 64-bit value left.
+ * @param x Value.
+ * @param r Number of bits.
+ * @return Rotated value.
+ */
+static inline uint64_t rotl64(uint64_t x, int r)
+{
+	return (x << r) | (x >> (64 - r));
+}
+
+/**
+ * Update the hash of a line.
+ * This must be called after the line is rendered.
+ * @param line Line number.
+ */
+void MdFb::updateLineHash(int line)
+{
+	assert(line >= 0 && line < m_numLines);
+
+	// NOTE: Only the visible pixels are hashed.
+	const size_t pxSize = (m_bpp == BPP_32 ? sizeof(uint32_t) : sizeof(uint16_t));
+	const uint8_t *px = static_cast<const uint8_t*>(m_fb) +
+		((m_lineNumTable[line] + m_pxStart) * pxSize);
+	size_t bytes = (m_pxPerLine * pxSize);
+
+	// xxHash64-style rounds. Each round is a bijection
+	// of the accumulator, so changing any single 64-bit
+	// word always changes the hash. Two accumulators are
+	// used to shorten the multiply dependency chain.
+	static const uint64_t PRIME1 = 0x9E3779B185EBCA87ULL;
+	static const uint64_t PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+	uint64_t h0 = PRIME1;
+	uint64_t h1 = PRIME2;
+	uint64_t w0, w1;
+	for (; bytes >= 16; bytes -= 16, px += 16) {
+		memcpy(&w0, px, sizeof(w0));
+		memcpy(&w1, px + 8, sizeof(w1));
+		h0 = rotl64(h0 + (w0 * PRIME2), 31) * PRIME1;
+		h1 = rotl64(h1 + (w1 * PRIME2), 31) * PRIME1;
+	}
+	while (bytes > 0) {
+		// Remaining pixels. (not normally used)
+		const size_t n = (bytes > sizeof(w0) ? sizeof(w0) : bytes);
+		w0 = 0;
+		memcpy(&w0, px, n);
+		h0 = rotl64(h0 + (w0 * PRIME2), 31) * PRIME1;
+		bytes -= n;
+		px += n;
+	}
+
+	uint64_t h = (h0 ^ rotl64(h1, 27)) * PRIME1;
+	h ^= (h >> 29);
+	if (h == LINE_HASH_INVALID)
+		h = 1;
+	m_lineHash[line] = h;
+}
+
+/**
+ * Update the hashes of all lines.
+ */
+void MdFb::updateLineHashes(void)
+{
+	for (int line = 0; line < m_numLines; line++) {
+		updateLineHash(line);
+	}
 }
 
 /** Convenience functions. **/
@@ -28,6 +28,8 @@
 #include <cstring>
 #include <stdint.h>
 
+#include <algorithm>
+#include <atomic>
 #include <vector>
 
 namespace LibGens {
@@ -42,7 +44,10 @@ class MdFb
 
 	protected:
 		~MdFb();
-		mutable int m_refcnt;	// Allow ref()/unref() even for const MdFb.
+		// Allow ref()/unref() even for const MdFb.
+		// Atomic, since an MdFb may be shared between the
+		// emulation thread and the video backend. (MdFbRing)
+		mutable std::atomic<int> m_refcnt;
 
 	private:
 		// Q_DISABLE_COPY() equivalent.
@@ -76,6 +81,42 @@ class MdFb
 		template<typename pixel> pixel *lineBuf(int line);
 		template<typename pixel> const pixel *lineBuf(int line) const;
 
+		/** Line change detection. **/
+
+		/**
+		 * Invalid line hash.
+		 * Lines with this hash always compare as changed.
+		 */
+		static const uint64_t LINE_HASH_INVALID = 0;
+
+		/**
+		 * Get the hash of a line.
+		 * This can be compared to the hash of the same line
+		 * in a previous frame to check if the line changed.
+		 * @param line Line number.
+		 * @return Line hash, or LINE_HASH_INVALID if unknown.
+		 */
+		uint64_t lineHash(int line) const;
+
+		/**
+		 * Update the hash of a line.
+		 * This must be called after the line is rendered.
+		 * @param line Line number.
+		 */
+		void updateLineHash(int line);
+
+		/**
+		 * Update the hashes of all lines.
+		 */
+		void updateLineHashes(void);
+
+		/**
+		 * Invalidate the hashes of all lines.
+		 * This must be called if the framebuffer is modified
+		 * without updating the line hashes.
+		 */
+		void invalidateLineHashes(void);
+
 		/** Framebuffer access. **/
 
 		/**
@@ -203,6 +244,11 @@ class MdFb
 		 */
 		std::vector<uint32_t> m_lineNumTable;
 
+		/**
+		 * Line hashes.
+		 */
+		std::vector<uint64_t> m_lineHash;
+
 		/**
 		 * Reinitialize the framebuffer.
 		 */
@@ -224,17 +270,14 @@ class MdFb
 
 inline MdFb* MdFb::ref(void) const
 {
-	// TODO: Use atomic access?
 	m_refcnt++;
 	return (MdFb*)this;
 }
 
 inline void MdFb::unref(void) const
 {
-	// TODO: Use atomic access?
 	assert(m_refcnt > 0);
-	m_refcnt--;
-	if (m_refcnt <= 0)
+	if (--m_refcnt <= 0)
 		delete this;
 }
 
@@ -244,6 +287,7 @@ inline void MdFb::unref(void) const
 inline void MdFb::clear(void)
 {
 	memset(m_fb, 0x00, m_fb_sz);
+	invalidateLineHashes();
 }
 
 /** Color depth. **/
@@ -251,7 +295,13 @@ inline void MdFb::clear(void)
 inline MdFb::ColorDepth MdFb::bpp(void) const
 	{ return m_bpp; }
 inline void MdFb::setBpp(ColorDepth bpp)
-	{ m_bpp = bpp; }
+{
+	if (m_bpp == bpp)
+		return;
+	m_bpp = bpp;
+	// Existing lines are now interpreted differently.
+	invalidateLineHashes();
+}
 
 /** Line access. **/
 // TODO: Assert on incorrect color depth.
@@ -336,6 +386,31 @@ inline const pixel *MdFb::lineBuf(int line) const
 		return (pixel*)lineBuf16(line);
 }
 
+/** Line change detection. **/
+
+/**
+ * Get the hash of a line.
+ * This can be compared to the hash of the same line
+ * in a previous frame to check if the line changed.
+ * @param line Line number.
+ * @return Line hash, or LINE_HASH_INVALID if unknown.
+ */
+inline uint64_t MdFb::lineHash(int line) const
+{
+	assert(line >= 0 && line < m_numLines);
+	return m_lineHash[line];
+}
+
+/**
+ * Invalidate the hashes of all lines.
+ * This must be called if the framebuffer is modified
+ * without updating the line hashes.
+ */
+inline void MdFb::invalidateLineHashes(void)
+{
+	std::fill(m_lineHash.begin(), m_lineHash.end(), LINE_HASH_INVALID);
+}
+
 /** Framebuffer access. **/
 
 inline uint16_t *MdFb::fb16(void)
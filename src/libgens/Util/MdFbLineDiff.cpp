@@ -0,0 +1,88 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * MdFbLineDiff.cpp: MdFb line change detection.                           *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "MdFbLineDiff.hpp"
+#include "MdFb.hpp"
+
+namespace LibGens {
+
+MdFbLineDiff::MdFbLineDiff()
+{ }
+
+/**
+ * Forget the last presented frame.
+ * All lines will be reported as changed by the next update().
+ * This should be called if the destination was reallocated.
+ */
+void MdFbLineDiff::reset(void)
+{
+	m_lineHash.clear();
+}
+
+/**
+ * Compare a framebuffer to the last presented frame.
+ * The framebuffer becomes the last presented frame.
+ * @param fb Framebuffer.
+ * @return Number of lines that changed.
+ */
+int MdFbLineDiff::update(const MdFb *fb)
+{
+	const int numLines = fb->numLines();
+	if ((int)m_lineHash.size() != numLines) {
+		// Framebuffer size has changed.
+		m_lineHash.assign(numLines, MdFb::LINE_HASH_INVALID);
+	}
+	m_changed.resize(numLines);
+
+	int count = 0;
+	for (int line = 0; line < numLines; line++) {
+		const uint64_t hash = fb->lineHash(line);
+		const bool changed = (hash == MdFb::LINE_HASH_INVALID ||
+				      hash != m_lineHash[line]);
+		m_changed[line] = changed;
+		m_lineHash[line] = hash;
+		count += changed;
+	}
+	return count;
+}
+
+/**
+ * Find the next run of lines that changed in the last update().
+ * @param line [in/out] Starting line. On return, the first line of the run.
+ * @return Number of lines in the run, or 0 if no more lines changed.
+ */
+int MdFbLineDiff::nextRun(int *line) const
+{
+	const int numLines = (int)m_changed.size();
+	int start = *line;
+	while (start < numLines && !m_changed[start]) {
+		start++;
+	}
+	int end = start;
+	while (end < numLines && m_changed[end]) {
+		end++;
+	}
+
+	*line = start;
+	return (end - start);
+}
+
+}
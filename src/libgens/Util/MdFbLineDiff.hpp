@@ -0,0 +1,100 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * MdFbLineDiff.hpp: MdFb line change detection.                           *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_UTIL_MDFBLINEDIFF_HPP__
+#define __LIBGENS_UTIL_MDFBLINEDIFF_HPP__
+
+// C includes.
+#include <stdint.h>
+
+// C++ includes.
+#include <vector>
+
+namespace LibGens {
+
+class MdFb;
+
+/**
+ * MdFb line change detection.
+ *
+ * Tracks the line hashes of the last frame that was presented
+ * by a video backend, so only lines that changed since then
+ * have to be uploaded or processed.
+ *
+ * NOTE: This tracks the framebuffer contents, not a specific
+ * MdFb object, so it works with MdFbRing.
+ */
+class MdFbLineDiff
+{
+	public:
+		MdFbLineDiff();
+
+	public:
+		/**
+		 * Forget the last presented frame.
+		 * All lines will be reported as changed by the next update().
+		 * This should be called if the destination was reallocated.
+		 */
+		void reset(void);
+
+		/**
+		 * Compare a framebuffer to the last presented frame.
+		 * The framebuffer becomes the last presented frame.
+		 * @param fb Framebuffer.
+		 * @return Number of lines that changed.
+		 */
+		int update(const MdFb *fb);
+
+		/**
+		 * Did a line change in the last update()?
+		 * @param line Line number.
+		 * @return True if the line changed.
+		 */
+		bool isLineChanged(int line) const;
+
+		/**
+		 * Find the next run of lines that changed in the last update().
+		 * @param line [in/out] Starting line. On return, the first line of the run.
+		 * @return Number of lines in the run, or 0 if no more lines changed.
+		 */
+		int nextRun(int *line) const;
+
+	private:
+		// Line hashes of the last presented frame.
+		std::vector<uint64_t> m_lineHash;
+
+		// Lines that changed in the last update().
+		std::vector<uint8_t> m_changed;
+};
+
+/**
+ * Did a line change in the last update()?
+ * @param line Line number.
+ * @return True if the line changed.
+ */
+inline bool MdFbLineDiff::isLineChanged(int line) const
+{
+	return (line >= 0 && line < (int)m_changed.size() && m_changed[line]);
+}
+
+}
+
+#endif /* __LIBGENS_UTIL_MDFBLINEDIFF_HPP__ */
@@ -0,0 +1,81 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * MdFbRing.cpp: Triple-buffered MdFb ring.                                *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "MdFbRing.hpp"
+#include "MdFb.hpp"
+
+namespace LibGens {
+
+const unsigned int MdFbRing::STATE_IDX_MASK;
+const unsigned int MdFbRing::STATE_NEW;
+
+MdFbRing::MdFbRing()
+	: m_back(0)
+	, m_front(2)
+	, m_middle(1)
+{
+	for (int i = 0; i < 3; i++) {
+		m_fb[i] = new MdFb();
+	}
+}
+
+MdFbRing::~MdFbRing()
+{
+	// NOTE: Buffers may still be referenced elsewhere,
+	// e.g. by the VDP or by a video backend.
+	for (int i = 0; i < 3; i++) {
+		m_fb[i]->unref();
+	}
+}
+
+/**
+ * Publish the back buffer.
+ * The back buffer becomes the middle buffer, and the
+ * previous middle buffer becomes the new back buffer.
+ */
+void MdFbRing::publish(void)
+{
+	// Release: The reader must see the completed frame.
+	// Acquire: The reader must be done with the old front
+	// buffer if it was swapped into the middle.
+	const unsigned int prev = m_middle.exchange(
+		m_back | STATE_NEW, std::memory_order_acq_rel);
+	m_back = (prev & STATE_IDX_MASK);
+}
+
+/**
+ * Acquire the most recently published frame.
+ * If no new frame is available, the current
+ * front buffer is returned again.
+ * @return Front buffer.
+ */
+MdFb *MdFbRing::acquire(void)
+{
+	if (m_middle.load(std::memory_order_relaxed) & STATE_NEW) {
+		// New frame. Swap it with the front buffer.
+		const unsigned int prev = m_middle.exchange(
+			m_front, std::memory_order_acq_rel);
+		m_front = (prev & STATE_IDX_MASK);
+	}
+	return m_fb[m_front];
+}
+
+}
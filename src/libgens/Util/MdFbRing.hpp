@@ -0,0 +1,143 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * MdFbRing.hpp: Triple-buffered MdFb ring.                                *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_UTIL_MDFBRING_HPP__
+#define __LIBGENS_UTIL_MDFBRING_HPP__
+
+// C++ includes.
+#include <atomic>
+
+namespace LibGens {
+
+class MdFb;
+
+/**
+ * Triple-buffered MdFb ring.
+ *
+ * The ring has three MdFb objects:
+ * - Back: Owned by the writer. (emulation thread)
+ * - Front: Owned by the reader. (video backend)
+ * - Middle: The most recently published frame.
+ *
+ * publish() swaps the back and middle buffers; acquire() swaps
+ * the middle and front buffers if a new frame was published.
+ * Both swaps are a single atomic exchange, so the writer can
+ * render frame N+1 while the reader uploads frame N without
+ * locking and without tearing.
+ *
+ * Only one thread may call the writer functions, and only one
+ * thread may call the reader functions.
+ */
+class MdFbRing
+{
+	public:
+		MdFbRing();
+		~MdFbRing();
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		MdFbRing(const MdFbRing &);
+		MdFbRing &operator=(const MdFbRing &);
+
+	public:
+		/** Writer functions. **/
+
+		/**
+		 * Get the back buffer.
+		 * The writer renders the next frame into this buffer.
+		 * @return Back buffer.
+		 */
+		MdFb *writeFb(void) const;
+
+		/**
+		 * Publish the back buffer.
+		 * The back buffer becomes the middle buffer, and the
+		 * previous middle buffer becomes the new back buffer.
+		 */
+		void publish(void);
+
+		/** Reader functions. **/
+
+		/**
+		 * Has a frame been published since the last acquire()?
+		 * @return True if a new frame is available.
+		 */
+		bool hasNewFrame(void) const;
+
+		/**
+		 * Acquire the most recently published frame.
+		 * If no new frame is available, the current
+		 * front buffer is returned again.
+		 * @return Front buffer.
+		 */
+		MdFb *acquire(void);
+
+		/**
+		 * Get the front buffer.
+		 * @return Front buffer.
+		 */
+		MdFb *readFb(void) const;
+
+	private:
+		// Buffers.
+		MdFb *m_fb[3];
+
+		// Back buffer index. (writer only)
+		unsigned int m_back;
+		// Front buffer index. (reader only)
+		unsigned int m_front;
+
+		/**
+		 * Middle buffer index.
+		 * Bits 0-1: Buffer index.
+		 * Bit 2: New frame flag. (STATE_NEW)
+		 */
+		std::atomic<unsigned int> m_middle;
+		static const unsigned int STATE_IDX_MASK = 3;
+		static const unsigned int STATE_NEW = 4;
+};
+
+/**
+ * Get the back buffer.
+ * The writer renders the next frame into this buffer.
+ * @return Back buffer.
+ */
+inline MdFb *MdFbRing::writeFb(void) const
+	{ return m_fb[m_back]; }
+
+/**
+ * Has a frame been published since the last acquire()?
+ * @return True if a new frame is available.
+ */
+inline bool MdFbRing::hasNewFrame(void) const
+	{ return !!(m_middle.load(std::memory_order_acquire) & STATE_NEW); }
+
+/**
+ * Get the front buffer.
+ * @return Front buffer.
+ */
+inline MdFb *MdFbRing::readFb(void) const
+	{ return m_fb[m_front]; }
+
+}
+
+#endif /* __LIBGENS_UTIL_MDFBRING_HPP__ */
@@ -0,0 +1,636 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * Movie.cpp: Input movie recording and playback.                          *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "Movie.hpp"
+#include "EmuContext/EmuContext.hpp"
+#include "IO/IoManager.hpp"
+#include "cpu/M68K_Mem.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Rom.hpp"
+#include "macros/common.h"
+
+#include "libcompat/byteswap.h"
+
+#ifdef _WIN32
+// Win32 Unicode Translation Layer.
+// Needed for proper Unicode filename support on Windows.
+#include "libcompat/W32U/W32U_mini.h"
+#endif
+
+// zlib: crc32()
+#include <zlib.h>
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens {
+
+class MoviePrivate
+{
+	public:
+		MoviePrivate();
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		MoviePrivate(const MoviePrivate &);
+		MoviePrivate &operator=(const MoviePrivate &);
+
+	public:
+		/**
+		 * Movie file header.
+		 * All fields are little-endian.
+		 * The header is followed by:
+		 * - Starting savestate. (stateSize bytes)
+		 *   This is a portable in-memory ZOMG savestate;
+		 *   see EmuContext::saveStateToBuffer().
+		 * - Encoded inputs. (inputSize bytes)
+		 * - State hashes. (hashCount uint32_t values)
+		 */
+		struct Header {
+			char magic[8];		// "GSIIMOV\0"
+			uint32_t version;	// File version.
+			uint32_t romCrc32;	// CRC32 of the ROM.
+			uint32_t hashInterval;	// Frames between state hashes.
+			uint32_t frameCount;	// Number of frames.
+			uint32_t stateSize;	// Size of the starting savestate.
+			uint32_t inputSize;	// Size of the encoded inputs.
+			uint32_t hashCount;	// Number of state hashes.
+			uint8_t devTypes[28];	// IoManager::IoType_t for each virtual port.
+		};
+
+		static const char MAGIC[8];
+		static const uint32_t VERSION = 2;
+
+		// Controller types. Only ports with a device are recorded.
+		uint8_t devTypes[IoManager::VIRTPORT_MAX];
+		int ports[IoManager::VIRTPORT_MAX];
+		int portCount;
+
+		/**
+		 * Determine the recorded ports from devTypes[].
+		 */
+		void updatePorts(void);
+
+		uint32_t romCrc32;
+		int hashInterval;
+		vector<uint8_t> state;		// Starting savestate.
+		vector<uint32_t> buttons;	// Buttons. (portCount values per frame)
+		vector<uint32_t> hashes;	// State hashes.
+
+		int frameCount;
+		int frame;
+		int desyncFrame;
+
+		/**
+		 * Encode the buttons.
+		 * Identical consecutive frames are stored as a single run:
+		 * a varint run length, followed by a varint of the
+		 * inverted (active-high) buttons for each port.
+		 * @param out Output buffer.
+		 */
+		void encodeButtons(vector<uint8_t> &out) const;
+
+		/**
+		 * Decode the buttons.
+		 * @param in Encoded buttons.
+		 * @param size Size of in.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int decodeButtons(const uint8_t *in, size_t size);
+
+		static void writeVarint(vector<uint8_t> &out, uint32_t value);
+		static int readVarint(const uint8_t **p, const uint8_t *end, uint32_t *value);
+};
+
+const char MoviePrivate::MAGIC[8] = {'G','S','I','I','M','O','V','\0'};
+
+MoviePrivate::MoviePrivate()
+	: portCount(0)
+	, romCrc32(0)
+	, hashInterval(60)
+	, frameCount(0)
+	, frame(0)
+	, desyncFrame(-1)
+{
+	memset(devTypes, 0, sizeof(devTypes));
+	memset(ports, 0, sizeof(ports));
+}
+
+/**
+ * Determine the recorded ports from devTypes[].
+ */
+void MoviePrivate::updatePorts(void)
+{
+	portCount = 0;
+	for (int i = 0; i < IoManager::VIRTPORT_MAX; i++) {
+		if (devTypes[i] != IoManager::IOT_NONE) {
+			ports[portCount++] = i;
+		}
+	}
+}
+
+void MoviePrivate::writeVarint(vector<uint8_t> &out, uint32_t value)
+{
+	while (value >= 0x80) {
+		out.push_back((uint8_t)(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back((uint8_t)value);
+}
+
+int MoviePrivate::readVarint(const uint8_t **p, const uint8_t *end, uint32_t *value)
+{
+	uint32_t v = 0;
+	for (int shift = 0; shift < 35; shift += 7) {
+		if (*p >= end)
+			return -EINVAL;
+		const uint8_t b = *(*p)++;
+		v |= (uint32_t)(b & 0x7F) << shift;
+		if (!(b & 0x80)) {
+			*value = v;
+			return 0;
+		}
+	}
+	return -EINVAL;
+}
+
+/**
+ * Encode the buttons.
+ * @param out Output buffer.
+ */
+void MoviePrivate::encodeButtons(vector<uint8_t> &out) const
+{
+	out.clear();
+	if (portCount == 0)
+		return;
+
+	int frm = 0;
+	while (frm < frameCount) {
+		const uint32_t *cur = &buttons[frm * portCount];
+		int run = 1;
+		while (frm + run < frameCount &&
+		       !memcmp(cur, &buttons[(frm + run) * portCount], portCount * sizeof(uint32_t)))
+		{
+			run++;
+		}
+
+		writeVarint(out, run);
+		for (int i = 0; i < portCount; i++) {
+			// Buttons are active-low, so invert them.
+			// Released buttons then encode as 0.
+			writeVarint(out, ~cur[i]);
+		}
+		frm += run;
+	}
+}
+
+/**
+ * Decode the buttons.
+ * @param in Encoded buttons.
+ * @param size Size of in.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int MoviePrivate::decodeButtons(const uint8_t *in, size_t size)
+{
+	buttons.clear();
+	if (portCount == 0)
+		return (size == 0 ? 0 : -EINVAL);
+
+	// NOTE: Don't reserve frameCount entries up front.
+	// frameCount comes from the file, so it can't be trusted
+	// until the encoded inputs have been decoded.
+	const uint8_t *p = in;
+	const uint8_t *const end = in + size;
+	int frm = 0;
+	while (p < end) {
+		uint32_t run;
+		int ret = readVarint(&p, end, &run);
+		if (ret != 0)
+			return ret;
+		if (run == 0 || run > (uint32_t)(frameCount - frm))
+			return -EINVAL;
+
+		uint32_t cur[IoManager::VIRTPORT_MAX];
+		for (int i = 0; i < portCount; i++) {
+			ret = readVarint(&p, end, &cur[i]);
+			if (ret != 0)
+				return ret;
+			cur[i] = ~cur[i];
+		}
+		for (; run > 0; run--, frm++) {
+			buttons.insert(buttons.end(), cur, cur + portCount);
+		}
+	}
+
+	return (frm == frameCount ? 0 : -EINVAL);
+}
+
+/** Movie **/
+
+Movie::Movie()
+	: d(new MoviePrivate())
+{ }
+
+Movie::~Movie()
+{
+	delete d;
+}
+
+/**
+ * Discard the movie.
+ */
+void Movie::clear(void)
+{
+	memset(d->devTypes, 0, sizeof(d->devTypes));
+	d->portCount = 0;
+	d->romCrc32 = 0;
+	d->state.clear();
+	d->buttons.clear();
+	d->hashes.clear();
+	d->frameCount = 0;
+	d->frame = 0;
+	d->desyncFrame = -1;
+}
+
+/** File functions. **/
+
+/**
+ * Load a movie from a file.
+ * @param filename Movie filename.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Movie::load(const char *filename)
+{
+	clear();
+
+	FILE *f = fopen(filename, "rb");
+	if (!f)
+		return (errno != 0 ? -errno : -EIO);
+
+	MoviePrivate::Header header;
+	int ret = 0;
+	if (fread(&header, 1, sizeof(header), f) != sizeof(header) ||
+	    memcmp(header.magic, MoviePrivate::MAGIC, sizeof(header.magic)) != 0 ||
+	    le32_to_cpu(header.version) != MoviePrivate::VERSION)
+	{
+		// Not a movie file, or an unsupported version.
+		ret = -EINVAL;
+	}
+
+	const uint32_t hashInterval = le32_to_cpu(header.hashInterval);
+	const uint32_t frameCount = le32_to_cpu(header.frameCount);
+	const uint32_t stateSize = le32_to_cpu(header.stateSize);
+	const uint32_t inputSize = le32_to_cpu(header.inputSize);
+	const uint32_t hashCount = le32_to_cpu(header.hashCount);
+	if (ret == 0 &&
+	    (hashInterval == 0 || frameCount > 0x7FFFFFFF ||
+	     hashCount != frameCount / hashInterval ||
+	     stateSize == 0 || stateSize > 64*1024*1024 ||
+	     inputSize > 64*1024*1024))
+	{
+		// Invalid header.
+		ret = -EINVAL;
+	}
+
+	if (ret == 0) {
+		// Make sure the file actually contains the data
+		// before allocating buffers for it.
+		const long pos = ftell(f);
+		long fileSize = -1;
+		if (pos >= 0 && fseek(f, 0, SEEK_END) == 0) {
+			fileSize = ftell(f);
+			if (fseek(f, pos, SEEK_SET) != 0)
+				fileSize = -1;
+		}
+		const uint64_t dataSize = (uint64_t)stateSize + inputSize +
+					  ((uint64_t)hashCount * sizeof(uint32_t));
+		if (fileSize < pos || (uint64_t)(fileSize - pos) < dataSize) {
+			// File is truncated.
+			ret = -EINVAL;
+		}
+	}
+
+	vector<uint8_t> input;
+	if (ret == 0) {
+		d->romCrc32 = le32_to_cpu(header.romCrc32);
+		d->hashInterval = (int)hashInterval;
+		d->frameCount = (int)frameCount;
+		memcpy(d->devTypes, header.devTypes, sizeof(d->devTypes));
+		d->updatePorts();
+
+		d->state.resize(stateSize);
+		input.resize(inputSize);
+		d->hashes.resize(hashCount);
+		if (fread(d->state.data(), 1, stateSize, f) != stateSize ||
+		    fread(input.data(), 1, inputSize, f) != inputSize ||
+		    fread(d->hashes.data(), sizeof(uint32_t), hashCount, f) != hashCount)
+		{
+			// Short read.
+			ret = -EINVAL;
+		}
+	}
+	fclose(f);
+
+	if (ret == 0) {
+		for (size_t i = 0; i < d->hashes.size(); i++) {
+			d->hashes[i] = le32_to_cpu(d->hashes[i]);
+		}
+		ret = d->decodeButtons(input.data(), input.size());
+	}
+
+	if (ret != 0) {
+		clear();
+	}
+	return ret;
+}
+
+/**
+ * Save the movie to a file.
+ * @param filename Movie filename.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Movie::save(const char *filename) const
+{
+	if (d->state.empty()) {
+		// Nothing has been recorded.
+		return -ENOENT;
+	}
+
+	vector<uint8_t> input;
+	d->encodeButtons(input);
+
+	MoviePrivate::Header header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, MoviePrivate::MAGIC, sizeof(header.magic));
+	header.version = cpu_to_le32(MoviePrivate::VERSION);
+	header.romCrc32 = cpu_to_le32(d->romCrc32);
+	header.hashInterval = cpu_to_le32(d->hashInterval);
+	header.frameCount = cpu_to_le32(d->frameCount);
+	header.stateSize = cpu_to_le32((uint32_t)d->state.size());
+	header.inputSize = cpu_to_le32((uint32_t)input.size());
+	header.hashCount = cpu_to_le32((uint32_t)d->hashes.size());
+	memcpy(header.devTypes, d->devTypes, sizeof(d->devTypes));
+
+	vector<uint32_t> hashes(d->hashes);
+	for (size_t i = 0; i < hashes.size(); i++) {
+		hashes[i] = cpu_to_le32(hashes[i]);
+	}
+
+	FILE *f = fopen(filename, "wb");
+	if (!f)
+		return (errno != 0 ? -errno : -EIO);
+
+	int ret = 0;
+	if (fwrite(&header, 1, sizeof(header), f) != sizeof(header) ||
+	    fwrite(d->state.data(), 1, d->state.size(), f) != d->state.size() ||
+	    fwrite(input.data(), 1, input.size(), f) != input.size() ||
+	    fwrite(hashes.data(), sizeof(uint32_t), hashes.size(), f) != hashes.size())
+	{
+		ret = (errno != 0 ? -errno : -EIO);
+	}
+	if (fclose(f) != 0 && ret == 0) {
+		ret = (errno != 0 ? -errno : -EIO);
+	}
+	return ret;
+}
+
+/** Recording. **/
+
+/**
+ * Start recording a movie from the current emulation state.
+ * Any existing movie is discarded.
+ * @param context Emulation context.
+ * @param hashInterval Hash 68K RAM and VRAM every hashInterval frames.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Movie::startRecording(const EmuContext *context, int hashInterval)
+{
+	clear();
+	if (hashInterval <= 0)
+		return -EINVAL;
+
+	int ret = context->saveStateToBuffer(nullptr, 0);
+	if (ret < 0)
+		return ret;
+	d->state.resize(ret);
+	ret = context->saveStateToBuffer(d->state.data(), d->state.size());
+	if (ret < 0) {
+		clear();
+		return ret;
+	}
+	d->state.resize(ret);
+
+	const IoManager *const ioManager = context->m_ioManager;
+	for (int i = 0; i < IoManager::VIRTPORT_MAX; i++) {
+		d->devTypes[i] = (uint8_t)ioManager->devType((IoManager::VirtPort_t)i);
+	}
+	d->updatePorts();
+
+	d->romCrc32 = (context->rom() ? context->rom()->rom_crc32() : 0);
+	d->hashInterval = hashInterval;
+	return 0;
+}
+
+/**
+ * Record the frame that was just run.
+ * @param context Emulation context.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Movie::recordFrame(const EmuContext *context)
+{
+	if (d->state.empty()) {
+		// Not recording.
+		return -EINVAL;
+	}
+
+	const IoManager *const ioManager = context->m_ioManager;
+	for (int i = 0; i < d->portCount; i++) {
+		d->buttons.push_back(ioManager->buttons(d->ports[i]));
+	}
+
+	d->frameCount++;
+	d->frame = d->frameCount;
+	if (d->frameCount % d->hashInterval == 0) {
+		d->hashes.push_back(StateHash(context));
+	}
+	return 0;
+}
+
+/** Playback. **/
+
+/**
+ * Start playing the movie.
+ * This loads the starting savestate and sets up the controllers.
+ * @param context Emulation context.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int Movie::startPlayback(EmuContext *context)
+{
+	if (d->state.empty()) {
+		// No movie is loaded.
+		return -ENOENT;
+	}
+	if (context->rom() && d->romCrc32 != context->rom()->rom_crc32()) {
+		// Movie was recorded with a different ROM.
+		return -EINVAL;
+	}
+
+	// Set up the controllers.
+	// Multitaps must be set up before their ports.
+	IoManager *const ioManager = context->m_ioManager;
+	for (int i = 0; i < IoManager::VIRTPORT_MAX; i++) {
+		if (i <= IoManager::VIRTPORT_EXT || d->devTypes[i] != IoManager::IOT_NONE) {
+			ioManager->setDevType((IoManager::VirtPort_t)i,
+				(IoManager::IoType_t)d->devTypes[i]);
+		}
+	}
+
+	int ret = context->loadStateFromBuffer(d->state.data(), d->state.size());
+	if (ret != 0)
+		return ret;
+
+	d->frame = 0;
+	d->desyncFrame = -1;
+	return 0;
+}
+
+/**
+ * Set the controller buttons for the next frame.
+ * @param context Emulation context.
+ * @return 0 on success; -ENOENT if the movie has ended.
+ */
+int Movie::playFrame(EmuContext *context)
+{
+	if (d->frame >= d->frameCount)
+		return -ENOENT;
+
+	IoManager *const ioManager = context->m_ioManager;
+	const uint32_t *cur = &d->buttons[d->frame * d->portCount];
+	for (int i = 0; i < d->portCount; i++) {
+		ioManager->update(d->ports[i], cur[i]);
+	}
+	return 0;
+}
+
+/**
+ * Verify the frame that was just run.
+ * @param context Emulation context.
+ * @return 0 if the frame matches or has no hash; -EILSEQ on desync; -ENOENT if the movie has ended.
+ */
+int Movie::verifyFrame(const EmuContext *context)
+{
+	if (d->frame >= d->frameCount)
+		return -ENOENT;
+
+	const int frm = d->frame++;
+	if (d->frame % d->hashInterval != 0)
+		return 0;
+
+	const uint32_t hash = StateHash(context);
+	if (hash == d->hashes[(d->frame / d->hashInterval) - 1])
+		return 0;
+
+	// Desync. The state was last known to match
+	// hashInterval frames ago, so this frame is
+	// where the desync was detected.
+	if (d->desyncFrame < 0) {
+		d->desyncFrame = frm;
+	}
+	return -EILSEQ;
+}
+
+/** Properties. **/
+
+/**
+ * Get the number of frames in the movie.
+ * @return Number of frames.
+ */
+int Movie::frameCount(void) const
+{
+	return d->frameCount;
+}
+
+/**
+ * Get the current frame number.
+ * This is the number of frames recorded or verified so far.
+ * @return Current frame number.
+ */
+int Movie::frame(void) const
+{
+	return d->frame;
+}
+
+/**
+ * Get the hash interval.
+ * @return Number of frames between hashes.
+ */
+int Movie::hashInterval(void) const
+{
+	return d->hashInterval;
+}
+
+/**
+ * Get the first frame that didn't match the recording.
+ * @return Frame number, or -1 if playback hasn't desynced.
+ */
+int Movie::desyncFrame(void) const
+{
+	return d->desyncFrame;
+}
+
+/**
+ * Hash the emulation state that movies verify. (68K RAM and VRAM)
+ * Both are hashed as little-endian 16-bit words so the
+ * hash doesn't depend on the host byte order.
+ * @param context Emulation context.
+ * @return CRC32.
+ */
+uint32_t Movie::StateHash(const EmuContext *context)
+{
+	uint16_t buf[2048];
+	uLong crc = crc32(0, nullptr, 0);
+
+	// 68K RAM.
+	const uint16_t *ram = context->m_m68kMem->Ram_68k.u16;
+	for (unsigned int i = 0; i < ARRAY_SIZE(context->m_m68kMem->Ram_68k.u16); i += ARRAY_SIZE(buf)) {
+		memcpy(buf, &ram[i], sizeof(buf));
+		cpu_to_le16_array(buf, sizeof(buf));
+		crc = crc32(crc, reinterpret_cast<const Bytef*>(buf), sizeof(buf));
+	}
+
+	// VRAM.
+	for (uint32_t address = 0; address < 0x10000; address += sizeof(buf)) {
+		context->m_vdp->dbg_readVRam_16(address, buf, sizeof(buf));
+		cpu_to_le16_array(buf, sizeof(buf));
+		crc = crc32(crc, reinterpret_cast<const Bytef*>(buf), sizeof(buf));
+	}
+
+	return (uint32_t)crc;
+}
+
+}
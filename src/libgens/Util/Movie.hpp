@@ -0,0 +1,178 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * Movie.hpp: Input movie recording and playback.                          *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_UTIL_MOVIE_HPP__
+#define __LIBGENS_UTIL_MOVIE_HPP__
+
+#include <libgens/config.libgens.h>
+
+// C includes.
+#include <stdint.h>
+
+namespace LibGens {
+
+class EmuContext;
+
+/**
+ * Input movie.
+ *
+ * A movie contains a savestate of the starting point, the
+ * controller buttons for every frame, and a hash of 68K RAM
+ * and VRAM every hashInterval() frames. Playing a movie back
+ * must reproduce the same hashes; if it doesn't, emulation
+ * has changed, and desyncFrame() reports where.
+ *
+ * Recording:
+ * - startRecording() before the first frame.
+ * - recordFrame() after each frame is run.
+ * - save() when done.
+ *
+ * Playback:
+ * - load(), then startPlayback().
+ * - playFrame() before each frame is run.
+ * - verifyFrame() after each frame is run.
+ *
+ * Frames may be run with either execFrame() or execFrameFast().
+ *
+ * NOTE: Movies should be recorded from power-on. ZOMG savestates
+ * don't include all of the emulation state (e.g. the 68K cycle
+ * counters), so a movie started mid-game may desync on playback.
+ *
+ * TODO: Absolute positioning devices aren't recorded.
+ */
+class MoviePrivate;
+class Movie
+{
+	public:
+		Movie();
+		~Movie();
+
+	protected:
+		friend class MoviePrivate;
+		MoviePrivate *const d;
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		Movie(const Movie &);
+		Movie &operator=(const Movie &);
+
+	public:
+		/**
+		 * Discard the movie.
+		 */
+		void clear(void);
+
+		/** File functions. **/
+
+		/**
+		 * Load a movie from a file.
+		 * @param filename Movie filename.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int load(const char *filename);
+
+		/**
+		 * Save the movie to a file.
+		 * @param filename Movie filename.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int save(const char *filename) const;
+
+		/** Recording. **/
+
+		/**
+		 * Start recording a movie from the current emulation state.
+		 * Any existing movie is discarded.
+		 * @param context Emulation context.
+		 * @param hashInterval Hash 68K RAM and VRAM every hashInterval frames.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int startRecording(const EmuContext *context, int hashInterval = 60);
+
+		/**
+		 * Record the frame that was just run.
+		 * @param context Emulation context.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int recordFrame(const EmuContext *context);
+
+		/** Playback. **/
+
+		/**
+		 * Start playing the movie.
+		 * This loads the starting savestate and sets up the controllers.
+		 * @param context Emulation context.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int startPlayback(EmuContext *context);
+
+		/**
+		 * Set the controller buttons for the next frame.
+		 * @param context Emulation context.
+		 * @return 0 on success; -ENOENT if the movie has ended.
+		 */
+		int playFrame(EmuContext *context);
+
+		/**
+		 * Verify the frame that was just run.
+		 * @param context Emulation context.
+		 * @return 0 if the frame matches or has no hash; -EILSEQ on desync; -ENOENT if the movie has ended.
+		 */
+		int verifyFrame(const EmuContext *context);
+
+		/** Properties. **/
+
+		/**
+		 * Get the number of frames in the movie.
+		 * @return Number of frames.
+		 */
+		int frameCount(void) const;
+
+		/**
+		 * Get the current frame number.
+		 * This is the number of frames recorded or verified so far.
+		 * @return Current frame number.
+		 */
+		int frame(void) const;
+
+		/**
+		 * Get the hash interval.
+		 * @return Number of frames between hashes.
+		 */
+		int hashInterval(void) const;
+
+		/**
+		 * Get the first frame that didn't match the recording.
+		 * @return Frame number, or -1 if playback hasn't desynced.
+		 */
+		int desyncFrame(void) const;
+
+		/**
+		 * Hash the emulation state that movies verify. (68K RAM and VRAM)
+		 * @param context Emulation context.
+		 * @return CRC32.
+		 */
+		static uint32_t StateHash(const EmuContext *context);
+};
+
+}
+
+#endif /* __LIBGENS_UTIL_MOVIE_HPP__ */
@@ -0,0 +1,77 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * Profiler.cpp: Per-frame profiling counters.                             *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "Profiler.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+
+namespace LibGens {
+
+/**
+ * Format the last frame's counters for an onscreen display.
+ * @param buf Output buffer.
+ * @param size Size of buf.
+ * @return Number of characters written. (0 if the profiler is disabled.)
+ */
+int ProfilerT<false>::format(char *buf, size_t size) const
+{
+	if (size > 0)
+		buf[0] = 0;
+	return 0;
+}
+
+/**
+ * Format the last frame's counters for an onscreen display.
+ * Lines are kept under 38 characters for a 320-pixel OSD.
+ * @param buf Output buffer.
+ * @param size Size of buf.
+ * @return Number of characters written.
+ */
+int ProfilerT<true>::format(char *buf, size_t size) const
+{
+	// Times are displayed in microseconds.
+	#define US(section) ((double)m_last[(section)] / 1000.0)
+	int ret = snprintf(buf, size,
+		"Frame:  %8.1f us\n"
+		"M68K:   %8.1f us  %6u/%6u cyc\n"
+		"Z80:    %8.1f us  %6u/%6u cyc\n"
+		"VDP:    %8.1f us  %3u lines\n"
+		"YM2612: %8.1f us  %4u smp\n"
+		"PSG:    %8.1f us  %4u smp\n"
+		"I/O:    %8.1f us\n"
+		"DMA:    %8u cyc",
+		(double)m_lastFrameTime / 1000.0,
+		US(PROF_M68K), m_cntLast[CNT_M68K_CYCLES], m_cntLast[CNT_M68K_BUDGET],
+		US(PROF_Z80), m_cntLast[CNT_Z80_CYCLES], m_cntLast[CNT_Z80_BUDGET],
+		US(PROF_VDP), m_cntLast[CNT_LINES_RENDERED],
+		US(PROF_YM2612), m_cntLast[CNT_YM2612_SAMPLES],
+		US(PROF_PSG), m_cntLast[CNT_PSG_SAMPLES],
+		US(PROF_IO),
+		m_cntLast[CNT_DMA_CYCLES]);
+	#undef US
+
+	if (ret < 0)
+		return 0;
+	return ((size_t)ret >= size ? (int)size - 1 : ret);
+}
+
+}
@@ -0,0 +1,318 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * Profiler.hpp: Per-frame profiling counters.                             *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_UTIL_PROFILER_HPP__
+#define __LIBGENS_UTIL_PROFILER_HPP__
+
+#include <libgens/config.libgens.h>
+
+#include <cassert>
+#include <cstring>
+#include <stdint.h>
+
+#include "Timing.hpp"
+
+namespace LibGens {
+
+/**
+ * Profiler sections.
+ * Shared by all ProfilerT<> specializations.
+ */
+class ProfilerBase
+{
+	public:
+		enum Section {
+			PROF_M68K,	// M68K::exec()
+			PROF_Z80,	// Z80::exec()
+			PROF_VDP,	// Vdp::renderLine()
+			PROF_YM2612,	// Ym2612::update(), updateDacAndTimers()
+			PROF_PSG,	// Psg::update()
+			PROF_IO,	// IoManager::doScanline()
+
+			PROF_MAX
+		};
+
+		enum Counter {
+			CNT_M68K_CYCLES,	// 68000 cycles executed. (odometer)
+			CNT_M68K_BUDGET,	// 68000 cycles budgeted. (Cycles_M68K)
+			CNT_Z80_CYCLES,		// Z80 cycles executed. (odometer)
+			CNT_Z80_BUDGET,		// Z80 cycles budgeted. (Cycles_Z80)
+			CNT_DMA_CYCLES,		// 68000 cycles charged by Vdp::updateDMA().
+			CNT_LINES_RENDERED,	// Lines rendered by Vdp::renderLine().
+			CNT_YM2612_SAMPLES,	// Samples generated by Ym2612::update().
+			CNT_PSG_SAMPLES,	// Samples generated by Psg::update().
+
+			CNT_MAX
+		};
+
+		/**
+		 * Get the name of a profiler section.
+		 * @param section Section.
+		 * @return Section name. (ASCII)
+		 */
+		static inline const char *SectionName(Section section)
+		{
+			static const char *const names[PROF_MAX] = {
+				"m68k", "z80", "vdp", "ym2612", "psg", "io"
+			};
+			return ((unsigned int)section < PROF_MAX ? names[section] : nullptr);
+		}
+
+		/**
+		 * Get the name of a profiler counter.
+		 * @param counter Counter.
+		 * @return Counter name. (ASCII)
+		 */
+		static inline const char *CounterName(Counter counter)
+		{
+			static const char *const names[CNT_MAX] = {
+				"m68k_cycles", "m68k_budget",
+				"z80_cycles", "z80_budget",
+				"dma_cycles", "lines_rendered",
+				"ym2612_samples", "psg_samples"
+			};
+			return ((unsigned int)counter < CNT_MAX ? names[counter] : nullptr);
+		}
+};
+
+/**
+ * Per-frame profiling counters.
+ * ProfilerT<false> is a no-op and is optimized out entirely.
+ * ProfilerT<true> records host time spent in each section,
+ * as well as cycle, line, and sample counts.
+ *
+ * Section times are exclusive: if a section is entered while
+ * another section is active (e.g. a YM2612 update triggered by
+ * a 68000 write), the nested time is only counted once.
+ */
+template<bool Enabled>
+class ProfilerT;
+
+template<>
+class ProfilerT<false> : public ProfilerBase
+{
+	public:
+		static const bool IsEnabled = false;
+
+		inline void startFrame(void) { }
+		inline void endFrame(void) { }
+		inline void enter(Section) { }
+		inline void leave(void) { }
+
+		inline void add(Counter, unsigned int) { }
+		inline void set(Counter, unsigned int) { }
+
+		inline uint64_t frameTime(void) const { return 0; }
+		inline uint64_t sectionTime(Section) const { return 0; }
+		inline unsigned int counter(Counter) const { return 0; }
+
+		/**
+		 * Format the last frame's counters for an onscreen display.
+		 * @param buf Output buffer.
+		 * @param size Size of buf.
+		 * @return Number of characters written. (0 if the profiler is disabled.)
+		 */
+		int format(char *buf, size_t size) const;
+
+		class Scope
+		{
+			public:
+				inline Scope(ProfilerT *, Section) { }
+		};
+};
+
+template<>
+class ProfilerT<true> : public ProfilerBase
+{
+	public:
+		ProfilerT()
+			: m_depth(0)
+			, m_stamp(0)
+			, m_frameStart(0)
+			, m_lastFrameTime(0)
+		{
+			memset(m_cur, 0, sizeof(m_cur));
+			memset(m_last, 0, sizeof(m_last));
+			memset(m_cntCur, 0, sizeof(m_cntCur));
+			memset(m_cntLast, 0, sizeof(m_cntLast));
+		}
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		ProfilerT(const ProfilerT &);
+		ProfilerT &operator=(const ProfilerT &);
+
+	public:
+		static const bool IsEnabled = true;
+
+		/**
+		 * Start a new frame.
+		 * Counters for the current frame are reset.
+		 */
+		inline void startFrame(void)
+		{
+			memset(m_cur, 0, sizeof(m_cur));
+			memset(m_cntCur, 0, sizeof(m_cntCur));
+			m_depth = 0;
+			m_frameStart = m_timing.getTimeNs();
+			m_stamp = m_frameStart;
+		}
+
+		/**
+		 * End the current frame.
+		 * The frame's counters become the "last frame" values.
+		 */
+		inline void endFrame(void)
+		{
+			memcpy(m_last, m_cur, sizeof(m_last));
+			memcpy(m_cntLast, m_cntCur, sizeof(m_cntLast));
+			m_lastFrameTime = m_timing.getTimeNs() - m_frameStart;
+		}
+
+		/**
+		 * Enter a section.
+		 * @param section Section.
+		 */
+		inline void enter(Section section)
+		{
+			const uint64_t now = m_timing.getTimeNs();
+			if (m_depth > 0) {
+				m_cur[m_stack[m_depth-1]] += (now - m_stamp);
+			}
+			assert(m_depth < MAX_DEPTH);
+			m_stack[m_depth++] = section;
+			m_stamp = now;
+		}
+
+		/**
+		 * Leave the current section.
+		 */
+		inline void leave(void)
+		{
+			const uint64_t now = m_timing.getTimeNs();
+			assert(m_depth > 0);
+			m_cur[m_stack[--m_depth]] += (now - m_stamp);
+			m_stamp = now;
+		}
+
+		/**
+		 * Add to a counter.
+		 * @param counter Counter.
+		 * @param value Value to add.
+		 */
+		inline void add(Counter counter, unsigned int value)
+			{ m_cntCur[counter] += value; }
+
+		/**
+		 * Set a counter.
+		 * @param counter Counter.
+		 * @param value New value.
+		 */
+		inline void set(Counter counter, unsigned int value)
+			{ m_cntCur[counter] = value; }
+
+		/**
+		 * Get the total host time of the last frame.
+		 * @return Time, in nanoseconds.
+		 */
+		inline uint64_t frameTime(void) const
+			{ return m_lastFrameTime; }
+
+		/**
+		 * Get the host time spent in a section during the last frame.
+		 * @param section Section.
+		 * @return Time, in nanoseconds.
+		 */
+		inline uint64_t sectionTime(Section section) const
+			{ return m_last[section]; }
+
+		/**
+		 * Get a counter value from the last frame.
+		 * @param counter Counter.
+		 * @return Counter value.
+		 */
+		inline unsigned int counter(Counter counter) const
+			{ return m_cntLast[counter]; }
+
+		/**
+		 * Format the last frame's counters for an onscreen display.
+		 * @param buf Output buffer.
+		 * @param size Size of buf.
+		 * @return Number of characters written. (0 if the profiler is disabled.)
+		 */
+		int format(char *buf, size_t size) const;
+
+		/**
+		 * Enter a section for the lifetime of this object.
+		 */
+		class Scope
+		{
+			public:
+				inline Scope(ProfilerT *profiler, Section section)
+					: m_profiler(profiler)
+				{
+					if (m_profiler)
+						m_profiler->enter(section);
+				}
+
+				inline ~Scope()
+				{
+					if (m_profiler)
+						m_profiler->leave();
+				}
+
+			private:
+				ProfilerT *const m_profiler;
+
+				Scope(const Scope &);
+				Scope &operator=(const Scope &);
+		};
+
+	private:
+		Timing m_timing;
+
+		// Section stack.
+		static const int MAX_DEPTH = 8;
+		uint8_t m_stack[MAX_DEPTH];
+		int m_depth;
+		uint64_t m_stamp;	// Time of the last enter()/leave().
+
+		// Counters, in nanoseconds.
+		uint64_t m_cur[PROF_MAX];
+		uint64_t m_last[PROF_MAX];
+		uint64_t m_frameStart;
+		uint64_t m_lastFrameTime;
+
+		// Event counters.
+		unsigned int m_cntCur[CNT_MAX];
+		unsigned int m_cntLast[CNT_MAX];
+};
+
+#ifdef LIBGENS_ENABLE_PROFILER
+typedef ProfilerT<true> Profiler;
+#else /* !LIBGENS_ENABLE_PROFILER */
+typedef ProfilerT<false> Profiler;
+#endif /* LIBGENS_ENABLE_PROFILER */
+
+}
+
+#endif /* __LIBGENS_UTIL_PROFILER_HPP__ */
@@ -0,0 +1,601 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * RewindBuffer.cpp: Savestate ring buffer for rewinding.                  *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "RewindBuffer.hpp"
+#include "EmuContext/EmuContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cassert>
+#include <cerrno>
+#include <cstring>
+
+// C++ includes.
+#include <deque>
+#include <vector>
+using std::deque;
+using std::vector;
+
+namespace LibGens {
+
+/**
+ * Encoded snapshot format:
+ *
+ * The snapshot is XORed against its base state, and the result
+ * is stored as a sequence of runs:
+ * - varint: Number of zero bytes to skip.
+ * - varint: Number of literal bytes.
+ * - Literal bytes. (XOR of the state and the base state)
+ * Runs continue until the end of the state is reached.
+ *
+ * Varints are stored as LEB128: 7 bits per byte, LSB first,
+ * with the high bit set if more bytes follow.
+ */
+
+class RewindBufferPrivate
+{
+	public:
+		RewindBufferPrivate(size_t budget, int interval, int keyframeInterval);
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		RewindBufferPrivate(const RewindBufferPrivate &);
+		RewindBufferPrivate &operator=(const RewindBufferPrivate &);
+
+	public:
+		const size_t budget;
+		const int interval;
+		const int keyframeInterval;
+
+		int frameCount;		// Frames since the last snapshot.
+		int deltaCount;		// Snapshots since the newest keyframe.
+		bool stepping;		// Set by step(); cleared by capture().
+
+		// Encoded snapshots.
+		struct Entry {
+			size_t offset;
+			size_t size;
+			bool isKeyframe;
+		};
+		deque<Entry> entries;	// Oldest snapshot is at the front.
+		vector<uint8_t> ring;	// Allocated on the first snapshot.
+		size_t head;		// End of the newest snapshot.
+		size_t used;		// Total size of all snapshots.
+
+		vector<uint8_t> state;		// Current state.
+		vector<uint8_t> keyframe;	// Decoded newest keyframe. (empty if none)
+		vector<uint8_t> diff;		// XOR of the state and its base.
+		vector<uint8_t> enc;		// Encoded snapshot.
+
+		/**
+		 * Encode the current state.
+		 * @param base Base state, or nullptr for an all-zero base.
+		 */
+		void encode(const uint8_t *base);
+
+		/**
+		 * Decode a snapshot by XORing it into a buffer.
+		 * @param out Buffer containing the base state.
+		 * @param size Size of out.
+		 * @param src Encoded snapshot.
+		 * @param srcSize Size of src.
+		 * @return 0 on success; -EIO if the snapshot is corrupt.
+		 */
+		static int decode(uint8_t *out, size_t size, const uint8_t *src, size_t srcSize);
+
+		/**
+		 * Store the encoded snapshot in the ring, discarding old snapshots if necessary.
+		 * @param isKeyframe True if this is a keyframe.
+		 * @return 0 on success; -EAGAIN if a delta's keyframe was discarded; -ENOSPC if it doesn't fit.
+		 */
+		int store(bool isKeyframe);
+
+		/**
+		 * Discard the oldest snapshot.
+		 */
+		void popFront(void);
+
+		/**
+		 * Decode the newest snapshot into state.
+		 * @return 0 on success; -EIO if the snapshot is corrupt.
+		 */
+		int decodeBack(void);
+
+		/**
+		 * Discard the newest snapshot.
+		 */
+		void popBack(void);
+
+		/**
+		 * Decode the newest keyframe in the ring into keyframe.
+		 */
+		void reloadKeyframe(void);
+
+		/**
+		 * Discard all snapshots.
+		 */
+		void clear(void);
+
+	private:
+		static inline void writeVarint(vector<uint8_t> &out, size_t value);
+		static inline bool readVarint(const uint8_t *&src, const uint8_t *end, size_t *value);
+};
+
+RewindBufferPrivate::RewindBufferPrivate(size_t budget, int interval, int keyframeInterval)
+	: budget(budget)
+	, interval(interval > 0 ? interval : 1)
+	, keyframeInterval(keyframeInterval > 0 ? keyframeInterval : 1)
+	, frameCount(0)
+	, deltaCount(0)
+	, stepping(false)
+	, head(0)
+	, used(0)
+{ }
+
+inline void RewindBufferPrivate::writeVarint(vector<uint8_t> &out, size_t value)
+{
+	while (value >= 0x80) {
+		out.push_back((uint8_t)(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back((uint8_t)value);
+}
+
+inline bool RewindBufferPrivate::readVarint(const uint8_t *&src, const uint8_t *end, size_t *value)
+{
+	size_t ret = 0;
+	for (unsigned int shift = 0; shift < sizeof(size_t)*8; shift += 7) {
+		if (src >= end)
+			return false;
+		const uint8_t b = *src++;
+		ret |= (size_t)(b & 0x7F) << shift;
+		if (!(b & 0x80)) {
+			*value = ret;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Encode the current state.
+ * @param base Base state, or nullptr for an all-zero base.
+ */
+void RewindBufferPrivate::encode(const uint8_t *base)
+{
+	// Zero runs shorter than this are merged into the literal.
+	static const size_t MIN_ZERO_RUN = 8;
+
+	const size_t size = state.size();
+	diff.resize(size);
+	const uint8_t *src = state.data();
+	uint8_t *d = diff.data();
+	if (base) {
+		for (size_t i = 0; i < size; i++) {
+			d[i] = src[i] ^ base[i];
+		}
+	} else {
+		memcpy(d, src, size);
+	}
+
+	enc.clear();
+	size_t i = 0;
+	while (i < size) {
+		// Zero run.
+		const size_t zeroStart = i;
+		uint64_t qw;
+		while (i + sizeof(qw) <= size) {
+			memcpy(&qw, &d[i], sizeof(qw));
+			if (qw != 0)
+				break;
+			i += sizeof(qw);
+		}
+		while (i < size && d[i] == 0) {
+			i++;
+		}
+
+		// Literal run. Ends at the next long zero run.
+		const size_t litStart = i;
+		while (i < size) {
+			if (d[i] != 0) {
+				i++;
+				continue;
+			}
+			size_t j = i;
+			while (j < size && d[j] == 0 && (j - i) < MIN_ZERO_RUN) {
+				j++;
+			}
+			if (j == size || (j - i) >= MIN_ZERO_RUN)
+				break;
+			i = j;
+		}
+
+		writeVarint(enc, litStart - zeroStart);
+		writeVarint(enc, i - litStart);
+		enc.insert(enc.end(), &d[litStart], &d[i]);
+	}
+}
+
+/**
+ * Decode a snapshot by XORing it into a buffer.
+ * @param out Buffer containing the base state.
+ * @param size Size of out.
+ * @param src Encoded snapshot.
+ * @param srcSize Size of src.
+ * @return 0 on success; -EIO if the snapshot is corrupt.
+ */
+int RewindBufferPrivate::decode(uint8_t *out, size_t size, const uint8_t *src, size_t srcSize)
+{
+	const uint8_t *const end = src + srcSize;
+	size_t pos = 0;
+	while (src < end) {
+		size_t skip, lit;
+		if (!readVarint(src, end, &skip) ||
+		    !readVarint(src, end, &lit))
+			return -EIO;
+		if (skip > size - pos)
+			return -EIO;
+		pos += skip;
+		if (lit > size - pos || lit > (size_t)(end - src))
+			return -EIO;
+		for (size_t i = 0; i < lit; i++) {
+			out[pos + i] ^= src[i];
+		}
+		pos += lit;
+		src += lit;
+	}
+	return 0;
+}
+
+/**
+ * Discard the oldest snapshot.
+ */
+void RewindBufferPrivate::popFront(void)
+{
+	assert(!entries.empty());
+	used -= entries.front().size;
+	entries.pop_front();
+	if (entries.empty()) {
+		head = 0;
+		keyframe.clear();
+		deltaCount = 0;
+	}
+}
+
+/**
+ * Decode the newest snapshot into state.
+ * @return 0 on success; -EIO if the snapshot is corrupt.
+ */
+int RewindBufferPrivate::decodeBack(void)
+{
+	assert(!entries.empty());
+	const Entry &entry = entries.back();
+	if (entry.isKeyframe) {
+		state.assign(state.size(), 0);
+	} else {
+		state = keyframe;
+	}
+	return decode(state.data(), state.size(), &ring[entry.offset], entry.size);
+}
+
+/**
+ * Discard the newest snapshot.
+ */
+void RewindBufferPrivate::popBack(void)
+{
+	assert(!entries.empty());
+	const Entry entry = entries.back();
+	entries.pop_back();
+	used -= entry.size;
+	head = (entries.empty() ? 0 : entries.back().offset + entries.back().size);
+	if (entry.isKeyframe) {
+		reloadKeyframe();
+	} else {
+		deltaCount--;
+	}
+}
+
+/**
+ * Store the encoded snapshot in the ring, discarding old snapshots if necessary.
+ * @param isKeyframe True if this is a keyframe.
+ * @return 0 on success; -EAGAIN if a delta's keyframe was discarded; -ENOSPC if it doesn't fit.
+ */
+int RewindBufferPrivate::store(bool isKeyframe)
+{
+	const size_t size = enc.size();
+	// Require room for at least two snapshots.
+	if (size > budget / 2)
+		return -ENOSPC;
+	if (ring.empty())
+		ring.resize(budget);
+
+	size_t pos = head;
+	if (pos + size > ring.size()) {
+		// Wrap around. Snapshots past the head are older
+		// than the ones at the start of the ring.
+		while (!entries.empty() && entries.front().offset >= head) {
+			popFront();
+		}
+		pos = 0;
+	}
+
+	// Discard snapshots that overlap the new one.
+	while (!entries.empty()) {
+		const Entry &front = entries.front();
+		if (front.offset >= pos + size || front.offset + front.size <= pos)
+			break;
+		popFront();
+	}
+
+	// Deltas can't be decoded without their keyframe.
+	while (!entries.empty() && !entries.front().isKeyframe) {
+		popFront();
+	}
+	if (!isKeyframe && entries.empty()) {
+		// The delta's keyframe was discarded.
+		return -EAGAIN;
+	}
+
+	memcpy(&ring[pos], enc.data(), size);
+	Entry entry;
+	entry.offset = pos;
+	entry.size = size;
+	entry.isKeyframe = isKeyframe;
+	entries.push_back(entry);
+	head = pos + size;
+	used += size;
+	return 0;
+}
+
+/**
+ * Decode the newest keyframe in the ring into keyframe.
+ */
+void RewindBufferPrivate::reloadKeyframe(void)
+{
+	keyframe.clear();
+	deltaCount = 0;
+	for (int i = (int)entries.size() - 1; i >= 0; i--) {
+		const Entry &entry = entries[i];
+		if (!entry.isKeyframe) {
+			deltaCount++;
+			continue;
+		}
+
+		keyframe.assign(state.size(), 0);
+		decode(keyframe.data(), keyframe.size(), &ring[entry.offset], entry.size);
+		return;
+	}
+
+	// No keyframe. This shouldn't happen, since store()
+	// always discards deltas at the front of the ring.
+	assert(entries.empty());
+	clear();
+}
+
+/**
+ * Discard all snapshots.
+ */
+void RewindBufferPrivate::clear(void)
+{
+	entries.clear();
+	keyframe.clear();
+	head = 0;
+	used = 0;
+	frameCount = 0;
+	deltaCount = 0;
+	stepping = false;
+}
+
+/** RewindBuffer **/
+
+/**
+ * Create a rewind buffer.
+ * @param budget Memory budget for encoded snapshots, in bytes.
+ * @param interval Take a snapshot every interval frames.
+ * @param keyframeInterval Store a keyframe every keyframeInterval snapshots.
+ */
+RewindBuffer::RewindBuffer(size_t budget, int interval, int keyframeInterval)
+	: d(new RewindBufferPrivate(budget, interval, keyframeInterval))
+{ }
+
+RewindBuffer::~RewindBuffer()
+{
+	delete d;
+}
+
+/**
+ * Discard all snapshots.
+ * This must be called if a different ROM is loaded.
+ */
+void RewindBuffer::clear(void)
+{
+	d->clear();
+}
+
+/**
+ * Notify the rewind buffer that a frame has been emulated.
+ * A snapshot is taken every interval frames.
+ * @param context Emulation context.
+ * @return 1 if a snapshot was taken; 0 if not; negative POSIX error code on error.
+ */
+int RewindBuffer::capture(const EmuContext *context)
+{
+	d->stepping = false;
+	if (++d->frameCount < d->interval)
+		return 0;
+	d->frameCount = 0;
+
+	// Save the state. The size only changes
+	// if a different ROM is loaded.
+	int ret = -ENOSPC;
+	if (!d->state.empty()) {
+		ret = context->saveStateToBuffer(d->state.data(), d->state.size());
+	}
+	if (ret == -ENOSPC) {
+		ret = context->saveStateToBuffer(nullptr, 0);
+		if (ret < 0)
+			return ret;
+		d->state.resize(ret);
+		ret = context->saveStateToBuffer(d->state.data(), d->state.size());
+	}
+	if (ret < 0)
+		return ret;
+	if ((size_t)ret != d->state.size()) {
+		d->state.resize(ret);
+	}
+	if (!d->keyframe.empty() && d->keyframe.size() != d->state.size()) {
+		// State size changed. Old snapshots can't be used.
+		d->clear();
+	}
+
+	bool isKeyframe = (d->keyframe.empty() ||
+			   d->deltaCount + 1 >= d->keyframeInterval);
+	if (!isKeyframe) {
+		d->encode(d->keyframe.data());
+		ret = d->store(false);
+		if (ret == -EAGAIN) {
+			// Keyframe was discarded.
+			isKeyframe = true;
+		} else if (ret != 0) {
+			return ret;
+		}
+	}
+	if (isKeyframe) {
+		d->encode(nullptr);
+		ret = d->store(true);
+		if (ret != 0)
+			return ret;
+		d->keyframe = d->state;
+		d->deltaCount = 0;
+	} else {
+		d->deltaCount++;
+	}
+
+	return 1;
+}
+
+/**
+ * Restore the most recent snapshot and remove it from the buffer.
+ * @param context Emulation context.
+ * @return 0 on success; -ENOENT if the buffer is empty; other negative POSIX error code on error.
+ */
+int RewindBuffer::rewind(EmuContext *context)
+{
+	if (d->entries.empty())
+		return -ENOENT;
+
+	int ret = d->decodeBack();
+	d->popBack();
+	d->frameCount = 0;
+
+	if (ret != 0) {
+		// Snapshot is corrupt. This shouldn't happen...
+		d->clear();
+		return ret;
+	}
+	return context->loadStateFromBuffer(d->state.data(), d->state.size());
+}
+
+/**
+ * Step back while rewinding.
+ * The caller runs one frame after each step to redraw the screen.
+ * On the first step after capture(), snapshots less than two frames
+ * older than the current frame are discarded, since that frame would
+ * end up at or after the current frame. The oldest snapshot is kept,
+ * so rewinding holds there.
+ * @param context Emulation context.
+ * @return 0 on success; -ENOENT if the buffer is empty; other negative POSIX error code on error.
+ */
+int RewindBuffer::step(EmuContext *context)
+{
+	if (d->entries.empty())
+		return -ENOENT;
+
+	if (!d->stepping) {
+		// Snapshots are interval frames apart.
+		int age = d->frameCount;
+		while (age < 2 && d->entries.size() > 1) {
+			d->popBack();
+			age += d->interval;
+		}
+		d->stepping = true;
+	}
+
+	int ret = d->decodeBack();
+	if (d->entries.size() > 1) {
+		d->popBack();
+	}
+	d->frameCount = 0;
+
+	if (ret != 0) {
+		// Snapshot is corrupt. This shouldn't happen...
+		d->clear();
+		return ret;
+	}
+	return context->loadStateFromBuffer(d->state.data(), d->state.size());
+}
+
+/**
+ * Is the buffer empty?
+ * @return True if there are no snapshots.
+ */
+bool RewindBuffer::isEmpty(void) const
+{
+	return d->entries.empty();
+}
+
+/**
+ * Get the number of snapshots in the buffer.
+ * @return Number of snapshots.
+ */
+int RewindBuffer::count(void) const
+{
+	return (int)d->entries.size();
+}
+
+/**
+ * Get the number of bytes used by encoded snapshots.
+ * @return Bytes used.
+ */
+size_t RewindBuffer::bytesUsed(void) const
+{
+	return d->used;
+}
+
+/**
+ * Get the memory budget.
+ * @return Memory budget, in bytes.
+ */
+size_t RewindBuffer::budget(void) const
+{
+	return d->budget;
+}
+
+/**
+ * Get the snapshot interval.
+ * @return Snapshot interval, in frames.
+ */
+int RewindBuffer::interval(void) const
+{
+	return d->interval;
+}
+
+}
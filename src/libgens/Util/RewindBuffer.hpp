@@ -0,0 +1,136 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * RewindBuffer.hpp: Savestate ring buffer for rewinding.                  *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_UTIL_REWINDBUFFER_HPP__
+#define __LIBGENS_UTIL_REWINDBUFFER_HPP__
+
+#include <libgens/config.libgens.h>
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cstddef>
+
+namespace LibGens {
+
+class EmuContext;
+
+/**
+ * Fixed-size ring buffer of in-memory savestates.
+ *
+ * Every snapshot is XORed against a base state and run-length encoded.
+ * Keyframes use an all-zero base; other snapshots use the most recent
+ * keyframe, so consecutive frames usually only cost a few kilobytes.
+ * When the ring is full, the oldest keyframe and its deltas are discarded.
+ *
+ * NOTE: Not thread-safe. Call capture(), rewind(), and step() from
+ * the thread that runs the emulation context.
+ */
+class RewindBufferPrivate;
+class RewindBuffer
+{
+	public:
+		/**
+		 * Create a rewind buffer.
+		 * @param budget Memory budget for encoded snapshots, in bytes.
+		 * @param interval Take a snapshot every interval frames.
+		 * @param keyframeInterval Store a keyframe every keyframeInterval snapshots.
+		 */
+		explicit RewindBuffer(size_t budget, int interval = 1, int keyframeInterval = 60);
+		~RewindBuffer();
+
+	protected:
+		friend class RewindBufferPrivate;
+		RewindBufferPrivate *const d;
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		RewindBuffer(const RewindBuffer &);
+		RewindBuffer &operator=(const RewindBuffer &);
+
+	public:
+		/**
+		 * Discard all snapshots.
+		 * This must be called if a different ROM is loaded.
+		 */
+		void clear(void);
+
+		/**
+		 * Notify the rewind buffer that a frame has been emulated.
+		 * A snapshot is taken every interval frames.
+		 * @param context Emulation context.
+		 * @return 1 if a snapshot was taken; 0 if not; negative POSIX error code on error.
+		 */
+		int capture(const EmuContext *context);
+
+		/**
+		 * Restore the most recent snapshot and remove it from the buffer.
+		 * @param context Emulation context.
+		 * @return 0 on success; -ENOENT if the buffer is empty; other negative POSIX error code on error.
+		 */
+		int rewind(EmuContext *context);
+
+		/**
+		 * Step back while rewinding.
+		 * The caller must run one frame after each step to redraw
+		 * the screen. Each step goes back at least one frame,
+		 * including the first one after capture().
+		 * The oldest snapshot is kept, so rewinding holds there.
+		 * @param context Emulation context.
+		 * @return 0 on success; -ENOENT if the buffer is empty; other negative POSIX error code on error.
+		 */
+		int step(EmuContext *context);
+
+		/**
+		 * Is the buffer empty?
+		 * @return True if there are no snapshots.
+		 */
+		bool isEmpty(void) const;
+
+		/**
+		 * Get the number of snapshots in the buffer.
+		 * @return Number of snapshots.
+		 */
+		int count(void) const;
+
+		/**
+		 * Get the number of bytes used by encoded snapshots.
+		 * @return Bytes used.
+		 */
+		size_t bytesUsed(void) const;
+
+		/**
+		 * Get the memory budget.
+		 * @return Memory budget, in bytes.
+		 */
+		size_t budget(void) const;
+
+		/**
+		 * Get the snapshot interval.
+		 * @return Snapshot interval, in frames.
+		 */
+		int interval(void) const;
+};
+
+}
+
+#endif /* __LIBGENS_UTIL_REWINDBUFFER_HPP__ */
@@ -0,0 +1,306 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * RunAhead.cpp: Run-ahead input latency reduction.                        *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "RunAhead.hpp"
+#include "Timing.hpp"
+#include "EmuContext/EmuContext.hpp"
+#include "sound/SoundMgr.hpp"
+#include "cpu/M68K.hpp"
+#include "Vdp/Vdp.hpp"
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens {
+
+class RunAheadPrivate
+{
+	public:
+		explicit RunAheadPrivate(int frames);
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		RunAheadPrivate(const RunAheadPrivate &);
+		RunAheadPrivate &operator=(const RunAheadPrivate &);
+
+	public:
+		int frames;	// Number of frames to run ahead.
+		Timing timing;
+
+		// Saved emulation state.
+		vector<uint8_t> state;
+
+		// Saved sound chip state.
+		// ZOMG savestates don't include the envelopes
+		// or timers, so the sound chips are saved separately.
+		Ym2612 ym2612;
+		Psg psg;
+
+		// Saved CPU and VDP state.
+		// ZOMG savestates don't include the M68K interrupt
+		// lines, pending VDP interrupts, or DMA counters.
+		M68K::CoreState m68kState;
+		Vdp::RuntimeState vdpState;
+
+		// Saved audio from the real frame.
+		int32_t segBufL[SoundMgr::MAX_SEGMENT_SIZE];
+		int32_t segBufR[SoundMgr::MAX_SEGMENT_SIZE];
+
+		// Statistics.
+		uint64_t lastFrameTime;
+		uint64_t lastRunAheadTime;
+		uint64_t totalFrameTime;
+		uint64_t totalRunAheadTime;
+		unsigned int totalFrames;
+
+		/**
+		 * Save the emulation state.
+		 * @param context Emulation context.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int saveState(const EmuContext *context);
+};
+
+RunAheadPrivate::RunAheadPrivate(int frames)
+	: frames(frames)
+	, lastFrameTime(0)
+	, lastRunAheadTime(0)
+	, totalFrameTime(0)
+	, totalRunAheadTime(0)
+	, totalFrames(0)
+{ }
+
+/**
+ * Save the emulation state.
+ * @param context Emulation context.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int RunAheadPrivate::saveState(const EmuContext *context)
+{
+	// The state size only changes if a different ROM is loaded.
+	int ret = -ENOSPC;
+	if (!state.empty()) {
+		ret = context->saveStateToBuffer(state.data(), state.size());
+	}
+	if (ret == -ENOSPC) {
+		ret = context->saveStateToBuffer(nullptr, 0);
+		if (ret < 0)
+			return ret;
+		state.resize(ret);
+		ret = context->saveStateToBuffer(state.data(), state.size());
+	}
+	if (ret < 0)
+		return ret;
+	state.resize(ret);
+	return 0;
+}
+
+/** RunAhead **/
+
+/**
+ * Create a run-ahead frame runner.
+ * @param frames Number of frames to run ahead. (0 to disable)
+ */
+RunAhead::RunAhead(int frames)
+	: d(new RunAheadPrivate(0))
+{
+	setFrames(frames);
+}
+
+RunAhead::~RunAhead()
+{
+	delete d;
+}
+
+/**
+ * Get the number of frames to run ahead.
+ * @return Number of frames to run ahead.
+ */
+int RunAhead::frames(void) const
+{
+	return d->frames;
+}
+
+/**
+ * Set the number of frames to run ahead.
+ * @param frames Number of frames to run ahead. (0 to disable)
+ */
+void RunAhead::setFrames(int frames)
+{
+	if (frames < 0)
+		frames = 0;
+	else if (frames > MAX_FRAMES)
+		frames = MAX_FRAMES;
+	d->frames = frames;
+}
+
+/**
+ * Run a frame and render it.
+ * If run-ahead fails, the real frame is still run,
+ * and the emulation state is left unchanged.
+ * @param context Emulation context.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int RunAhead::execFrame(EmuContext *context)
+{
+	const uint64_t start = d->timing.getTimeNs();
+	if (d->frames <= 0) {
+		// Run-ahead is disabled.
+		context->execFrame();
+		d->lastFrameTime = d->timing.getTimeNs() - start;
+		d->lastRunAheadTime = 0;
+		d->totalFrameTime += d->lastFrameTime;
+		d->totalFrames++;
+		return 0;
+	}
+
+	// Run the real frame. Its video output is never displayed.
+	context->execFrameFast();
+	const uint64_t ahead = d->timing.getTimeNs();
+	d->lastFrameTime = ahead - start;
+	d->totalFrameTime += d->lastFrameTime;
+	d->totalFrames++;
+
+	// Save the state.
+	int ret = d->saveState(context);
+	if (ret != 0) {
+		d->lastRunAheadTime = 0;
+		return ret;
+	}
+	context->m_m68k->saveCoreState(&d->m68kState);
+	context->m_vdp->saveRuntimeState(&d->vdpState);
+	SoundMgr *const soundMgr = context->m_soundMgr;
+	d->ym2612.copyStateFrom(soundMgr->m_ym2612);
+	d->psg.copyStateFrom(soundMgr->m_psg);
+	memcpy(d->segBufL, soundMgr->m_segBufL, sizeof(d->segBufL));
+	memcpy(d->segBufR, soundMgr->m_segBufR, sizeof(d->segBufR));
+
+	// Run ahead, rendering the last frame.
+	for (int i = d->frames - 1; i > 0; i--) {
+		context->execFrameFast();
+	}
+	context->execFrame();
+
+	// Roll back to the real frame.
+	ret = context->loadStateFromBuffer(d->state.data(), d->state.size());
+	context->m_m68k->restoreCoreState(&d->m68kState);
+	context->m_vdp->restoreRuntimeState(&d->vdpState);
+	soundMgr->m_ym2612.copyStateFrom(d->ym2612);
+	soundMgr->m_psg.copyStateFrom(d->psg);
+	memcpy(soundMgr->m_segBufL, d->segBufL, sizeof(d->segBufL));
+	memcpy(soundMgr->m_segBufR, d->segBufR, sizeof(d->segBufR));
+
+	d->lastRunAheadTime = d->timing.getTimeNs() - ahead;
+	d->totalRunAheadTime += d->lastRunAheadTime;
+	return ret;
+}
+
+/** Cost statistics. **/
+
+/**
+ * Get the time spent running the last real frame.
+ * @return Time, in nanoseconds.
+ */
+uint64_t RunAhead::lastFrameTime(void) const
+{
+	return d->lastFrameTime;
+}
+
+/**
+ * Get the time spent on run-ahead for the last frame.
+ * This includes saving and restoring the state.
+ * @return Time, in nanoseconds.
+ */
+uint64_t RunAhead::lastRunAheadTime(void) const
+{
+	return d->lastRunAheadTime;
+}
+
+/**
+ * Get the total time spent running real frames.
+ * @return Time, in nanoseconds.
+ */
+uint64_t RunAhead::totalFrameTime(void) const
+{
+	return d->totalFrameTime;
+}
+
+/**
+ * Get the total time spent on run-ahead.
+ * @return Time, in nanoseconds.
+ */
+uint64_t RunAhead::totalRunAheadTime(void) const
+{
+	return d->totalRunAheadTime;
+}
+
+/**
+ * Get the number of frames run since the statistics were reset.
+ * @return Number of frames.
+ */
+unsigned int RunAhead::totalFrames(void) const
+{
+	return d->totalFrames;
+}
+
+/**
+ * Reset the cost statistics.
+ */
+void RunAhead::resetStats(void)
+{
+	d->totalFrameTime = 0;
+	d->totalRunAheadTime = 0;
+	d->totalFrames = 0;
+}
+
+/**
+ * Format the cost statistics for an onscreen display.
+ * Averages are taken since the statistics were last reset.
+ * @param buf Output buffer.
+ * @param size Size of buf.
+ * @return Number of characters written.
+ */
+int RunAhead::format(char *buf, size_t size) const
+{
+	const unsigned int n = (d->totalFrames > 0 ? d->totalFrames : 1);
+	const double frameUs = (double)d->totalFrameTime / n / 1000.0;
+	const double aheadUs = (double)d->totalRunAheadTime / n / 1000.0;
+	const double cost = (frameUs > 0 ? (frameUs + aheadUs) / frameUs : 0);
+
+	int ret = snprintf(buf, size,
+		"Run-ahead: %d frame%s\n"
+		"Frame:  %8.1f us\n"
+		"Ahead:  %8.1f us  x%.2f",
+		d->frames, (d->frames == 1 ? "" : "s"),
+		frameUs, aheadUs, cost);
+	if (ret < 0)
+		return 0;
+	return ((size_t)ret >= size ? (int)size - 1 : ret);
+}
+
+}
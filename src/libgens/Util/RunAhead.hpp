@@ -0,0 +1,150 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * RunAhead.hpp: Run-ahead input latency reduction.                        *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_UTIL_RUNAHEAD_HPP__
+#define __LIBGENS_UTIL_RUNAHEAD_HPP__
+
+#include <libgens/config.libgens.h>
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cstddef>
+
+namespace LibGens {
+
+class EmuContext;
+
+/**
+ * Run-ahead frame runner.
+ *
+ * Each displayed frame runs the real frame, saves the state,
+ * runs the next frames() frames with the current input, and
+ * displays the last one. The saved state is then restored.
+ * Games that only respond to input a frame or two after
+ * reading the controller will appear to respond immediately.
+ *
+ * Audio is only taken from the real frame. The sound chips
+ * are rolled back completely, including the envelope and
+ * timer counters that aren't in ZOMG savestates.
+ * Likewise, the M68K interrupt lines and the VDP's pending
+ * interrupts and DMA counters are saved separately, so the
+ * rolled-back emulation matches a normal run exactly.
+ *
+ * Run-ahead costs (frames() + 1) frames of emulation, plus
+ * a savestate and a restore, per displayed frame.
+ */
+class RunAheadPrivate;
+class RunAhead
+{
+	public:
+		/**
+		 * Create a run-ahead frame runner.
+		 * @param frames Number of frames to run ahead. (0 to disable)
+		 */
+		explicit RunAhead(int frames = 1);
+		~RunAhead();
+
+	protected:
+		friend class RunAheadPrivate;
+		RunAheadPrivate *const d;
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		RunAhead(const RunAhead &);
+		RunAhead &operator=(const RunAhead &);
+
+	public:
+		// Maximum number of frames to run ahead.
+		static const int MAX_FRAMES = 8;
+
+		/**
+		 * Get the number of frames to run ahead.
+		 * @return Number of frames to run ahead.
+		 */
+		int frames(void) const;
+
+		/**
+		 * Set the number of frames to run ahead.
+		 * @param frames Number of frames to run ahead. (0 to disable)
+		 */
+		void setFrames(int frames);
+
+		/**
+		 * Run a frame and render it.
+		 * If run-ahead fails, the real frame is still run,
+		 * and the emulation state is left unchanged.
+		 * @param context Emulation context.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int execFrame(EmuContext *context);
+
+		/** Cost statistics. **/
+
+		/**
+		 * Get the time spent running the last real frame.
+		 * @return Time, in nanoseconds.
+		 */
+		uint64_t lastFrameTime(void) const;
+
+		/**
+		 * Get the time spent on run-ahead for the last frame.
+		 * This includes saving and restoring the state.
+		 * @return Time, in nanoseconds.
+		 */
+		uint64_t lastRunAheadTime(void) const;
+
+		/**
+		 * Get the total time spent running real frames.
+		 * @return Time, in nanoseconds.
+		 */
+		uint64_t totalFrameTime(void) const;
+
+		/**
+		 * Get the total time spent on run-ahead.
+		 * @return Time, in nanoseconds.
+		 */
+		uint64_t totalRunAheadTime(void) const;
+
+		/**
+		 * Get the number of frames run since the statistics were reset.
+		 * @return Number of frames.
+		 */
+		unsigned int totalFrames(void) const;
+
+		/**
+		 * Reset the cost statistics.
+		 */
+		void resetStats(void);
+
+		/**
+		 * Format the cost statistics for an onscreen display.
+		 * @param buf Output buffer.
+		 * @param size Size of buf.
+		 * @return Number of characters written.
+		 */
+		int format(char *buf, size_t size) const;
+};
+
+}
+
+#endif /* __LIBGENS_UTIL_RUNAHEAD_HPP__ */
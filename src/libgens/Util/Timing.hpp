@@ -99,6 +99,13 @@ class Timing
 		 */
 		uint64_t getTime(void);
 
+		/**
+		 * Get the elapsed time in nanoseconds.
+		 * Resolution depends on the timing method.
+		 * @return Elapsed time, in nanoseconds.
+		 */
+		uint64_t getTimeNs(void);
+
 	protected:
 		TimingMethod m_tMethod;
 
@@ -110,4 +110,17 @@ uint64_t Timing::getTime(void)
 	return (uint64_t)(d_abs_time / 1000.0);
 }
 
+/**
+ * Get the elapsed time in nanoseconds.
+ * Resolution depends on the timing method.
+ * @return Elapsed time, in nanoseconds.
+ */
+uint64_t Timing::getTimeNs(void)
+{
+	// Mach absolute time. (Mac OS X)
+	uint64_t abs_time = mach_absolute_time() - m_timer_base;
+	double d_abs_time = (double)abs_time * (double)m_timebase_info.numer / (double)m_timebase_info.denom;
+	return (uint64_t)d_abs_time;
+}
+
 }
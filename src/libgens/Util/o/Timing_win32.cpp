@@ -206,4 +206,39 @@ uint64_t Timing::getTime(void)
 	return timer;
 }
 
+/**
+ * Get the elapsed time in nanoseconds.
+ * Resolution depends on the timing method.
+ * @return Elapsed time, in nanoseconds.
+ */
+uint64_t Timing::getTimeNs(void)
+{
+	uint64_t timer;
+	switch (m_tMethod) {
+		case TM_GETTICKCOUNT:
+		default:
+			// FIXME: Prevent overflow.
+			timer = (uint64_t)(GetTickCount() - m_timer_base) * 1000000;
+			break;
+
+		case TM_GETTICKCOUNT64:
+			timer = (d->pGetTickCount64() - m_timer_base) * 1000000;
+			break;
+
+		case TM_QUERYPERFORMANCECOUNTER: {
+			// Split the conversion into seconds and remainder
+			// to prevent overflow when multiplying by 10^9.
+			LARGE_INTEGER perf_ctr;
+			QueryPerformanceCounter(&perf_ctr);
+			const uint64_t ticks = (perf_ctr.QuadPart - m_timer_base);
+			const uint64_t freq = d->perfFreq.QuadPart;
+			timer = ((ticks / freq) * 1000000000) +
+				(((ticks % freq) * 1000000000) / freq);
+			break;
+		}
+	}
+
+	return timer;
+}
+
 }
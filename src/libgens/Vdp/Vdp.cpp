@@ -35,6 +35,9 @@
 // VDP includes.
 #include "VdpPalette.hpp"
 
+// Framebuffer ring.
+#include "../Util/MdFbRing.hpp"
+
 // Private classes.
 #include "Vdp_p.hpp"
 #include "VdpRend_Err_p.hpp"
@@ -55,12 +58,21 @@ const VdpTypes::VdpEmuOptions_t VdpPrivate::def_vdpEmuOptions = {
 	true,				// vscrollBug
 	false,				// updatePaletteInVBlankOnly
 	true,				// enableInterlacedMode
+	false,				// midLineWrites
+	true,				// bulkDMA
 };
 
-VdpPrivate::VdpPrivate(Vdp *q)
+VdpPrivate::VdpPrivate(Vdp *q, EmuContext *context)
 	: q(q)
+	, context(context)
+	, fbRing(nullptr)
 	, VDP_Model(VdpTypes::VDP_MODEL_MD)	// TODO: Add support for more models.
+	, patternCache(new VdpCache())
+	, rendThread(nullptr)
 	, VRam_Mask(0xFFFF)	// Always ensure this mask is valid.
+	, lineLogCount(-1)
+	, lineLogFbLine(0)
+	, lineLogSprDotOverflow(false)
 	, d_err(new VdpRend_Err_Private(q))
 {
 	// TODO: Initialize all private variables.
@@ -77,6 +89,44 @@ VdpPrivate::VdpPrivate(Vdp *q)
 		H_Counter_Table[hc][1] = (uint8_t)hc_val;
 	}
 
+	// Find the end of the active display.
+	// H32: 256px (H counter 0x00-0x7F)
+	// H40: 320px (H counter 0x00-0x9F)
+	// NOTE: The H counter starts at 0xE8 (H32) or 0xE4 (H40).
+	static const uint8_t hc_end[2] = {0x80, 0xA0};
+	for (int i = 0; i < 2; i++) {
+		int hc = 0;
+		while (hc < 488 && (H_Counter_Table[hc][i] < hc_end[i] ||
+				    H_Counter_Table[hc][i] >= 0xE0))
+		{
+			hc++;
+		}
+		activeEndCycle[i] = hc;
+	}
+
+	// Initialize the FIFO access slot table.
+	// Slot positions are in 68000 cycles from the start of the line.
+	// Reference: Genesis Plus GX (fifo_timing[])
+	static const uint16_t slots_h32[] = {
+		32, 72, 115, 138, 161, 207, 230, 252,
+		298, 321, 344, 390, 412, 435, 478, 481
+	};
+	static const uint16_t slots_h40[] = {
+		50, 117, 135, 153, 190, 208, 226, 263, 281,
+		300, 336, 354, 373, 409, 428, 446, 480, 482
+	};
+	static const uint16_t *const slots[2] = {slots_h32, slots_h40};
+	static const int slot_count[2] = {ARRAY_SIZE(slots_h32), ARRAY_SIZE(slots_h40)};
+	for (int i = 0; i < 2; i++) {
+		int slot = 0;
+		for (int cycle = 0; cycle < 512; cycle++) {
+			while (slot < slot_count[i] && slots[i][slot] < cycle) {
+				slot++;
+			}
+			FIFO_Slot_Table[cycle][i] = (uint8_t)slot;
+		}
+	}
+
 	// Clear VDP_Reg before initializing the VDP.
 	// Valgrind complains if we don't do this.
 	memset(&VDP_Reg.reg[0], 0x00, sizeof(VDP_Reg.reg));
@@ -85,17 +135,49 @@ VdpPrivate::VdpPrivate(Vdp *q)
 
 VdpPrivate::~VdpPrivate()
 {
+	delete rendThread;
+	delete patternCache;
 	delete d_err;
 }
 
+/**
+ * Switch MD_Screen to the ring's back buffer.
+ * Does nothing if no ring is set.
+ */
+void VdpPrivate::useBackBuffer(void)
+{
+	if (!fbRing)
+		return;
+
+	// Frame settings are copied from the previous frame,
+	// since they're only updated when VDP registers change.
+	MdFb *const prevFb = q->MD_Screen;
+	MdFb *const fb = fbRing->writeFb();
+	if (fb == prevFb)
+		return;
+
+	fb->setBpp(prevFb->bpp());
+	fb->setImgWidth(prevFb->imgWidth());
+	fb->setImgHeight(prevFb->imgHeight());
+	fb->setImgXStart(prevFb->imgXStart());
+	fb->setImgYStart(prevFb->imgYStart());
+	q->MD_Screen = fb->ref();
+	prevFb->unref();
+
+	// VdpRend_Err only draws when something changes,
+	// so it has to redraw everything in the new buffer.
+	d_err->lastVdpMode = ~0;
+}
+
 /** Vdp **/
 
 /**
  * Initialize the VDP subsystem.
  * @param fb Existing MdFb to use. (If nullptr, allocate a new MdFb.)
+ * @param context Emulation context that owns this VDP. (May be nullptr.)
  */
-Vdp::Vdp(MdFb *fb)
-	: d(new VdpPrivate(this))
+Vdp::Vdp(MdFb *fb, EmuContext *context)
+	: d(new VdpPrivate(this, context))
 	, options(VdpPrivate::def_vdpEmuOptions)
 	, DMAT_Length(0)
 	, MD_Screen(fb ? fb->ref() : new MdFb())
@@ -128,14 +210,20 @@ Vdp::~Vdp(void)
  */
 void Vdp::reset(void)
 {
+	// Wait for deferred lines to finish rendering.
+	if (d->rendThread)
+		d->rendThread->sync();
+
 	// Reset the VDP rendering arrays.
 	d->rend_reset();
 
 	// Clear VRam and VSRam.
 	memset(&d->VRam, 0, sizeof(d->VRam));
 	memset(&d->VSRam, 0, sizeof(d->VSRam));
+	d->invalidateVRam();
 	// Clear the Sprite Attribute Table cache.
 	memset(&d->SprAttrTbl_m5.b, 0, sizeof(d->SprAttrTbl_m5.b));
+	d->invalidateSprLineIdx();
 	// Clear the sprite line cache.
 	memset(d->sprLineCache, 0, sizeof(d->sprLineCache));
 	memset(d->sprCountCache, 0, sizeof(d->sprCountCache));
@@ -155,6 +243,7 @@ void Vdp::reset(void)
 	// Reset more stuff.
 	d->VDP_Int = 0;		// No pending interrupts.
 	d->VDP_Ctrl.reset();	// VDP control struct.
+	d->VDP_FIFO.reset();	// Write FIFO.
 
 	// Reset all VDP registers.
 	// We're assuming the boot ROM is present.
@@ -340,6 +429,96 @@ void Vdp::startFrame(void)
 	d->Reg_Status.setBit(VdpStatus::VDP_STATUS_VBLANK, false);
 }
 
+/**
+ * Set the framebuffer ring.
+ * If set, MD_Screen is always the ring's back buffer.
+ * finishRender() publishes it and switches MD_Screen to
+ * the new back buffer, so the emulation thread never
+ * writes to a published frame. Use the ring's reader
+ * functions to get the most recently rendered frame.
+ * NOTE: The ring is not owned by the VDP, and must be
+ * unset before it's deleted.
+ * @param fbRing Framebuffer ring, or nullptr to render into MD_Screen.
+ */
+void Vdp::setFbRing(MdFbRing *fbRing)
+{
+	d->fbRing = fbRing;
+	d->useBackBuffer();
+}
+
+/**
+ * Get the framebuffer ring.
+ * @return Framebuffer ring, or nullptr if not set.
+ */
+MdFbRing *Vdp::fbRing(void) const
+{
+	return d->fbRing;
+}
+
+/**
+ * Start rendering a frame.
+ * This should be called after startFrame() if
+ * renderLine() will be used for this frame.
+ */
+void Vdp::startRender(void)
+{
+	// MD_Screen should already be the back buffer,
+	// but make sure nothing is drawn to a published frame.
+	d->useBackBuffer();
+}
+
+/**
+ * Finish rendering a frame.
+ * If a framebuffer ring is set, the frame is published.
+ */
+void Vdp::finishRender(void)
+{
+	if (d->rendThread) {
+		// Wait for deferred lines to finish rendering.
+		d->rendThread->sync();
+		if (d->rendThread->takeCollision())
+			d->Reg_Status.setBit(VdpStatus::VDP_STATUS_COLLISION, true);
+	}
+
+	if (d->fbRing && MD_Screen == d->fbRing->writeFb()) {
+		d->fbRing->publish();
+		// The published frame now belongs to the reader.
+		d->useBackBuffer();
+	}
+}
+
+/**
+ * Enable or disable deferred rendering.
+ * If enabled, Mode 5 lines are composed on a separate
+ * render thread while the CPUs continue running.
+ * Sprite collisions may be reported a few lines late.
+ * @param enable If true, enable deferred rendering.
+ */
+void Vdp::setDeferredRender(bool enable)
+{
+	if (enable == !!d->rendThread)
+		return;
+
+	if (enable) {
+		// NOTE: VdpRendThread's constructor marks
+		// all of VRam as dirty.
+		d->rendThread = new VdpRendThread(this);
+	} else {
+		// Queued lines are rendered before the thread exits.
+		delete d->rendThread;
+		d->rendThread = nullptr;
+	}
+}
+
+/**
+ * Is deferred rendering enabled?
+ * @return True if deferred rendering is enabled.
+ */
+bool Vdp::isDeferredRender(void) const
+{
+	return !!d->rendThread;
+}
+
 /**
  * Set a bit in the status register.
  * Wrapper for VdpStatus::setBit().
@@ -395,15 +574,21 @@ void Vdp::zomgSaveMD(LibZomg::Zomg *zomg) const
 	ctrl_reg.address	= d->VDP_Ctrl.address;
 	ctrl_reg.status = d->Reg_Status.read_raw();
 
-	// TODO: Implement the FIFO and data read buffer.
-	memset(ctrl_reg.data_fifo, 0, sizeof(ctrl_reg.data_fifo));
-	ctrl_reg.data_fifo_index = 0;
-	ctrl_reg.data_fifo_count = 0;
+	// Write FIFO.
+	// NOTE: Slot timing isn't saved.
+	memcpy(ctrl_reg.data_fifo, d->VDP_FIFO.data, sizeof(ctrl_reg.data_fifo));
+	ctrl_reg.data_fifo_index = d->VDP_FIFO.index;
+	ctrl_reg.data_fifo_count = d->VDP_FIFO.count;
+
+	// TODO: Implement the data read buffer.
 	ctrl_reg.data_read_buffer = 0;
 
 	// Make sure reserved fields are zero.
 	ctrl_reg.reserved1 = 0;
 	ctrl_reg.reserved2 = 0;
+	// DMA status isn't saved yet. (See below.)
+	// Clear it so the savestate doesn't contain stack garbage.
+	memset(ctrl_reg.dma_TBD, 0, sizeof(ctrl_reg.dma_TBD));
 
 	zomg->saveVdpCtrl_16(&ctrl_reg);
 
@@ -448,6 +633,10 @@ void Vdp::zomgRestoreMD(LibZomg::Zomg *zomg)
 	// TODO: Assert if called when not emulating MD VDP.
 	// TODO: Error handling.
 
+	// Wait for deferred lines to finish rendering.
+	if (d->rendThread)
+		d->rendThread->sync();
+
 	// Load the user-accessible VDP registers.
 	// TODO: Move "24" to a const somewhere.
 	uint8_t vdp_reg[24];
@@ -476,7 +665,21 @@ void Vdp::zomgRestoreMD(LibZomg::Zomg *zomg)
 		status |= ctrl_reg.status & ~VdpStatus::VDP_STATUS_PAL;
 		d->Reg_Status.write_raw(status);
 
-		// TODO: Implement the FIFO and data read buffer.
+		// Write FIFO.
+		// NOTE: Slot timing isn't saved, so each pending entry's
+		// slot cost is derived from the current destination, and
+		// none of its slots are considered to have been used yet.
+		d->VDP_FIFO.reset();
+		memcpy(d->VDP_FIFO.data, ctrl_reg.data_fifo, sizeof(d->VDP_FIFO.data));
+		d->VDP_FIFO.index = ctrl_reg.data_fifo_index & 3;
+		d->VDP_FIFO.count = (ctrl_reg.data_fifo_count <= 4 ? ctrl_reg.data_fifo_count : 4);
+		const uint8_t cost =
+			((d->VDP_Ctrl.code & VdpTypes::CD_DEST_MASK) == VdpTypes::CD_DEST_VRAM ? 2 : 1);
+		for (int i = 0; i < d->VDP_FIFO.count; i++) {
+			d->VDP_FIFO.cost[(d->VDP_FIFO.index - 1 - i) & 3] = cost;
+		}
+
+		// TODO: Implement the data read buffer.
 	} else {
 		// TODO: Handle this error...
 		LOG_MSG(vdp_m5, LOG_MSG_LEVEL_WARNING,
@@ -485,6 +688,7 @@ void Vdp::zomgRestoreMD(LibZomg::Zomg *zomg)
 
 	// Load VRam.
 	zomg->loadVRam(d->VRam.u16, sizeof(d->VRam.u16), ZOMG_BYTEORDER_16H);
+	d->invalidateVRam();
 
 	// Load CRam.
 	Zomg_CRam_t cram;
@@ -523,6 +727,7 @@ void Vdp::zomgRestoreMD(LibZomg::Zomg *zomg)
 			sat_cache[5] = sat_zomg[3];
 		}
 	}
+	d->invalidateSprLineIdx();
 
 	// Clear the sprite dot overflow flag.
 	d->sprDotOverflow = false;
@@ -548,4 +753,33 @@ void Vdp::zomgRestoreMD(LibZomg::Zomg *zomg)
 	}
 }
 
+
+/** In-memory state functions. **/
+
+/**
+ * Save the internal counters.
+ * @param state RuntimeState struct to save to.
+ */
+void Vdp::saveRuntimeState(RuntimeState *state) const
+{
+	state->VDP_Int = d->VDP_Int;
+	state->HInt_Counter = d->HInt_Counter;
+	state->DMAT_Length = DMAT_Length;
+	state->DMAT_Type = (int)d->DMAT_Type;
+}
+
+/**
+ * Restore the internal counters.
+ * This should be called after zomgRestoreMD().
+ * NOTE: The M68K interrupt line isn't updated here.
+ * @param state RuntimeState struct to restore from.
+ */
+void Vdp::restoreRuntimeState(const RuntimeState *state)
+{
+	d->VDP_Int = state->VDP_Int;
+	d->HInt_Counter = state->HInt_Counter;
+	DMAT_Length = state->DMAT_Length;
+	d->DMAT_Type = (VdpPrivate::DMAT_Type_t)state->DMAT_Type;
+}
+
 }
@@ -41,16 +41,20 @@ namespace LibZomg {
 
 namespace LibGens {
 
+class EmuContext;
+class MdFbRing;
+
 class VdpPrivate;
 class Vdp
 {
 	public:
 		// TODO: Remove MdFb.
-		Vdp(MdFb *fb = nullptr);
+		Vdp(MdFb *fb = nullptr, EmuContext *context = nullptr);
 		~Vdp();
 
 	protected:
 		friend class VdpPrivate;
+		friend class VdpRendThreadPrivate;
 		VdpPrivate *const d;
 	private:
 		// Q_DISABLE_COPY() equivalent.
@@ -154,6 +158,81 @@ class Vdp
 		 */
 		void renderLine(void);
 
+		/**
+		 * Update the VDP for a line that isn't rendered.
+		 * This should be called instead of renderLine()
+		 * if the frame is being skipped.
+		 */
+		void skipLine(void);
+
+		/**
+		 * Get the line cycle where the active display ends.
+		 * Used by the emulation loop if options.midLineWrites is set.
+		 * @return Line cycle. (68000 cycles from the start of the line)
+		 */
+		unsigned int activeDisplayEnd(void) const;
+
+		/**
+		 * Finish the current line.
+		 * If options.midLineWrites is set, VDP writes that occurred
+		 * after renderLine() are applied at the pixel column where
+		 * they happened. This should be called at the end of the
+		 * active display.
+		 */
+		void finishLine(void);
+
+		/** Framebuffer ring. **/
+
+		/**
+		 * Set the framebuffer ring.
+		 * If set, MD_Screen is always the ring's back buffer.
+		 * finishRender() publishes it and switches MD_Screen to
+		 * the new back buffer, so the emulation thread never
+		 * writes to a published frame. Use the ring's reader
+		 * functions to get the most recently rendered frame.
+		 * NOTE: The ring is not owned by the VDP, and must be
+		 * unset before it's deleted.
+		 * @param fbRing Framebuffer ring, or nullptr to render into MD_Screen.
+		 */
+		void setFbRing(MdFbRing *fbRing);
+
+		/**
+		 * Get the framebuffer ring.
+		 * @return Framebuffer ring, or nullptr if not set.
+		 */
+		MdFbRing *fbRing(void) const;
+
+		/**
+		 * Start rendering a frame.
+		 * This should be called after startFrame() if
+		 * renderLine() will be used for this frame.
+		 */
+		void startRender(void);
+
+		/**
+		 * Finish rendering a frame.
+		 * If a framebuffer ring is set, the frame is published,
+		 * and MD_Screen is switched to the new back buffer.
+		 */
+		void finishRender(void);
+
+		/** Deferred rendering. **/
+
+		/**
+		 * Enable or disable deferred rendering.
+		 * If enabled, Mode 5 lines are composed on a separate
+		 * render thread while the CPUs continue running.
+		 * Sprite collisions may be reported a few lines late.
+		 * @param enable If true, enable deferred rendering.
+		 */
+		void setDeferredRender(bool enable);
+
+		/**
+		 * Is deferred rendering enabled?
+		 * @return True if deferred rendering is enabled.
+		 */
+		bool isDeferredRender(void) const;
+
 	public:
 		/** MD-side interface. **/
 		// NOTE: Byte-wide MD ctrl/data functions are
@@ -169,6 +248,17 @@ class Vdp
 		void writeCtrlMD(uint16_t ctrl);
 		void writeCtrlMD_8(uint8_t ctrl);
 
+		/**
+		 * Is the status register stable?
+		 * If it is, reading the control port returns the same value
+		 * until the VDP is written to or the current 68000 timeslice
+		 * ends, since the status flags are otherwise only updated
+		 * between timeslices. The FIFO flags change as the FIFO
+		 * drains, so the FIFO must be empty.
+		 * @return True if the status register is stable.
+		 */
+		bool isStatusStable(void) const;
+
 		// H/V counter: $C00008 [mirrors: 0A, 0C, 0E]
 		uint16_t readHVCounterMD(void);	// convenience function
 		uint8_t readHCounter(void);
@@ -210,6 +300,31 @@ class Vdp
 		 */
 		void zomgRestoreMD(LibZomg::Zomg *zomg);
 
+		/** In-memory state functions. **/
+
+		/**
+		 * Internal counters that aren't in ZOMG savestates.
+		 */
+		struct RuntimeState {
+			int VDP_Int;
+			int HInt_Counter;
+			int DMAT_Length;
+			int DMAT_Type;
+		};
+
+		/**
+		 * Save the internal counters.
+		 * @param state RuntimeState struct to save to.
+		 */
+		void saveRuntimeState(RuntimeState *state) const;
+
+		/**
+		 * Restore the internal counters.
+		 * This should be called after zomgRestoreMD().
+		 * @param state RuntimeState struct to restore from.
+		 */
+		void restoreRuntimeState(const RuntimeState *state);
+
 	public:
 		// TODO: Move to private class.
 		int DMAT_Length;
@@ -250,6 +365,7 @@ class Vdp
 		int dbg_setTestReg(uint16_t val);
 
 		// TODO: Better VRAM writing functions.
+		int dbg_readVRam_16(uint32_t address, uint16_t *vram, int length) const;
 		int dbg_writeVRam_16(uint32_t address, const uint16_t *vram, int length);
 		int dbg_writeCRam_16(uint8_t address, const uint16_t *cram, int length);
 		int dbg_writeVSRam_16(uint8_t address, const uint16_t *vsram, int length);
@@ -44,6 +44,9 @@ VdpCache::VdpCache()
 	init_m4_lut();
 }
 
+VdpCache::~VdpCache()
+{ }
+
 /**
  * Initialize the Mode 4 lookup table.
  */
@@ -160,6 +163,10 @@ void VdpCache::update_m4(const VRam_t *vram)
 				// TODO: Combine with update_m5, since this function is
 				// nearly identical except for the pattern retrieval code?
 				uint32_t src = m4_lookup(vram_src[y*2], vram_src[y*2+1]);
+#if SYS_BYTEORDER == SYS_LIL_ENDIAN
+				// Rotate the pattern data into VRam_t::u32[] order.
+				src = (src << 16) | (src >> 16);
+#endif
 
 				// Update the normal cache.
 				cache.x8[0][tile][y] = src;
@@ -197,11 +204,9 @@ void VdpCache::update_m5(const VRam_t *vram)
 				// Line is dirty.
 				// TODO: Combine with update_m4, since this function is
 				// nearly identical except for the pattern retrieval code?
+				// NOTE: The cache uses the VRam_t::u32[] layout,
+				// so no byteswapping is needed here.
 				uint32_t src = vram_src[y];
-#if SYS_BYTEORDER == SYS_LIL_ENDIAN
-				// Rotate the source data into the correct order.
-				src = (src << 16) | (src >> 16);
-#endif
 
 				// Update the normal cache.
 				cache.x8[0][tile][y] = src;
@@ -40,8 +40,7 @@ namespace VdpTypes {
 }
 
 class VdpCache {
-	// NOTE: This class isn't currently in use.
-	private:
+	public:
 		VdpCache();
 		~VdpCache();
 
@@ -59,6 +58,19 @@ class VdpCache {
 		 */
 		void invalidate(void);
 
+		/**
+		 * Mark a VRAM address as dirty.
+		 * This must be called whenever VRAM is written.
+		 * @param address VRAM address. (bytes)
+		 */
+		inline void markDirty(uint32_t address);
+
+		/**
+		 * Are any patterns dirty?
+		 * @return True if update_m4() or update_m5() needs to be called.
+		 */
+		inline bool isDirty(void) const;
+
 		/**
 		 * Update the pattern cache. (Mode 4)
 		 * @param vram VRAM source data.
@@ -113,6 +125,13 @@ class VdpCache {
 		 */
 		inline uint32_t pattern_line_m5_spr_8x16(uint16_t attr, int y);
 
+		/**
+		 * Get a pattern line by VRAM address. (Mode 5)
+		 * @param hflip H flip. (0=normal, 1=H)
+		 * @param address VRAM address. (bytes)
+		 */
+		inline uint32_t pattern_line_m5_addr(unsigned int hflip, uint32_t address);
+
 	protected:
 		/**
 		 * Mode 4 lookup table.
@@ -147,7 +166,11 @@ class VdpCache {
 
 		/**
 		 * Pattern cache for Mode 4 and Mode 5.
-		 * Internal data is packed Mode 5 format.
+		 * Internal data is packed Mode 5 format, using the
+		 * same host-endian DWORD layout as VRam_t::u32[],
+		 * so the renderer's pixel masks work unchanged.
+		 * The H-flip cache is a full nybble reversal,
+		 * which is a valid H-flip of that layout.
 		 *
 		 * TODO: Store the data "reversed"?
 		 * i.e. left pixel is low nybble for no-flip
@@ -186,6 +209,31 @@ class VdpCache {
 		unsigned int dirty_idx;
 };
 
+/**
+ * Mark a VRAM address as dirty.
+ * This must be called whenever VRAM is written.
+ * @param address VRAM address. (bytes)
+ */
+inline void VdpCache::markDirty(uint32_t address)
+{
+	// TODO: 128 KB support.
+	const unsigned int tile = (address >> 5) & 0x7FF;
+	if (dirty_flags[tile] == 0) {
+		// Tile isn't in the dirty list yet.
+		dirty_list[dirty_idx++] = tile;
+	}
+	dirty_flags[tile] |= (1 << ((address >> 2) & 7));
+}
+
+/**
+ * Are any patterns dirty?
+ * @return True if update_m4() or update_m5() needs to be called.
+ */
+inline bool VdpCache::isDirty(void) const
+{
+	return (dirty_idx > 0);
+}
+
 /**
  * Get a pattern line. (Mode 4, nametable, 8x8 cell)
  * @param attr Nametable attribute word.
@@ -301,6 +349,18 @@ inline uint32_t VdpCache::pattern_line_m5_spr_8x16(uint16_t attr, int y)
 	return cache.x8[(attr >> 11) & 1][tile][y & 7];
 }
 
+/**
+ * Get a pattern line by VRAM address. (Mode 5)
+ * @param hflip H flip. (0=normal, 1=H)
+ * @param address VRAM address. (bytes)
+ */
+inline uint32_t VdpCache::pattern_line_m5_addr(unsigned int hflip, uint32_t address)
+{
+	assert(hflip <= 1);
+	// TODO: 128 KB support.
+	return cache.d[hflip][(address >> 2) & 0x3FFF];
+}
+
 }
 
 #endif /* __LIBGENS_MD_VDPCACHE_HPP__ */
@@ -157,6 +157,29 @@ int Vdp::dbg_setTestReg(uint16_t val)
 	return 0;
 }
 
+/**
+ * Read data from VRAM.
+ * @param address Source address.
+ * @param vram Buffer for VRAM data.
+ * @param length Length, in bytes.
+ * @return 0 on success; non-zero on error.
+ */
+int Vdp::dbg_readVRam_16(uint32_t address, uint16_t *vram, int length) const
+{
+	if (address & 1 || length & 1 ||
+	    address >= 0x10000 || address + length > 0x10000) {
+		// Invalid address:
+		// - Address and length must be even.
+		// - Must start within VRAM.
+		// - Must not wrap around the end of VRAM.
+		// TODO: Support 128 KB VRAM?
+		return -1;
+	}
+
+	memcpy(vram, &d->VRam.u16[address>>1], length);
+	return 0;
+}
+
 /**
  * Write data to VRAM.
  * @param address Destination address.
@@ -178,12 +201,15 @@ int Vdp::dbg_writeVRam_16(uint32_t address, const uint16_t *vram, int length)
 
 	memcpy(&d->VRam.u16[address>>1], vram, length);
 
-	// Check if the VRAM write overlaps the Sprite Attribute Table.
+	// Mark the written patterns as dirty, and check if
+	// the VRAM write overlaps the Sprite Attribute Table.
 	// TODO: Optimize this into a few calculations and a memcpy.
 	for (; length > 0; address += 2, length -= 2, vram++) {
+		d->markVRamDirty(address);
 		if ((address & d->Spr_Tbl_Mask) == d->Spr_Tbl_Addr) {
 			// Sprite Attribute Table.
 			d->SprAttrTbl_m5.w[(address & ~d->Spr_Tbl_Mask) >> 1] = *vram;
+			d->markSprAttrDirty(address & ~d->Spr_Tbl_Mask);
 		}
 	}
 
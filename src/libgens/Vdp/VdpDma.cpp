@@ -29,8 +29,13 @@
 // LOG_MSG() subsystem.
 #include "macros/log_msg.h"
 
+// C includes. (C++ namespace)
+#include <cstring>
+
 // M68K CPU.
+#include "cpu/M68K.hpp"
 #include "cpu/M68K_Mem.hpp"
+#include "EmuContext/EmuContext.hpp"
 #include "Cartridge/RomCartridgeMD.hpp"
 
 namespace LibGens {
@@ -68,15 +73,21 @@ void VdpPrivate::DMA_Fill(uint16_t data)
 
 	// TODO: Do DMA FILL line-by-line instead of all at once.
 	const uint8_t fill_hi = (data >> 8) & 0xFF;
+	// CRAM and VSRAM fills use the next FIFO entry instead of
+	// the data word. This is the oldest word in the FIFO, which
+	// was written three data port writes before this one.
+	const uint16_t fill_word = VDP_FIFO.data[VDP_FIFO.index];
 	switch (VDP_Ctrl.code & VdpTypes::CD_DEST_MODE_MASK) {
 		case VdpTypes::CD_DEST_VRAM_WRITE:
 			// Write to VRAM.
 			do {
 				// NOTE: DMA FILL writes to the adjacent byte.
 				VRam.u8[address ^ 1 ^ U16DATA_U8_INVERT] = fill_hi;
+				markVRamDirty(address);
 				if ((address & Spr_Tbl_Mask) == Spr_Tbl_Addr) {
 					// Sprite Attribute Table.
 					SprAttrTbl_m5.b[(address & ~Spr_Tbl_Mask) ^ U16DATA_U8_INVERT] = fill_hi;
+					markSprAttrDirty(address & ~Spr_Tbl_Mask);
 				}
 				address += VDP_Reg.m5.Auto_Inc;
 				address &= VRam_Mask;
@@ -85,9 +96,10 @@ void VdpPrivate::DMA_Fill(uint16_t data)
 
 		case VdpTypes::CD_DEST_CRAM_WRITE:
 			// Write to CRAM.
-			// TODO: FIFO emulation.
+			// NOTE: DMA fills aren't logged as mid-line writes.
+			abortLineLog();
 			do {
-				palette.writeCRam_16((address & 0x7E), data);
+				palette.writeCRam_16((address & 0x7E), fill_word);
 				address += VDP_Reg.m5.Auto_Inc;
 				address &= VRam_Mask;
 			} while (--length != 0);
@@ -95,9 +107,10 @@ void VdpPrivate::DMA_Fill(uint16_t data)
 
 		case VdpTypes::CD_DEST_VSRAM_WRITE:
 			// Write to VSRAM.
-			// TODO: FIFO emulation.
+			// NOTE: DMA fills aren't logged as mid-line writes.
+			abortLineLog();
 			do {
-				VSRam.u16[(address & 0x7E) >> 1] = data;
+				VSRam.u16[(address & 0x7E) >> 1] = fill_word;
 				address += VDP_Reg.m5.Auto_Inc;
 				address &= VRam_Mask;
 			} while (--length != 0);
@@ -119,6 +132,85 @@ void VdpPrivate::DMA_Fill(uint16_t data)
 	inc_DMA_Src_Adr(q->DMAT_Length);
 }
 
+/**
+ * Mem-to-DMA bulk transfer.
+ * This handles the common case of a contiguous source
+ * and an auto-increment of 2 without any wraparound.
+ * Source and destination words are both host-endian,
+ * so VRam transfers are a straight copy.
+ * @param dest_component Destination component.
+ * @param src Source data.
+ * @param length Length, in words.
+ * @return True if the transfer was done; false if the word loop is needed.
+ */
+template<VdpPrivate::DMA_Dest_t dest_component>
+inline bool VdpPrivate::T_DMA_Bulk(const uint16_t *src, int length)
+{
+	if (VDP_Reg.m5.Auto_Inc != 2)
+		return false;
+
+	const uint32_t address = VDP_Ctrl.address;
+	const uint32_t size = (length * 2);
+	switch (dest_component) {
+		case DMA_DEST_VRAM: {
+			// TODO: 128 KB support.
+			if ((address & 1) || (address & ~VRam_Mask) ||
+			    (address + size) > (VRam_Mask + 1))
+			{
+				// Odd address or wraparound.
+				return false;
+			}
+
+			memcpy(&VRam.u16[address >> 1], src, size);
+			markVRamDirtyRange(address, size);
+
+			// Update the overlapping part of the Sprite Attribute Table cache.
+			const uint32_t satSize = (~Spr_Tbl_Mask & VRam_Mask) + 1;
+			const uint32_t satStart = (address > Spr_Tbl_Addr ? address : Spr_Tbl_Addr);
+			const uint32_t satEnd = ((address + size) < (Spr_Tbl_Addr + satSize)
+					? (address + size)
+					: (Spr_Tbl_Addr + satSize));
+			if (satStart < satEnd) {
+				memcpy(&SprAttrTbl_m5.w[(satStart - Spr_Tbl_Addr) >> 1],
+					&VRam.u16[satStart >> 1], satEnd - satStart);
+				for (uint32_t sat = satStart; sat < satEnd; sat += 2) {
+					markSprAttrDirty(sat - Spr_Tbl_Addr);
+				}
+			}
+			break;
+		}
+
+		case DMA_DEST_CRAM:
+			// CRam is 128 bytes. (64 words)
+			// NOTE: Writes past 0x80 are ignored. (See vdpDataWrite_int().)
+			if ((address + size) > 0x80)
+				return false;
+			// NOTE: Bulk transfers aren't logged as mid-line writes.
+			abortLineLog();
+			for (uint32_t i = 0; i < (uint32_t)length; i++) {
+				palette.writeCRam_16((address + (i * 2)) & 0x7E, src[i]);
+			}
+			break;
+
+		case DMA_DEST_VSRAM:
+			// VSRam is 80 bytes, but 128 bytes are addressable.
+			// (See vdpDataWrite_int().)
+			if ((address & 1) || (address + size) > 0x80)
+				return false;
+			// NOTE: Bulk transfers aren't logged as mid-line writes.
+			abortLineLog();
+			memcpy(&VSRam.u16[address >> 1], src, size);
+			break;
+
+		default:	// to make gcc shut up
+			return false;
+	}
+
+	// Increment the address register.
+	VDP_Ctrl.address = (address + size) & VRam_Mask;
+	return true;
+}
+
 /**
  * Mem-to-DMA loop.
  * @param src_component Source component.
@@ -127,6 +219,10 @@ void VdpPrivate::DMA_Fill(uint16_t data)
 template<VdpPrivate::DMA_Src_t src_component, VdpPrivate::DMA_Dest_t dest_component>
 inline void VdpPrivate::T_DMA_Loop(void)
 {
+	// A standalone VDP has no memory to DMA from.
+	if (!context)
+		return;
+
 	// Get the DMA source address.
 	// NOTE: DMA_Src_Adr is the source address / 2.
 	uint32_t src_address = DMA_Src_Adr() * 2;
@@ -210,8 +306,49 @@ inline void VdpPrivate::T_DMA_Loop(void)
 	// src_base_address is used to ensure 128 KB wrapping.
 	unsigned int src_base_address = ((src_address & 0xFE0000) >> 1);
 
+	// M68K memory. (DMA sources)
+	M68K_Mem *const m68kMem = context->m_m68kMem;
+
+	// Check if the transfer can be done in bulk.
+	// The source must not wrap around. (128 KB for ROM; 64 KB for RAM.)
+	const uint16_t *bulk_src = nullptr;
+	if (q->options.bulkDMA) {
+		switch (src_component) {
+			case DMA_SRC_ROM:
+				if ((src_word_address + length) <= 0x10000) {
+					bulk_src = m68kMem->m_romCartridge->romWordPtr(
+						((src_word_address | src_base_address) << 1), length);
+				}
+				break;
+
+			case DMA_SRC_M68K_RAM:
+				if ((src_word_address + length) <= (int)ARRAY_SIZE(m68kMem->Ram_68k.u16)) {
+					bulk_src = &m68kMem->Ram_68k.u16[src_word_address];
+				}
+				break;
+
+			default:	// to make gcc shut up
+				break;
+		}
+	}
+	if (bulk_src && T_DMA_Bulk<dest_component>(bulk_src, length)) {
+		// Transfer is done.
+		// DMA goes through the FIFO, so it ends up
+		// with the last four words of the transfer.
+		// The index must end up where the word loop leaves it.
+		int i = 0;
+		if (length > 4) {
+			i = length - 4;
+			VDP_FIFO.index = (VDP_FIFO.index + i) & 3;
+		}
+		for (; i < length; i++) {
+			VDP_FIFO.push(bulk_src[i]);
+		}
+		length = 0;
+	}
+
 	// TODO: Do DMA MEM-to-VRAM line-by-line instead of all at once.
-	do {
+	while (length != 0) {
 		// Get the word.
 		uint16_t w;
 		switch (src_component) {
@@ -219,13 +356,14 @@ inline void VdpPrivate::T_DMA_Loop(void)
 				// TODO: Banking is done in 512 KB segments.
 				// Optimize this by getting a pointer to the segment?
 				const uint32_t req_addr = ((src_word_address | src_base_address) << 1);
-				w = M68K_Mem::ms_RomCartridge->readWord(req_addr);
+				w = m68kMem->m_romCartridge->readWord(req_addr);
 				break;
 			}
 
 			case DMA_SRC_M68K_RAM:
-				//w = M68K_Mem::Ram_68k.u16[src_word_address];
-				w = Ram_68k.u16[src_word_address];
+				// 68K RAM is mirrored every 64 KB, so the
+				// 128 KB source wraparound stays in RAM.
+				w = m68kMem->Ram_68k.u16[src_word_address & (ARRAY_SIZE(m68kMem->Ram_68k.u16) - 1)];
 				break;
 
 			// TODO: Port to LibGens.
@@ -274,8 +412,10 @@ inline void VdpPrivate::T_DMA_Loop(void)
 
 		// Write the word.
 		// TODO: Might not work if Auto_Inc is odd...
+		VDP_FIFO.push(w);
 		vdpDataWrite_int(w);
-	} while (--length != 0);
+		length--;
+	}
 
 	// DMA is done.
 	VDP_Ctrl.code &= ~VdpTypes::CD_DMA_ENABLE;
@@ -299,7 +439,8 @@ inline void VdpPrivate::T_DMA_Loop(void)
 
 	// Update DMA.
 	int cycles = q->updateDMA();
-	M68K::ReleaseCycles(cycles);
+	context->profiler()->add(Profiler::CNT_DMA_CYCLES, cycles);
+	context->m_m68k->releaseCycles(cycles);
 }
 
 /**
@@ -330,7 +471,12 @@ void VdpPrivate::processDmaCtrlWrite(void)
 			break;
 		default:
 			// Invalid destination component.
-			return;
+			// DMA COPY always copies within VRam,
+			// so it runs with any destination code.
+			if (VDP_Ctrl.DMA_Mode != 0xC0)
+				return;
+			dest_component = VdpPrivate::DMA_DEST_VRAM;
+			break;
 	}
 
 	// Get the DMA addresses.
@@ -369,9 +515,11 @@ void VdpPrivate::processDmaCtrlWrite(void)
 		do {
 			uint8_t src = VRam.u8[src_address];
 			VRam.u8[dest_address] = src;
+			markVRamDirty(dest_address);
 			if ((dest_address & Spr_Tbl_Mask) == Spr_Tbl_Addr) {
 				// Sprite Attribute Table.
 				SprAttrTbl_m5.b[(dest_address & ~Spr_Tbl_Mask) ^ U16DATA_U8_INVERT] = src;
+				markSprAttrDirty(dest_address & ~Spr_Tbl_Mask);
 			}
 
 			// Increment the addresses.
@@ -387,6 +535,11 @@ void VdpPrivate::processDmaCtrlWrite(void)
 		// NOTE: DMA COPY uses bytes, not words.
 		inc_DMA_Src_Adr(q->DMAT_Length);	// TODO: Should DMA_Src_Adr_H's DMA flags be cleared?
 		VDP_Ctrl.address = dest_address;
+
+		// DMA is done.
+		// NOTE: If CD5 isn't cleared and M1 is disabled afterwards,
+		// every control word write would restart the copy.
+		VDP_Ctrl.code &= ~VdpTypes::CD_DMA_ENABLE;
 		return;
 	}
 
@@ -607,7 +760,8 @@ unsigned int Vdp::updateDMA(void)
 	}
 
 	// Cycles elapsed is based on M68K cycles per line.
-	unsigned int cycles = M68K_Mem::CPL_M68K;
+	// NOTE: A standalone VDP has no M68K.
+	unsigned int cycles = (d->context ? d->context->m_m68kMem->CPL_M68K : 0);
 
 	// DMA timing table.
 	static const uint8_t DMA_Timing_Table[4][4] = {
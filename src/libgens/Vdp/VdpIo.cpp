@@ -39,26 +39,6 @@
 // Emulation Context.
 #include "EmuContext/EmuContext.hpp"
 
-// C wrapper functions for Starscream.
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-uint8_t VDP_Int_Ack(void)
-{
-	// TODO: This won't work with multiple contexts...
-	LibGens::EmuContext *instance = LibGens::EmuContext::Instance();
-	if (instance != nullptr)
-		return instance->m_vdp->Int_Ack();
-
-	// TODO: What should we return here?
-	return 0;
-}
-
-#ifdef __cplusplus
-}
-#endif
-
 namespace LibGens {
 
 /**
@@ -96,34 +76,183 @@ void Vdp::updateIRQLine(int interrupt)
 	// 'interrupt' contains a new interrupt value.
 	d->VDP_Int |= interrupt;
 
+	// No CPU to interrupt if the VDP is used standalone.
+	if (!d->context)
+		return;
+	M68K *const m68k = d->context->m_m68k;
+
 	// TODO: HBlank interrupt should take priority over VBlank interrupt.
 	if ((d->VDP_Reg.m5.Set2 & VDP_REG_M5_SET2_IE0) && (d->VDP_Int & 0x08)) {
 		// VBlank interrupt.
-		M68K::Interrupt(6, -1);
+		m68k->interrupt(6, -1);
 		return;
 	} else if ((d->VDP_Reg.m5.Set1 & VDP_REG_M5_SET1_IE1) && (d->VDP_Int & 0x04)) {
 		// HBlank interrupt.
-		M68K::Interrupt(4, -1);
+		m68k->interrupt(4, -1);
 		return;
 	}
 
 	// No VDP interrupts.
 	// TODO: Move to M68K class.
 #ifdef GENS_ENABLE_EMULATION
-	M68K::Interrupt(0, -1);
+	m68k->interrupt(0, -1);
 	//main68k_context.interrupts[0] &= 0xF0;
 #endif /* GENS_ENABLE_EMULATION */
 }
 
+/**
+ * Get the 68000 cycle within the current line.
+ * @return Line cycle. (0-511)
+ */
+unsigned int VdpPrivate::lineCycle(void) const
+{
+	unsigned int odo_68K = 0;
+	if (context) {
+		const M68K_Mem *const m68kMem = context->m_m68kMem;
+		// Mid-line writes need the 68000's exact position
+		// within the timeslice. Otherwise, the odometer is
+		// only updated when the timeslice ends.
+		odo_68K = (q->options.midLineWrites
+			? context->m_m68k->readOdometerExact()
+			: context->m_m68k->readOdometer());
+		odo_68K -= (m68kMem->Cycles_M68K - m68kMem->CPL_M68K);
+		odo_68K &= 0x1FF;
+	}
+	return odo_68K;
+}
+
+/**
+ * Commit pending FIFO entries using the access slots
+ * that have passed since the last update.
+ * @param now 68000 odometer.
+ */
+void VdpPrivate::fifoUpdate(unsigned int now)
+{
+	const unsigned int last = VDP_FIFO.lastCycle;
+	VDP_FIFO.lastCycle = now;
+	if (VDP_FIFO.count == 0)
+		return;
+
+	if (!context || !isFifoTimed()) {
+		// Every slot is an access slot.
+		VDP_FIFO.count = 0;
+		VDP_FIFO.progress = 0;
+		return;
+	}
+
+	// Count the access slots since the last update.
+	const M68K_Mem *const m68kMem = context->m_m68kMem;
+	const unsigned int cpl = m68kMem->CPL_M68K;
+	const unsigned int lineStart = m68kMem->Cycles_M68K - cpl;
+	const int h40 = (isH40() ? 1 : 0);
+	unsigned int pos = (now > lineStart ? now - lineStart : 0);
+	if (pos > 511)
+		pos = 511;
+
+	unsigned int slots;
+	if (now < last) {
+		// Odometer was reset for a new frame.
+		slots = 8;
+	} else if (last >= lineStart) {
+		// Same line.
+		const unsigned int lastPos = (last - lineStart <= 511 ? last - lineStart : 511);
+		slots = FIFO_Slot_Table[pos][h40] -
+			FIFO_Slot_Table[lastPos][h40];
+	} else if (last + cpl >= lineStart) {
+		// Previous line.
+		slots = FIFO_Slot_Table[511][h40] -
+			FIFO_Slot_Table[last + cpl - lineStart][h40] +
+			FIFO_Slot_Table[pos][h40];
+	} else {
+		// More than a line has passed.
+		// This is enough to commit every entry.
+		slots = 8;
+	}
+
+	// Commit entries, oldest first.
+	while (VDP_FIFO.count > 0) {
+		const int head = (VDP_FIFO.index - VDP_FIFO.count) & 3;
+		const unsigned int need = VDP_FIFO.cost[head] - VDP_FIFO.progress;
+		if (slots < need) {
+			VDP_FIFO.progress += slots;
+			break;
+		}
+		slots -= need;
+		VDP_FIFO.progress = 0;
+		VDP_FIFO.count--;
+	}
+}
+
+/**
+ * Queue a data port write in the FIFO.
+ * If the FIFO is full, the 68000 is stalled until
+ * the oldest entry is committed.
+ * @param data Data word.
+ */
+void VdpPrivate::fifoWrite(uint16_t data)
+{
+	if (!context || !isFifoTimed()) {
+		// Fast path: The FIFO can't fill up, so
+		// the write is committed immediately.
+		VDP_FIFO.count = 0;
+		VDP_FIFO.progress = 0;
+		VDP_FIFO.push(data);
+		return;
+	}
+
+	M68K *const m68k = context->m_m68k;
+	const unsigned int now = m68k->readOdometerExact();
+	fifoUpdate(now);
+
+	if (VDP_FIFO.count == 4) {
+		// FIFO is full. Find the access slot that
+		// commits the oldest entry, and stall until then.
+		const M68K_Mem *const m68kMem = context->m_m68kMem;
+		const unsigned int cpl = m68kMem->CPL_M68K;
+		const unsigned int lineStart = m68kMem->Cycles_M68K - cpl;
+		const int h40 = (isH40() ? 1 : 0);
+		unsigned int pos = (now > lineStart ? now - lineStart : 0);
+		if (pos >= cpl)
+			pos = cpl - 1;
+
+		unsigned int need = VDP_FIFO.cost[VDP_FIFO.index] - VDP_FIFO.progress;
+		unsigned int base = FIFO_Slot_Table[pos][h40];
+		int wait = 0;
+		for (;;) {
+			pos++;
+			wait++;
+			const unsigned int slots = FIFO_Slot_Table[pos][h40] - base;
+			if (slots >= need)
+				break;
+			if (pos >= cpl) {
+				// Continue on the next line.
+				need -= slots;
+				pos = 0;
+				base = 0;
+			}
+		}
+
+		m68k->stall(wait);
+		VDP_FIFO.lastCycle = now + wait;
+		VDP_FIFO.progress = 0;
+		VDP_FIFO.count--;
+	}
+
+	// Queue the write.
+	// VRam writes use two access slots; everything else uses one.
+	VDP_FIFO.cost[VDP_FIFO.index] =
+		((VDP_Ctrl.code & VdpTypes::CD_DEST_MASK) == VdpTypes::CD_DEST_VRAM ? 2 : 1);
+	VDP_FIFO.push(data);
+	VDP_FIFO.count++;
+}
+
 /**
  * Read the H Counter.
  * @return H Counter.
  */
 uint8_t Vdp::readHCounter(void)
 {
-	unsigned int odo_68K = M68K::ReadOdometer();
-	odo_68K -= (M68K_Mem::Cycles_M68K - M68K_Mem::CPL_M68K);
-	odo_68K &= 0x1FF;
+	const unsigned int odo_68K = d->lineCycle();
 
 	// H_Counter_Table[][0] == H32.
 	// H_Counter_Table[][1] == H40.
@@ -140,9 +269,7 @@ uint8_t Vdp::readHCounter(void)
  */
 uint8_t Vdp::readVCounter(void)
 {
-	unsigned int odo_68K = M68K::ReadOdometer();
-	odo_68K -= (M68K_Mem::Cycles_M68K - M68K_Mem::CPL_M68K);
-	odo_68K &= 0x1FF;
+	const unsigned int odo_68K = d->lineCycle();
 
 	unsigned int H_Counter;
 	uint8_t bl, bh;		// TODO: Figure out what this actually means.
@@ -234,6 +361,13 @@ void Vdp::writeTestRegMD_8(uint8_t data)
  */
 uint16_t Vdp::readCtrlMD(void)
 {
+	// Update the FIFO flags.
+	if (d->VDP_FIFO.count != 0 && d->context) {
+		d->fifoUpdate(d->context->m_m68k->readOdometerExact());
+	}
+	d->Reg_Status.setBit(VdpStatus::VDP_STATUS_FULL, (d->VDP_FIFO.count == 4));
+	d->Reg_Status.setBit(VdpStatus::VDP_STATUS_EMPTY, (d->VDP_FIFO.count == 0));
+
 	const uint16_t status = d->Reg_Status.read();
 
 	// Reading the control port clears the control word latch.
@@ -246,6 +380,17 @@ uint16_t Vdp::readCtrlMD(void)
 		return (status | VdpStatus::VDP_STATUS_VBLANK);
 }
 
+/**
+ * Is the status register stable?
+ * If it is, reading the control port returns the same value
+ * until the VDP is written to or the current 68000 timeslice ends.
+ * @return True if the status register is stable.
+ */
+bool Vdp::isStatusStable(void) const
+{
+	return (d->VDP_FIFO.count == 0);
+}
+
 /**
  * Read the VDP data port. (M5)
  * This returns the requested data as set by the control word.
@@ -280,22 +425,25 @@ uint16_t Vdp::readDataMD(void)
 
 		case VdpTypes::CD_DEST_CRAM_READ:
 			// CRam Read.
-			// FIXME: Missing bits should come from the FIFO.
-			data = d->palette.readCRam_16(d->VDP_Ctrl.address & 0x7E);
+			// Missing bits come from the next FIFO entry.
+			data = (d->palette.readCRam_16(d->VDP_Ctrl.address & 0x7E) & 0x0EEE) |
+			       (d->VDP_FIFO.data[d->VDP_FIFO.index] & ~0x0EEE);
 			break;
 
 		case VdpTypes::CD_DEST_VSRAM_READ:
 			// VSRam Read.
-			// FIXME: Missing bits should come from the FIFO.
+			// Missing bits come from the next FIFO entry.
 			// FIXME: MD1 and MD2 only have 80 bytes. (Genesis 3 has 128.)
-			data = d->VSRam.u16[(d->VDP_Ctrl.address & 0x7E) >> 1];
+			data = (d->VSRam.u16[(d->VDP_Ctrl.address & 0x7E) >> 1] & 0x07FF) |
+			       (d->VDP_FIFO.data[d->VDP_FIFO.index] & ~0x07FF);
 			break;
 
 		case VdpTypes::CD_DEST_VRAM_8BIT:
 			// VRam Read. (8-bit; undocumented)
 			// Low byte is from VRAM, with inverted LSB.
-			// High byte is the high byte of the next FIFO entry. (TODO)
-			data = d->VRam.u8[(d->VDP_Ctrl.address & d->VRam_Mask) ^ 1 ^ U16DATA_U8_INVERT];
+			// High byte is the high byte of the next FIFO entry.
+			data = d->VRam.u8[(d->VDP_Ctrl.address & d->VRam_Mask) ^ 1 ^ U16DATA_U8_INVERT] |
+			       (d->VDP_FIFO.data[d->VDP_FIFO.index] & 0xFF00);
 			break;
 
 		default:
@@ -332,9 +480,9 @@ void Vdp::writeDataMD_8(uint8_t data)
 }
 
 /**
- * Read to the VDP data port. (M5)
+ * Write to the VDP data port. (M5)
  * This writes to the target memory as set by the control word.
- * TODO: Implement the FIFO.
+ * The write goes through the FIFO, which may stall the 68000.
  * @param data 16-bit data.
  */
 void Vdp::writeDataMD(uint16_t data)
@@ -346,6 +494,9 @@ void Vdp::writeDataMD(uint16_t data)
 	// Writing to the data port clears the control word latch.
 	d->VDP_Ctrl.ctrl_latch = 0;
 
+	// Queue the write in the FIFO.
+	d->fifoWrite(data);
+
 	if (d->VDP_Ctrl.code & VdpTypes::CD_MODE_WRITE)
 		d->vdpDataWrite_int(data);
 
@@ -383,9 +534,11 @@ void VdpPrivate::vdpDataWrite_int(uint16_t data)
 				tmp_data = data;
 			}
 			VRam.u16[address>>1] = tmp_data;
+			markVRamDirty(address);
 			if ((address & Spr_Tbl_Mask) == Spr_Tbl_Addr) {
 				// Sprite Attribute Table.
 				SprAttrTbl_m5.w[(address & ~Spr_Tbl_Mask) >> 1] = tmp_data;
+				markSprAttrDirty(address & ~Spr_Tbl_Mask);
 			}
 			break;
 		}
@@ -405,6 +558,11 @@ void VdpPrivate::vdpDataWrite_int(uint16_t data)
 			// Write the word to CRam.
 			// CRam is 128 bytes. (64 words)
 			if (address < 0x80) {
+				if (lineLogCount >= 0) {
+					// Mid-line write.
+					logLineWrite(LINEWRITE_CRAM, (address & 0x7E) >> 1,
+						palette.readCRam_16(address & 0x7E), data);
+				}
 				palette.writeCRam_16((address & 0x7E), data);
 			}
 			break;
@@ -418,6 +576,11 @@ void VdpPrivate::vdpDataWrite_int(uint16_t data)
 			// VSRam is 80 bytes. (40 words)
 			// TODO: VSRam is 80 bytes, but we're allowing a maximum of 128 bytes here...
 			// TODO: Mask off high bits? (Only 10/11 bits are present.)
+			if (lineLogCount >= 0) {
+				// Mid-line write.
+				logLineWrite(LINEWRITE_VSRAM, (address & 0x7E) >> 1,
+					VSRam.u16[(address & 0x7E) >> 1], data);
+			}
 			VSRam.u16[(address & 0x7E) >> 1] = data;
 			break;
 
@@ -431,6 +594,137 @@ void VdpPrivate::vdpDataWrite_int(uint16_t data)
 	VDP_Ctrl.address &= VRam_Mask;
 }
 
+/**
+ * Log a mid-line write.
+ * @param type Write type. (See LineWriteType_t.)
+ * @param index Register number, or CRam/VSRam word index.
+ * @param oldVal Value before the write.
+ * @param newVal Value after the write.
+ */
+void VdpPrivate::logLineWrite(LineWriteType_t type, uint8_t index, uint16_t oldVal, uint16_t newVal)
+{
+	if (lineLogCount >= LINE_LOG_MAX) {
+		// Too many writes on this line.
+		abortLineLog();
+		return;
+	}
+
+	// Determine the pixel column from the H counter.
+	// Each H counter step is 2 pixels.
+	const unsigned int hc = H_Counter_Table[lineCycle()][isH40() ? 1 : 0];
+	unsigned int column;
+	if (hc >= 0xE0) {
+		// Before the active display.
+		column = 0;
+	} else {
+		column = (hc * 2);
+		if (column > (unsigned int)H_Pix)
+			column = H_Pix;
+	}
+
+	// Columns can't go backwards.
+	if (lineLogCount > 0 && column < lineLog[lineLogCount-1].column)
+		column = lineLog[lineLogCount-1].column;
+
+	LineWrite_t *const lw = &lineLog[lineLogCount++];
+	lw->column = column;
+	lw->type = type;
+	lw->index = index;
+	lw->oldVal = oldVal;
+	lw->newVal = newVal;
+}
+
+/**
+ * Set a VDP register while mid-line writes are being logged.
+ * @param reg_num Register number.
+ * @param val New value for the register.
+ */
+void VdpPrivate::setRegMidLine(int reg_num, uint8_t val)
+{
+	if (reg_num > 23) {
+		// Not a valid Mode 5 register.
+		setReg(reg_num, val);
+		return;
+	}
+
+	const uint8_t oldVal = VDP_Reg.reg[reg_num];
+	const uint8_t diff = (oldVal ^ val);
+	switch (reg_num) {
+		case 0:
+			// Mode Set 1.
+			// Mode changes can't be split.
+			if (diff & (VDP_REG_M5_SET1_M4 | VDP_REG_M5_SET1_M3))
+				abortLineLog();
+			else if (diff)
+				logLineWrite(LINEWRITE_REG, reg_num, oldVal, val);
+			break;
+
+		case 1:
+			// Mode Set 2.
+			// Mode changes can't be split.
+			if (diff & (VDP_REG_M5_SET2_128K | VDP_REG_M5_SET2_M1 |
+				    VDP_REG_M5_SET2_M2 | VDP_REG_M5_SET2_M5))
+				abortLineLog();
+			else if (diff)
+				logLineWrite(LINEWRITE_REG, reg_num, oldVal, val);
+			break;
+
+		case 12:
+			// Mode Set 4.
+			// H32/H40 and interlaced mode changes can't be split.
+			if (diff & 0x87)
+				abortLineLog();
+			else if (diff)
+				logLineWrite(LINEWRITE_REG, reg_num, oldVal, val);
+			break;
+
+		case 2: case 3: case 4: case 6: case 7:
+		case 11: case 13: case 14: case 16: case 17: case 18:
+			// Registers that affect rendering.
+			if (diff)
+				logLineWrite(LINEWRITE_REG, reg_num, oldVal, val);
+			break;
+
+		default:
+			// Registers that don't affect the current line.
+			break;
+	}
+
+	setReg(reg_num, val);
+}
+
+/**
+ * Apply or undo a mid-line write.
+ * @param lw Mid-line write.
+ * @param undo If true, restore the old value.
+ */
+void VdpPrivate::applyLineWrite(const LineWrite_t *lw, bool undo)
+{
+	const uint16_t val = (undo ? lw->oldVal : lw->newVal);
+	switch (lw->type) {
+		case LINEWRITE_REG:
+			if (lw->index <= 1) {
+				// Mode Set 1/2: Only rendering bits are logged.
+				// setReg() isn't used because it updates the IRQ line.
+				VDP_Reg.reg[lw->index] = (uint8_t)val;
+			} else {
+				setReg(lw->index, (uint8_t)val);
+			}
+			break;
+
+		case LINEWRITE_CRAM:
+			palette.writeCRam_16((lw->index << 1), val);
+			break;
+
+		case LINEWRITE_VSRAM:
+			VSRam.u16[lw->index] = val;
+			break;
+
+		default:
+			break;
+	}
+}
+
 /**
  * Write to the VDP control port. (M5, 8-bit)
  * Convenience function. This function doubles the bytes
@@ -500,7 +794,12 @@ void Vdp::writeCtrlMD(uint16_t ctrl)
 			 * D = data
 			 */
 			const int reg = (ctrl >> 8) & 0x1F;
-			d->setReg(reg, (ctrl & 0xFF));
+			if (d->lineLogCount >= 0) {
+				// Mid-line write.
+				d->setRegMidLine(reg, (ctrl & 0xFF));
+			} else {
+				d->setReg(reg, (ctrl & 0xFF));
+			}
 		} else {
 			// First control word.
 			d->VDP_Ctrl.ctrl_latch = 1;
@@ -0,0 +1,258 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * VdpLineBuf.cpp: VDP line buffer to framebuffer conversion.              *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "VdpLineBuf.hpp"
+#include "libcompat/cpuflags.h"
+
+// C includes. (C++ namespace)
+#include <cassert>
+
+// SIMD implementations use compiler intrinsics with per-function
+// target attributes, so the rest of libgens doesn't have to be
+// built with -mavx2.
+#if (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))) || defined(__clang__)
+#if defined(__i386__) || defined(__amd64__) || defined(__x86_64__)
+#define VDPLINEBUF_HAS_SIMD 1
+#include <immintrin.h>
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace LibGens {
+
+/** Generic implementations. **/
+
+/**
+ * Resolve line buffer pixels using the active palette.
+ * @param pixel Type of pixel.
+ * @param dest		[out] Destination pixels.
+ * @param src		[in] Line buffer words.
+ * @param count		[in] Number of pixels. (must be a multiple of 8)
+ * @param md_palette	[in] Active palette. (256 entries)
+ */
+template<typename pixel>
+static inline void T_resolve_noasm(pixel *dest, const uint16_t *src, int count, const pixel *md_palette)
+{
+	// NOTE: The palette index is always the low byte,
+	// regardless of host byteorder.
+	for (; count > 0; count -= 8, dest += 8, src += 8) {
+		*(dest+0) = md_palette[*(src+0) & 0xFF];
+		*(dest+1) = md_palette[*(src+1) & 0xFF];
+		*(dest+2) = md_palette[*(src+2) & 0xFF];
+		*(dest+3) = md_palette[*(src+3) & 0xFF];
+		*(dest+4) = md_palette[*(src+4) & 0xFF];
+		*(dest+5) = md_palette[*(src+5) & 0xFF];
+		*(dest+6) = md_palette[*(src+6) & 0xFF];
+		*(dest+7) = md_palette[*(src+7) & 0xFF];
+	}
+}
+
+/**
+ * Fill pixels with a single color.
+ * @param pixel Type of pixel.
+ * @param dest	[out] Destination pixels.
+ * @param count	[in] Number of pixels. (must be a multiple of 8)
+ * @param color	[in] Color.
+ */
+template<typename pixel>
+static inline void T_fill_noasm(pixel *dest, int count, pixel color)
+{
+	for (; count > 0; count -= 8, dest += 8) {
+		*(dest+0) = color;
+		*(dest+1) = color;
+		*(dest+2) = color;
+		*(dest+3) = color;
+		*(dest+4) = color;
+		*(dest+5) = color;
+		*(dest+6) = color;
+		*(dest+7) = color;
+	}
+}
+
+#ifdef VDPLINEBUF_HAS_SIMD
+/** AVX2-optimized implementations. **/
+
+/**
+ * Fill bytes with a 32-bit pattern. (AVX2-optimized)
+ * @param dest	[out] Destination.
+ * @param bytes	[in] Number of bytes. (must be a multiple of 16)
+ * @param color	[in] 32-bit pattern.
+ */
+static TARGET_AVX2 void fill_AVX2(void *dest, int bytes, uint32_t color)
+{
+	assert(bytes % 16 == 0);
+	const __m256i ymm_color = _mm256_set1_epi32((int)color);
+	__m256i *ymm_dest = (__m256i*)dest;
+	for (; bytes >= 32; bytes -= 32, ymm_dest++) {
+		_mm256_storeu_si256(ymm_dest, ymm_color);
+	}
+	if (bytes > 0) {
+		_mm_storeu_si128((__m128i*)ymm_dest, _mm256_castsi256_si128(ymm_color));
+	}
+}
+
+/**
+ * Load eight line buffer palette indexes as 32-bit integers.
+ * @param src Line buffer words.
+ * @return Palette indexes.
+ */
+static TARGET_AVX2 inline __m256i loadIdx_AVX2(const uint16_t *src)
+{
+	const __m128i px = _mm_loadu_si128((const __m128i*)src);
+	return _mm256_cvtepu16_epi32(_mm_and_si128(px, _mm_set1_epi16(0xFF)));
+}
+
+/**
+ * Resolve line buffer pixels using the active palette. (32-bit color; AVX2-optimized)
+ * @param dest		[out] Destination pixels.
+ * @param src		[in] Line buffer words.
+ * @param count		[in] Number of pixels. (must be a multiple of 8)
+ * @param md_palette	[in] Active palette. (256 entries)
+ */
+static TARGET_AVX2 void resolve32_AVX2(uint32_t *dest, const uint16_t *src, int count, const uint32_t *md_palette)
+{
+	const int *pal = (const int*)md_palette;
+	for (; count >= 16; count -= 16, dest += 16, src += 16) {
+		// Two independent gathers per iteration.
+		const __m256i c0 = _mm256_i32gather_epi32(pal, loadIdx_AVX2(src), 4);
+		const __m256i c1 = _mm256_i32gather_epi32(pal, loadIdx_AVX2(src+8), 4);
+		_mm256_storeu_si256((__m256i*)dest, c0);
+		_mm256_storeu_si256((__m256i*)(dest+8), c1);
+	}
+	if (count > 0) {
+		const __m256i c0 = _mm256_i32gather_epi32(pal, loadIdx_AVX2(src), 4);
+		_mm256_storeu_si256((__m256i*)dest, c0);
+	}
+}
+
+/**
+ * Resolve line buffer pixels using the active palette. (16-bit color; AVX2-optimized)
+ * There's no 16-bit gather, so 32-bit gathers with a scale of 2 are used,
+ * and the high halves are discarded. This reads 2 bytes past the
+ * last palette entry; see VdpLineBuf::resolve().
+ * @param dest		[out] Destination pixels.
+ * @param src		[in] Line buffer words.
+ * @param count		[in] Number of pixels. (must be a multiple of 8)
+ * @param md_palette	[in] Active palette. (257 readable entries)
+ */
+static TARGET_AVX2 void resolve16_AVX2(uint16_t *dest, const uint16_t *src, int count, const uint16_t *md_palette)
+{
+	const int *pal = (const int*)md_palette;
+	const __m256i mask = _mm256_set1_epi32(0xFFFF);
+	for (; count >= 16; count -= 16, dest += 16, src += 16) {
+		__m256i c0 = _mm256_i32gather_epi32(pal, loadIdx_AVX2(src), 2);
+		__m256i c1 = _mm256_i32gather_epi32(pal, loadIdx_AVX2(src+8), 2);
+		c0 = _mm256_and_si256(c0, mask);
+		c1 = _mm256_and_si256(c1, mask);
+		// packus works per 128-bit lane:
+		// [c0_lo | c1_lo | c0_hi | c1_hi] -> [c0_lo | c0_hi | c1_lo | c1_hi]
+		__m256i out = _mm256_packus_epi32(c0, c1);
+		out = _mm256_permute4x64_epi64(out, 0xD8);
+		_mm256_storeu_si256((__m256i*)dest, out);
+	}
+	if (count > 0) {
+		__m256i c0 = _mm256_i32gather_epi32(pal, loadIdx_AVX2(src), 2);
+		c0 = _mm256_and_si256(c0, mask);
+		const __m128i out = _mm_packus_epi32(_mm256_castsi256_si128(c0),
+						     _mm256_extracti128_si256(c0, 1));
+		_mm_storeu_si128((__m128i*)dest, out);
+	}
+}
+#endif /* VDPLINEBUF_HAS_SIMD */
+
+/** VdpLineBuf **/
+
+/**
+ * Resolve line buffer pixels using the active palette. (16-bit color)
+ * @param dest		[out] Destination pixels.
+ * @param src		[in] Line buffer words.
+ * @param count		[in] Number of pixels. (must be a multiple of 8)
+ * @param md_palette	[in] Active palette. (257 readable entries)
+ */
+void VdpLineBuf::resolve(uint16_t *dest, const uint16_t *src, int count, const uint16_t *md_palette)
+{
+	assert(count % 8 == 0);
+#ifdef VDPLINEBUF_HAS_SIMD
+	if (CPU_Flags & MDP_CPUFLAG_X86_AVX2) {
+		resolve16_AVX2(dest, src, count, md_palette);
+		return;
+	}
+#endif /* VDPLINEBUF_HAS_SIMD */
+	T_resolve_noasm<uint16_t>(dest, src, count, md_palette);
+}
+
+/**
+ * Resolve line buffer pixels using the active palette. (32-bit color)
+ * @param dest		[out] Destination pixels.
+ * @param src		[in] Line buffer words.
+ * @param count		[in] Number of pixels. (must be a multiple of 8)
+ * @param md_palette	[in] Active palette. (256 entries)
+ */
+void VdpLineBuf::resolve(uint32_t *dest, const uint16_t *src, int count, const uint32_t *md_palette)
+{
+	assert(count % 8 == 0);
+#ifdef VDPLINEBUF_HAS_SIMD
+	if (CPU_Flags & MDP_CPUFLAG_X86_AVX2) {
+		resolve32_AVX2(dest, src, count, md_palette);
+		return;
+	}
+#endif /* VDPLINEBUF_HAS_SIMD */
+	T_resolve_noasm<uint32_t>(dest, src, count, md_palette);
+}
+
+/**
+ * Fill pixels with a single color. (16-bit color)
+ * @param dest	[out] Destination pixels.
+ * @param count	[in] Number of pixels. (must be a multiple of 8)
+ * @param color	[in] Color.
+ */
+void VdpLineBuf::fill(uint16_t *dest, int count, uint16_t color)
+{
+	assert(count % 8 == 0);
+#ifdef VDPLINEBUF_HAS_SIMD
+	const uint32_t color32 = (color | (color << 16));
+	if (CPU_Flags & MDP_CPUFLAG_X86_AVX2) {
+		fill_AVX2(dest, count * 2, color32);
+		return;
+	}
+#endif /* VDPLINEBUF_HAS_SIMD */
+	T_fill_noasm<uint16_t>(dest, count, color);
+}
+
+/**
+ * Fill pixels with a single color. (32-bit color)
+ * @param dest	[out] Destination pixels.
+ * @param count	[in] Number of pixels. (must be a multiple of 8)
+ * @param color	[in] Color.
+ */
+void VdpLineBuf::fill(uint32_t *dest, int count, uint32_t color)
+{
+	assert(count % 8 == 0);
+#ifdef VDPLINEBUF_HAS_SIMD
+	if (CPU_Flags & MDP_CPUFLAG_X86_AVX2) {
+		fill_AVX2(dest, count * 4, color);
+		return;
+	}
+#endif /* VDPLINEBUF_HAS_SIMD */
+	T_fill_noasm<uint32_t>(dest, count, color);
+}
+
+}
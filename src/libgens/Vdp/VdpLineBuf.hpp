@@ -0,0 +1,67 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * VdpLineBuf.hpp: VDP line buffer to framebuffer conversion.              *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_MD_VDPLINEBUF_HPP__
+#define __LIBGENS_MD_VDPLINEBUF_HPP__
+
+// C includes.
+#include <stdint.h>
+
+namespace LibGens {
+
+/**
+ * Line buffer to framebuffer conversion.
+ * SIMD implementations are selected at runtime using CPU_Flags.
+ */
+class VdpLineBuf
+{
+	public:
+		/**
+		 * Resolve line buffer pixels using the active palette.
+		 * The palette index is the low byte of each line buffer word.
+		 * @param dest		[out] Destination pixels.
+		 * @param src		[in] Line buffer words.
+		 * @param count		[in] Number of pixels. (must be a multiple of 8)
+		 * @param md_palette	[in] Active palette. (256 entries)
+		 * NOTE: The 16-bit AVX2 implementation uses 32-bit gathers,
+		 * so md_palette must be readable for 257 entries.
+		 * VdpPalette::m_palActive satisfies this.
+		 */
+		static void resolve(uint16_t *dest, const uint16_t *src, int count, const uint16_t *md_palette);
+		static void resolve(uint32_t *dest, const uint16_t *src, int count, const uint32_t *md_palette);
+
+		/**
+		 * Fill pixels with a single color, e.g. for borders.
+		 * @param dest	[out] Destination pixels.
+		 * @param count	[in] Number of pixels. (must be a multiple of 8)
+		 * @param color	[in] Color.
+		 */
+		static void fill(uint16_t *dest, int count, uint16_t color);
+		static void fill(uint32_t *dest, int count, uint32_t color);
+
+	private:
+		VdpLineBuf() { }
+		~VdpLineBuf() { }
+};
+
+}
+
+#endif /* __LIBGENS_MD_VDPLINEBUF_HPP__ */
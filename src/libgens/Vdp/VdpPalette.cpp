@@ -97,6 +97,7 @@ VdpPalette::VdpPalette()
 	: d(new VdpPalettePrivate(this))
 	, cram_addr_mask(0x7F)
 	, m_bpp(MdFb::BPP_32)
+	, m_dirtyCRam(0)
 {
 	// Set the dirty flags.
 	m_dirty.active = true;
@@ -236,16 +236,26 @@ class VdpPalette
 			};
 		} m_dirty;
 
+		/**
+		 * Dirty CRam words.
+		 * Bit n corresponds to m_cram.u16[n].
+		 * If m_dirty.active is set, the entire active
+		 * palette is recalculated, and this is ignored.
+		 */
+		uint64_t m_dirtyCRam;
+
 		/** Active palette recalculation functions. **/
 
 		template<typename pixel>
 		FORCE_INLINE void T_update_MD_M4(pixel *palActiveMD,
-					   const pixel *palFullSMS);
+					   const pixel *palFullSMS,
+					   uint64_t dirtyCRam);
 
 		template<typename pixel>
 		FORCE_INLINE void T_update_MD(pixel *palActiveMD,
 					const pixel *palFullMD,
-					const pixel *palFullSMS);
+					const pixel *palFullSMS,
+					uint64_t dirtyCRam);
 
 		// TODO: Needs testing.
 		template<typename pixel>
@@ -254,11 +264,13 @@ class VdpPalette
 
 		template<typename pixel>
 		FORCE_INLINE void T_update_SMS(pixel *palActiveSMS,
-					 const pixel *palFullSMS);
+					 const pixel *palFullSMS,
+					 uint64_t dirtyCRam);
 
 		template<typename pixel>
 		FORCE_INLINE void T_update_GG(pixel *palActiveGG,
-					const pixel *palFullGG);
+					const pixel *palFullGG,
+					uint64_t dirtyCRam);
 
 		template<typename pixel>
 		FORCE_INLINE void T_update_TMS9918A(pixel *palActiveTMS,
@@ -270,7 +282,7 @@ class VdpPalette
  * @return True if the palette is dirty.
  */
 inline bool VdpPalette::isDirty(void) const
-	{ return !!(m_dirty.data); }
+	{ return (m_dirty.data != 0 || m_dirtyCRam != 0); }
 
 /** CRam functions. **/
 
@@ -312,8 +324,7 @@ inline void VdpPalette::writeCRam_8(uint8_t address, uint8_t data)
 	address &= cram_addr_mask;
 	// FIXME: Use U16DATA_U8_INVERT?
 	m_cram.u8[address] = data;
-	// TODO: Per-color dirty flag?
-	m_dirty.active = true;
+	m_dirtyCRam |= (1ULL << (address >> 1));
 }
 
 /**
@@ -328,8 +339,7 @@ inline void VdpPalette::writeCRam_16(uint8_t address, uint16_t data)
 
 	address &= cram_addr_mask;
 	m_cram.u16[address >> 1] = data;
-	// TODO: Per-color dirty flag?
-	m_dirty.active = true;
+	m_dirtyCRam |= (1ULL << (address >> 1));
 }
 
 /** 32X CRam functions. **/
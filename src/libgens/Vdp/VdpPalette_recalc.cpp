@@ -372,6 +372,7 @@ void VdpPalettePrivate::recalcFull(void)
 
 		q->m_dirty.full = false;
 		q->m_dirty.active = false;
+		q->m_dirtyCRam = 0;
 		return;
 	}
 
@@ -35,42 +35,35 @@ namespace LibGens {
  * CRAM is in MD format; however, only the top two bits are relevant.
  * @param palActiveMD Active MD palette. (Must have 0x40 entries!)
  * @param palFullSMS Full SMS palette. (Must have 0x40 entries!)
+ * @param dirtyCRam Dirty CRam words. (~0 to update all colors)
  */
 template<typename pixel>
 FORCE_INLINE void VdpPalette::T_update_MD_M4(pixel *palActiveMD,
-				       const pixel *palFullSMS)
+				       const pixel *palFullSMS,
+				       uint64_t dirtyCRam)
 {
 #if !defined(DO_FOUR_PALETTE_LINES_IN_ALL_MODES_FOR_LULZ)
-	// Update all 32 colors.
-	static const int color_start = (32 - 2);
-#else
-	// Process all 64 colors for lulz.
-	static const int color_start = (64 - 2);
+	// Update the first 32 colors.
+	dirtyCRam &= 0xFFFFFFFFULL;
 #endif
 
 	// CRAM format for MD, Mode 4: (TODO: Needs verification.)
 	// ---- -BB- -GG- -RR-
-	for (int i = color_start; i >= 0; i -= 2) {
+	for (int i = 0; dirtyCRam != 0; i++, dirtyCRam >>= 1) {
+		if (!(dirtyCRam & 1))
+			continue;
+
 		// TODO: Use alternating bytes in SMS CRAM for MD compatibility?
-		uint16_t color1_raw = m_cram.u16[i];
-		uint16_t color2_raw = m_cram.u16[i + 1];
+		uint16_t color_raw = m_cram.u16[i];
 
-		// Shift the colors into SMS-compatible values.
+		// Shift the color into an SMS-compatible value.
 		// TODO: Create a lookup table? (Or don't - this mode is rarely used.)
-		color1_raw = ((color1_raw & 0x0600) >> 5) |
-			     ((color1_raw & 0x0060) >> 3) |
-			     ((color1_raw & 0x0006) >> 1);
-		color2_raw = ((color2_raw & 0x0600) >> 5) |
-			     ((color2_raw & 0x0060) >> 3) |
-			     ((color2_raw & 0x0006) >> 1);
-
-		// Get the palette color.
-		pixel color1 = palFullSMS[color1_raw];
-		pixel color2 = palFullSMS[color2_raw];
+		color_raw = ((color_raw & 0x0600) >> 5) |
+			    ((color_raw & 0x0060) >> 3) |
+			    ((color_raw & 0x0006) >> 1);
 
 		// Set the new color.
-		palActiveMD[i]     = color1;
-		palActiveMD[i + 1] = color2;
+		palActiveMD[i] = palFullSMS[color_raw];
 	}
 
 	// Update the background color.
@@ -82,12 +75,14 @@ FORCE_INLINE void VdpPalette::T_update_MD_M4(pixel *palActiveMD,
  * @param palActiveMD Active MD palette. (Must have 0x40 entries!)
  * @param palFullMD Full MD palette. (Must have 0x1000 entries!)
  * @param palFullSMS Full SMS palette. (Must have 0x40 entries!)
+ * @param dirtyCRam Dirty CRam words. (~0 to update all colors)
  * TODO: Figure out a way to get rid of palFullSMS.
  */
 template<typename pixel>
 FORCE_INLINE void VdpPalette::T_update_MD(pixel *palActiveMD,
 				    const pixel *palFullMD,
-				    const pixel *palFullSMS)
+				    const pixel *palFullSMS,
+				    uint64_t dirtyCRam)
 {
 	uint16_t mdColorMask;
 	switch (d->m5m4bits & 0x03) {
@@ -99,7 +94,7 @@ FORCE_INLINE void VdpPalette::T_update_MD(pixel *palActiveMD,
 		case 1:
 			// M5=0, M4=1
 			// Mode 4: CRAM only has two significant bits.
-			T_update_MD_M4(palActiveMD, palFullSMS);
+			T_update_MD_M4(palActiveMD, palFullSMS, dirtyCRam);
 			return;
 		case 2:
 			// M5=1, M4=0
@@ -113,51 +108,48 @@ FORCE_INLINE void VdpPalette::T_update_MD(pixel *palActiveMD,
 			break;
 	}
 
-	// Update all 64 colors.
-	for (int i = 62; i >= 0; i -= 2) {
-		const uint16_t color1_raw = (m_cram.u16[i] & mdColorMask);
-		const uint16_t color2_raw = (m_cram.u16[i + 1] & mdColorMask);
-
-		// Get the palette color.
-		pixel color1 = palFullMD[color1_raw];
-		pixel color2 = palFullMD[color2_raw];
+	if (!d->mdShadowHighlight) {
+		// Update the dirty colors.
+		for (int i = 0; dirtyCRam != 0; i++, dirtyCRam >>= 1) {
+			if (dirtyCRam & 1) {
+				palActiveMD[i] = palFullMD[m_cram.u16[i] & mdColorMask];
+			}
+		}
 
-		// Set the new color.
-		palActiveMD[i]     = color1;
-		palActiveMD[i + 1] = color2;
+		// Update the background color.
+		palActiveMD[0] = palActiveMD[d->maskedBgColorIdx];
+		return;
 	}
 
-	// Update the background color.
-	palActiveMD[0] = palActiveMD[d->maskedBgColorIdx];
+	// Update the dirty colors, plus their shadow and highlight colors.
+	// References:
+	// - http://www.tehskeen.com/forums/showpost.php?p=71308&postcount=1077
+	// - http://forums.sonicretro.org/index.php?showtopic=17905
+	for (int i = 0; dirtyCRam != 0; i++, dirtyCRam >>= 1) {
+		if (!(dirtyCRam & 1))
+			continue;
 
-	if (d->mdShadowHighlight) {
-		// Update the shadow and highlight colors.
-		// References:
-		// - http://www.tehskeen.com/forums/showpost.php?p=71308&postcount=1077
-		// - http://forums.sonicretro.org/index.php?showtopic=17905
-		
-		// Shadow (64-127) and highlight (128-191) palettes.
-		for (int i = 62; i >= 0; i -= 2) {
-			uint16_t color1_raw = ((m_cram.u16[i] & mdColorMask) >> 1);
-			uint16_t color2_raw = ((m_cram.u16[i + 1] & mdColorMask) >> 1);
-
-			// Shadow color. (0xxx)
-			palActiveMD[i + 64]      = palFullMD[color1_raw];
-			palActiveMD[i + 1 + 64]  = palFullMD[color2_raw];
-
-			// Highlight color. (1xxx - 0001)
-			palActiveMD[i + 128]     = palFullMD[(0x888 | color1_raw) - 0x111];
-			palActiveMD[i + 1 + 128] = palFullMD[(0x888 | color2_raw) - 0x111];
-		}
+		const uint16_t color_raw = (m_cram.u16[i] & mdColorMask);
+		const uint16_t shadow_raw = (color_raw >> 1);
 
-		// Copy the normal colors (0-63) to shadow+highlight (192-255).
-		// Pixels with both shadow and highlight show up as normal.
-		memcpy(&palActiveMD[192], &palActiveMD[0], (sizeof(palActiveMD[0]) * 64));
+		// Normal color. (0-63)
+		// Pixels with both shadow and highlight show up as normal. (192-255)
+		const pixel color = palFullMD[color_raw];
+		palActiveMD[i]       = color;
+		palActiveMD[i + 192] = color;
 
-		// Update the background color for the shadow and highlight palettes.
-		palActiveMD[64]  = palActiveMD[d->maskedBgColorIdx + 64];	// Shadow color.
-		palActiveMD[128] = palActiveMD[d->maskedBgColorIdx + 128];	// Highlight color.
+		// Shadow color. (0xxx) (64-127)
+		palActiveMD[i + 64]  = palFullMD[shadow_raw];
+
+		// Highlight color. (1xxx - 0001) (128-191)
+		palActiveMD[i + 128] = palFullMD[(0x888 | shadow_raw) - 0x111];
 	}
+
+	// Update the background color for all four palettes.
+	palActiveMD[0]   = palActiveMD[d->maskedBgColorIdx];
+	palActiveMD[64]  = palActiveMD[d->maskedBgColorIdx + 64];	// Shadow color.
+	palActiveMD[128] = palActiveMD[d->maskedBgColorIdx + 128];	// Highlight color.
+	palActiveMD[192] = palActiveMD[0];
 }
 
 /**
@@ -186,17 +178,19 @@ FORCE_INLINE void VdpPalette::T_update_32X(pixel *palActive32X,
  * TODO: UNTESTED!
  * @param palActiveSMS Active SMS palette. (Must have 0x20 entries!)
  * @param palFullSMS Full SMS palette. (Must have 0x40 entries!)
+ * @param dirtyCRam Dirty CRam words. (~0 to update all colors)
  */
 template<typename pixel>
 FORCE_INLINE void VdpPalette::T_update_SMS(pixel *palActiveSMS,
-				     const pixel *palFullSMS)
+				     const pixel *palFullSMS,
+				     uint64_t dirtyCRam)
 {
 #if !defined(DO_FOUR_PALETTE_LINES_IN_ALL_MODES_FOR_LULZ)
-	// Update all 32 colors.
-	static const int color_start = (32 - 2);
+	// Update the first 32 colors.
+	dirtyCRam &= 0xFFFFULL;
 #else
 	// Process all 64 colors for lulz.
-	static const int color_start = (64 - 2);
+	dirtyCRam &= 0xFFFFFFFFULL;
 #endif
 
 	/**
@@ -234,18 +228,18 @@ FORCE_INLINE void VdpPalette::T_update_SMS(pixel *palActiveSMS,
 		cram = &PalTMS9918A_SMS[0];
 	}
 
-	for (int i = color_start; i >= 0; i -= 2) {
+	// SMS colors are bytes, so each dirty CRam word has two colors.
+	for (int i = 0; dirtyCRam != 0; i += 2, dirtyCRam >>= 1) {
+		if (!(dirtyCRam & 1))
+			continue;
+
 		// TODO: Use alternating bytes in SMS CRam for MD compatibility?
 		const uint8_t color1_raw = (cram[i] & 0x3F);
 		const uint8_t color2_raw = (cram[i + 1] & 0x3F);
 
-		// Get the palette color.
-		pixel color1 = palFullSMS[color1_raw];
-		pixel color2 = palFullSMS[color2_raw];
-
-		// Set the new color.
-		palActiveSMS[i]     = color1;
-		palActiveSMS[i + 1] = color2;
+		// Set the new colors.
+		palActiveSMS[i]     = palFullSMS[color1_raw];
+		palActiveSMS[i + 1] = palFullSMS[color2_raw];
 	}
 
 	// Update the background color.
@@ -257,30 +251,22 @@ FORCE_INLINE void VdpPalette::T_update_SMS(pixel *palActiveSMS,
  * TODO: UNTESTED!
  * @param palActiveGG Active GG palette. (Must have 0x20 entries!)
  * @param palFullGG Full GG palette. (Must have 0x1000 entries!)
+ * @param dirtyCRam Dirty CRam words. (~0 to update all colors)
  */
 template<typename pixel>
 FORCE_INLINE void VdpPalette::T_update_GG(pixel *palActiveGG,
-				    const pixel *palFullGG)
+				    const pixel *palFullGG,
+				    uint64_t dirtyCRam)
 {
 #if !defined(DO_FOUR_PALETTE_LINES_IN_ALL_MODES_FOR_LULZ)
-	// Update all 32 colors.
-	static const int color_start = (32 - 2);
-#else
-	// Process all 64 colors for lulz.
-	static const int color_start = (64 - 2);
+	// Update the first 32 colors.
+	dirtyCRam &= 0xFFFFFFFFULL;
 #endif
 
-	for (int i = color_start; i >= 0; i -= 2) {
-		const uint16_t color1_raw = (m_cram.u16[i] & 0xFFF);
-		const uint16_t color2_raw = (m_cram.u16[i + 1] & 0xFFF);
-
-		// Get the palette color.
-		pixel color1 = palFullGG[color1_raw];
-		pixel color2 = palFullGG[color2_raw];
-
-		// Set the new color.
-		palActiveGG[i]     = color1;
-		palActiveGG[i + 1] = color2;
+	for (int i = 0; dirtyCRam != 0; i++, dirtyCRam >>= 1) {
+		if (dirtyCRam & 1) {
+			palActiveGG[i] = palFullGG[m_cram.u16[i] & 0xFFF];
+		}
 	}
 
 	// Update the background color.
@@ -323,66 +309,84 @@ void VdpPalette::update(void)
 {
 	if (m_dirty.full)
 		d->recalcFull();
-	if (!m_dirty.active)
+	if (!m_dirty.active && m_dirtyCRam == 0)
 		return;
 	if (d->isAppOs)
 		return;
 
+	// If the entire active palette is dirty, update all colors.
+	// Otherwise, only update colors whose CRam words have changed.
+	const bool active = m_dirty.active;
+	const uint64_t dirtyCRam = (active ? ~0ULL : m_dirtyCRam);
+
 	// TODO: Add an AND to each switch() for optimization?
 	if (m_bpp != MdFb::BPP_32) {
 		switch (d->palMode) {
 			case PALMODE_32X:
-				T_update_32X<uint16_t>(m_palActive32X.u16, d->palFull32X.u16);
-				// NOTE: 32X falls through to MD, since both 32X and MD palettes must be updated.
+				// NOTE: 32X CRam writes mark the entire active palette as dirty.
 				// TODO: Add a separate dirty flag for the 32X palette?
+				if (active) {
+					T_update_32X<uint16_t>(m_palActive32X.u16, d->palFull32X.u16);
+				}
+				// NOTE: 32X falls through to MD, since both 32X and MD palettes must be updated.
 				// FALLTHROUGH
 
 			case PALMODE_MD:
 			default:
-				T_update_MD<uint16_t>(m_palActive.u16, d->palFullMD.u16, d->palFullSMS.u16);
+				T_update_MD<uint16_t>(m_palActive.u16, d->palFullMD.u16, d->palFullSMS.u16, dirtyCRam);
 				break;
 
 			case PALMODE_SMS:
-				T_update_SMS<uint16_t>(m_palActive.u16, d->palFullSMS.u16);
+				T_update_SMS<uint16_t>(m_palActive.u16, d->palFullSMS.u16, dirtyCRam);
 				break;
 
 			case PALMODE_GG:
-				T_update_GG<uint16_t>(m_palActive.u16, d->palFullMD.u16);
+				T_update_GG<uint16_t>(m_palActive.u16, d->palFullMD.u16, dirtyCRam);
 				break;
 
 			case PALMODE_TMS9918A:
-				T_update_TMS9918A<uint16_t>(m_palActive.u16, d->palFullSMS.u16);
+				// TMS9918A colors don't depend on CRam.
+				if (active) {
+					T_update_TMS9918A<uint16_t>(m_palActive.u16, d->palFullSMS.u16);
+				}
 				break;
 		}
 	} else {
 		switch (d->palMode) {
 			case PALMODE_32X:
-				T_update_32X<uint32_t>(m_palActive32X.u32, d->palFull32X.u32);
-				// NOTE: 32X falls through to MD, since both 32X and MD palettes must be updated.
+				// NOTE: 32X CRam writes mark the entire active palette as dirty.
 				// TODO: Add a separate dirty flag for the 32X palette?
+				if (active) {
+					T_update_32X<uint32_t>(m_palActive32X.u32, d->palFull32X.u32);
+				}
+				// NOTE: 32X falls through to MD, since both 32X and MD palettes must be updated.
 				// FALLTHROUGH
 
 			case PALMODE_MD:
 			default:
-				T_update_MD<uint32_t>(m_palActive.u32, d->palFullMD.u32, d->palFullSMS.u32);
+				T_update_MD<uint32_t>(m_palActive.u32, d->palFullMD.u32, d->palFullSMS.u32, dirtyCRam);
 				break;
 
 			case PALMODE_SMS:
-				T_update_SMS<uint32_t>(m_palActive.u32, d->palFullSMS.u32);
+				T_update_SMS<uint32_t>(m_palActive.u32, d->palFullSMS.u32, dirtyCRam);
 				break;
 
 			case PALMODE_GG:
-				T_update_GG<uint32_t>(m_palActive.u32, d->palFullMD.u32);
+				T_update_GG<uint32_t>(m_palActive.u32, d->palFullMD.u32, dirtyCRam);
 				break;
 
 			case PALMODE_TMS9918A:
-				T_update_TMS9918A<uint32_t>(m_palActive.u32, d->palFullSMS.u32);
+				// TMS9918A colors don't depend on CRam.
+				if (active) {
+					T_update_TMS9918A<uint32_t>(m_palActive.u32, d->palFullSMS.u32);
+				}
 				break;
 		}
 	}
 
-	// Clear the active palette dirty bit.
+	// Clear the active palette dirty bits.
 	m_dirty.active = false;
+	m_dirtyCRam = 0;
 }
 
 // TODO: Port to LibGens: T_update_32X()
@@ -68,6 +68,7 @@ void VdpPrivate::rend_reset(void)
 
 	// Sprite Attribute Table cache. (Mode 5)
 	memset(SprAttrTbl_m5.b, 0, sizeof(SprAttrTbl_m5.b));
+	invalidateSprLineIdx();
 
 	// Sprite line cache.
 	memset(sprLineCache, 0, sizeof(sprLineCache));
@@ -82,6 +83,9 @@ void VdpPrivate::rend_reset(void)
  */
 void Vdp::renderLine(void)
 {
+	// Mid-line writes are logged for the line that was rendered last.
+	d->abortLineLog();
+
 	// TODO: 32X-specific function.
 	if (d->VDP_Mode & VdpTypes::VDP_MODE_M5) {
 		// Mode 5.
@@ -90,11 +94,20 @@ void Vdp::renderLine(void)
 #if 0
 			d->renderLine_m5_32X();
 #endif
+		} else if (d->rendThread) {
+			// Deferred rendering.
+			d->queueLine_m5();
+			if (d->rendThread->takeCollision())
+				d->Reg_Status.setBit(VdpStatus::VDP_STATUS_COLLISION, true);
 		} else {
 			d->renderLine_m5();
 		}
 	} else {
 		// Unsupported mode.
+		// Deferred lines must be finished first,
+		// since they share the framebuffer.
+		if (d->rendThread)
+			d->rendThread->sync();
 		d->renderLine_Err();
 	}
 
@@ -102,4 +115,46 @@ void Vdp::renderLine(void)
 	d->updateErr();
 }
 
+/**
+ * Update the VDP for a line that isn't rendered.
+ * This should be called instead of renderLine()
+ * if the frame is being skipped.
+ */
+void Vdp::skipLine(void)
+{
+	// Mid-line writes are only logged for rendered lines.
+	d->abortLineLog();
+
+	// TODO: 32X-specific function.
+	if ((d->VDP_Mode & VdpTypes::VDP_MODE_M5) && !SysStatus._32X) {
+		d->skipLine_m5();
+	}
+}
+
+/**
+ * Get the line cycle where the active display ends.
+ * Used by the emulation loop if options.midLineWrites is set.
+ * @return Line cycle. (68000 cycles from the start of the line)
+ */
+unsigned int Vdp::activeDisplayEnd(void) const
+{
+	return d->activeEndCycle[d->isH40() ? 1 : 0];
+}
+
+/**
+ * Finish the current line.
+ * If options.midLineWrites is set, VDP writes that occurred
+ * after renderLine() are applied at the pixel column where
+ * they happened. This should be called at the end of the
+ * active display.
+ */
+void Vdp::finishLine(void)
+{
+	// NOTE: Writes are only logged in Mode 5.
+	if (d->lineLogCount > 0) {
+		d->finishLine_m5();
+	}
+	d->abortLineLog();
+}
+
 }
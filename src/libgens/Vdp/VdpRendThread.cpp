@@ -0,0 +1,509 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * VdpRendThread.cpp: Deferred VDP line rendering thread.                  *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "VdpRendThread.hpp"
+#include "Vdp.hpp"
+#include "Vdp_p.hpp"
+
+// C includes. (C++ namespace)
+#include <cstring>
+
+// C++ includes.
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace LibGens {
+
+/** VdpRendThreadPrivate **/
+
+class VdpRendThreadPrivate
+{
+	public:
+		VdpRendThreadPrivate(VdpRendThread *q, Vdp *vdp);
+		~VdpRendThreadPrivate();
+
+	private:
+		VdpRendThread *const q;
+
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		VdpRendThreadPrivate(const VdpRendThreadPrivate &);
+		VdpRendThreadPrivate &operator=(const VdpRendThreadPrivate &);
+
+	public:
+		// VDP that queues lines. (emulation thread)
+		VdpPrivate *const vd;
+
+		// Shadow VDP. (render thread)
+		// It has its own framebuffer until the first line is
+		// queued, since Vdp::reset() clears the framebuffer.
+		Vdp *const shadow;
+
+		/**
+		 * Line queue.
+		 * Enough for a few dozen lines of slack; if the
+		 * emulation thread gets this far ahead, it waits.
+		 */
+		static const unsigned int LINE_QUEUE_SZ = 32;
+		VdpPrivate::RendLine_t lines[LINE_QUEUE_SZ];
+		std::atomic<unsigned int> lineHead;	// Next line to render.
+		std::atomic<unsigned int> lineTail;	// Next line to queue.
+
+		/**
+		 * If the render thread is idle, it isn't woken up
+		 * until this many lines are queued, since waking it
+		 * up for every line costs more than rendering it.
+		 */
+		static const unsigned int LINE_BATCH_SZ = 8;
+
+		/**
+		 * VRam tile queue.
+		 * Must be able to hold all of VRam at once,
+		 * plus the tiles of lines that are still queued.
+		 */
+		static const unsigned int TILE_QUEUE_SZ = 4096;
+		struct Tile_t {
+			uint32_t tile;
+			uint32_t data[8];	// VRam_t::u32[] layout.
+		};
+		Tile_t tiles[TILE_QUEUE_SZ];
+		std::atomic<unsigned int> tileHead;	// Render thread.
+		unsigned int tileTail;			// Emulation thread.
+
+		// If true, the next queued line resynchronizes
+		// render-only state. (emulation thread)
+		bool resync;
+
+		// Set by the render thread if a sprite collision occurred.
+		std::atomic<bool> collision;
+
+		// Thread control.
+		std::mutex mtx;
+		std::condition_variable cvLine;	// Line was queued.
+		std::condition_variable cvDone;	// Line was rendered.
+		std::atomic<bool> threadWaiting;
+		std::atomic<bool> vdpWaiting;
+		std::atomic<unsigned int> vdpWaitLines;
+		bool quit;	// Protected by mtx.
+		std::thread thread;
+
+		/**
+		 * Check if the queues have enough space.
+		 * @param lines Maximum number of lines that may be queued.
+		 * @param tiles Number of tiles that must be available.
+		 * @return True if the queues have enough space.
+		 */
+		inline bool hasSpace(unsigned int lines, unsigned int tiles) const
+		{
+			return ((lineTail.load() - lineHead.load()) <= lines &&
+				(TILE_QUEUE_SZ - (tileTail - tileHead.load())) >= tiles);
+		}
+
+		/**
+		 * Wait for the render thread.
+		 * @param lines Maximum number of lines that may be queued.
+		 * @param tiles Number of tiles that must be available.
+		 */
+		void waitForSpace(unsigned int lines, unsigned int tiles);
+
+		/**
+		 * Render thread function.
+		 */
+		void run(void);
+
+		/**
+		 * Render a queued line on the shadow VDP.
+		 * @param rl Line render state.
+		 */
+		void renderLine(const VdpPrivate::RendLine_t *rl);
+};
+
+VdpRendThreadPrivate::VdpRendThreadPrivate(VdpRendThread *q, Vdp *vdp)
+	: q(q)
+	, vd(vdp->d)
+	, shadow(new Vdp())
+	, lineHead(0)
+	, lineTail(0)
+	, tileHead(0)
+	, tileTail(0)
+	, resync(true)
+	, collision(false)
+	, threadWaiting(false)
+	, vdpWaiting(false)
+	, vdpWaitLines(0)
+	, quit(false)
+{
+	thread = std::thread(&VdpRendThreadPrivate::run, this);
+}
+
+VdpRendThreadPrivate::~VdpRendThreadPrivate()
+{
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		quit = true;
+	}
+	cvLine.notify_one();
+	thread.join();
+	delete shadow;
+}
+
+/**
+ * Wait for the render thread.
+ * @param lines Maximum number of lines that may be queued.
+ * @param tiles Number of tiles that must be available.
+ */
+void VdpRendThreadPrivate::waitForSpace(unsigned int lines, unsigned int tiles)
+{
+	if (hasSpace(lines, tiles))
+		return;
+
+	std::unique_lock<std::mutex> lock(mtx);
+	vdpWaitLines.store(lines);
+	vdpWaiting.store(true);
+	// The render thread may be waiting for a full batch.
+	cvLine.notify_one();
+	while (!hasSpace(lines, tiles)) {
+		cvDone.wait(lock);
+	}
+	vdpWaiting.store(false);
+}
+
+/**
+ * Render thread function.
+ */
+void VdpRendThreadPrivate::run(void)
+{
+	for (;;) {
+		const unsigned int head = lineHead.load(std::memory_order_relaxed);
+		if (head == lineTail.load()) {
+			// Queue is empty.
+			std::unique_lock<std::mutex> lock(mtx);
+			threadWaiting.store(true);
+			while (head == lineTail.load() && !quit) {
+				cvLine.wait(lock);
+			}
+			threadWaiting.store(false);
+			if (head == lineTail.load()) {
+				// Queue is empty, and we're quitting.
+				break;
+			}
+			continue;
+		}
+
+		renderLine(&lines[head % LINE_QUEUE_SZ]);
+
+		// Line is done.
+		// The emulation thread is only woken up once enough
+		// lines are done, or the queue is empty. (The latter
+		// ensures that waiting for tile space can't stall.)
+		lineHead.store(head + 1);
+		if (vdpWaiting.load() &&
+		    ((lineTail.load() - (head + 1)) <= vdpWaitLines.load() ||
+		     (head + 1) == lineTail.load()))
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			cvDone.notify_one();
+		}
+	}
+}
+
+/**
+ * Render a queued line on the shadow VDP.
+ * @param rl Line render state.
+ */
+void VdpRendThreadPrivate::renderLine(const VdpPrivate::RendLine_t *rl)
+{
+	VdpPrivate *const sd = shadow->d;
+
+	// Apply the VRam tiles for this line.
+	unsigned int tileIdx = tileHead.load(std::memory_order_relaxed);
+	for (; tileIdx != rl->tileEnd; tileIdx++) {
+		const Tile_t *tile = &tiles[tileIdx % TILE_QUEUE_SZ];
+		const uint32_t address = (tile->tile << 5);
+		memcpy(&sd->VRam.u32[address >> 2], tile->data, sizeof(tile->data));
+		for (int y = 0; y < 8; y++) {
+			sd->patternCache->markDirty(address + (y * 4));
+		}
+	}
+	tileHead.store(tileIdx);
+
+	// Render the line.
+	sd->loadRendLine(rl);
+	sd->renderQueuedLine_m5();
+
+	// Report sprite collisions.
+	if (sd->Reg_Status.read_raw() & VdpStatus::VDP_STATUS_COLLISION) {
+		sd->Reg_Status.setBit(VdpStatus::VDP_STATUS_COLLISION, false);
+		collision.store(true);
+	}
+}
+
+/** VdpRendThread **/
+
+/**
+ * Start the render thread.
+ * @param vdp VDP that queues lines to this thread.
+ */
+VdpRendThread::VdpRendThread(Vdp *vdp)
+	: d(new VdpRendThreadPrivate(this, vdp))
+	, m_dirtyCount(0)
+{
+	// The shadow VDP starts out empty.
+	memset(m_dirtyFlags, 0, sizeof(m_dirtyFlags));
+	invalidate();
+}
+
+/**
+ * Stop the render thread.
+ * Queued lines are rendered first.
+ */
+VdpRendThread::~VdpRendThread()
+{
+	delete d;
+}
+
+/**
+ * Mark all of VRam as dirty.
+ * This also resynchronizes the sprite dot overflow
+ * flag on the next queued line, so it should be
+ * called on reset and savestate load.
+ */
+void VdpRendThread::invalidate(void)
+{
+	m_dirtyCount = 0;
+	for (unsigned int i = 0; i < ARRAY_SIZE(m_dirtyList); i++) {
+		m_dirtyFlags[i] = 1;
+		m_dirtyList[m_dirtyCount++] = i;
+	}
+	d->resync = true;
+}
+
+/**
+ * Queue the current line.
+ * The VDP's render state is copied, along with
+ * any VRam tiles that were marked as dirty.
+ * This may block if the queue is full.
+ */
+void VdpRendThread::queueLine(void)
+{
+	// Make sure there's room for this line and its tiles.
+	// If the line queue is full, wait until it's half-empty
+	// so the threads don't switch back and forth every line.
+	if (!d->hasSpace(VdpRendThreadPrivate::LINE_QUEUE_SZ - 1, m_dirtyCount)) {
+		d->waitForSpace(VdpRendThreadPrivate::LINE_QUEUE_SZ / 2, m_dirtyCount);
+	}
+
+	// Copy the dirty tiles.
+	const VdpPrivate *const vd = d->vd;
+	for (unsigned int i = 0; i < m_dirtyCount; i++) {
+		const unsigned int tile = m_dirtyList[i];
+		VdpRendThreadPrivate::Tile_t *dest =
+			&d->tiles[d->tileTail++ % VdpRendThreadPrivate::TILE_QUEUE_SZ];
+		dest->tile = tile;
+		memcpy(dest->data, &vd->VRam.u32[tile * 8], sizeof(dest->data));
+		m_dirtyFlags[tile] = 0;
+	}
+	m_dirtyCount = 0;
+
+	// Save the render state.
+	const unsigned int tail = d->lineTail.load(std::memory_order_relaxed);
+	VdpPrivate::RendLine_t *rl = &d->lines[tail % VdpRendThreadPrivate::LINE_QUEUE_SZ];
+	vd->saveRendLine(rl);
+	rl->tileEnd = d->tileTail;
+	rl->resync = d->resync;
+	d->resync = false;
+
+	// Queue the line.
+	d->lineTail.store(tail + 1);
+	if (d->threadWaiting.load() &&
+	    (tail + 1 - d->lineHead.load()) >= VdpRendThreadPrivate::LINE_BATCH_SZ)
+	{
+		std::lock_guard<std::mutex> lock(d->mtx);
+		d->cvLine.notify_one();
+	}
+}
+
+/**
+ * Wait for all queued lines to be rendered.
+ */
+void VdpRendThread::sync(void)
+{
+	d->waitForSpace(0, 0);
+}
+
+/**
+ * Check if the render thread detected a sprite collision.
+ * The flag is cleared after it's read.
+ * NOTE: Collisions are reported when the render thread
+ * reaches the line, so they may be delayed by a few lines.
+ * @return True if a sprite collision occurred.
+ */
+bool VdpRendThread::takeCollision(void)
+{
+	if (!d->collision.load(std::memory_order_relaxed))
+		return false;
+	return d->collision.exchange(false);
+}
+
+/** VdpPrivate **/
+
+/**
+ * Save the render state for the current line.
+ * (emulation thread)
+ * @param rl Line render state.
+ */
+void VdpPrivate::saveRendLine(RendLine_t *rl) const
+{
+	rl->sprDotOverflow = sprDotOverflow;
+	rl->fb = q->MD_Screen;
+	rl->VDP_Lines = q->VDP_Lines;
+	rl->options = q->options;
+
+	rl->VDP_Reg = VDP_Reg;
+	rl->VDP_Mode = VDP_Mode;
+	rl->status = Reg_Status.read_raw();
+	rl->VDP_Layers = VDP_Layers;
+	rl->H_Cell = H_Cell;
+	rl->H_Pix = H_Pix;
+	rl->H_Pix_Begin = H_Pix_Begin;
+	rl->H_Win_Shift = H_Win_Shift;
+	rl->V_Scroll_MMask = V_Scroll_MMask;
+	rl->H_Scroll_Mask = H_Scroll_Mask;
+	rl->H_Scroll_CMul = H_Scroll_CMul;
+	rl->H_Scroll_CMask = H_Scroll_CMask;
+	rl->V_Scroll_CMask = V_Scroll_CMask;
+	rl->Win_X_Pos = Win_X_Pos;
+	rl->Win_Y_Pos = Win_Y_Pos;
+	rl->im2_flag = im2_flag;
+
+	rl->ScrA_Tbl_Addr = ScrA_Tbl_Addr;
+	rl->ScrB_Tbl_Addr = ScrB_Tbl_Addr;
+	rl->Win_Tbl_Addr = Win_Tbl_Addr;
+	rl->Spr_Tbl_Addr = Spr_Tbl_Addr;
+	rl->H_Scroll_Tbl_Addr = H_Scroll_Tbl_Addr;
+	rl->ScrA_Gen_Addr = ScrA_Gen_Addr;
+	rl->ScrB_Gen_Addr = ScrB_Gen_Addr;
+	rl->Spr_Gen_Addr = Spr_Gen_Addr;
+
+	rl->VRam_Mask = VRam_Mask;
+	rl->ScrA_Tbl_Mask = ScrA_Tbl_Mask;
+	rl->ScrB_Tbl_Mask = ScrB_Tbl_Mask;
+	rl->Win_Tbl_Mask = Win_Tbl_Mask;
+	rl->Spr_Tbl_Mask = Spr_Tbl_Mask;
+	rl->H_Scroll_Tbl_Mask = H_Scroll_Tbl_Mask;
+
+	rl->VSRam = VSRam;
+
+	palette.zomgSaveCRam(&rl->cram);
+	rl->palMode = palette.palMode();
+	rl->bgColorIdx = palette.bgColorIdx();
+	rl->m5m4bits = palette.m5m4bits();
+	rl->mdShadowHighlight = palette.mdShadowHighlight();
+
+	// Sprite line cache.
+	// Only the cached sprites are copied.
+	rl->sprCountCache[0] = sprCountCache[0];
+	rl->sprCountCache[1] = sprCountCache[1];
+	memcpy(rl->sprLineCache[0], sprLineCache[0], sprCountCache[0] * sizeof(sprLineCache[0][0]));
+	memcpy(rl->sprLineCache[1], sprLineCache[1], sprCountCache[1] * sizeof(sprLineCache[1][0]));
+}
+
+/**
+ * Load the render state for a queued line.
+ * (render thread; shadow VDP)
+ * @param rl Line render state.
+ */
+void VdpPrivate::loadRendLine(const RendLine_t *rl)
+{
+	if (rl->resync) {
+		// Render-only state.
+		sprDotOverflow = rl->sprDotOverflow;
+	}
+
+	if (q->MD_Screen != rl->fb) {
+		// Framebuffer has changed.
+		rl->fb->ref();
+		q->MD_Screen->unref();
+		q->MD_Screen = rl->fb;
+	}
+	q->VDP_Lines = rl->VDP_Lines;
+	q->options = rl->options;
+
+	VDP_Reg = rl->VDP_Reg;
+	VDP_Mode = rl->VDP_Mode;
+	Reg_Status.write_raw(rl->status);
+	VDP_Layers = rl->VDP_Layers;
+	H_Cell = rl->H_Cell;
+	H_Pix = rl->H_Pix;
+	H_Pix_Begin = rl->H_Pix_Begin;
+	H_Win_Shift = rl->H_Win_Shift;
+	V_Scroll_MMask = rl->V_Scroll_MMask;
+	H_Scroll_Mask = rl->H_Scroll_Mask;
+	H_Scroll_CMul = rl->H_Scroll_CMul;
+	H_Scroll_CMask = rl->H_Scroll_CMask;
+	V_Scroll_CMask = rl->V_Scroll_CMask;
+	Win_X_Pos = rl->Win_X_Pos;
+	Win_Y_Pos = rl->Win_Y_Pos;
+	im2_flag = rl->im2_flag;
+
+	ScrA_Tbl_Addr = rl->ScrA_Tbl_Addr;
+	ScrB_Tbl_Addr = rl->ScrB_Tbl_Addr;
+	Win_Tbl_Addr = rl->Win_Tbl_Addr;
+	Spr_Tbl_Addr = rl->Spr_Tbl_Addr;
+	H_Scroll_Tbl_Addr = rl->H_Scroll_Tbl_Addr;
+	ScrA_Gen_Addr = rl->ScrA_Gen_Addr;
+	ScrB_Gen_Addr = rl->ScrB_Gen_Addr;
+	Spr_Gen_Addr = rl->Spr_Gen_Addr;
+
+	VRam_Mask = rl->VRam_Mask;
+	ScrA_Tbl_Mask = rl->ScrA_Tbl_Mask;
+	ScrB_Tbl_Mask = rl->ScrB_Tbl_Mask;
+	Win_Tbl_Mask = rl->Win_Tbl_Mask;
+	Spr_Tbl_Mask = rl->Spr_Tbl_Mask;
+	H_Scroll_Tbl_Mask = rl->H_Scroll_Tbl_Mask;
+
+	VSRam = rl->VSRam;
+
+	// Palette.
+	// The setters only mark the palette as dirty if
+	// something changed, so check CRam here as well.
+	// Only the changed CRam words are written so the
+	// active palette can be updated incrementally.
+	palette.setPalMode(rl->palMode);
+	palette.setBgColorIdx(rl->bgColorIdx);
+	palette.setM5M4bits(rl->m5m4bits);
+	palette.setMdShadowHighlight(rl->mdShadowHighlight);
+	for (int i = 0; i < (int)ARRAY_SIZE(rl->cram.md); i++) {
+		if (palette.readCRam_16(i << 1) != rl->cram.md[i]) {
+			palette.writeCRam_16(i << 1, rl->cram.md[i]);
+		}
+	}
+
+	// Sprite line cache.
+	sprCountCache[0] = rl->sprCountCache[0];
+	sprCountCache[1] = rl->sprCountCache[1];
+	memcpy(sprLineCache[0], rl->sprLineCache[0], sprCountCache[0] * sizeof(sprLineCache[0][0]));
+	memcpy(sprLineCache[1], rl->sprLineCache[1], sprCountCache[1] * sizeof(sprLineCache[1][0]));
+}
+
+}
@@ -0,0 +1,135 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * VdpRendThread.hpp: Deferred VDP line rendering thread.                  *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_MD_VDPRENDTHREAD_HPP__
+#define __LIBGENS_MD_VDPRENDTHREAD_HPP__
+
+// C includes.
+#include <stdint.h>
+
+namespace LibGens {
+
+class Vdp;
+
+/**
+ * Deferred VDP line rendering.
+ *
+ * The render thread owns a standalone "shadow" VDP.
+ * For each line, the emulation thread queues a snapshot of
+ * the render inputs (registers, VSRam, CRam, and the sprite
+ * line cache), plus the VRam tiles that changed since the
+ * previous line. The render thread applies the snapshot to
+ * the shadow VDP and composes the line into MD_Screen while
+ * the CPUs continue running.
+ *
+ * All functions must be called from the emulation thread.
+ */
+class VdpRendThreadPrivate;
+class VdpRendThread
+{
+	public:
+		/**
+		 * Start the render thread.
+		 * @param vdp VDP that queues lines to this thread.
+		 */
+		VdpRendThread(Vdp *vdp);
+
+		/**
+		 * Stop the render thread.
+		 * Queued lines are rendered first.
+		 */
+		~VdpRendThread();
+
+	protected:
+		friend class VdpRendThreadPrivate;
+		VdpRendThreadPrivate *const d;
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		VdpRendThread(const VdpRendThread &);
+		VdpRendThread &operator=(const VdpRendThread &);
+
+	public:
+		/**
+		 * Mark a VRam address as dirty.
+		 * The tile will be sent to the render thread
+		 * with the next queued line.
+		 * @param address VRam address. (bytes)
+		 */
+		inline void markDirty(uint32_t address);
+
+		/**
+		 * Mark all of VRam as dirty.
+		 * This also resynchronizes the sprite dot overflow
+		 * flag on the next queued line, so it should be
+		 * called on reset and savestate load.
+		 */
+		void invalidate(void);
+
+		/**
+		 * Queue the current line.
+		 * The VDP's render state is copied, along with
+		 * any VRam tiles that were marked as dirty.
+		 * This may block if the queue is full.
+		 */
+		void queueLine(void);
+
+		/**
+		 * Wait for all queued lines to be rendered.
+		 */
+		void sync(void);
+
+		/**
+		 * Check if the render thread detected a sprite collision.
+		 * The flag is cleared after it's read.
+		 * NOTE: Collisions are reported when the render thread
+		 * reaches the line, so they may be delayed by a few lines.
+		 * @return True if a sprite collision occurred.
+		 */
+		bool takeCollision(void);
+
+	private:
+		// Dirty VRam tiles. (emulation thread only)
+		// TODO: 128 KB support.
+		uint8_t m_dirtyFlags[2048];
+		uint16_t m_dirtyList[2048];
+		unsigned int m_dirtyCount;
+};
+
+/**
+ * Mark a VRam address as dirty.
+ * The tile will be sent to the render thread
+ * with the next queued line.
+ * @param address VRam address. (bytes)
+ */
+inline void VdpRendThread::markDirty(uint32_t address)
+{
+	// TODO: 128 KB support.
+	const unsigned int tile = (address >> 5) & 0x7FF;
+	if (!m_dirtyFlags[tile]) {
+		m_dirtyFlags[tile] = 1;
+		m_dirtyList[m_dirtyCount++] = tile;
+	}
+}
+
+}
+
+#endif /* __LIBGENS_MD_VDPRENDTHREAD_HPP__ */
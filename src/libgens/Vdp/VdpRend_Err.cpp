@@ -451,6 +451,9 @@ void VdpPrivate::renderLine_Err(void)
 
 		// Save the new border color.
 		d_err->lastBorderColor = newBorderColor;
+
+		// Error screen was redrawn.
+		q->MD_Screen->updateLineHashes();
 	}
 }
 
@@ -23,6 +23,7 @@
 
 #include "Vdp.hpp"
 #include "VdpTypes.hpp"
+#include "VdpLineBuf.hpp"
 
 // M68K_Mem::ms_Region is needed for region detection.
 #include "cpu/M68K_Mem.hpp"
@@ -626,6 +627,8 @@ FORCE_INLINE uint16_t VdpPrivate::T_Get_Nametable_Word(unsigned int x, unsigned
 
 /**
  * Get pattern data for a given tile for the current line.
+ * The pattern data is retrieved from the pattern cache,
+ * so H-flip has already been applied.
  * @param interlaced True for interlaced; false for non-interlaced.
  * @param pattern Pattern info.
  * @param y_fine_offset Y fine offset.
@@ -655,7 +658,8 @@ FORCE_INLINE uint32_t VdpPrivate::T_Get_Pattern_Data(uint16_t pattern, unsigned
 
 	// Return the pattern data.
 	// FIXME: Rebase to upper 64 KB if necessary. (128 KB VRAM mode)
-	return VRam.u32[(TileAddr + (y_fine_offset * 4)) >> 2];
+	return patternCache->pattern_line_m5_addr((pattern >> 11) & 1,
+			TileAddr + (y_fine_offset * 4));
 }
 
 /**
@@ -758,20 +762,11 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_Scroll(int cell_start, int cell_leng
 		if (VDP_Layers & VdpTypes::VDP_LAYER_SCROLLB_SWAP)
 			nametable_word ^= 0x8000;
 
-		// Check for horizontal flip.
-		if (nametable_word & 0x0800) {
-			// Pattern has H-Flip enabled.
-			if (nametable_word & 0x8000)
-				T_PutLine_P1<plane, h_s, true>(disp_pixnum, pattern_data, palette);
-			else
-				T_PutLine_P0<plane, h_s, true>(disp_pixnum, pattern_data, palette);
-		} else {
-			// Pattern doesn't have flip enabled.
-			if (nametable_word & 0x8000)
-				T_PutLine_P1<plane, h_s, false>(disp_pixnum, pattern_data, palette);
-			else
-				T_PutLine_P0<plane, h_s, false>(disp_pixnum, pattern_data, palette);
-		}
+		// NOTE: H-flip was applied by the pattern cache.
+		if (nametable_word & 0x8000)
+			T_PutLine_P1<plane, h_s, false>(disp_pixnum, pattern_data, palette);
+		else
+			T_PutLine_P0<plane, h_s, false>(disp_pixnum, pattern_data, palette);
 
 		// Go to the next H cell.
 		x_cell_offset = (x_cell_offset + 1) & H_Scroll_CMask;
@@ -867,20 +862,11 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_ScrollA_Window(void)
 			if (VDP_Layers & VdpTypes::VDP_LAYER_SCROLLA_SWAP)
 				pattern_info ^= 0x8000;
 
-			// Check for horizontal flip.
-			if (pattern_info & 0x0800) {
-				// Pattern has H-Flip enabled.
-				if (pattern_info & 0x8000)
-					T_PutLine_P1<true, h_s, true>(disp_pixnum, pattern_data, palette);
-				else
-					T_PutLine_P0<true, h_s, true>(disp_pixnum, pattern_data, palette);
-			} else {
-				// Pattern doesn't have flip enabled.
-				if (pattern_info & 0x8000)
-					T_PutLine_P1<true, h_s, false>(disp_pixnum, pattern_data, palette);
-				else
-					T_PutLine_P0<true, h_s, false>(disp_pixnum, pattern_data, palette);
-			}
+			// NOTE: H-flip was applied by the pattern cache.
+			if (pattern_info & 0x8000)
+				T_PutLine_P1<true, h_s, false>(disp_pixnum, pattern_data, palette);
+			else
+				T_PutLine_P0<true, h_s, false>(disp_pixnum, pattern_data, palette);
 		}
 
 		// Mark window pixels.
@@ -920,6 +906,161 @@ FORCE_INLINE void VdpPrivate::Update_Sprite_Line_Cache_m5(int line)
 	}
 }
 
+/**
+ * Get the index of the lowest set bit.
+ * @param x Value. (Must not be 0.)
+ * @return Index of the lowest set bit.
+ */
+static FORCE_INLINE unsigned int lowestBit64(uint64_t x)
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(x);
+#else
+	unsigned int bit = 0;
+	while (!(x & 1)) {
+		x >>= 1;
+		bit++;
+	}
+	return bit;
+#endif
+}
+
+/**
+ * Set or clear a link position in the sprite line index.
+ * @param lineMask Sprite line index bitmasks.
+ * @param lines Number of lines in the index.
+ * @param pos Link position.
+ * @param y Top line.
+ * @param y_max Bottom line.
+ * @param set If true, set the position; otherwise, clear it.
+ */
+static inline void sprLineIdxSetRange(uint64_t lineMask[][2], int lines,
+	unsigned int pos, int y, int y_max, bool set)
+{
+	if (y < 0)
+		y = 0;
+	if (y_max >= lines)
+		y_max = lines - 1;
+
+	const unsigned int word = (pos >> 6);
+	const uint64_t bit = (1ULL << (pos & 63));
+	if (set) {
+		for (; y <= y_max; y++) {
+			lineMask[y][word] |= bit;
+		}
+	} else {
+		for (; y <= y_max; y++) {
+			lineMask[y][word] &= ~bit;
+		}
+	}
+}
+
+/**
+ * Rebuild the sprite line index from the SAT cache.
+ * This walks the link list the same way the VDP does.
+ * @param interlaced If true, using Interlaced Mode 2. (2x res)
+ * @param max_spr_frame Maximum number of sprites per frame.
+ */
+template<bool interlaced>
+void VdpPrivate::T_Rebuild_Sprite_Line_Idx_m5(uint8_t max_spr_frame)
+{
+	SprLineIdx_t *const idx = &sprLineIdx;
+	memset(idx->lineMask, 0, sizeof(idx->lineMask));
+	memset(idx->pos, 0xFF, sizeof(idx->pos));
+	idx->dirty[0] = 0;
+	idx->dirty[1] = 0;
+	idx->max_spr_frame = max_spr_frame;
+	idx->interlaced = interlaced;
+	idx->rebuild = false;
+
+	uint8_t spr = 0;
+	unsigned int pos = 0;
+	do {
+		const VdpStructs::SprEntry_m5 *spr_SAT = &SprAttrTbl_m5.spr[spr];
+
+		// Calculate the sprite's position and height.
+		int y = spr_SAT->y;
+		int height = (spr_SAT->sz & 3);
+		if (interlaced) {
+			y = (y & 0x3FF) - 256;
+			height = (height * 16) + 15;
+		} else {
+			y = (y & 0x1FF) - 128;
+			height = (height * 8) + 7;
+		}
+
+		// NOTE: Link field is 7-bit. (See T_Update_Sprite_Line_Cache_m5().)
+		const uint8_t link = spr_SAT->link & 0x7F;
+		idx->spr[pos] = spr;
+		idx->link[pos] = link;
+		idx->y[pos] = y;
+		idx->y_max[pos] = y + height;	// height is already -1
+		idx->pos[spr] = pos;
+		sprLineIdxSetRange(idx->lineMask, SPR_IDX_LINES, pos, y, y + height, true);
+		pos++;
+
+		if (link == 0 || link >= max_spr_frame)
+			break;
+		spr = link;
+	} while (pos < max_spr_frame);
+
+	idx->count = pos;
+}
+
+/**
+ * Update the sprite line index for SAT cache changes.
+ * @param interlaced If true, using Interlaced Mode 2. (2x res)
+ * @param max_spr_frame Maximum number of sprites per frame.
+ */
+template<bool interlaced>
+FORCE_INLINE void VdpPrivate::T_Update_Sprite_Line_Idx_m5(uint8_t max_spr_frame)
+{
+	SprLineIdx_t *const idx = &sprLineIdx;
+	if (idx->rebuild || idx->interlaced != interlaced ||
+	    idx->max_spr_frame != max_spr_frame)
+	{
+		// Parameters have changed.
+		T_Rebuild_Sprite_Line_Idx_m5<interlaced>(max_spr_frame);
+		return;
+	}
+
+	for (unsigned int word = 0; word < 2; word++) {
+		uint64_t dirty = idx->dirty[word];
+		idx->dirty[word] = 0;
+		while (dirty != 0) {
+			const unsigned int spr = (word * 64) + lowestBit64(dirty);
+			dirty &= (dirty - 1);
+			const unsigned int pos = idx->pos[spr];
+			if (pos == 0xFF) {
+				// Sprite isn't linked.
+				continue;
+			}
+
+			const VdpStructs::SprEntry_m5 *spr_SAT = &SprAttrTbl_m5.spr[spr];
+			if ((spr_SAT->link & 0x7F) != idx->link[pos]) {
+				// Link order has changed.
+				T_Rebuild_Sprite_Line_Idx_m5<interlaced>(max_spr_frame);
+				return;
+			}
+
+			// Move the sprite to its new lines.
+			int y = spr_SAT->y;
+			int height = (spr_SAT->sz & 3);
+			if (interlaced) {
+				y = (y & 0x3FF) - 256;
+				height = (height * 16) + 15;
+			} else {
+				y = (y & 0x1FF) - 128;
+				height = (height * 8) + 7;
+			}
+			sprLineIdxSetRange(idx->lineMask, SPR_IDX_LINES, pos, idx->y[pos], idx->y_max[pos], false);
+			idx->y[pos] = y;
+			idx->y_max[pos] = y + height;	// height is already -1
+			sprLineIdxSetRange(idx->lineMask, SPR_IDX_LINES, pos, y, y + height, true);
+		}
+	}
+}
+
 /**
  * Update the Sprite Line Cache for the next line.
  * @param interlaced If true, using Interlaced Mode 2. (2x res)
@@ -933,7 +1074,6 @@ unsigned int VdpPrivate::T_Update_Sprite_Line_Cache_m5(int line)
 	// is used in Vdp.cpp. gcc-5.1 fails in release builds due to
 	// the function definition not being available there.
 	unsigned int ret = 0;
-	uint8_t link = 0;
 
 	// Determine the maximum number of sprites.
 	// NOTE: Max sprites per frame is always limited
@@ -981,78 +1121,58 @@ unsigned int VdpPrivate::T_Update_Sprite_Line_Cache_m5(int line)
 	uint8_t count = 0;
 
 	/**
-	 * The following values are read from the cached
-	 * Sprite Attribute Table instead of VRAM:
+	 * The following values are read from the sprite line index,
+	 * which is built from the cached Sprite Attribute Table:
 	 * - Y position
 	 * - Sprite size
-	 * - Link number
+	 * - Link order
 	 */
-	const VdpStructs::SprEntry_m5 *spr_SAT = &SprAttrTbl_m5.spr[0];
-
-	// Process up to max_spr_line sprites.
-	// (16 in H32, 20 in H40.)
-	int total_spr_count = max_spr_frame;
-	do {
-		// Check the Y position.
-		int y = spr_SAT->y;
-		if (interlaced) {
-			y = (y & 0x3FF) - 256;
-		} else {
-			y = (y & 0x1FF) - 128;
-		}
+	T_Update_Sprite_Line_Idx_m5<interlaced>(max_spr_frame);
+	const SprLineIdx_t *const idx = &sprLineIdx;
+	if (line < 0 || line >= SPR_IDX_LINES) {
+		// Line is out of range. No sprites can be present.
+		// (Non-interlaced sprites end at line 414; Interlaced
+		// Mode 2 lines never reach SPR_IDX_LINES.)
+		sprCountCache[cacheId] = 0;
+		return 0;
+	}
 
-		if (line >= y) {
-			// Calculate the sprite's height.
-			const uint8_t sz = spr_SAT->sz;
-			int height = (sz & 3);
-			if (interlaced) {
-				height = (height * 16) + 15;
-			} else {
-				height = (height * 8) + 7;
+	// Process the sprites on this line in link order.
+	// Up to max_spr_line sprites are cached. (16 in H32, 20 in H40.)
+	for (unsigned int word = 0; word < 2; word++) {
+		uint64_t mask = idx->lineMask[line][word];
+		while (mask != 0) {
+			const unsigned int pos = (word * 64) + lowestBit64(mask);
+			mask &= (mask - 1);
+
+			if (count == max_spr_line) {
+				// Sprite overflow!
+				ret = VdpStatus::VDP_STATUS_SOVR;
+				word = 2;	// Exit the outer loop, too.
+				break;
 			}
 
-			// Check if the bottom of the sprite is in range.
-			const int y_max = y + height;	// height is already -1
-			if (line <= y_max) {
-				// Sprite is in range.
-				if (count == max_spr_line) {
-					// Sprite overflow!
-					ret = VdpStatus::VDP_STATUS_SOVR;
-					break;
-				}
-
-				// Get the remaining sprite information from VRAM.
-				const VdpStructs::SprEntry_m5 *spr_VRam = Spr_Tbl_Addr_PtrM5(link);
-
-				// Save the sprite information in the line cache.
-				cache->Pos_X = (spr_VRam->x & 0x1FF) - 128;
-				cache->Pos_Y = y;
-				// NOTE: Size_? is in units of cells, not pixels.
-				cache->Size_X = ((sz >> 2) & 3) + 1;	// 1 more than the original value.
-				cache->Size_Y = (sz & 3);		// Exactly the original value.
-				// Pos_Y_Max is in units of pixels.
-				cache->Pos_Y_Max = y_max;
-				// Tile number. (Also includes palette, priority, and flip bits.)
-				cache->Num_Tile = spr_VRam->attr;
-
-				// Added a sprite.
-				count++;
-				cache++;
-			}
+			// Get the remaining sprite information from VRAM.
+			const uint8_t spr = idx->spr[pos];
+			const VdpStructs::SprEntry_m5 *spr_VRam = Spr_Tbl_Addr_PtrM5(spr);
+			const uint8_t sz = SprAttrTbl_m5.spr[spr].sz;
+
+			// Save the sprite information in the line cache.
+			cache->Pos_X = (spr_VRam->x & 0x1FF) - 128;
+			cache->Pos_Y = idx->y[pos];
+			// NOTE: Size_? is in units of cells, not pixels.
+			cache->Size_X = ((sz >> 2) & 3) + 1;	// 1 more than the original value.
+			cache->Size_Y = (sz & 3);		// Exactly the original value.
+			// Pos_Y_Max is in units of pixels.
+			cache->Pos_Y_Max = idx->y_max[pos];
+			// Tile number. (Also includes palette, priority, and flip bits.)
+			cache->Num_Tile = spr_VRam->attr;
+
+			// Added a sprite.
+			count++;
+			cache++;
 		}
-
-		// Link field.
-		// NOTE: Link field is 7-bit. Usually this won't cause a problem,
-		// since most games won't set the high bit.
-		// Dino Land incorrectly sets the high bit on some sprites,
-		// so we have to mask it off.
-		link = spr_SAT->link & 0x7F;
-		if (link == 0 || link >= max_spr_frame)
-			break;
-
-		// Get the next sprite address in the SAT.
-		spr_SAT = &SprAttrTbl_m5.spr[link];
-	} while (--total_spr_count);
+	}
 
 	// Save the sprite count for the next line.
 	sprCountCache[cacheId] = count;
@@ -1065,8 +1185,9 @@ unsigned int VdpPrivate::T_Update_Sprite_Line_Cache_m5(int line)
  * Render a sprite line.
  * @param interlaced	[in] True for interlaced; false for non-interlaced.
  * @param h_s		[in] Highlight/Shadow enable.
+ * @param spr_limit	[in] True to enforce the sprite dot limit.
  */
-template<bool interlaced, bool h_s>
+template<bool interlaced, bool h_s, bool spr_limit>
 FORCE_INLINE void VdpPrivate::T_Render_Line_Sprite(void)
 {
 	// Current line number, adjusting for Interlaced Mode 2.
@@ -1077,9 +1198,8 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_Sprite(void)
 	const SprLineCache_t *cache = &sprLineCache[cacheId][0];
 
 	// Pixel count for sprite limit.
-	// NOTE: If the user disabled sprite limit, then there's no maximum.
-	const unsigned int pixel_count_max =
-		(q->options.spriteLimits ? H_Pix : 65536);
+	// NOTE: If the user disabled sprite limit, sprite dots aren't counted.
+	const unsigned int pixel_count_max = H_Pix;
 	unsigned int pixel_count = 0;
 
 	// Sprite masking.
@@ -1109,12 +1229,14 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_Sprite(void)
 		int H_Pos_Max = H_Pos_Min + (cache->Size_X * 8) - 1;
 
 		// NOTE: Masked sprites still count towards the sprite dot limit.
-		pixel_count += (cache->Size_X * 8);
-		if (pixel_count > pixel_count_max) {
-			// Sprite dot overflow.
-			H_Pos_Max -= (pixel_count - pixel_count_max);
-			if (H_Pos_Max < H_Pos_Min)
-				break;
+		if (spr_limit) {
+			pixel_count += (cache->Size_X * 8);
+			if (pixel_count > pixel_count_max) {
+				// Sprite dot overflow.
+				H_Pos_Max -= (pixel_count - pixel_count_max);
+				if (H_Pos_Max < H_Pos_Min)
+					break;
+			}
 		}
 
 		if (sprites_masked) {
@@ -1201,18 +1323,19 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_Sprite(void)
 			}
 
 			// Draw the sprite.
+			// NOTE: H-flip is applied by the pattern cache.
 			if ((VDP_Layers & VdpTypes::VDP_LAYER_SPRITE_ALWAYSONTOP) || (spr_info & 0x8000)) {
 				// High priority.
 				for (; H_Pos_Max >= H_Pos_Min; H_Pos_Max -= 8) {
-					uint32_t pattern = Spr_Gen_Addr_u32(tile_num);
-					T_PutLine_Sprite<true, h_s, true>(H_Pos_Max, pattern, palette);
+					uint32_t pattern = Spr_Gen_Cache_u32(1, tile_num);
+					T_PutLine_Sprite<true, h_s, false>(H_Pos_Max, pattern, palette);
 					tile_num += Y_cell_size;
 				}
 			} else {
 				// Low priority.
 				for (; H_Pos_Max >= H_Pos_Min; H_Pos_Max -= 8) {
-					uint32_t pattern = Spr_Gen_Addr_u32(tile_num);
-					T_PutLine_Sprite<false, h_s, true>(H_Pos_Max, pattern, palette);
+					uint32_t pattern = Spr_Gen_Cache_u32(1, tile_num);
+					T_PutLine_Sprite<false, h_s, false>(H_Pos_Max, pattern, palette);
 					tile_num += Y_cell_size;
 				}
 			}
@@ -1230,14 +1353,14 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_Sprite(void)
 			if ((VDP_Layers & VdpTypes::VDP_LAYER_SPRITE_ALWAYSONTOP) || (spr_info & 0x8000)) {
 				// High priority.
 				for (; H_Pos_Min < H_Pos_Max; H_Pos_Min += 8) {
-					uint32_t pattern = Spr_Gen_Addr_u32(tile_num);
+					uint32_t pattern = Spr_Gen_Cache_u32(0, tile_num);
 					T_PutLine_Sprite<true, h_s, false>(H_Pos_Min, pattern, palette);
 					tile_num += Y_cell_size;
 				}
 			} else {
 				// Low priority.
 				for (; H_Pos_Min < H_Pos_Max; H_Pos_Min += 8) {
-					uint32_t pattern = Spr_Gen_Addr_u32(tile_num);
+					uint32_t pattern = Spr_Gen_Cache_u32(0, tile_num);
 					T_PutLine_Sprite<false, h_s, false>(H_Pos_Min, pattern, palette);
 					tile_num += Y_cell_size;
 				}
@@ -1245,7 +1368,7 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_Sprite(void)
 		}
 	}
 
-	if (pixel_count > pixel_count_max) {
+	if (spr_limit && pixel_count > pixel_count_max) {
 		// Sprite dot overflow.
 		sprDotOverflow = true;
 	} else {
@@ -1256,26 +1379,67 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_Sprite(void)
 
 /**
  * Render a line.
+ * This is called through renderLineFns_m5[].
  * @param interlaced	[in] True for interlaced; false for non-interlaced.
  * @param h_s		[in] Highlight/Shadow enable.
+ * @param vscroll	[in] True for 2-cell mode; false for full scroll.
+ * @param spr_limit	[in] True to enforce the sprite dot limit.
  */
-template<bool interlaced, bool h_s>
-FORCE_INLINE void VdpPrivate::T_Render_Line_m5(void)
+template<bool interlaced, bool h_s, bool vscroll, bool spr_limit>
+void VdpPrivate::T_Render_Line_m5(void)
 {
+	// Update the pattern cache.
+	if (patternCache->isDirty())
+		patternCache->update_m5(&VRam);
+
 	// Clear the line first.
 	memset(&LineBuf, (h_s ? LINEBUF_SHAD_B : 0), sizeof(LineBuf));
 
-	if (VDP_Reg.m5.Set3 & VDP_REG_M5_SET3_VSCR) {
-		// 2-cell VScroll.
-		T_Render_Line_Scroll<false, interlaced, true, h_s>(0, H_Cell);	// Scroll B
-		T_Render_Line_ScrollA_Window<interlaced, true, h_s>();		// Scroll A
-	} else {
-		// Full VScroll.
-		T_Render_Line_Scroll<false, interlaced, false, h_s>(0, H_Cell);	// Scroll B
-		T_Render_Line_ScrollA_Window<interlaced, false, h_s>();		// Scroll A
-	}
+	T_Render_Line_Scroll<false, interlaced, vscroll, h_s>(0, H_Cell);	// Scroll B
+	T_Render_Line_ScrollA_Window<interlaced, vscroll, h_s>();		// Scroll A
+	T_Render_Line_Sprite<interlaced, h_s, spr_limit>();
+}
+
+/**
+ * Mode 5 line renderers, indexed by M5Key_t.
+ */
+const VdpPrivate::RenderLineFn_m5 VdpPrivate::renderLineFns_m5[VdpPrivate::M5KEY_MAX] = {
+	// Sprite limits disabled; full VScroll.
+	&VdpPrivate::T_Render_Line_m5<false, false, false, false>,
+	&VdpPrivate::T_Render_Line_m5<true,  false, false, false>,
+	&VdpPrivate::T_Render_Line_m5<false, true,  false, false>,
+	&VdpPrivate::T_Render_Line_m5<true,  true,  false, false>,
+	// Sprite limits disabled; 2-cell VScroll.
+	&VdpPrivate::T_Render_Line_m5<false, false, true,  false>,
+	&VdpPrivate::T_Render_Line_m5<true,  false, true,  false>,
+	&VdpPrivate::T_Render_Line_m5<false, true,  true,  false>,
+	&VdpPrivate::T_Render_Line_m5<true,  true,  true,  false>,
+	// Sprite limits enabled; full VScroll.
+	&VdpPrivate::T_Render_Line_m5<false, false, false, true>,
+	&VdpPrivate::T_Render_Line_m5<true,  false, false, true>,
+	&VdpPrivate::T_Render_Line_m5<false, true,  false, true>,
+	&VdpPrivate::T_Render_Line_m5<true,  true,  false, true>,
+	// Sprite limits enabled; 2-cell VScroll.
+	&VdpPrivate::T_Render_Line_m5<false, false, true,  true>,
+	&VdpPrivate::T_Render_Line_m5<true,  false, true,  true>,
+	&VdpPrivate::T_Render_Line_m5<false, true,  true,  true>,
+	&VdpPrivate::T_Render_Line_m5<true,  true,  true,  true>,
+};
 
-	T_Render_Line_Sprite<interlaced, h_s>();
+/**
+ * Get the Mode 5 line renderer key for the current line.
+ * @return Mode 5 line renderer key. (See M5Key_t.)
+ */
+FORCE_INLINE unsigned int VdpPrivate::m5Key(void) const
+{
+	unsigned int key = (im2_flag ? M5KEY_IM2 : 0);
+	if (VDP_Reg.m5.Set4 & VDP_REG_M5_SET4_STE)
+		key |= M5KEY_HS;
+	if (VDP_Reg.m5.Set3 & VDP_REG_M5_SET3_VSCR)
+		key |= M5KEY_VSCROLL;
+	if (q->options.spriteLimits)
+		key |= M5KEY_SPRLIMIT;
+	return key;
 }
 
 /**
@@ -1283,25 +1447,16 @@ FORCE_INLINE void VdpPrivate::T_Render_Line_m5(void)
  * @param pixel Type of pixel.
  * @param dest Destination surface.
  * @param md_palette MD palette buffer.
+ * @param border_color Border color.
  */
 template<typename pixel>
-FORCE_INLINE void VdpPrivate::T_Render_LineBuf(pixel *dest, pixel *md_palette)
+FORCE_INLINE void VdpPrivate::T_Render_LineBuf(pixel *dest, pixel *md_palette, pixel border_color)
 {
-	const LineBuf_t::LineBuf_px_t *src = &LineBuf.px[8];
-
 	// Render the line buffer to the destination surface.
+	// NOTE: VdpLineBuf selects an optimized implementation
+	// based on CPU_Flags.
 	dest += H_Pix_Begin;
-	const pixel *dest_end = dest + H_Pix;
-	for (; dest < dest_end; dest += 8, src += 8) {
-		*(dest+0) = md_palette[src->pixel];
-		*(dest+1) = md_palette[(src+1)->pixel];
-		*(dest+2) = md_palette[(src+2)->pixel];
-		*(dest+3) = md_palette[(src+3)->pixel];
-		*(dest+4) = md_palette[(src+4)->pixel];
-		*(dest+5) = md_palette[(src+5)->pixel];
-		*(dest+6) = md_palette[(src+6)->pixel];
-		*(dest+7) = md_palette[(src+7)->pixel];
-	}
+	VdpLineBuf::resolve(dest, &LineBuf.u16[8], H_Pix, md_palette);
 
 	if (H_Pix_Begin == 0)
 		return;
@@ -1309,38 +1464,11 @@ FORCE_INLINE void VdpPrivate::T_Render_LineBuf(pixel *dest, pixel *md_palette)
 	// Draw the borders.
 	// NOTE: S/H is ignored if we're in the border region.
 
-	// Get the border color.
-	register const pixel border_color =
-		(q->options.borderColorEmulation ? md_palette[0] : 0);
-
 	// Left border.
-	dest -= H_Pix_Begin;
-	dest -= H_Pix;
-	dest_end = dest + H_Pix_Begin;
-	for (; dest < dest_end; dest += 8) {
-		*(dest+0) = border_color;
-		*(dest+1) = border_color;
-		*(dest+2) = border_color;
-		*(dest+3) = border_color;
-		*(dest+4) = border_color;
-		*(dest+5) = border_color;
-		*(dest+6) = border_color;
-		*(dest+7) = border_color;
-	}
+	VdpLineBuf::fill(dest - H_Pix_Begin, H_Pix_Begin, border_color);
 
 	// Right border.
-	dest += H_Pix;
-	dest_end = dest + H_Pix_Begin;
-	for (; dest < dest_end; dest += 8) {
-		*(dest+0) = border_color;
-		*(dest+1) = border_color;
-		*(dest+2) = border_color;
-		*(dest+3) = border_color;
-		*(dest+4) = border_color;
-		*(dest+5) = border_color;
-		*(dest+6) = border_color;
-		*(dest+7) = border_color;
-	}
+	VdpLineBuf::fill(dest + H_Pix, H_Pix_Begin, border_color);
 }
 
 /**
@@ -1367,16 +1495,15 @@ FORCE_INLINE void VdpPrivate::T_Apply_SMS_LCB(pixel *dest, pixel border_color)
 }
 
 /**
- * Render a line. (Mode 5)
+ * Update the VDP for a line that isn't rendered. (Mode 5)
+ * The sprite line cache for line 0 is updated on the
+ * last line of the previous frame, so this must be
+ * called even if the frame is skipped.
  */
-void VdpPrivate::renderLine_m5(void)
+void VdpPrivate::skipLine_m5(void)
 {
-	// Determine what part of the screen we're in.
-	bool in_border = false;
-	int lineNum = q->VDP_Lines.currentLine;
-
 	// TODO: This check needs to be optimized.
-	if (lineNum == (q->VDP_Lines.totalDisplayLines - 1) &&
+	if (q->VDP_Lines.currentLine == (q->VDP_Lines.totalDisplayLines - 1) &&
 	    (VDP_Reg.m5.Set2 & VDP_REG_M5_SET2_DISP))
 	{
 		// Clear the sprite dot overflow variable.
@@ -1387,6 +1514,39 @@ void VdpPrivate::renderLine_m5(void)
 		// Update the sprite line cache.
 		Update_Sprite_Line_Cache_m5(-1);
 	}
+}
+
+/**
+ * Render a line. (Mode 5)
+ * @param mode Rendering mode. (See RendMode_t.)
+ */
+template<VdpPrivate::RendMode_t mode>
+FORCE_INLINE void VdpPrivate::T_renderLine_m5(void)
+{
+	// Determine what part of the screen we're in.
+	bool in_border = false;
+	int lineNum = q->VDP_Lines.currentLine;
+
+	if (mode != RENDMODE_THREAD) {
+		// Update the sprite line cache for line 0, if necessary.
+		skipLine_m5();
+	} else {
+		// The sprite line cache was queued with the line,
+		// but the sprite dot overflow flag is render-only.
+		// (See skipLine_m5().)
+		if (q->VDP_Lines.currentLine == (q->VDP_Lines.totalDisplayLines - 1) &&
+		    (VDP_Reg.m5.Set2 & VDP_REG_M5_SET2_DISP))
+		{
+			sprDotOverflow = false;
+		}
+	}
+
+	if (mode == RENDMODE_QUEUE) {
+		// Queue the line for the render thread.
+		// This must be done before the sprite line cache
+		// is updated for the next line.
+		rendThread->queueLine();
+	}
 
 	// Check for borders.
 	if (lineNum >= q->VDP_Lines.Border.borderStartBottom &&
@@ -1423,6 +1583,12 @@ void VdpPrivate::renderLine_m5(void)
 	}
 	lineNum += q->VDP_Lines.Border.borderSize;
 
+	if (mode == RENDMODE_QUEUE && (in_border || !(VDP_Reg.m5.Set2 & VDP_REG_M5_SET2_DISP))) {
+		// The render thread will draw this line.
+		// The sprite line cache isn't updated here.
+		return;
+	}
+
 	if (in_border && !q->options.borderColorEmulation) {
 		// We're in the border area, but border color emulation is disabled.
 		// Clear the border area.
@@ -1434,11 +1600,15 @@ void VdpPrivate::renderLine_m5(void)
 			memset(q->MD_Screen->lineBuf32(lineNum), 0x00,
 				(q->MD_Screen->pxPerLine() * sizeof(uint32_t)));
 		}
+		q->MD_Screen->updateLineHash(lineNum);
 
 		// ...and we're done here.
 		return;
 	}
 
+	// If true, mid-line writes will be logged for this line.
+	bool logMidLine = false;
+
 	// Check if the VDP is enabled.
 	if (!(VDP_Reg.m5.Set2 & VDP_REG_M5_SET2_DISP) || in_border) {
 		// VDP is disabled, or this is the border region.
@@ -1453,33 +1623,23 @@ void VdpPrivate::renderLine_m5(void)
 	} else {
 		// VDP is enabled.
 
-		// Determine how to render the image.
-		int RenderMode = ((VDP_Reg.m5.Set4 & VDP_REG_M5_SET4_STE) >> 2);	// Shadow/Highlight
-		RenderMode |= !!im2_flag;						// Interlaced.
-		switch (RenderMode & 3) {
-			case 0:
-				// H/S disabled; normal display.
-				T_Render_Line_m5<false, false>();
-				break;
-			case 1:
-				// H/S disabled: Interlaced Mode 2.
-				T_Render_Line_m5<true, false>();
-				break;
-			case 2:
-				// H/S enabled; normal display.
-				T_Render_Line_m5<false, true>();
-				break;
-			case 3:
-				// H/S enabled: Interlaced Mode 2.
-				T_Render_Line_m5<true, true>();
-				break;
-			default:
-				// to make gcc shut up
-				break;
+		if (mode != RENDMODE_QUEUE) {
+			if (mode == RENDMODE_FULL && q->options.midLineWrites) {
+				// Save the sprite dot overflow flag in case
+				// the line has to be rerendered.
+				logMidLine = true;
+				lineLogSprDotOverflow = sprDotOverflow;
+			}
+
+			// Render the image using the variant
+			// that's specialized for the current mode.
+			(this->*renderLineFns_m5[m5Key()])();
 		}
 
 		// Update the sprite line cache for the next line.
-		if (q->VDP_Lines.currentLine < (q->VDP_Lines.totalDisplayLines - 1)) {
+		if (mode != RENDMODE_THREAD &&
+		    q->VDP_Lines.currentLine < (q->VDP_Lines.totalDisplayLines - 1))
+		{
 			// Update only for visible lines.
 			if (im2_flag) {
 				Update_Sprite_Line_Cache_m5(T_GetLineNumber<true>());
@@ -1489,40 +1649,188 @@ void VdpPrivate::renderLine_m5(void)
 		}
 	}
 
+	if (mode == RENDMODE_QUEUE) {
+		// The render thread will draw this line.
+		return;
+	}
+
 	// Update the active palette.
 	// FIXME: If palette is locked and bpp is changed, convert it.
 	if (!(VDP_Layers & VdpTypes::VDP_LAYER_PALETTE_LOCK)) {
 		if (!q->options.updatePaletteInVBlankOnly || in_border) {
+			// NOTE: setBpp() only marks the palette as dirty,
+			// so update() must still be called on this line.
 			if (palette.bpp() != q->MD_Screen->bpp())
 				palette.setBpp(q->MD_Screen->bpp());
-			else
-				palette.update();
+			palette.update();
 		}
 	}
 
 	// Render the image.
+	// NOTE: The border color is also used for SMS LCB.
+	// FIXME: Should borderColorEmulation apply to SMS LCB?
 	// TODO: Optimize SMS LCB handling. (maybe use Linux's unlikely() macro?)
+	const bool borderColorEmulation = q->options.borderColorEmulation;
 	if (q->MD_Screen->bpp() != MdFb::BPP_32) {
 		uint16_t *lineBuf16 = q->MD_Screen->lineBuf16(lineNum);
-		T_Render_LineBuf<uint16_t>(lineBuf16, palette.m_palActive.u16);
+		const uint16_t border_color =
+			(borderColorEmulation ? palette.m_palActive.u16[0] : 0);
+		T_Render_LineBuf<uint16_t>(lineBuf16, palette.m_palActive.u16, border_color);
 
 		if (VDP_Reg.m5.Set1 & VDP_REG_M5_SET1_LCB) {
 			// SMS left-column blanking bit is set.
-			// FIXME: Should borderColorEmulation apply here?
-			T_Apply_SMS_LCB<uint16_t>(lineBuf16, 
-				(q->options.borderColorEmulation ? palette.m_palActive.u16[0] : 0));
+			T_Apply_SMS_LCB<uint16_t>(lineBuf16, border_color);
 		}
 	} else {
 		uint32_t *lineBuf32 = q->MD_Screen->lineBuf32(lineNum);
-		T_Render_LineBuf<uint32_t>(lineBuf32, palette.m_palActive.u32);
+		const uint32_t border_color =
+			(borderColorEmulation ? palette.m_palActive.u32[0] : 0);
+		T_Render_LineBuf<uint32_t>(lineBuf32, palette.m_palActive.u32, border_color);
 
 		if (VDP_Reg.m5.Set1 & VDP_REG_M5_SET1_LCB) {
 			// SMS left-column blanking bit is set.
-			// FIXME: Should borderColorEmulation apply here?
-			T_Apply_SMS_LCB<uint32_t>(lineBuf32, 
-				(q->options.borderColorEmulation ? palette.m_palActive.u32[0] : 0));
+			T_Apply_SMS_LCB<uint32_t>(lineBuf32, border_color);
 		}
 	}
+
+	// Update the line hash so video backends
+	// can skip lines that haven't changed.
+	q->MD_Screen->updateLineHash(lineNum);
+
+	if (logMidLine) {
+		// Log writes until finishLine_m5().
+		lineLogCount = 0;
+		lineLogFbLine = lineNum;
+	}
+}
+
+/**
+ * Render the line buffer to the destination surface, starting at a given column.
+ * The right border is also redrawn, since the border color may have changed.
+ * @param pixel Type of pixel.
+ * @param dest Destination surface.
+ * @param md_palette MD palette buffer.
+ * @param column First pixel column.
+ */
+template<typename pixel>
+FORCE_INLINE void VdpPrivate::T_Render_LineSpan(pixel *dest, const pixel *md_palette, int column)
+{
+	const pixel border_color =
+		(q->options.borderColorEmulation ? md_palette[0] : 0);
+	dest += H_Pix_Begin;
+
+	// VdpLineBuf::resolve() requires a multiple of 8 pixels.
+	const int aligned = (column + 7) & ~7;
+	for (int x = column; x < aligned && x < H_Pix; x++) {
+		dest[x] = md_palette[LineBuf.u16[8 + x] & 0xFF];
+	}
+	if (aligned < H_Pix) {
+		VdpLineBuf::resolve(&dest[aligned], &LineBuf.u16[8 + aligned],
+				H_Pix - aligned, md_palette);
+	}
+
+	if (VDP_Reg.m5.Set1 & VDP_REG_M5_SET1_LCB) {
+		// SMS left-column blanking bit is set.
+		for (int x = column; x < 8; x++) {
+			dest[x] = border_color;
+		}
+	}
+
+	if (H_Pix_Begin != 0) {
+		// Right border.
+		VdpLineBuf::fill(dest + H_Pix, H_Pix_Begin, border_color);
+	}
+}
+
+/**
+ * Finish the current line. (Mode 5)
+ * The line is rerendered in spans using the logged writes.
+ */
+void VdpPrivate::finishLine_m5(void)
+{
+	const int count = lineLogCount;
+	abortLineLog();
+	if (count <= 0 || lineLog[0].column >= H_Pix) {
+		// No writes during the active display.
+		return;
+	}
+
+	// Undo all of the writes to get the state
+	// that was used to render the line.
+	for (int i = count - 1; i >= 0; i--) {
+		applyLineWrite(&lineLog[i], true);
+	}
+
+	// Redo the writes one column at a time.
+	// Each span is rendered from its column to the end of the line;
+	// the next span overwrites the rest of the line.
+	const bool sprDotOverflow_end = sprDotOverflow;
+	int i = 0;
+	while (i < count) {
+		const int column = lineLog[i].column;
+		for (; i < count && lineLog[i].column == column; i++) {
+			applyLineWrite(&lineLog[i], false);
+		}
+		if (column >= H_Pix) {
+			// Writes after the active display only
+			// affect the next line.
+			continue;
+		}
+
+		if (VDP_Reg.m5.Set2 & VDP_REG_M5_SET2_DISP) {
+			sprDotOverflow = lineLogSprDotOverflow;
+			(this->*renderLineFns_m5[m5Key()])();
+		} else {
+			// Display was disabled.
+			memset(LineBuf.u8, 0x00, sizeof(LineBuf.u8));
+		}
+
+		// Update the active palette.
+		if (!(VDP_Layers & VdpTypes::VDP_LAYER_PALETTE_LOCK) &&
+		    !q->options.updatePaletteInVBlankOnly)
+		{
+			palette.update();
+		}
+
+		if (q->MD_Screen->bpp() != MdFb::BPP_32) {
+			T_Render_LineSpan<uint16_t>(q->MD_Screen->lineBuf16(lineLogFbLine),
+				palette.m_palActive.u16, column);
+		} else {
+			T_Render_LineSpan<uint32_t>(q->MD_Screen->lineBuf32(lineLogFbLine),
+				palette.m_palActive.u32, column);
+		}
+	}
+	sprDotOverflow = sprDotOverflow_end;
+
+	q->MD_Screen->updateLineHash(lineLogFbLine);
+}
+
+/**
+ * Render a line. (Mode 5)
+ */
+void VdpPrivate::renderLine_m5(void)
+{
+	T_renderLine_m5<RENDMODE_FULL>();
+}
+
+/**
+ * Queue a line for the render thread. (Mode 5)
+ * The sprite line cache is updated here, so the
+ * sprite overflow flag is set without any delay.
+ */
+void VdpPrivate::queueLine_m5(void)
+{
+	T_renderLine_m5<RENDMODE_QUEUE>();
+}
+
+/**
+ * Render a queued line. (Mode 5)
+ * This is called on the render thread's shadow VDP
+ * after loadRendLine().
+ */
+void VdpPrivate::renderQueuedLine_m5(void)
+{
+	T_renderLine_m5<RENDMODE_THREAD>();
 }
 
 // TODO: 32X stuff.
@@ -55,15 +55,10 @@ uint16_t VdpStatus::read(void)
 {
 	// Save the original status register.
 	// The original status register will be returned to the CPU.
+	// NOTE: The FIFO flags are updated by the VDP
+	// before the status register is read.
 	const uint16_t status_orig = m_status;
 	
-	// Toggle the VDP FIFO flags.
-	// This is needed for some games that expect the FIFO
-	// state to change instead of remaining perpetually
-	// empty or half-full.
-	// TODO: Implement the FIFO.
-	m_status ^= (VDP_STATUS_FULL | VDP_STATUS_EMPTY);
-	
 	// Mask the SOVR ("Sprite Overflow") and C ("Collision between non-zero pixels in two sprites") bits.
 	m_status &= ~(VDP_STATUS_SOVR | VDP_STATUS_COLLISION);
 	
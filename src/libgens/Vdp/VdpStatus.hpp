@@ -44,8 +44,8 @@ class VdpStatus
 			VDP_STATUS_COLLISION	= 0x0020,	// 1 == collision between non-zero sprite pixels
 			VDP_STATUS_SOVR		= 0x0040,	// 1 == sprite overflow occurred
 			VDP_STATUS_F		= 0x0080,	// 1 == VINT happened
-			VDP_STATUS_FULL		= 0x0100,	// 1 == WRITE FIFO FULL (TODO: Not properly emulated!)
-			VDP_STATUS_EMPTY	= 0x0200,	// 1 == WRITE FIFO EMPTY (TODO: Not properly emulated!)
+			VDP_STATUS_FULL		= 0x0100,	// 1 == WRITE FIFO FULL
+			VDP_STATUS_EMPTY	= 0x0200,	// 1 == WRITE FIFO EMPTY
 		};
 		
 		/**
@@ -182,6 +182,23 @@ namespace VdpTypes {
 		 * This is similar to Genecyst.
 		 */
 		bool enableInterlacedMode;
+
+		/**
+		 * Apply VDP writes that occur during the active display
+		 * at the pixel column where they happened, e.g. for
+		 * mid-line palette changes. (Mode 5 only)
+		 * This also delays HINT until the end of the active display.
+		 * Not supported with deferred rendering.
+		 */
+		bool midLineWrites;
+
+		/**
+		 * Copy 68000-to-VDP DMA transfers in one go
+		 * when the source and destination are contiguous.
+		 * Default is true. If false, every transfer uses
+		 * the word-by-word loop. (for testing)
+		 */
+		bool bulkDMA;
 	};
 
 	// VDP layer flags.
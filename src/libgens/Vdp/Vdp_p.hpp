@@ -36,16 +36,21 @@
 #include "VdpPalette.hpp"
 #include "VdpStatus.hpp"
 #include "VdpStructs.hpp"
+#include "VdpCache.hpp"
+#include "VdpRendThread.hpp"
 
 #include "VdpRend_Err_p.hpp"
 
 namespace LibGens {
 
+class EmuContext;
+class MdFbRing;
+
 class Vdp;
 class VdpPrivate
 {
 	public:
-		VdpPrivate(Vdp *q);
+		VdpPrivate(Vdp *q, EmuContext *context);
 		~VdpPrivate();
 
 	protected:
@@ -57,6 +62,23 @@ class VdpPrivate
 		VdpPrivate(const VdpPrivate &);
 		VdpPrivate &operator=(const VdpPrivate &);
 
+	public:
+		// Emulation context that owns this VDP.
+		// May be nullptr if the VDP is used standalone,
+		// e.g. in the test suites.
+		EmuContext *const context;
+
+		// Framebuffer ring. (not owned by the VDP)
+		// If set, MD_Screen is the ring's back buffer.
+		// (See Vdp::setFbRing().)
+		MdFbRing *fbRing;
+
+		/**
+		 * Switch MD_Screen to the ring's back buffer.
+		 * Does nothing if no ring is set.
+		 */
+		void useBackBuffer(void);
+
 	public:
 		// Default VDP emulation options.
 		static const VdpTypes::VdpEmuOptions_t def_vdpEmuOptions;
@@ -149,6 +171,53 @@ class VdpPrivate
 		VdpTypes::VRam_t VRam;
 		VdpTypes::VSRam_t VSRam;
 
+		// Decoded pattern cache.
+		// All VRam writes must call markVRamDirty().
+		VdpCache *patternCache;
+
+		// Deferred rendering thread.
+		// nullptr if lines are rendered synchronously.
+		VdpRendThread *rendThread;
+
+		/**
+		 * Mark a VRam address as dirty.
+		 * This must be called whenever VRam is written.
+		 * @param address VRam address. (bytes)
+		 */
+		inline void markVRamDirty(uint32_t address)
+		{
+			patternCache->markDirty(address);
+			if (rendThread)
+				rendThread->markDirty(address);
+		}
+
+		/**
+		 * Mark a range of VRam as dirty.
+		 * @param address VRam address. (bytes)
+		 * @param size Size of the range. (bytes)
+		 */
+		inline void markVRamDirtyRange(uint32_t address, uint32_t size)
+		{
+			// Pattern cache granularity is 4 bytes.
+			const uint32_t end = address + size;
+			for (address &= ~3; address < end; address += 4) {
+				markVRamDirty(address);
+			}
+		}
+
+		/**
+		 * Mark all of VRam as dirty.
+		 * This must be called if VRam is overwritten
+		 * without using markVRamDirty(), e.g. on reset
+		 * or savestate load.
+		 */
+		inline void invalidateVRam(void)
+		{
+			patternCache->invalidate();
+			if (rendThread)
+				rendThread->invalidate();
+		}
+
 		int HInt_Counter;	// Horizontal Interrupt Counter.
 		int VDP_Int;		// VDP interrupt state.
 		VdpStatus Reg_Status;	// VDP status register.
@@ -254,6 +323,9 @@ class VdpPrivate
 			{ return ScrA_Gen_Addr_u16(offset); }
 		inline uint32_t Spr_Gen_Addr_u32(uint32_t offset) const
 			{ return VRam.u32[((Spr_Gen_Addr + offset) & VRam_Mask) >> 2]; }
+		// Pattern Generators (pattern cache; hflip: 0=normal, 1=H)
+		inline uint32_t Spr_Gen_Cache_u32(unsigned int hflip, uint32_t offset) const
+			{ return patternCache->pattern_line_m5_addr(hflip, (Spr_Gen_Addr + offset) & VRam_Mask); }
 
 		/**
 		 * Update the VDP address cache. (Mode 5)
@@ -318,6 +390,83 @@ class VdpPrivate
 			}
 		} VDP_Ctrl;
 
+		/**
+		 * VDP write FIFO. (M5)
+		 * Data port writes are queued here, and each entry is
+		 * committed during the VDP's external access slots.
+		 * VRam writes take two slots (one per byte); CRam and
+		 * VSRam writes take one slot.
+		 *
+		 * NOTE: Writes are applied to memory immediately.
+		 * The FIFO only tracks timing, plus the last four
+		 * words written, which show up in the unused bits
+		 * of CRam, VSRam, and 8-bit VRam reads.
+		 */
+		struct {
+			uint16_t data[4];	// FIFO entries.
+			uint8_t cost[4];	// Access slots needed for each entry.
+			uint8_t index;		// Next entry to be written.
+			uint8_t count;		// Number of pending entries.
+			uint8_t progress;	// Slots already used by the oldest pending entry.
+			uint8_t reserved;
+			unsigned int lastCycle;	// 68000 odometer at the last update.
+
+			void reset(void)
+			{
+				for (int i = 0; i < 4; i++) {
+					data[i] = 0;
+					cost[i] = 0;
+				}
+				index = 0;
+				count = 0;
+				progress = 0;
+				reserved = 0;
+				lastCycle = 0;
+			}
+
+			/**
+			 * Store a word in the FIFO without any timing.
+			 * Used by DMA and by the fast path.
+			 * @param w Data word.
+			 */
+			inline void push(uint16_t w)
+			{
+				data[index] = w;
+				index = (index + 1) & 3;
+			}
+		} VDP_FIFO;
+
+		// Number of external access slots before each line cycle. [H32, H40]
+		// Index 511 has the total number of slots per line.
+		uint8_t FIFO_Slot_Table[512][2];
+
+		/**
+		 * Check if the write FIFO is timed.
+		 * During VBlank or with the display disabled, every
+		 * slot is an access slot, so the FIFO never fills up.
+		 * @return True if FIFO writes are limited by access slots.
+		 */
+		inline bool isFifoTimed(void) const
+		{
+			return ((VDP_Reg.m5.Set2 & VDP_REG_M5_SET2_DISP) &&
+				!(Reg_Status.read_raw() & VdpStatus::VDP_STATUS_VBLANK));
+		}
+
+		/**
+		 * Commit pending FIFO entries using the access slots
+		 * that have passed since the last update.
+		 * @param now 68000 odometer.
+		 */
+		void fifoUpdate(unsigned int now);
+
+		/**
+		 * Queue a data port write in the FIFO.
+		 * If the FIFO is full, the 68000 is stalled until
+		 * the oldest entry is committed.
+		 * @param data Data word.
+		 */
+		void fifoWrite(uint16_t data);
+
 		/** DMA helper functions. **/
 
 		/**
@@ -409,6 +558,9 @@ class VdpPrivate
 		template<DMA_Src_t src_component, DMA_Dest_t dest_component>
 		inline void T_DMA_Loop(void);
 
+		template<DMA_Dest_t dest_component>
+		inline bool T_DMA_Bulk(const uint16_t *src, int length);
+
 		void processDmaCtrlWrite(void);
 
 	/*!**************************************************************
@@ -454,8 +606,29 @@ class VdpPrivate
 	 * VdpRend_m5: Mode 5 rendering functions and variables.        *
 	 ****************************************************************/
 	public:
+		/**
+		 * Mode 5 line rendering mode.
+		 * Used for deferred rendering. (See VdpRendThread.)
+		 */
+		enum RendMode_t {
+			// Update the sprite line cache and render the line.
+			RENDMODE_FULL,
+			// Update the sprite line cache and queue the line.
+			// (emulation thread; deferred rendering)
+			RENDMODE_QUEUE,
+			// Render the line using the queued sprite line cache.
+			// (render thread; deferred rendering)
+			RENDMODE_THREAD,
+		};
+
 		/** Line rendering functions. **/
 		void renderLine_m5(void);
+		void queueLine_m5(void);
+		void renderQueuedLine_m5(void);
+		void skipLine_m5(void);
+
+		template<RendMode_t mode>
+		FORCE_INLINE void T_renderLine_m5(void);
 
 	private:
 		// Sprite Attribute Table cache. (Mode 5)
@@ -513,6 +686,72 @@ class VdpPrivate
 		// Includes both the current line and the next line.
 		uint8_t sprCountCache[2];
 
+		/**
+		 * Sprite line index. (Mode 5)
+		 * Sprites are stored in link order, along with a bitmask
+		 * of the link positions that are present on each line.
+		 * This lets the sprite line cache be updated without
+		 * walking the link list for every line.
+		 *
+		 * The index is rebuilt from the SAT cache if a link field
+		 * changes. If only the Y position or size of a linked
+		 * sprite changes, only that sprite is updated.
+		 */
+		static const int SPR_IDX_LINES = 512;
+		struct SprLineIdx_t {
+			// Link positions present on each line.
+			uint64_t lineMask[SPR_IDX_LINES][2];
+
+			// Sprites, in link order.
+			uint8_t spr[80];	// SAT index.
+			uint8_t link[80];	// Link field. (masked)
+			int16_t y[80];		// Top line.
+			int16_t y_max[80];	// Bottom line.
+			uint8_t count;		// Number of linked sprites.
+
+			// Link position of each SAT entry. (0xFF if not linked)
+			uint8_t pos[128];
+
+			// SAT entries whose Y position, size, or link changed.
+			uint64_t dirty[2];
+
+			// Parameters the index was built with.
+			uint8_t max_spr_frame;
+			bool interlaced;
+			bool rebuild;	// If true, the index must be rebuilt.
+		};
+		SprLineIdx_t sprLineIdx;
+
+		/**
+		 * Mark a SAT cache entry as dirty.
+		 * This must be called whenever the SAT cache is written.
+		 * @param offset Byte offset in the SAT cache.
+		 */
+		inline void markSprAttrDirty(uint32_t offset)
+		{
+			// Only the Y position, size, and link are indexed.
+			if ((offset & 7) < 4) {
+				const unsigned int idx = (offset >> 3) & 0x7F;
+				sprLineIdx.dirty[idx >> 6] |= (1ULL << (idx & 63));
+			}
+		}
+
+		/**
+		 * Rebuild the sprite line index on the next update.
+		 * This must be called if the SAT cache is overwritten
+		 * without using markSprAttrDirty().
+		 */
+		inline void invalidateSprLineIdx(void)
+		{
+			sprLineIdx.rebuild = true;
+		}
+
+		template<bool interlaced>
+		void T_Rebuild_Sprite_Line_Idx_m5(uint8_t max_spr_frame);
+
+		template<bool interlaced>
+		FORCE_INLINE void T_Update_Sprite_Line_Idx_m5(uint8_t max_spr_frame);
+
 	/*!*****************************************
 	 * VdpRend_m5: Mode 5 rendering functions. *
 	 *******************************************/
@@ -575,18 +814,212 @@ class VdpPrivate
 		template<bool interlaced>
 		unsigned int T_Update_Sprite_Line_Cache_m5(int line);
 
-		template<bool interlaced, bool h_s>
+		template<bool interlaced, bool h_s, bool spr_limit>
 		FORCE_INLINE void T_Render_Line_Sprite(void);
 
-		template<bool interlaced, bool h_s>
-		FORCE_INLINE void T_Render_Line_m5(void);
+		template<bool interlaced, bool h_s, bool vscroll, bool spr_limit>
+		void T_Render_Line_m5(void);
+
+		/**
+		 * Mode 5 line renderer key.
+		 * Each combination of bits selects a fully-specialized
+		 * T_Render_Line_m5() variant from renderLineFns_m5[].
+		 */
+		enum M5Key_t {
+			M5KEY_IM2	= (1 << 0),	// Interlaced Mode 2.
+			M5KEY_HS	= (1 << 1),	// Highlight/Shadow.
+			M5KEY_VSCROLL	= (1 << 2),	// 2-cell VScroll.
+			M5KEY_SPRLIMIT	= (1 << 3),	// Sprite dot limit.
+
+			M5KEY_MAX	= (1 << 4)
+		};
+
+		/**
+		 * Get the Mode 5 line renderer key for the current line.
+		 * @return Mode 5 line renderer key. (See M5Key_t.)
+		 */
+		FORCE_INLINE unsigned int m5Key(void) const;
+
+		typedef void (VdpPrivate::*RenderLineFn_m5)(void);
+		static const RenderLineFn_m5 renderLineFns_m5[M5KEY_MAX];
 
 		template<typename pixel>
-		FORCE_INLINE void T_Render_LineBuf(pixel *dest, pixel *md_palette);
+		FORCE_INLINE void T_Render_LineBuf(pixel *dest, pixel *md_palette, pixel border_color);
 
 		template<typename pixel>
 		FORCE_INLINE void T_Apply_SMS_LCB(pixel *dest, pixel border_color);
 
+		template<typename pixel>
+		FORCE_INLINE void T_Render_LineSpan(pixel *dest, const pixel *md_palette, int column);
+
+	/*!*************************************************************
+	 * VdpRendThread: Deferred rendering functions and variables. *
+	 ***************************************************************/
+	public:
+		/**
+		 * Render state for a single line.
+		 * Everything the Mode 5 renderer reads,
+		 * other than VRam, is included here.
+		 */
+		struct RendLine_t {
+			// Tile queue index following this line's VRam tiles.
+			unsigned int tileEnd;
+
+			// If true, render-only state is resynchronized.
+			bool resync;
+			bool sprDotOverflow;
+
+			// Framebuffer.
+			MdFb *fb;
+
+			// Vdp class variables.
+			VdpTypes::VdpLines_t VDP_Lines;
+			VdpTypes::VdpEmuOptions_t options;
+
+			// VDP registers and derived values.
+			VdpTypes::VdpReg_t VDP_Reg;
+			VdpTypes::VDP_Mode_t VDP_Mode;
+			uint16_t status;
+			unsigned int VDP_Layers;
+			unsigned int H_Cell;
+			int H_Pix;
+			int H_Pix_Begin;
+			uint8_t H_Win_Shift;
+			uint8_t V_Scroll_MMask;
+			uint8_t H_Scroll_Mask;
+			uint8_t H_Scroll_CMul;
+			uint8_t H_Scroll_CMask;
+			uint8_t V_Scroll_CMask;
+			unsigned int Win_X_Pos;
+			unsigned int Win_Y_Pos;
+			bool im2_flag;
+
+			uint32_t ScrA_Tbl_Addr;
+			uint32_t ScrB_Tbl_Addr;
+			uint32_t Win_Tbl_Addr;
+			uint32_t Spr_Tbl_Addr;
+			uint32_t H_Scroll_Tbl_Addr;
+			uint32_t ScrA_Gen_Addr;
+			uint32_t ScrB_Gen_Addr;
+			uint32_t Spr_Gen_Addr;
+
+			uint32_t VRam_Mask;
+			uint32_t ScrA_Tbl_Mask;
+			uint32_t ScrB_Tbl_Mask;
+			uint32_t Win_Tbl_Mask;
+			uint32_t Spr_Tbl_Mask;
+			uint32_t H_Scroll_Tbl_Mask;
+
+			// VSRam.
+			VdpTypes::VSRam_t VSRam;
+
+			// Palette.
+			Zomg_CRam_t cram;
+			VdpPalette::PalMode_t palMode;
+			uint8_t bgColorIdx;
+			uint8_t m5m4bits;
+			bool mdShadowHighlight;
+
+			// Sprite line cache.
+			uint8_t sprCountCache[2];
+			SprLineCache_t sprLineCache[2][80];
+		};
+
+		/**
+		 * Save the render state for the current line.
+		 * (emulation thread)
+		 * @param rl Line render state.
+		 */
+		void saveRendLine(RendLine_t *rl) const;
+
+		/**
+		 * Load the render state for a queued line.
+		 * (render thread; shadow VDP)
+		 * @param rl Line render state.
+		 */
+		void loadRendLine(const RendLine_t *rl);
+
+	/*!***********************************************************
+	 * Mid-line writes: Raster effects within a line. (Mode 5)  *
+	 *************************************************************/
+	public:
+		/**
+		 * Mid-line write type.
+		 */
+		enum LineWriteType_t {
+			LINEWRITE_REG,		// VDP register.
+			LINEWRITE_CRAM,		// CRam word.
+			LINEWRITE_VSRAM,	// VSRam word.
+		};
+
+		/**
+		 * Logged mid-line write.
+		 * Both values are saved so the write can be
+		 * undone and redone when the line is split.
+		 */
+		struct LineWrite_t {
+			uint16_t column;	// Pixel column. (H_Pix if after the active display)
+			uint8_t type;		// Write type. (See LineWriteType_t.)
+			uint8_t index;		// Register number, or CRam/VSRam word index.
+			uint16_t oldVal;	// Value before the write.
+			uint16_t newVal;	// Value after the write.
+		};
+
+		// Mid-line write log for the current line.
+		// lineLogCount is -1 if writes aren't being logged.
+		static const int LINE_LOG_MAX = 128;
+		LineWrite_t lineLog[LINE_LOG_MAX];
+		int lineLogCount;
+		int lineLogFbLine;		// MD_Screen line number.
+		bool lineLogSprDotOverflow;	// sprDotOverflow before the line was rendered.
+
+		// Line cycle where the active display ends. [H32, H40]
+		unsigned int activeEndCycle[2];
+
+		/**
+		 * Get the 68000 cycle within the current line.
+		 * @return Line cycle. (0-511)
+		 */
+		unsigned int lineCycle(void) const;
+
+		/**
+		 * Log a mid-line write.
+		 * @param type Write type. (See LineWriteType_t.)
+		 * @param index Register number, or CRam/VSRam word index.
+		 * @param oldVal Value before the write.
+		 * @param newVal Value after the write.
+		 */
+		void logLineWrite(LineWriteType_t type, uint8_t index, uint16_t oldVal, uint16_t newVal);
+
+		/**
+		 * Set a VDP register while mid-line writes are being logged.
+		 * @param reg_num Register number.
+		 * @param val New value for the register.
+		 */
+		void setRegMidLine(int reg_num, uint8_t val);
+
+		/**
+		 * Stop logging mid-line writes for the current line.
+		 * This is used if something was written that can't be
+		 * split, e.g. an H32/H40 change. The line will be
+		 * left as it was rendered at the start of the line.
+		 */
+		inline void abortLineLog(void)
+			{ lineLogCount = -1; }
+
+		/**
+		 * Apply or undo a mid-line write.
+		 * @param lw Mid-line write.
+		 * @param undo If true, restore the old value.
+		 */
+		void applyLineWrite(const LineWrite_t *lw, bool undo);
+
+		/**
+		 * Finish the current line. (Mode 5)
+		 * The line is rerendered in spans using the logged writes.
+		 */
+		void finishLine_m5(void);
+
 	/*!*****************************************
 	 * VdpRend_m4: Mode 4 rendering functions. *
 	 *******************************************/
@@ -28,48 +28,122 @@
 
 #include "macros/common.h"
 #include "Cartridge/RomCartridgeMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "EmuContext/EmuContext.hpp"
 
 // C includes. (C++ namespace)
+#include <cerrno>
 #include <cstring>
 
 namespace LibGens {
 
-m68ki_cpu_core M68K::ms_Context;
-int M68K::m_cycleCnt;
-int M68K::m_intVectors[8];
-
-// Last system ID.
-M68K::SysID M68K::ms_LastSysID = SYSID_NONE;
-
+#ifdef LIBGENS_M68000_NEW
+// M68K whose context is current on this thread.
+M68K_THREAD_LOCAL M68K *M68K::ms_active = nullptr;
+#endif
 
 // C wrapper functions for Starscream.
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// param == M68K_Mem*
 static unsigned int Gens_M68K_RB(void *param, unsigned int address)
 {
-	return LibGens::M68K_Mem::M68K_RB(address);
+	return ((LibGens::M68K_Mem*)param)->M68K_RB(address);
 }
 static unsigned int Gens_M68K_RW(void *param, unsigned int address)
 {
-	return LibGens::M68K_Mem::M68K_RW(address);
+	return ((LibGens::M68K_Mem*)param)->M68K_RW(address);
 }
 static void Gens_M68K_WB(void *param, unsigned int address, unsigned int data)
 {
-	LibGens::M68K_Mem::M68K_WB(address, data);
+	((LibGens::M68K_Mem*)param)->M68K_WB(address, data);
 }
 static void Gens_M68K_WW(void *param, unsigned int address, unsigned int data)
 {
-	LibGens::M68K_Mem::M68K_WW(address, data);
+	((LibGens::M68K_Mem*)param)->M68K_WW(address, data);
 }
 
-uint8_t VDP_Int_Ack(void);
-
 #ifdef __cplusplus
 }
 #endif
 
+/**
+ * Initialize an M68K CPU.
+ * @param context Emulation context that owns this CPU.
+ */
+M68K::M68K(EmuContext *context)
+	: m_context(context)
+	, m_cycleCnt(0)
+	, m_inExec(false)
+	, m_lastSysID(SYSID_NONE)
+{
+	memset(m_intVectors, 0, sizeof(m_intVectors));
+
+#ifdef LIBGENS_M68000_NEW
+	// Clear the 68000 context.
+	const unsigned int ctxSize = m68k_context_size();
+	m_ctx = new uint8_t[ctxSize];
+	memset(m_ctx, 0, ctxSize);
+	m_irqLines = 0;
+
+	// Callbacks are part of the context.
+	activate();
+	m68k_init();
+	m68k_set_cpu_type(M68K_CPU_TYPE_68000);
+	m68k_set_int_ack_callback(M68K_Int_Ack);
+#else
+	// Clear the 68000 context.
+	memset(&m_cpu, 0, sizeof(m_cpu));
+
+	m68k_init(&m_cpu);
+
+	// Callbacks receive the m68ki_cpu_core.
+	// The user parameter points back to this object.
+	m_cpu.param = this;
+	m_cpu.reset_instr_callback = M68K_Reset_Handler;
+	m_cpu.int_ack_callback = M68K_Int_Ack;
+
+	// Decoded block cache.
+	// EXPERIMENTAL: It doesn't have a measured benefit yet,
+	// so it's disabled by default.
+	m_bcache = new m68k_bcache();
+	setBlockCache(false);
+
+	// Idle loop skipping.
+	setIdleSkip(true);
+#endif
+}
+
+M68K::~M68K()
+{
+#ifdef LIBGENS_M68000_NEW
+	if (ms_active == this) {
+		ms_active = nullptr;
+		m68k_set_context_ptr(nullptr);
+	}
+	delete[] m_ctx;
+#else
+	m68k_jit_free(m_bcache);
+	delete m_bcache;
+#endif
+}
+
+#ifdef LIBGENS_M68000_NEW
+int M68K::M68K_Int_Ack(int int_level)
+{
+	M68K *const m68k = ms_active;
+	if ( (int_level == 4) || (int_level == 6) )
+		m68k->m_context->m_vdp->Int_Ack();
+
+	// An interrupt is being processed, so don't check for
+	// another one until the handler's SR has been set.
+	m68k->m_irqLines &= ~(1 << int_level);
+	m68k_set_irq_delayed(m68k->irqLevel());
+	return m68k->m_intVectors[int_level];
+}
+#else
 /**
  * Reset handler.
  * TODO: What does this function do?
@@ -81,12 +155,36 @@ void M68K::M68K_Reset_Handler(m68ki_cpu_core *cpu)
 
 int M68K::M68K_Int_Ack(m68ki_cpu_core *cpu, int int_level)
 {
+	M68K *const m68k = (M68K*)cpu->param;
 	if ( (int_level == 4) || (int_level == 6) )
-		VDP_Int_Ack();
+		m68k->m_context->m_vdp->Int_Ack();
 
 	m68k_set_irq(cpu, int_level, RESET_LINE);
-	return m_intVectors[int_level];
+	return m68k->m_intVectors[int_level];
+}
+
+/**
+ * Check if an idle loop can read an address.
+ * @param cpu 68000 context.
+ * @param address Address.
+ * @return Non-zero if the address can be read; 0 if not.
+ */
+int M68K::M68K_Idle_Read(m68ki_cpu_core *cpu, unsigned int address)
+{
+	M68K *const m68k = (M68K*)cpu->param;
+	return m68k->m_context->m_m68kMem->isIdleRead(address);
 }
+#endif
+
+/**
+ * Fetch buffer for unmapped memory.
+ * Instructions are fetched directly from memory_map[].base,
+ * so unmapped banks point here instead of to NULL. Otherwise,
+ * a program that jumps into unmapped memory would crash the
+ * emulator instead of executing garbage.
+ * NOTE: Shared by all M68K instances; never written to.
+ */
+static uint8_t unmapped_fetch[0x10000];
 
 static unsigned int dummy_read(void *param, unsigned int address)
 {
@@ -103,8 +201,9 @@ static void dummy_write(void *param, unsigned int address, unsigned int data)
 }
 
 
-void M68K::SetFetch(unsigned low_addr, unsigned high_addr, void *base)
+void M68K::setFetch(unsigned low_addr, unsigned high_addr, void *base)
 {
+	cpu_memory_map *const memory_map = memoryMap();
 	unsigned i;
 
 	base -= (low_addr & 0xFFFF);
@@ -112,48 +211,64 @@ void M68K::SetFetch(unsigned low_addr, unsigned high_addr, void *base)
 	{
 		if ( i >= 256 )
 			return;
-		ms_Context.memory_map[i].base = (unsigned char *)base;
+		memory_map[i].base = (unsigned char *)base;
 		base += 0x10000;
 	}
+
+#ifndef LIBGENS_M68000_NEW
+	// Cached blocks may refer to the old mapping.
+	m68k_bcache_flush(&m_cpu);
+#endif
 }
 
-void M68K::SetMemReadFunc(unsigned low_addr, unsigned high_addr,
+void M68K::setMemReadFunc(unsigned low_addr, unsigned high_addr,
 	unsigned int (*read8)(void *param, unsigned int address),
 	unsigned int (*read16)(void *param, unsigned int address))
 {
+	M68K_Mem *const mem = m_context->m_m68kMem;
+	cpu_memory_map *const memory_map = memoryMap();
 	int i;
 	for ( i = (low_addr >> 16); i <= (high_addr >> 16); i ++ )
 	{
-		ms_Context.memory_map[i].read8 = read8;
-		ms_Context.memory_map[i].read16 = read16;
+		memory_map[i].param = mem;
+		memory_map[i].read8 = read8;
+		memory_map[i].read16 = read16;
 	}
 }
 
-void M68K::SetMemWriteFunc(unsigned low_addr, unsigned high_addr,
+void M68K::setMemWriteFunc(unsigned low_addr, unsigned high_addr,
 	void (*write8)(void *param, unsigned int address, unsigned int data),
 	void (*write16)(void *param, unsigned int address, unsigned int data))
 {
+	M68K_Mem *const mem = m_context->m_m68kMem;
+	cpu_memory_map *const memory_map = memoryMap();
 	int i;
 	for ( i = (low_addr >> 16); i <= (high_addr >> 16); i ++ )
 	{
-		ms_Context.memory_map[i].write8 = write8;
-		ms_Context.memory_map[i].write16 = write16;
+		memory_map[i].param = mem;
+		memory_map[i].write8 = write8;
+		memory_map[i].write16 = write16;
 	}
 }
 
 /**
  * Initialize the M68K CPU emulator.
+ * This builds the opcode handler table, which is
+ * shared by all M68K instances.
  */
 void M68K::Init(void)
 {
-	// Clear the 68000 context.
-	memset( &ms_Context, 0, sizeof(ms_Context) );
-	
-	m68k_init(&ms_Context);
-	
-	ms_Context.reset_instr_callback = M68K_Reset_Handler;
-	
-	ms_Context.int_ack_callback = M68K_Int_Ack;
+	// m68k_init() builds the opcode table on first use.
+	// Do it here so it isn't done (unsynchronized) while
+	// creating emulation contexts on multiple threads.
+#ifdef LIBGENS_M68000_NEW
+	// NOTE: This initializes the default context.
+	m68k_init();
+#else
+	m68ki_cpu_core tmp;
+	memset(&tmp, 0, sizeof(tmp));
+	m68k_init(&tmp);
+#endif
 }
 
 /**
@@ -168,68 +283,73 @@ void M68K::End(void)
  * Initialize a specific system for the M68K CPU emulator.
  * @param system System ID.
  */
-void M68K::InitSys(SysID system)
+void M68K::initSys(SysID system)
 {
 	m_cycleCnt = 0;
 	
 	// TODO: This is not 64-bit clean!
-	ms_LastSysID = system;
+	m_lastSysID = system;
 
 	// Clear M68K RAM.
-	memset(Ram_68k.u8, 0x00, sizeof(Ram_68k.u8));
+	M68K_Mem *const mem = m_context->m_m68kMem;
+	memset(mem->Ram_68k.u8, 0x00, sizeof(mem->Ram_68k.u8));
 	
 	// Initialize the memory handlers.
-	SetMemReadFunc(0x000000, 0xFEFFFF, Gens_M68K_RB, Gens_M68K_RW);
-	SetMemWriteFunc(0x000000, 0xFEFFFF, Gens_M68K_WB, Gens_M68K_WW);
-	SetFetch(0xFF0000, 0xFFFFFF, Ram_68k.u8);
+	// Banks that aren't fetchable use the unmapped fetch buffer.
+	cpu_memory_map *const memory_map = memoryMap();
+	for (int i = 0; i < 256; i++) {
+		memory_map[i].base = unmapped_fetch;
+	}
+	setMemReadFunc(0x000000, 0xFEFFFF, Gens_M68K_RB, Gens_M68K_RW);
+	setMemWriteFunc(0x000000, 0xFEFFFF, Gens_M68K_WB, Gens_M68K_WW);
+	setFetch(0xFF0000, 0xFFFFFF, mem->Ram_68k.u8);
 
 	// Initialize the M68K memory handlers.
-	M68K_Mem::InitSys(system);
+	mem->initSys(system);
 
 	// Initialize M68K RAM handlers.
 	for (int i = 0; i < 32; i++) {
 		uint32_t ram_addr = (0xE00000 | (i << 16));
-		SetFetch(ram_addr, ram_addr | 0xFFFF, Ram_68k.u8);
+		setFetch(ram_addr, ram_addr | 0xFFFF, mem->Ram_68k.u8);
 	}
 
 	// Update the system-specific banking setup.
-	UpdateSysBanking();
+	updateSysBanking();
 
 	// Reset the M68K CPU.
-	Reset();
+	reset();
 }
 
 /**
  * Shut down M68K emulation.
  */
-void M68K::EndSys(void)
+void M68K::endSys(void)
 {
 	/*for (int i = 0; i < 256; i++) {
-		ms_Context.memory_map[i].base = NULL;
-		ms_Context.memory_map[i].read8 = dummy_read;
-		ms_Context.memory_map[i].read16 = dummy_read;
-		ms_Context.memory_map[i].write8 = dummy_write;
-		ms_Context.memory_map[i].write16 = dummy_write;
+		m_cpu.memory_map[i].base = NULL;
+		m_cpu.memory_map[i].read8 = dummy_read;
+		m_cpu.memory_map[i].read16 = dummy_read;
+		m_cpu.memory_map[i].write8 = dummy_write;
+		m_cpu.memory_map[i].write16 = dummy_write;
 	}*/
-	memset( ms_Context.memory_map, 0, sizeof(ms_Context.memory_map) );
+	memset(memoryMap(), 0, 256 * sizeof(cpu_memory_map));
 }
 
 /**
  * Update system-specific memory banking.
- * Uses the last system initialized via InitSys().
+ * Uses the last system initialized via initSys().
  */
-void M68K::UpdateSysBanking(void)
+void M68K::updateSysBanking(void)
 {
 	// Start at M68K_Fetch[0x20].
 	int cur_fetch = 0x20;
-	switch (ms_LastSysID) {
+	switch (m_lastSysID) {
 		case SYSID_MD:
 		case SYSID_PICO:
 			// Sega Genesis / Mega Drive.
 			// Also Pico. (This only adds cartridge ROM.)
-			cur_fetch += M68K_Mem::UpdateSysBanking(10);
+			cur_fetch += m_context->m_m68kMem->updateSysBanking(10);
 			break;
-
 		case SYSID_MCD:
 			// Sega CD.
 			// TODO
@@ -275,27 +395,36 @@ void M68K::UpdateSysBanking(void)
 /** ZOMG savestate functions. **/
 
 /**
- * ZomgSaveReg(): Save the M68K registers.
+ * Save the M68K registers.
  * @param state Zomg_M68KRegSave_t struct to save to.
  */
-void M68K::ZomgSaveReg(Zomg_M68KRegSave_t *state)
+void M68K::zomgSaveReg(Zomg_M68KRegSave_t *state)
 {
 	// NOTE: Byteswapping is done in libzomg.
 	int i;
+#ifdef LIBGENS_M68000_NEW
+	void *const cpu = m_ctx;
+#else
+	m68ki_cpu_core *const cpu = &m_cpu;
+#endif
 	
 	// Save the main registers.
 	for (i = 0; i < 8; i++)
-		state->dreg[i] = m68k_get_reg(&ms_Context, (m68k_register_t)(M68K_REG_D0 + i));
+		state->dreg[i] = m68k_get_reg(cpu, (m68k_register_t)(M68K_REG_D0 + i));
 	for (i = 0; i < 7; i++)
-		state->areg[i] = m68k_get_reg(&ms_Context, (m68k_register_t)(M68K_REG_A0 + i));
+		state->areg[i] = m68k_get_reg(cpu, (m68k_register_t)(M68K_REG_A0 + i));
 	
 	// Save the stack pointers.
-	state->ssp = ms_Context.s_flag ? ms_Context.dar[15] : ms_Context.sp[0];
-	state->usp = m68k_get_reg(&ms_Context, M68K_REG_USP);
+#ifdef LIBGENS_M68000_NEW
+	state->ssp = m68k_get_reg(cpu, M68K_REG_ISP);
+#else
+	state->ssp = m_cpu.s_flag ? m_cpu.dar[15] : m_cpu.sp[0];
+#endif
+	state->usp = m68k_get_reg(cpu, M68K_REG_USP);
 
 	// Other registers.
-	state->pc = m68k_get_reg(&ms_Context, M68K_REG_PC);
-	state->sr = m68k_get_reg(&ms_Context, M68K_REG_SR);
+	state->pc = m68k_get_reg(cpu, M68K_REG_PC);
+	state->sr = m68k_get_reg(cpu, M68K_REG_SR);
 
 	// Reserved fields.
 	state->reserved1 = 0;
@@ -307,26 +436,263 @@ void M68K::ZomgSaveReg(Zomg_M68KRegSave_t *state)
  * Restore the M68K registers.
  * @param state Zomg_M68KRegSave_t struct to restore from.
  */
-void M68K::ZomgRestoreReg(const Zomg_M68KRegSave_t *state)
+void M68K::zomgRestoreReg(const Zomg_M68KRegSave_t *state)
 {
 	int i;
-	
+
+#ifdef LIBGENS_M68000_NEW
+	// m68k_set_reg() sets the current context's registers.
+	activate();
+
+	for (i = 0; i < 8; i++)
+		m68k_set_reg((m68k_register_t)(M68K_REG_D0 + i), state->dreg[i]);
+	for (i = 0; i < 7; i++)
+		m68k_set_reg((m68k_register_t)(M68K_REG_A0 + i), state->areg[i]);
+
+	m68k_set_reg(M68K_REG_PC, state->pc);
+	m68k_set_reg(M68K_REG_SR, state->sr);
+
+	m68k_set_reg(M68K_REG_USP, state->usp);
+	m68k_set_reg(M68K_REG_ISP, state->ssp);
+#else
 	// Load the main registers.
 	for (i = 0; i < 8; i++)
-		m68k_set_reg(&ms_Context, (m68k_register_t)(M68K_REG_D0 + i), state->dreg[i]);
+		m68k_set_reg(&m_cpu, (m68k_register_t)(M68K_REG_D0 + i), state->dreg[i]);
 	for (i = 0; i < 7; i++)
-		m68k_set_reg(&ms_Context, (m68k_register_t)(M68K_REG_A0 + i), state->areg[i]);
+		m68k_set_reg(&m_cpu, (m68k_register_t)(M68K_REG_A0 + i), state->areg[i]);
 
 	// Other registers.
-	m68k_set_reg(&ms_Context, M68K_REG_PC, state->pc);
-	m68k_set_reg(&ms_Context, M68K_REG_SR, state->sr);
+	m68k_set_reg(&m_cpu, M68K_REG_PC, state->pc);
+	m68k_set_reg(&m_cpu, M68K_REG_SR, state->sr);
 
 	// Load the stack pointers.
-	m68k_set_reg(&ms_Context, M68K_REG_USP, state->usp);
-	if ( ms_Context.s_flag )
-		ms_Context.dar[15] = state->ssp;
+	m68k_set_reg(&m_cpu, M68K_REG_USP, state->usp);
+	if ( m_cpu.s_flag )
+		m_cpu.dar[15] = state->ssp;
 	else
-		ms_Context.sp[0] = state->ssp;
+		m_cpu.sp[0] = state->ssp;
+
+	// M68K memory has been reloaded.
+	m68k_bcache_flush(&m_cpu);
+#endif
+}
+
+
+/** Debugging functions. **/
+
+/**
+ * Is the program counter in unmapped memory?
+ * If it is, the program has most likely crashed.
+ * @return True if the PC is in unmapped memory; false if not.
+ */
+bool M68K::isPcUnmapped(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	const unsigned int pc = m68k_get_reg(m_ctx, M68K_REG_PC);
+#else
+	const unsigned int pc = m_cpu.pc;
+#endif
+	return (memoryMap()[(pc >> 16) & 0xFF].base == unmapped_fetch);
+}
+
+/** Decoded block cache. **/
+
+/**
+ * Enable or disable the decoded block cache.
+ * EXPERIMENTAL: The block cache is disabled by default.
+ * @param enable True to enable; false to disable.
+ */
+void M68K::setBlockCache(bool enable)
+{
+#ifdef LIBGENS_M68000_NEW
+	// Not supported by the Musashi 3.4 core.
+	((void)enable);
+#else
+	if (!enable) {
+		// The recompiler requires the block cache.
+		m68k_set_jit(&m_cpu, 0);
+	}
+	m68k_set_bcache(&m_cpu, (enable ? m_bcache : nullptr),
+			m_context->m_m68kMem->Ram_68k.u8);
+#endif
+}
+
+/**
+ * Is the decoded block cache supported by the 68000 core?
+ * @return True if supported; false if not.
+ */
+bool M68K::isBlockCacheAvailable(void)
+{
+#ifdef LIBGENS_M68000_NEW
+	return false;
+#else
+	return true;
+#endif
+}
+
+/**
+ * Is the dynamic recompiler supported on this host?
+ * @return True if supported; false if not.
+ */
+bool M68K::isJitAvailable(void)
+{
+#ifdef LIBGENS_M68000_NEW
+	return false;
+#else
+	return !!m68k_jit_available();
+#endif
+}
+
+/**
+ * Enable or disable the dynamic recompiler.
+ * The recompiler is disabled by default.
+ * Enabling it also enables the decoded block cache.
+ * @param enable True to enable; false to disable.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int M68K::setJit(bool enable)
+{
+#ifdef LIBGENS_M68000_NEW
+	// Not supported by the Musashi 3.4 core.
+	return (enable ? -ENOSYS : 0);
+#else
+	if (enable && !m_cpu.bcache) {
+		setBlockCache(true);
+	}
+	return m68k_set_jit(&m_cpu, enable);
+#endif
+}
+
+/**
+ * Enable or disable lockstep checking for the dynamic recompiler.
+ * @param enable True to enable; false to disable.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int M68K::setJitLockstep(bool enable)
+{
+#ifdef LIBGENS_M68000_NEW
+	// Not supported by the Musashi 3.4 core.
+	return (enable ? -ENOSYS : 0);
+#else
+	return m68k_set_jit_lockstep(m_bcache, enable);
+#endif
+}
+
+/**
+ * Get the results of lockstep checking.
+ * @param checked Number of translated blocks that were checked.
+ * @param mismatches Number of blocks that didn't match the interpreter.
+ */
+void M68K::jitLockstepStats(unsigned int *checked, unsigned int *mismatches) const
+{
+#ifdef LIBGENS_M68000_NEW
+	*checked = 0;
+	*mismatches = 0;
+#else
+	m68k_jit_lockstep_stats(m_bcache, checked, mismatches);
+#endif
+}
+
+/** Opcode dispatch. **/
+
+/**
+ * Enable or disable the compact opcode table.
+ * @param enable True to enable; false to disable.
+ */
+void M68K::setCompactDispatch(bool enable)
+{
+#ifdef LIBGENS_M68000_NEW
+	// Not supported by the Musashi 3.4 core.
+	((void)enable);
+#else
+	m68k_set_compact_dispatch(&m_cpu, enable);
+#endif
+}
+
+/** Idle loop skipping. **/
+
+/**
+ * Is idle loop skipping supported by the 68000 core?
+ * @return True if supported; false if not.
+ */
+bool M68K::isIdleSkipAvailable(void)
+{
+#ifdef LIBGENS_M68000_NEW
+	return false;
+#else
+	return true;
+#endif
+}
+
+/**
+ * Enable or disable idle loop skipping.
+ * @param enable True to enable; false to disable.
+ */
+void M68K::setIdleSkip(bool enable)
+{
+#ifdef LIBGENS_M68000_NEW
+	// Not supported by the Musashi 3.4 core.
+	((void)enable);
+#else
+	m68k_set_idle_skip(&m_cpu, (enable ? M68K_Idle_Read : nullptr));
+#endif
+}
+
+/**
+ * Get the name of the 68000 core libgens was built with.
+ * @return 68000 core name.
+ */
+const char *M68K::coreName(void)
+{
+#ifdef LIBGENS_M68000_NEW
+	return "Musashi 3.4";
+#else
+	return "Musashi 4.55";
+#endif
+}
+
+/** In-memory state functions. **/
+
+/**
+ * Save the complete CPU state.
+ * @param state CoreState struct to save to.
+ */
+void M68K::saveCoreState(CoreState *state) const
+{
+#ifdef LIBGENS_M68000_NEW
+	state->cpu.assign(m_ctx, m_ctx + m68k_context_size());
+	state->irqLines = m_irqLines;
+#else
+	state->cpu = m_cpu;
+#endif
+	state->cycleCnt = m_cycleCnt;
+	memcpy(state->intVectors, m_intVectors, sizeof(state->intVectors));
+}
+
+/**
+ * Restore the complete CPU state.
+ * NOTE: The memory map is restored as well, so this must
+ * be called after any savestate that changes banking
+ * has been loaded.
+ * @param state CoreState struct to restore from.
+ */
+void M68K::restoreCoreState(const CoreState *state)
+{
+#ifdef LIBGENS_M68000_NEW
+	if (state->cpu.size() == m68k_context_size()) {
+		memcpy(m_ctx, state->cpu.data(), state->cpu.size());
+	}
+	m_irqLines = state->irqLines;
+#else
+	m_cpu = state->cpu;
+#endif
+	m_cycleCnt = state->cycleCnt;
+	memcpy(m_intVectors, state->intVectors, sizeof(m_intVectors));
+
+#ifndef LIBGENS_M68000_NEW
+	// M68K memory may have been reloaded.
+	m68k_bcache_flush(&m_cpu);
+#endif
 }
 
 }
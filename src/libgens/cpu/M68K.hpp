@@ -26,7 +26,13 @@
 
 #include <libgens/config.libgens.h>
 
+#ifdef LIBGENS_M68000_NEW
+#include "../m68000_new/m68k.h"
+// C++ includes.
+#include <vector>
+#else
 #include "../m68000/m68k.h"
+#endif
 
 // ZOMG M68K structs.
 #include "libzomg/zomg_m68k.h"
@@ -38,12 +44,24 @@
 namespace LibGens
 {
 
+class EmuContext;
+
 class M68K
 {
+	public:
+		M68K(EmuContext *context);
+		~M68K();
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		M68K(const M68K &);
+		M68K &operator=(const M68K &);
+
 	public:
 		static void Init(void);
 		static void End(void);
-		
+
 		/**
 		 * @name System IDs
 		 * TODO: Use MDP system IDs?
@@ -60,54 +78,309 @@ class M68K
 
 			SYSID_MAX
 		};
-		
-		static void InitSys(SysID system);
-		static void EndSys(void);
-		static void UpdateSysBanking(void);
-		
+
+		void initSys(SysID system);
+		void endSys(void);
+		void updateSysBanking(void);
+
 		/** ZOMG savestate functions. **/
-		static void ZomgSaveReg(Zomg_M68KRegSave_t *state);
-		static void ZomgRestoreReg(const Zomg_M68KRegSave_t *state);
-		
+		void zomgSaveReg(Zomg_M68KRegSave_t *state);
+		void zomgRestoreReg(const Zomg_M68KRegSave_t *state);
+
+		/** In-memory state functions. **/
+
+		/**
+		 * Complete CPU state.
+		 * Unlike Zomg_M68KRegSave_t, this includes the
+		 * interrupt lines and the STOP state.
+		 * Only valid for the M68K that saved it.
+		 */
+		struct CoreState {
+#ifdef LIBGENS_M68000_NEW
+			std::vector<uint8_t> cpu;	// m68k_get_context()
+			int irqLines;
+#else
+			m68ki_cpu_core cpu;
+#endif
+			int cycleCnt;
+			int intVectors[8];
+		};
+
+		void saveCoreState(CoreState *state) const;
+		void restoreCoreState(const CoreState *state);
+
+		/** Debugging functions. **/
+
+		/**
+		 * Get the number of illegal instruction exceptions taken.
+		 * This includes A-line and F-line instructions.
+		 * @return Number of illegal instruction exceptions.
+		 */
+		inline unsigned int illegalCount(void) const;
+
+		/**
+		 * Is the program counter in unmapped memory?
+		 * If it is, the program has most likely crashed.
+		 * @return True if the PC is in unmapped memory; false if not.
+		 */
+		bool isPcUnmapped(void) const;
+
+		/** Decoded block cache. **/
+
+		/**
+		 * Is the decoded block cache supported by the 68000 core?
+		 * @return True if supported; false if not.
+		 */
+		static bool isBlockCacheAvailable(void);
+
+		/**
+		 * Enable or disable the decoded block cache.
+		 * EXPERIMENTAL: The block cache is disabled by default,
+		 * since it isn't faster than the interpreter yet.
+		 * @param enable True to enable; false to disable.
+		 */
+		void setBlockCache(bool enable);
+
+		/**
+		 * Is the decoded block cache enabled?
+		 * @return True if enabled; false if not.
+		 */
+		inline bool isBlockCacheEnabled(void) const;
+
+		/**
+		 * Is the dynamic recompiler supported on this host?
+		 * @return True if supported; false if not.
+		 */
+		static bool isJitAvailable(void);
+
+		/**
+		 * Enable or disable the dynamic recompiler.
+		 * The recompiler is disabled by default.
+		 * Enabling it also enables the decoded block cache.
+		 * @param enable True to enable; false to disable.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int setJit(bool enable);
+
+		/**
+		 * Is the dynamic recompiler enabled?
+		 * @return True if enabled; false if not.
+		 */
+		inline bool isJitEnabled(void) const;
+
+		/**
+		 * Enable or disable lockstep checking for the dynamic recompiler.
+		 * Each translated block is run again by the interpreter,
+		 * and the results are compared. This is much slower,
+		 * so it's only meant for debugging the recompiler.
+		 * @param enable True to enable; false to disable.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int setJitLockstep(bool enable);
+
+		/**
+		 * Get the results of lockstep checking.
+		 * @param checked Number of translated blocks that were checked.
+		 * @param mismatches Number of blocks that didn't match the interpreter.
+		 */
+		void jitLockstepStats(unsigned int *checked, unsigned int *mismatches) const;
+
+		/** Opcode dispatch. **/
+
+		/**
+		 * Enable or disable the compact opcode table.
+		 * Opcodes are dispatched through 16-bit handler indexes instead
+		 * of the full handler and cycle tables, which use much more cache.
+		 * The emulation is the same either way.
+		 * This only affects instructions that aren't in the block cache.
+		 * @param enable True to enable; false to disable.
+		 */
+		void setCompactDispatch(bool enable);
+
+		/**
+		 * Is the compact opcode table enabled?
+		 * @return True if enabled; false if not.
+		 */
+		inline bool isCompactDispatchEnabled(void) const;
+
+		/** Idle loop skipping. **/
+
+		/**
+		 * Is idle loop skipping supported by the 68000 core?
+		 * @return True if supported; false if not.
+		 */
+		static bool isIdleSkipAvailable(void);
+
+		/**
+		 * Enable or disable idle loop skipping.
+		 * Short loops that only poll RAM or the VDP status register
+		 * run the same way until the end of the timeslice, so once
+		 * one is detected, its remaining iterations are skipped.
+		 * The emulation is the same either way.
+		 * Idle loop skipping is enabled by default.
+		 * @param enable True to enable; false to disable.
+		 */
+		void setIdleSkip(bool enable);
+
+		/**
+		 * Is idle loop skipping enabled?
+		 * @return True if enabled; false if not.
+		 */
+		inline bool isIdleSkipEnabled(void) const;
+
+		/**
+		 * Get the number of cycles skipped in idle loops.
+		 * @return Number of cycles skipped since the CPU was created.
+		 */
+		inline unsigned int idleCyclesSkipped(void) const;
+
+		/**
+		 * Report a write to M68K RAM that didn't go through the CPU core.
+		 * Cached blocks containing the written address are invalidated.
+		 * @param address Address.
+		 */
+		inline void ramWritten(uint32_t address);
+
+		/**
+		 * Get the name of the 68000 core libgens was built with.
+		 * @return 68000 core name.
+		 */
+		static const char *coreName(void);
+
 		/** BEGIN: Starscream wrapper functions. **/
-		static inline void Reset(void);
-		static inline int Interrupt(int level, int vector);
-		static inline unsigned int ReadOdometer(void);
-		static inline void ReleaseCycles(int cycles);
-		static inline void AddCycles(int cycles);
-		static inline unsigned int Exec(int n);
-		static inline unsigned int TripOdometer(void);
-		static void SetFetch(unsigned low_addr, unsigned high_addr, void *base);
-		static void SetMemReadFunc(unsigned low_addr, unsigned high_addr,
+		inline void reset(void);
+		inline int interrupt(int level, int vector);
+		inline unsigned int readOdometer(void) const;
+		inline unsigned int readOdometerExact(void) const;
+		inline void releaseCycles(int cycles);
+		inline void addCycles(int cycles);
+		inline void stall(int cycles);
+		inline unsigned int exec(int n);
+		inline unsigned int tripOdometer(void);
+		void setFetch(unsigned low_addr, unsigned high_addr, void *base);
+		void setMemReadFunc(unsigned low_addr, unsigned high_addr,
 			unsigned int (*read8)(void *param, unsigned int address),
 			unsigned int (*read16)(void *param, unsigned int address));
-		static void SetMemWriteFunc(unsigned low_addr, unsigned high_addr,
+		void setMemWriteFunc(unsigned low_addr, unsigned high_addr,
 			void (*write8)(void *param, unsigned int address, unsigned int data),
 			void (*write16)(void *param, unsigned int address, unsigned int data));
 		/** END: Starscream wrapper functions. **/
-	
+
 	protected:
-		static m68ki_cpu_core ms_Context;
-		static int m_cycleCnt;		// Cycles currently run.
-		static int m_intVectors[8];
-		
+		// Emulation context that owns this CPU.
+		EmuContext *const m_context;
+
+#ifdef LIBGENS_M68000_NEW
+		// Musashi 3.4 always runs the current (thread-local)
+		// CPU context. activate() makes this M68K's context
+		// current before it's used.
+		uint8_t *m_ctx;
+		int m_irqLines;		// Asserted interrupt lines. (bitfield)
+
+		// M68K whose context is current on this thread.
+		// Used by callbacks, which don't have a user parameter.
+		static M68K_THREAD_LOCAL M68K *ms_active;
+
+		/**
+		 * Make this M68K's context the current CPU context.
+		 */
+		inline void activate(void);
+
+		/**
+		 * Get the IPL level for the asserted interrupt lines.
+		 * @return IPL level.
+		 */
+		inline unsigned int irqLevel(void) const;
+
+		static int M68K_Int_Ack(int int_level);
+#else
+		m68ki_cpu_core m_cpu;
+#endif
+		int m_cycleCnt;		// Cycles currently run.
+		bool m_inExec;		// True while exec() is running.
+		int m_intVectors[8];
+
+		/**
+		 * Get the CPU's memory map.
+		 * @return Memory map. (256 banks of 64 KB)
+		 */
+		inline cpu_memory_map *memoryMap(void);
+		inline const cpu_memory_map *memoryMap(void) const;
+
+#ifndef LIBGENS_M68000_NEW
+		// Decoded block cache.
+		m68k_bcache *m_bcache;
+
 		// TODO: What does the Reset Handler function do?
 		static void M68K_Reset_Handler(m68ki_cpu_core *cpu);
 		static int M68K_Int_Ack(m68ki_cpu_core *cpu, int int_level);
-	
-	private:
-		M68K() { }
-		~M68K() { }
 
-		static SysID ms_LastSysID;
+		// Check if an idle loop can read an address.
+		static int M68K_Idle_Read(m68ki_cpu_core *cpu, unsigned int address);
+#endif
+
+	private:
+		SysID m_lastSysID;
 };
 
+#ifdef LIBGENS_M68000_NEW
+/**
+ * Make this M68K's context the current CPU context.
+ */
+inline void M68K::activate(void)
+{
+	ms_active = this;
+	m68k_set_context_ptr(m_ctx);
+}
+
+/**
+ * Get the IPL level for the asserted interrupt lines.
+ * @return IPL level.
+ */
+inline unsigned int M68K::irqLevel(void) const
+{
+	unsigned int level;
+	for (level = 7; level > 0; level--) {
+		if (m_irqLines & (1 << level))
+			break;
+	}
+	return level;
+}
+#endif
+
+/**
+ * Get the CPU's memory map.
+ * @return Memory map. (256 banks of 64 KB)
+ */
+inline cpu_memory_map *M68K::memoryMap(void)
+{
+#ifdef LIBGENS_M68000_NEW
+	return m68k_get_memory_map(m_ctx);
+#else
+	return m_cpu.memory_map;
+#endif
+}
+
+inline const cpu_memory_map *M68K::memoryMap(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	return m68k_get_memory_map(m_ctx);
+#else
+	return m_cpu.memory_map;
+#endif
+}
+
 /**
  * Reset the emulated CPU.
  */
-inline void M68K::Reset(void)
+inline void M68K::reset(void)
 {
-	m68k_pulse_reset(&ms_Context);
+#ifdef LIBGENS_M68000_NEW
+	activate();
+	m68k_pulse_reset();
+#else
+	m68k_pulse_reset(&m_cpu);
+#endif
 }
 
 /**
@@ -116,27 +389,143 @@ inline void M68K::Reset(void)
  * @param vector Interrupt vector. (???)
  * @return ???
  */
-inline int M68K::Interrupt(int level, int vector)
+inline int M68K::interrupt(int level, int vector)
 {
 	m_intVectors[level] = vector;
-	m68k_set_irq(&ms_Context, level, ASSERT_LINE);
+#ifdef LIBGENS_M68000_NEW
+	m_irqLines |= (1 << level);
+	activate();
+	m68k_set_irq_delayed(irqLevel());
+#else
+	m68k_set_irq(&m_cpu, level, ASSERT_LINE);
+#endif
 	return 0;
 }
 
+/**
+ * Get the number of illegal instruction exceptions taken.
+ * This includes A-line and F-line instructions.
+ * @return Number of illegal instruction exceptions.
+ */
+inline unsigned int M68K::illegalCount(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	return m68k_get_illegal_count(m_ctx);
+#else
+	return m_cpu.illegal_cnt;
+#endif
+}
+
+/**
+ * Is the decoded block cache enabled?
+ * @return True if enabled; false if not.
+ */
+inline bool M68K::isBlockCacheEnabled(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	return false;
+#else
+	return (m_cpu.bcache != nullptr);
+#endif
+}
+
+/**
+ * Is the dynamic recompiler enabled?
+ * @return True if enabled; false if not.
+ */
+inline bool M68K::isJitEnabled(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	return false;
+#else
+	return (m_cpu.bcache != nullptr && m_cpu.bcache->jit);
+#endif
+}
+
+/**
+ * Is the compact opcode table enabled?
+ * @return True if enabled; false if not.
+ */
+inline bool M68K::isCompactDispatchEnabled(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	return false;
+#else
+	return !!m_cpu.compact_dispatch;
+#endif
+}
+
+/**
+ * Is idle loop skipping enabled?
+ * @return True if enabled; false if not.
+ */
+inline bool M68K::isIdleSkipEnabled(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	return false;
+#else
+	return (m_cpu.poll.read_ok != nullptr);
+#endif
+}
+
+/**
+ * Get the number of cycles skipped in idle loops.
+ * @return Number of cycles skipped since the CPU was created.
+ */
+inline unsigned int M68K::idleCyclesSkipped(void) const
+{
+#ifdef LIBGENS_M68000_NEW
+	return 0;
+#else
+	return m_cpu.poll.skipped;
+#endif
+}
+
+/**
+ * Report a write to M68K RAM that didn't go through the CPU core.
+ * Cached blocks containing the written address are invalidated.
+ * @param address Address.
+ */
+inline void M68K::ramWritten(uint32_t address)
+{
+#ifdef LIBGENS_M68000_NEW
+	((void)address);
+#else
+	m68k_bcache_write(&m_cpu, address);
+#endif
+}
+
 /**
  * Read the M68K odometer.
  * @return M68K odometer.
  */
-inline unsigned int M68K::ReadOdometer(void)
+inline unsigned int M68K::readOdometer(void) const
 {
 	return m_cycleCnt;
 }
 
+/**
+ * Read the M68K odometer, including the cycles
+ * run so far in the current timeslice.
+ * readOdometer() is only updated when exec() returns.
+ * @return M68K odometer.
+ */
+inline unsigned int M68K::readOdometerExact(void) const
+{
+	if (!m_inExec)
+		return m_cycleCnt;
+#ifdef LIBGENS_M68000_NEW
+	return m_cycleCnt + m68k_cycles_run();
+#else
+	return m_cycleCnt + (m_cpu.initial_cycles - m_cpu.remaining_cycles);
+#endif
+}
+
 /**
 * Release cycles.
 * @param cycles Cycles to release.
 */
-inline void M68K::ReleaseCycles(int cycles)
+inline void M68K::releaseCycles(int cycles)
 {
 	//main68k_releaseCycles(cycles);
 }
@@ -145,17 +534,34 @@ inline void M68K::ReleaseCycles(int cycles)
  * Add cycles to the M68K odometer.
  * @param cycles Number of cycles to add.
  */
-inline void M68K::AddCycles(int cycles)
+inline void M68K::addCycles(int cycles)
 {
 	//main68k_addCycles(cycles);
 }
 
+/**
+ * Stall the CPU, e.g. while waiting for the VDP's write FIFO.
+ * The stalled cycles are taken from the current timeslice.
+ * @param cycles Number of cycles to stall.
+ */
+inline void M68K::stall(int cycles)
+{
+	if (m_inExec) {
+#ifdef LIBGENS_M68000_NEW
+		m68k_use_cycles(cycles);
+#else
+		m_cpu.remaining_cycles -= cycles;
+#endif
+	} else
+		m_cycleCnt += cycles;
+}
+
 /**
  * Execute instructions for a given number of cycles.
  * @param n Number of cycles to execute.
  * @return ???
  */
-inline unsigned int M68K::Exec(int n)
+inline unsigned int M68K::exec(int n)
 {
 	int cyclesToRun = n - m_cycleCnt;
 	int ret;
@@ -163,7 +569,16 @@ inline unsigned int M68K::Exec(int n)
 	if (cyclesToRun <= 0)
 		return 0;
 
-	ret = m68k_execute(&ms_Context, cyclesToRun);
+	m_inExec = true;
+#ifdef LIBGENS_M68000_NEW
+	activate();
+	// Check for interrupts that came in since the last timeslice.
+	m68k_set_irq(irqLevel());
+	ret = m68k_execute(cyclesToRun);
+#else
+	ret = m68k_execute(&m_cpu, cyclesToRun);
+#endif
+	m_inExec = false;
 
 	if (ret >= 0)
 		m_cycleCnt += ret;
@@ -177,7 +592,7 @@ inline unsigned int M68K::Exec(int n)
 * Clear the M68K odometer.
 * @return ???
 */
-inline unsigned int M68K::TripOdometer(void)
+inline unsigned int M68K::tripOdometer(void)
 {
 	m_cycleCnt = 0;
 	return 0;
@@ -44,10 +44,6 @@
 // Sound Manager.
 #include "sound/SoundMgr.hpp"
 
-// TODO: Starscream accesses Ram_68k directly.
-// Move Ram_68k back to M68K once Starscream is updated.
-Ram_68k_t Ram_68k;
-
 // EmuContext
 #include "EmuContext/EmuContext.hpp"
 
@@ -57,41 +53,9 @@ Ram_68k_t Ram_68k;
 
 namespace LibGens {
 
-/** ROM and RAM variables. **/
-//M68K_Mem::Ram_68k_t M68K_Mem::Ram_68k;	// TODO: Fix Starscream!
-
-// Z80 emulator.
-Z80 *M68K_Mem::ms_Z80 = nullptr;
-
-// ROM cartridge.
-RomCartridgeMD *M68K_Mem::ms_RomCartridge = nullptr;
-
-// TMSS registers.
-TmssReg M68K_Mem::tmss_reg;
-
 /** Z80/M68K cycle table. **/
 int M68K_Mem::Z80_M68K_Cycle_Tab[512];
 
-// M68K static variables.
-// TODO: Improve some of these, especially the cycle counters!
-unsigned int M68K_Mem::Z80_State;
-int M68K_Mem::Last_BUS_REQ_Cnt;
-int M68K_Mem::Last_BUS_REQ_St;
-int M68K_Mem::Bank_M68K;
-int M68K_Mem::Fake_Fetch;
-
-int M68K_Mem::CPL_M68K;
-int M68K_Mem::CPL_Z80;
-int M68K_Mem::Cycles_M68K;
-int M68K_Mem::Cycles_Z80;
-
-/**
- * M68K bank type identifiers.
- * These type identifiers indicate what's mapped to each virtual bank.
- * Banks are 2 MB each, for a total of 8 banks.
- */
-uint8_t M68K_Mem::ms_M68KBank_Type[8];
-
 /**
  * Default M68K bank type IDs for MD.
  */
@@ -134,6 +98,34 @@ const uint8_t M68K_Mem::msc_M68KBank_Def_Pico[8] =
 	M68K_BANK_RAM
 };
 
+/**
+ * Initialize an M68K memory handler.
+ * @param context Emulation context that owns this memory handler.
+ */
+M68K_Mem::M68K_Mem(EmuContext *context)
+	: m_romCartridge(nullptr)
+	, Z80_State(0)
+	, Last_BUS_REQ_Cnt(0)
+	, Last_BUS_REQ_St(0)
+	, Bank_M68K(0)
+	, Fake_Fetch(0)
+	, CPL_M68K(0)
+	, CPL_Z80(0)
+	, Cycles_M68K(0)
+	, Cycles_Z80(0)
+	, m_context(context)
+{
+	memset(&Ram_68k, 0x00, sizeof(Ram_68k));
+	memset(m_M68KBank_Type, M68K_BANK_UNUSED, sizeof(m_M68KBank_Type));
+}
+
+M68K_Mem::~M68K_Mem()
+{ }
+
+/**
+ * Initialize the M68K memory handler tables.
+ * These tables are shared by all M68K_Mem instances.
+ */
 void M68K_Mem::Init(void)
 {
 	// Initialize the Z80/M68K cycle table.
@@ -180,7 +172,7 @@ inline uint8_t M68K_Mem::M68K_Read_Byte_Misc(uint32_t address)
 
 		// Call the Z80 Read Byte function.
 		// TODO: CPU lockup on accessing 0x7Fxx or >=0x8000.
-		return ms_Z80->Z80_MD_ReadB(address & 0xFFFF);
+		return m_context->m_z80->Z80_MD_ReadB(address & 0xFFFF);
 	} else if (address >= 0xA20000) {
 		// Invalid address.
 		// TODO: Fake Fetch?
@@ -209,7 +201,7 @@ inline uint8_t M68K_Mem::M68K_Read_Byte_Misc(uint32_t address)
 			}
 
 			// Z80 is not running.
-			int odo68k = M68K::ReadOdometer();
+			int odo68k = m_context->m_m68k->readOdometer();
 			odo68k -= Last_BUS_REQ_Cnt;
 			if (odo68k <= CYCLE_FOR_TAKE_Z80_BUS_GENESIS)
 				return ((Last_BUS_REQ_St | 0x80) & 0xFF);
@@ -225,7 +217,7 @@ inline uint8_t M68K_Mem::M68K_Read_Byte_Misc(uint32_t address)
 
 		case 0x30:
 			// 0xA130xx: /TIME registers.
-			return ms_RomCartridge->readByte_TIME(address & 0xFF);
+			return m_romCartridge->readByte_TIME(address & 0xFF);
 
 		case 0x40: {
 			// 0xA14000: TMSS ('SEGA' register)
@@ -291,13 +283,11 @@ inline uint8_t M68K_Mem::M68K_Read_Byte_Misc(uint32_t address)
 			// NOTE: Reads from even addresses are handled the same as odd addresses.
 			// (Least-significant bit is ignored.)
 			uint8_t ret = 0xFF;
-			const LibGens::IoManager *const ioManager = EmuContext::m_ioManager;
+			const LibGens::IoManager *const ioManager = m_context->m_ioManager;
 			switch (address & 0x1E) {
 				case 0x00: {
 					// 0xA10001: Genesis version register.
-					EmuContext *context = EmuContext::Instance();
-					if (context)
-						ret = context->readVersionRegister_MD();
+					ret = m_context->readVersionRegister_MD();
 					break;
 				}
 
@@ -354,13 +344,8 @@ inline uint8_t M68K_Mem::M68K_Read_Byte_VDP(uint32_t address)
 		return 0x00;
 	}
 
-	// TODO: Don't use EmuContext here...
-	EmuContext *context = EmuContext::Instance();
-	if (!context)
-		return 0;
-
 	// Check the VDP address.
-	Vdp *vdp = context->m_vdp;
+	Vdp *const vdp = m_context->m_vdp;
 	uint8_t ret = 0; // TODO: Default to prefetched data?
 	switch (address & 0xFD) {
 		case 0x00:
@@ -442,7 +427,7 @@ inline uint8_t M68K_Mem::M68K_Read_Byte_Pico_IO(uint32_t address)
 		return 0xFF;
 	}
 
-	LibGens::IoManager *const ioManager = EmuContext::m_ioManager;
+	LibGens::IoManager *const ioManager = m_context->m_ioManager;
 	uint8_t ret = 0xFF; // TODO: Default to prefetched data?
 
 	switch (address & 0x1F) {
@@ -523,7 +508,7 @@ inline uint16_t M68K_Mem::M68K_Read_Word_Misc(uint32_t address)
 		// Call the Z80 Read Byte function.
 		// TODO: CPU lockup on accessing 0x7Fxx or >=0x8000.
 		// Genesis Plus duplicates the byte in both halves of the M68K word.
-		uint8_t ret = ms_Z80->Z80_MD_ReadB(address & 0xFFFF);
+		uint8_t ret = m_context->m_z80->Z80_MD_ReadB(address & 0xFFFF);
 		return (ret | (ret << 8));
 	} else if (address >= 0xA20000) {
 		// Invalid address.
@@ -550,7 +535,7 @@ inline uint16_t M68K_Mem::M68K_Read_Word_Misc(uint32_t address)
 			}
 
 			// Z80 is not running.
-			int odo68k = M68K::ReadOdometer();
+			int odo68k = m_context->m_m68k->readOdometer();
 			odo68k -= Last_BUS_REQ_Cnt;
 			if (odo68k <= CYCLE_FOR_TAKE_Z80_BUS_GENESIS) {
 				// bus not taken yet
@@ -577,7 +562,7 @@ inline uint16_t M68K_Mem::M68K_Read_Word_Misc(uint32_t address)
 
 		case 0x30:
 			// 0xA130xx: /TIME registers.
-			return ms_RomCartridge->readWord_TIME(address & 0xFF);
+			return m_romCartridge->readWord_TIME(address & 0xFF);
 
 		case 0x40: {
 			// 0xA14101: TMSS ('SEGA' register)
@@ -643,13 +628,11 @@ inline uint16_t M68K_Mem::M68K_Read_Word_Misc(uint32_t address)
 			 * 0xA1001F: Control Port 3: Serial Control.
 			 */
 			uint8_t ret = 0xFF;
-			const LibGens::IoManager *const ioManager = EmuContext::m_ioManager;
+			const LibGens::IoManager *const ioManager = m_context->m_ioManager;
 			switch (address & 0x1E) {
 				case 0x00: {
 					// 0xA10001: Genesis version register.
-					EmuContext *context = EmuContext::Instance();
-					if (context)
-						ret = context->readVersionRegister_MD();
+					ret = m_context->readVersionRegister_MD();
 					break;
 				}
 
@@ -708,13 +691,8 @@ inline uint16_t M68K_Mem::M68K_Read_Word_VDP(uint32_t address)
 		return 0x0000;
 	}
 
-	// TODO: Don't use EmuContext here...
-	EmuContext *context = EmuContext::Instance();
-	if (!context)
-		return 0;
-
 	// Check the VDP address.
-	Vdp *vdp = context->m_vdp;
+	Vdp *const vdp = m_context->m_vdp;
 	uint16_t ret = 0; // TODO: Default to prefetched data?
 	switch (address & 0xFC) {
 		case 0x00:
@@ -775,7 +753,7 @@ inline uint16_t M68K_Mem::M68K_Read_Word_Pico_IO(uint32_t address)
 		return 0xFFFF;
 	}
 
-	LibGens::IoManager *const ioManager = EmuContext::m_ioManager;
+	LibGens::IoManager *const ioManager = m_context->m_ioManager;
 	uint16_t ret = 0xFFFF; // TODO: Default to prefetched data?
 	switch (address & 0x1E) {
 		case 0x00:
@@ -845,6 +823,7 @@ inline void M68K_Mem::M68K_Write_Byte_Ram(uint32_t address, uint8_t data)
 	address &= 0xFFFF;
 	address ^= U16DATA_U8_INVERT;
 	Ram_68k.u8[address] = data;
+	m_context->m_m68k->ramWritten(address);
 }
 
 
@@ -867,7 +846,7 @@ inline void M68K_Mem::M68K_Write_Byte_Misc(uint32_t address, uint8_t data)
 
 		// Call the Z80 Write Byte function.
 		// TODO: CPU lockup on accessing 0x7Fxx or >=0x8000.
-		ms_Z80->Z80_MD_WriteB(address & 0xFFFF, data);
+		m_context->m_z80->Z80_MD_WriteB(address & 0xFFFF, data);
 		return;
 	} else if (address >= 0xA20000) {
 		// Invalid address.
@@ -890,7 +869,7 @@ inline void M68K_Mem::M68K_Write_Byte_Misc(uint32_t address, uint8_t data)
 			if (data & 0x01) {
 				// M68K requests the bus.
 				// Disable the Z80.
-				Last_BUS_REQ_Cnt = M68K::ReadOdometer();
+				Last_BUS_REQ_Cnt = m_context->m_m68k->readOdometer();
 				Last_BUS_REQ_St = (Z80_State & Z80_STATE_BUSREQ);
 
 				if (Z80_State & Z80_STATE_BUSREQ) {
@@ -903,7 +882,7 @@ inline void M68K_Mem::M68K_Write_Byte_Misc(uint32_t address, uint8_t data)
 					
 					int edx = Cycles_Z80;
 					edx -= ebx;
-					ms_Z80->exec(edx);
+					m_context->m_z80->exec(edx);
 				}
 			} else {
 				// M68K releases the bus.
@@ -914,14 +893,14 @@ inline void M68K_Mem::M68K_Write_Byte_Misc(uint32_t address, uint8_t data)
 					
 					// TODO: Rework this.
 					int ebx = Cycles_M68K;
-					ebx -= M68K::ReadOdometer();
+					ebx -= m_context->m_m68k->readOdometer();
 					
 					int edx = Cycles_Z80;
 					ebx = Z80_M68K_Cycle_Tab[ebx];
 					edx -= ebx;
 					
 					// Set the Z80 odometer.
-					ms_Z80->setOdometer((unsigned int)edx);
+					m_context->m_z80->setOdometer((unsigned int)edx);
 				}
 			}
 
@@ -938,17 +917,17 @@ inline void M68K_Mem::M68K_Write_Byte_Misc(uint32_t address, uint8_t data)
 				Z80_State &= ~Z80_STATE_RESET;
 			} else {
 				// RESET is low. Stop the Z80.
-				ms_Z80->softReset();
+				m_context->m_z80->softReset();
 				Z80_State |= Z80_STATE_RESET;
 
 				// YM2612's RESET line is tied to the Z80's RESET line.
-				SoundMgr::ms_Ym2612.reset();
+				m_context->m_soundMgr->m_ym2612.reset();
 			}
 			break;
 
 		case 0x30:
 			// 0xA130xx: /TIME registers.
-			ms_RomCartridge->writeByte_TIME(address & 0xFF, data);
+			m_romCartridge->writeByte_TIME(address & 0xFF, data);
 			break;
 
 		case 0x40: {
@@ -982,7 +961,7 @@ inline void M68K_Mem::M68K_Write_Byte_Misc(uint32_t address, uint8_t data)
 			tmss_reg.n_cart_ce = (data & 1);
 
 			// Update TMSS mapping.
-			UpdateTmssMapping();
+			updateTmssMapping();
 			break;
 		}
 
@@ -1009,7 +988,7 @@ inline void M68K_Mem::M68K_Write_Byte_Misc(uint32_t address, uint8_t data)
 			 * 0xA1001F: Control Port 3: Serial Control.
 			 */
 			// TODO: Do byte writes to even addresses (e.g. 0xA10002) work?
-			LibGens::IoManager *const ioManager = EmuContext::m_ioManager;
+			LibGens::IoManager *const ioManager = m_context->m_ioManager;
 			switch (address & 0x1E) {
 				default:
 				case 0x00: /// 0xA10001: Genesis version register.
@@ -1060,13 +1039,8 @@ inline void M68K_Mem::M68K_Write_Byte_VDP(uint32_t address, uint8_t data)
 		return;
 	}
 
-	// TODO: Don't use EmuContext here...
-	EmuContext *context = EmuContext::Instance();
-	if (!context)
-		return;
-
 	// Check the VDP address.
-	Vdp *vdp = context->m_vdp;
+	Vdp *const vdp = m_context->m_vdp;
 	switch (address & 0xFC) {
 		case 0x00:
 			// VDP data port.
@@ -1079,7 +1053,7 @@ inline void M68K_Mem::M68K_Write_Byte_VDP(uint32_t address, uint8_t data)
 		case 0x10: case 0x14:
 			// PSG control port. (Odd addresses only)
 			if (address & 1) {
-				SoundMgr::ms_Psg.write(data);
+				m_context->m_soundMgr->m_psg.write(data);
 			}
 			break;
 		case 0x18:
@@ -1146,6 +1120,7 @@ inline void M68K_Mem::M68K_Write_Word_Ram(uint32_t address, uint16_t data)
 {
 	address &= 0xFFFE;
 	Ram_68k.u16[address >> 1] = data;
+	m_context->m_m68k->ramWritten(address);
 }
 
 
@@ -1171,7 +1146,7 @@ inline void M68K_Mem::M68K_Write_Word_Misc(uint32_t address, uint16_t data)
 		// TODO: CPU lockup on accessing 0x7Fxx or >=0x8000.
 		// Genesis Plus writes the high byte of the M68K word.
 		// NOTE: Gunstar Heroes uses word write access to the Z80 area on startup.
-		ms_Z80->Z80_MD_WriteB(address & 0xFFFF, (data >> 8) & 0xFF);
+		m_context->m_z80->Z80_MD_WriteB(address & 0xFFFF, (data >> 8) & 0xFF);
 		return;
 	} else if (address >= 0xA20000) {
 		// Invalid address.
@@ -1193,7 +1168,7 @@ inline void M68K_Mem::M68K_Write_Word_Misc(uint32_t address, uint16_t data)
 			if (data & 0x0100) {
 				// M68K requests the bus.
 				// Disable the Z80.
-				Last_BUS_REQ_Cnt = M68K::ReadOdometer();
+				Last_BUS_REQ_Cnt = m_context->m_m68k->readOdometer();
 				Last_BUS_REQ_St = (Z80_State & Z80_STATE_BUSREQ);
 
 				if (Z80_State & Z80_STATE_BUSREQ) {
@@ -1206,7 +1181,7 @@ inline void M68K_Mem::M68K_Write_Word_Misc(uint32_t address, uint16_t data)
 
 					int edx = Cycles_Z80;
 					edx -= ebx;
-					ms_Z80->exec(edx);
+					m_context->m_z80->exec(edx);
 				}
 			} else {
 				// M68K releases the bus.
@@ -1217,14 +1192,14 @@ inline void M68K_Mem::M68K_Write_Word_Misc(uint32_t address, uint16_t data)
 
 					// TODO: Rework this.
 					int ebx = Cycles_M68K;
-					ebx -= M68K::ReadOdometer();
+					ebx -= m_context->m_m68k->readOdometer();
 
 					int edx = Cycles_Z80;
 					ebx = Z80_M68K_Cycle_Tab[ebx];
 					edx -= ebx;
 
 					// Set the Z80 odometer.
-					ms_Z80->setOdometer((unsigned int)edx);
+					m_context->m_z80->setOdometer((unsigned int)edx);
 				}
 			}
 
@@ -1240,18 +1215,18 @@ inline void M68K_Mem::M68K_Write_Word_Misc(uint32_t address, uint16_t data)
 				Z80_State &= ~Z80_STATE_RESET;
 			} else {
 				// RESET is low. Stop the Z80.
-				ms_Z80->softReset();
+				m_context->m_z80->softReset();
 				Z80_State |= Z80_STATE_RESET;
 
 				// YM2612's RESET line is tied to the Z80's RESET line.
-				SoundMgr::ms_Ym2612.reset();
+				m_context->m_soundMgr->m_ym2612.reset();
 			}
 
 			break;
 
 		case 0x30:
 			// 0xA130xx: /TIME registers.
-			ms_RomCartridge->writeWord_TIME(address & 0xFF, data);
+			m_romCartridge->writeWord_TIME(address & 0xFF, data);
 			break;
 
 		case 0x40: {
@@ -1285,7 +1260,7 @@ inline void M68K_Mem::M68K_Write_Word_Misc(uint32_t address, uint16_t data)
 			tmss_reg.n_cart_ce = (data & 1);
 
 			// Update TMSS mapping.
-			UpdateTmssMapping();
+			updateTmssMapping();
 			break;
 		}
 
@@ -1313,7 +1288,7 @@ inline void M68K_Mem::M68K_Write_Word_Misc(uint32_t address, uint16_t data)
 			 */
 			// TODO: Is there special handling for word writes,
 			// or is it just "LSB is written"?
-			LibGens::IoManager *const ioManager = EmuContext::m_ioManager;
+			LibGens::IoManager *const ioManager = m_context->m_ioManager;
 			switch (address & 0x1E) {
 				default:
 				case 0x00: /// 0xA10001: Genesis version register.
@@ -1364,13 +1339,8 @@ inline void M68K_Mem::M68K_Write_Word_VDP(uint32_t address, uint16_t data)
 		return;
 	}
 
-	// TODO: Don't use EmuContext here...
-	EmuContext *context = EmuContext::Instance();
-	if (!context)
-		return;
-
 	// Check the VDP address.
-	Vdp *vdp = context->m_vdp;
+	Vdp *const vdp = m_context->m_vdp;
 	switch (address & 0xFC) {
 		case 0x00:
 			// VDP data port.
@@ -1382,7 +1352,7 @@ inline void M68K_Mem::M68K_Write_Word_VDP(uint32_t address, uint16_t data)
 			break;
 		case 0x10: case 0x14:
 			// PSG control port.
-			SoundMgr::ms_Psg.write(data & 0xFF);
+			m_context->m_soundMgr->m_psg.write(data & 0xFF);
 			break;
 		case 0x18:
 			// Unused write address.
@@ -1441,28 +1411,28 @@ inline void M68K_Mem::M68K_Write_Word_Pico_IO(uint32_t address, uint16_t data)
 /**
  * Update the TMSS mapping.
  */
-void M68K_Mem::UpdateTmssMapping(void)
+void M68K_Mem::updateTmssMapping(void)
 {
 	if (!tmss_reg.isTmssMapped()) {
 		// TMSS is disabled, or
 		// TMSS is enabled and cartridge is mapped.
-		ms_M68KBank_Type[0] = M68K_BANK_CARTRIDGE;
-		ms_M68KBank_Type[1] = M68K_BANK_CARTRIDGE;
+		m_M68KBank_Type[0] = M68K_BANK_CARTRIDGE;
+		m_M68KBank_Type[1] = M68K_BANK_CARTRIDGE;
 	} else {
 		// TMSS is enabled.
-		ms_M68KBank_Type[0] = M68K_BANK_TMSS_ROM;
-		ms_M68KBank_Type[1] = M68K_BANK_TMSS_ROM;
+		m_M68KBank_Type[0] = M68K_BANK_TMSS_ROM;
+		m_M68KBank_Type[1] = M68K_BANK_TMSS_ROM;
 	}
 
 	// TODO: Better way to update Starscream?
-	M68K::UpdateSysBanking();
+	m_context->m_m68k->updateSysBanking();
 }
 
 /**
  * Initialize the M68K memory handler.
  * @param system System ID.
  */
-void M68K_Mem::InitSys(M68K::SysID system)
+void M68K_Mem::initSys(M68K::SysID system)
 {
 	// Reset the TMSS registers.
 	tmss_reg.reset();
@@ -1470,40 +1440,39 @@ void M68K_Mem::InitSys(M68K::SysID system)
 	// Initialize the M68K bank type identifiers.
 	switch (system) {
 		case M68K::SYSID_MD:
-			memcpy(ms_M68KBank_Type, msc_M68KBank_Def_MD, sizeof(ms_M68KBank_Type));
-			UpdateTmssMapping();
+			memcpy(m_M68KBank_Type, msc_M68KBank_Def_MD, sizeof(m_M68KBank_Type));
+			updateTmssMapping();
 			break;
 
 		case M68K::SYSID_PICO:
-			memcpy(ms_M68KBank_Type, msc_M68KBank_Def_Pico, sizeof(ms_M68KBank_Type));
+			memcpy(m_M68KBank_Type, msc_M68KBank_Def_Pico, sizeof(m_M68KBank_Type));
 			break;
 
 		default:
 			// Unknown system ID.
 			LOG_MSG(68k, LOG_MSG_LEVEL_ERROR,
 				"Unknown system ID: %d", system);
-			memset(ms_M68KBank_Type, 0x00, sizeof(ms_M68KBank_Type));
+			memset(m_M68KBank_Type, 0x00, sizeof(m_M68KBank_Type));
 			break;
 	}
 }
 
 /**
  * Update M68K CPU program access structs for bankswitching purposes.
- * @param M68K_Fetch Pointer to first STARSCREAM_PROGRAMREGION to update.
  * @param banks Maximum number of banks to update.
  * @return Number of banks updated.
  */
-int M68K_Mem::UpdateSysBanking(int banks)
+int M68K_Mem::updateSysBanking(int banks)
 {
 	// Mapping depends on if TMSS is mapped.
 	int cur_fetch = 0;
 	if (!tmss_reg.isTmssMapped()) {
 		// TMSS is not mapped.
 		// Update banking using RomCartridgeMD.
-		cur_fetch += ms_RomCartridge->updateSysBanking(banks);
+		cur_fetch += m_romCartridge->updateSysBanking(banks);
 	} else {
 		// TMSS is mapped.
-		cur_fetch += tmss_reg.updateSysBanking(banks);
+		cur_fetch += tmss_reg.updateSysBanking(m_context->m_m68k, banks);
 	}
 
 	return cur_fetch;
@@ -1522,13 +1491,13 @@ uint8_t M68K_Mem::M68K_RB(uint32_t address)
 	const uint8_t bank = ((address >> 21) & 0x7);
 
 	// TODO: Optimize the switch using a bitwise AND.
-	switch (ms_M68KBank_Type[bank]) {
+	switch (m_M68KBank_Type[bank]) {
 		default:
 		case M68K_BANK_UNUSED:	return 0xFF;
 
 		// ROM cartridge.
 		case M68K_BANK_CARTRIDGE:
-			return ms_RomCartridge->readByte(address);
+			return m_romCartridge->readByte(address);
 
 		// Other MD banks.
 		case M68K_BANK_MD_IO:		return M68K_Read_Byte_Misc(address);
@@ -1554,13 +1523,13 @@ uint16_t M68K_Mem::M68K_RW(uint32_t address)
 	const uint8_t bank = ((address >> 21) & 0x7);
 
 	// TODO: Optimize the switch using a bitwise AND.
-	switch (ms_M68KBank_Type[bank]) {
+	switch (m_M68KBank_Type[bank]) {
 		default:
 		case M68K_BANK_UNUSED:	return 0xFFFF;
 		
 		// ROM cartridge.
 		case M68K_BANK_CARTRIDGE:
-			return ms_RomCartridge->readWord(address);
+			return m_romCartridge->readWord(address);
 
 		// Other MD banks.
 		case M68K_BANK_MD_IO:		return M68K_Read_Word_Misc(address);
@@ -1587,7 +1556,7 @@ void M68K_Mem::M68K_WB(uint32_t address, uint8_t data)
 	const uint8_t bank = ((address >> 21) & 0x7);
 
 	// TODO: Optimize the switch using a bitwise AND.
-	switch (ms_M68KBank_Type[bank]) {
+	switch (m_M68KBank_Type[bank]) {
 		default:
 		case M68K_BANK_UNUSED:
 		case M68K_BANK_TMSS_ROM:
@@ -1595,7 +1564,7 @@ void M68K_Mem::M68K_WB(uint32_t address, uint8_t data)
 
 		// ROM cartridge.
 		case M68K_BANK_CARTRIDGE:
-			ms_RomCartridge->writeByte(address, data);
+			m_romCartridge->writeByte(address, data);
 			break;
 
 		// Other MD banks.
@@ -1619,7 +1588,7 @@ void M68K_Mem::M68K_WW(uint32_t address, uint16_t data)
 	const uint8_t bank = ((address >> 21) & 0x7);
 
 	// TODO: Optimize the switch using a bitwise AND.
-	switch (ms_M68KBank_Type[bank]) {
+	switch (m_M68KBank_Type[bank]) {
 		default:
 		case M68K_BANK_UNUSED:
 		case M68K_BANK_TMSS_ROM:
@@ -1627,7 +1596,7 @@ void M68K_Mem::M68K_WW(uint32_t address, uint16_t data)
 
 		// ROM cartridge.
 		case M68K_BANK_CARTRIDGE:
-			ms_RomCartridge->writeWord(address, data);
+			m_romCartridge->writeWord(address, data);
 			break;
 
 		// Other MD banks.
@@ -1638,4 +1607,36 @@ void M68K_Mem::M68K_WW(uint32_t address, uint16_t data)
 	}
 }
 
+/**
+ * Can a 68000 idle loop read an address?
+ * Reading it must return the same value and have no
+ * other effects until the end of the current timeslice,
+ * as long as nothing is written.
+ * @param address Address.
+ * @return True if the address can be read by an idle loop.
+ */
+bool M68K_Mem::isIdleRead(uint32_t address) const
+{
+	address &= 0xFFFFFF;
+	const uint8_t bank = ((address >> 21) & 0x7);
+
+	switch (m_M68KBank_Type[bank]) {
+		case M68K_BANK_RAM:
+			// Only the 68000 writes to RAM during a timeslice.
+			return true;
+
+		case M68K_BANK_VDP:
+			// VDP control port. (status register)
+			// Reading it only clears the control word latch.
+			return ((address & 0x700E0) == 0 &&
+				(address & 0x1C) == 0x04 &&
+				m_context->m_vdp->isStatusStable());
+
+		default:
+			// Cartridge mappers, I/O, the Z80 bus,
+			// and the HV counter may change.
+			return false;
+	}
+}
+
 }
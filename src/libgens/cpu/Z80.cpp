@@ -34,11 +34,22 @@
 
 namespace LibGens {
 
+/**
+ * Initialize the Z80 CPU emulator's static tables.
+ * Called by LibGens::Init().
+ */
+void Z80::Init(void)
+{
+	Cz80_Init_Tables();
+}
+
 /**
  * Initialize the Z80 CPU emulator.
+ * @param context Emulation context that owns this CPU.
  */
-Z80::Z80()
-	: m_cycleCnt(0)
+Z80::Z80(EmuContext *context)
+	: m_context(context)
+	, m_cycleCnt(0)
 {
 	// Allocate the Z80 context.
 	// TODO: Error handling.
@@ -90,11 +101,12 @@ void Z80::reinit(void)
 
 	// Disable the Z80 initially.
 	// NOTE: Bit 0 is used for the "Sound, Z80" option.
-	M68K_Mem::Z80_State &= Z80_STATE_ENABLED;
+	M68K_Mem *const m68kMem = m_context->m_m68kMem;
+	m68kMem->Z80_State &= Z80_STATE_ENABLED;
 
 	// Reset the BUSREQ variables.
-	M68K_Mem::Last_BUS_REQ_Cnt = 0;
-	M68K_Mem::Last_BUS_REQ_St = 0;
+	m68kMem->Last_BUS_REQ_Cnt = 0;
+	m68kMem->Last_BUS_REQ_St = 0;
 
 	// Hard-reset the Z80.
 	hardReset();
@@ -31,6 +31,7 @@
 
 // M68K_Mem is needed for Z80_State.
 #include "M68K_Mem.hpp"
+#include "../EmuContext/EmuContext.hpp"
 
 // C includes.
 #include <stdint.h>
@@ -41,10 +42,22 @@ namespace LibGens {
 class Z80
 {
 	public:
-		Z80();
+		Z80(EmuContext *context);
 		~Z80();
 
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		Z80(const Z80 &);
+		Z80 &operator=(const Z80 &);
+
 	public:
+		/**
+		 * Initialize the Z80 CPU emulator's static tables.
+		 * Called by LibGens::Init().
+		 */
+		static void Init(void);
+
 		/**
 		 * Reinitialize the Z80.
 		 * This function should be called when starting emulation.
@@ -62,9 +75,13 @@ class Z80
 		inline void interrupt(uint8_t irq);
 		inline void clearOdometer(void);
 		inline void setOdometer(unsigned int odo);
+		inline unsigned int readOdometer(void) const;
 		/** END: Cz80 wrapper functions. **/
 
 	protected:
+		// Emulation context that owns this CPU.
+		EmuContext *const m_context;
+
 		cz80_struc *m_z80;
 
 		// Cz80 uses "run xxx cycles" instead of an odometer.
@@ -141,14 +158,15 @@ inline void Z80::exec(int cyclesSubtract)
 	// M68K_Mem::Cycles_Z80 has the total number of cycles that should be run up to this point.
 	// cyclesSubtract is the number of cycles to save.
 	// cyclesTarget is the destination cycle count.
-	int cyclesTarget = (M68K_Mem::Cycles_Z80 - cyclesSubtract);
+	const M68K_Mem *const m68kMem = m_context->m_m68kMem;
+	int cyclesTarget = (m68kMem->Cycles_Z80 - cyclesSubtract);
 	// cyclesToRun is the number of cycles to run right now.
 	int cyclesToRun = cyclesTarget - m_cycleCnt;
 	if (cyclesToRun <= 0)
 		return;
 
 	// Only run the Z80 if it's enabled and it has the bus.
-	if (M68K_Mem::Z80_State == (Z80_STATE_ENABLED | Z80_STATE_BUSREQ)) {
+	if (m68kMem->Z80_State == (Z80_STATE_ENABLED | Z80_STATE_BUSREQ)) {
 		int ret = Cz80_Exec(m_z80, cyclesToRun);
 		if (ret >= 0) {
 			// ret == number of cycles run.
@@ -186,6 +204,15 @@ inline void Z80::setOdometer(unsigned int odo)
 	m_cycleCnt = odo;
 }
 
+/**
+ * Read the odometer.
+ * @return Z80 cycles executed in the current frame.
+ */
+inline unsigned int Z80::readOdometer(void) const
+{
+	return m_cycleCnt;
+}
+
 /** Memory access functions. **/
 
 inline uint8_t CZ80CALL Z80::Z80_MD_ReadB(uint16_t address)
@@ -92,16 +92,26 @@ static void Cz80_Init_Flags(void)
     memset(Cz80_dummy_fetch, 0x76, sizeof(Cz80_dummy_fetch));
 }
 
-void Cz80_Init(cz80_struc *cpu)
+/**
+ * Initialize the global flag tables and dummy fetch bank.
+ * This should be called once before any Z80 is created
+ * if Z80s will be created on multiple threads.
+ */
+void Cz80_Init_Tables(void)
 {
-    memset(cpu, 0, sizeof(cz80_struc));
-
     if (!flags_init)
     {
-        // Initialize the flag tables and dummy fetch bank.
-        flags_init = 1;
         Cz80_Init_Flags();
+        flags_init = 1;
     }
+}
+
+void Cz80_Init(cz80_struc *cpu)
+{
+    memset(cpu, 0, sizeof(cz80_struc));
+
+    // Initialize the flag tables and dummy fetch bank.
+    Cz80_Init_Tables();
 
     Cz80_Set_Fetch(cpu, 0x0000, 0xFFFF, Cz80_dummy_fetch);
 
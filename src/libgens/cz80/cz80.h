@@ -66,6 +66,13 @@ typedef struct _cz80_struc cz80_struc;
 /* Publics Z80 functions */
 /*************************/
 
+/**
+ * Initialize the global flag tables and dummy fetch bank.
+ * This should be called once before any Z80 is created
+ * if Z80s will be created on multiple threads.
+ */
+void    Cz80_Init_Tables(void);
+
 void    Cz80_Init(cz80_struc *cpu);
 uint8_t Cz80_Reset(cz80_struc *cpu);
 uint8_t Cz80_Soft_Reset(cz80_struc *cpu);
@@ -132,6 +132,7 @@ int Init(void)
 	// Initialize LibGens subsystems.
 	M68K::Init();
 	M68K_Mem::Init();
+	Z80::Init();
 
 	SoundMgr::Init();
 
@@ -233,23 +233,95 @@ typedef struct
   void (*write16)(void *param, unsigned int address, unsigned int data); /* I/O word write access */
 } cpu_memory_map;
 
-/* 68k idle loop detection */
+struct _m68ki_cpu_core;
+typedef struct _m68ki_cpu_core m68ki_cpu_core;
+
+/* 68k idle loop detection (Gens)
+ * An idle loop is a short loop that only reads memory that doesn't
+ * change during the timeslice, e.g. waiting for a RAM flag or for
+ * VBlank in the VDP status.  Once two consecutive iterations start
+ * with the same registers, every other iteration until the end of
+ * the timeslice is identical, so they're skipped.
+ */
+#define M68K_IDLE_LOOP_SIZE 32  /* maximum size of an idle loop, in bytes */
+
+#define M68K_IDLE_NO   0  /* not an idle loop */
+#define M68K_IDLE_LOOP 1  /* waiting for the loop's branch */
+#define M68K_IDLE_ITER 2  /* registers saved at the start of an iteration */
+
 typedef struct
 {
-  uint pc;
-  uint cycle;
-  uint detected;
+  uint pc;        /* start of the loop being checked */
+  uint branch;    /* address of the loop's branch instruction */
+  uint cycle;     /* remaining cycles at the start of the saved iteration */
+  uint detected;  /* M68K_IDLE_* */
+  uint dar[16];   /* registers at the start of the saved iteration */
+  uint sr;        /* status register at the start of the saved iteration */
+  uint skipped;   /* number of cycles skipped */
+
+  /* Can the loop read this address?  Reading it must return the same
+   * value with no further side effects until the end of the timeslice
+   * as long as nothing is written.  (NULL disables idle loop skipping.)
+   */
+  int (*read_ok)(m68ki_cpu_core *m68k, unsigned int address);
 } cpu_idle_t;
 
-struct _m68ki_cpu_core;
-typedef struct _m68ki_cpu_core m68ki_cpu_core;
+/* 68k decoded block cache (Gens)
+ * Each block is a trace of instructions that was executed starting
+ * at a given PC. The opcode fetch and the handler and cycle table
+ * lookups are done when the trace is recorded; when it is replayed,
+ * each instruction is only run if the PC still matches the trace.
+ */
+#define M68K_BCACHE_BLOCKS 1024  /* number of blocks (power of 2) */
+#define M68K_BCACHE_OPS    16    /* maximum instructions per block */
+#define M68K_JIT_HOT       8     /* replays before a block is translated */
+
+typedef struct
+{
+  void (*handler)(m68ki_cpu_core *m68k);  /* pre-resolved opcode handler */
+  uint pc;                                /* address of the opcode */
+  uint16 ir;                              /* opcode */
+  uint16 cycles;                          /* base cycle count */
+} m68k_bcache_op;
+
+typedef struct
+{
+  uint pc;       /* start address */
+  uint gen;      /* generation the block was recorded in */
+  uint ram;      /* block is in 68K RAM */
+  uint count;    /* number of instructions */
+  uint hits;     /* number of times the block was replayed */
+  void (*code)(m68ki_cpu_core *m68k);  /* translated block (JIT) */
+  m68k_bcache_op op[M68K_BCACHE_OPS];
+} m68k_bcache_block;
+
+/* JIT lockstep checker state (m68kjit.c) */
+typedef struct _m68k_jit_lockstep m68k_jit_lockstep;
+
+typedef struct
+{
+  unsigned char *ram;   /* 68K RAM (fetch base of the RAM banks) */
+  uint rom_gen;         /* current generation for blocks outside of RAM */
+  uint ram_gen;         /* current generation for blocks in RAM */
+  uint flushes;         /* incremented whenever blocks are invalidated */
+  uint8 ram_code[256];  /* 256-byte RAM pages containing cached opcodes */
+  uint jit;             /* translate hot blocks outside of RAM */
+  unsigned char *code_buf;  /* JIT code buffer */
+  uint code_size;       /* size of the JIT code buffer */
+  uint code_used;       /* bytes used in the JIT code buffer */
+  m68k_jit_lockstep *lockstep;  /* check translated blocks (NULL if disabled) */
+  m68k_bcache_block block[M68K_BCACHE_BLOCKS];
+} m68k_bcache;
 struct _m68ki_cpu_core
 {
   void *device;
   
   cpu_memory_map memory_map[256]; /* memory mapping */
 
-  cpu_idle_t poll;    /* polling detection */
+  cpu_idle_t poll;    /* idle loop detection (Gens) */
+
+  m68k_bcache *bcache; /* decoded block cache (NULL if disabled) */
+  uint compact_dispatch; /* use the compact opcode table (Gens) */
 
   uint irq_latency;
 
@@ -275,6 +347,7 @@ struct _m68ki_cpu_core
   uint int_mask;     /* I0-I2 */
   uint int_level;    /* State of interrupt pins IPL0-IPL2 -- ASG: changed from ints_pending */
   uint stopped;      /* Stopped state */
+  uint illegal_cnt;  /* Illegal, A-line, and F-line exceptions taken (Gens) */
 #if M68K_EMULATE_PREFETCH
   uint pref_addr;    /* Last prefetch address */
   uint pref_data;    /* Data in the prefetch queue */
@@ -423,6 +496,71 @@ extern void m68k_pulse_reset(m68ki_cpu_core *);
 /* Run until given cycle count is reached */
 extern int m68k_execute(m68ki_cpu_core *, unsigned int cycles);
 
+/* Attach a decoded block cache to the CPU, or detach it if bcache is NULL.
+ * ram is the fetch base of 68K RAM; writes to cached opcodes in RAM must
+ * be reported with m68k_bcache_write().  (Gens)
+ */
+extern void m68k_set_bcache(m68ki_cpu_core *m68k, m68k_bcache *bcache, unsigned char *ram);
+
+/* Invalidate all cached blocks.
+ * Must be called whenever the fetch memory map or the contents of
+ * ROM or RAM are changed by something other than a CPU write.  (Gens)
+ */
+extern void m68k_bcache_flush(m68ki_cpu_core *m68k);
+
+/* Invalidate all cached blocks in 68K RAM.  (Gens) */
+extern void m68k_bcache_flush_ram(m68ki_cpu_core *m68k);
+
+/* Is the dynamic recompiler supported on this host?  (Gens)
+ * Hot blocks outside of RAM are translated into host code that
+ * calls the opcode handlers directly, with the cycle accounting and
+ * block exit checks inlined.  Everything else is interpreted.
+ */
+extern int m68k_jit_available(void);
+
+/* Enable or disable the dynamic recompiler.  A block cache must be attached.
+ * Returns 0 on success; negative POSIX error code on error.  (Gens)
+ */
+extern int m68k_set_jit(m68ki_cpu_core *m68k, int enable);
+
+/* Enable or disable lockstep checking for the dynamic recompiler.  (Gens)
+ * Each translated block is checked against the interpreter after it runs:
+ * the block is run again by the interpreter from the same state, with
+ * the memory accesses of the first run replayed instead of repeated, and
+ * the resulting states are compared.  This is much slower, so it's only
+ * meant for debugging.
+ * Returns 0 on success; negative POSIX error code on error.
+ */
+extern int m68k_set_jit_lockstep(m68k_bcache *bcache, int enable);
+
+/* Get the number of translated blocks checked in lockstep mode, and the
+ * number of them that didn't match the interpreter.  (Gens)
+ */
+extern void m68k_jit_lockstep_stats(const m68k_bcache *bcache, unsigned int *checked, unsigned int *mismatches);
+
+/* Free the dynamic recompiler's code buffer.  (Gens) */
+extern void m68k_jit_free(m68k_bcache *bcache);
+
+/* Enable or disable the compact opcode table.  (Gens)
+ * Opcodes are dispatched through a table of 16-bit handler indexes
+ * instead of the table of handler pointers and the cycle table, which
+ * takes much less cache.  Both produce the same results.
+ */
+extern void m68k_set_compact_dispatch(m68ki_cpu_core *m68k, int enable);
+
+/* Enable idle loop skipping, or disable it if read_ok is NULL.  (Gens)
+ * read_ok is called for each address an idle loop reads that has a
+ * read handler.  See cpu_idle_t.
+ */
+extern void m68k_set_idle_skip(m68ki_cpu_core *m68k, int (*read_ok)(m68ki_cpu_core *m68k, unsigned int address));
+
+/* Report a write to 68K RAM.  (Gens) */
+INLINE void m68k_bcache_write(m68ki_cpu_core *m68k, unsigned int address)
+{
+  if (m68k->bcache && m68k->bcache->ram_code[(address >> 8) & 0xff])
+    m68k_bcache_flush_ram(m68k);
+}
+
 /* Set the IPL0-IPL2 pins on the CPU (IRQ).
  * A transition from < 7 to 7 will cause a non-maskable interrupt (NMI).
  * Setting IRQ to 0 will clear an interrupt request.
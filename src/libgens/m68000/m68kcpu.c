@@ -34,6 +34,7 @@ static const char copyright_notice[] =
 /* ======================================================================== */
 
 #include <setjmp.h>
+#include <string.h>
 #include "m68kconf.h"
 #include "m68kcpu.h"
 #include "m68kops.h"
@@ -682,6 +683,439 @@ static int m68k_translate( m68ki_cpu_core *m68k, unsigned int *address )
 	return TRUE;
 }
 
+/* Attach or detach the decoded block cache (Gens) */
+void m68k_set_bcache(m68ki_cpu_core *m68k, m68k_bcache *bcache, unsigned char *ram)
+{
+	m68k->bcache = bcache;
+	if (bcache)
+	{
+		bcache->ram = ram;
+		m68k_bcache_flush(m68k);
+	}
+}
+
+/* Enable or disable the compact opcode table (Gens) */
+void m68k_set_compact_dispatch(m68ki_cpu_core *m68k, int enable)
+{
+	m68k->compact_dispatch = !!enable;
+}
+
+/* Enable or disable idle loop skipping (Gens) */
+void m68k_set_idle_skip(m68ki_cpu_core *m68k, int (*read_ok)(m68ki_cpu_core *m68k, unsigned int address))
+{
+	m68k->poll.read_ok = read_ok;
+	m68k->poll.pc = 0xFFFFFFFF;
+	m68k->poll.detected = M68K_IDLE_NO;
+}
+
+/* Invalidate all cached blocks (Gens) */
+void m68k_bcache_flush(m68ki_cpu_core *m68k)
+{
+	m68k_bcache *bc = m68k->bcache;
+	if (!bc)
+		return;
+
+	bc->rom_gen++;
+	m68k_bcache_flush_ram(m68k);
+}
+
+/* Invalidate all cached blocks in 68K RAM (Gens) */
+void m68k_bcache_flush_ram(m68ki_cpu_core *m68k)
+{
+	m68k_bcache *bc = m68k->bcache;
+	if (!bc)
+		return;
+
+	bc->ram_gen++;
+	bc->flushes++;
+	memset(bc->ram_code, 0, sizeof(bc->ram_code));
+}
+
+/* Look up the cached block for the current PC.
+ * Returns the block if it's valid; otherwise, NULL.
+ * The block slot is returned in *slot so it can be recorded. (Gens)
+ */
+INLINE m68k_bcache_block *m68ki_bcache_lookup(m68ki_cpu_core *m68k, m68k_bcache_block **slot)
+{
+	m68k_bcache *bc = m68k->bcache;
+	m68k_bcache_block *blk = &bc->block[(REG_PC >> 1) & (M68K_BCACHE_BLOCKS - 1)];
+
+	*slot = blk;
+	if (blk->pc != REG_PC || blk->count == 0)
+		return NULL;
+	if (blk->gen != (blk->ram ? bc->ram_gen : bc->rom_gen))
+		return NULL;
+	return blk;
+}
+
+/* Replay a cached block.
+ * Instructions are run as long as the PC matches the recorded trace,
+ * there are cycles left, and no blocks have been invalidated. (Gens)
+ */
+INLINE void m68ki_bcache_replay(m68ki_cpu_core *m68k, const m68k_bcache_block *blk)
+{
+	const m68k_bcache_op *op = blk->op;
+	const m68k_bcache_op *const end = op + blk->count;
+	const uint flushes = m68k->bcache->flushes;
+
+	for (;;)
+	{
+		/* Skip the opcode fetch */
+		m68k->ir = op->ir;
+		REG_PC += 2;
+		op->handler(m68k);
+		m68k->remaining_cycles -= op->cycles;
+
+		/* Trace m68k_exception, if necessary */
+		m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+
+		if (++op == end || m68k->remaining_cycles <= 0 ||
+		    REG_PC != op->pc || m68k->bcache->flushes != flushes)
+			break;
+
+		/* Next instruction in the block */
+		m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
+		REG_PPC = REG_PC;
+	}
+}
+
+/* Check a memory read done by an idle loop.
+ * size is 1, 2, or 4 bytes.  Memory without a read handler is RAM
+ * or ROM; anything else has to be checked by the host.  (Gens)
+ */
+static int m68ki_idle_read_ok(m68ki_cpu_core *m68k, uint address, uint size)
+{
+	const cpu_memory_map *map;
+
+	address &= 0xFFFFFF;
+	if (size > 1 && (address & 1))
+		return 0;
+
+	map = &m68k->memory_map[(address >> 16) & 0xff];
+	if ((size == 1 ? map->read8 : map->read16) && !m68k->poll.read_ok(m68k, address))
+		return 0;
+	if (size == 4)
+		return m68ki_idle_read_ok(m68k, address + 2, 2);
+	return 1;
+}
+
+/* Check an idle loop instruction's effective address.
+ * pc points to the ea's extension words, and is updated past them.
+ * Only modes without side effects and with a fixed address are allowed:
+ * Dn, (An), (d16,An), (xxx).W, (xxx).L, (d16,PC), and #imm if imm is set.
+ * Memory reads must be allowed by m68ki_idle_read_ok().  (Gens)
+ */
+static int m68ki_idle_ea_ok(m68ki_cpu_core *m68k, uint *pc, uint ea, uint size, int imm)
+{
+	uint address;
+
+	switch ((ea >> 3) & 7)
+	{
+		case 0:	/* Dn */
+			return 1;
+		case 2:	/* (An) */
+			return m68ki_idle_read_ok(m68k, REG_A[ea & 7], size);
+		case 5:	/* (d16,An) */
+			address = REG_A[ea & 7] + MAKE_INT_16(m68k_read_immediate_16(m68k, *pc));
+			*pc += 2;
+			return m68ki_idle_read_ok(m68k, address, size);
+		case 7:
+			break;
+		default: /* An, (An)+, -(An), (d8,An,Xn) */
+			return 0;
+	}
+
+	switch (ea & 7)
+	{
+		case 0:	/* (xxx).W */
+			address = MAKE_INT_16(m68k_read_immediate_16(m68k, *pc));
+			*pc += 2;
+			return m68ki_idle_read_ok(m68k, address, size);
+		case 1:	/* (xxx).L */
+			address = m68k_read_immediate_32(m68k, *pc);
+			*pc += 4;
+			return m68ki_idle_read_ok(m68k, address, size);
+		case 2:	/* (d16,PC): read through the fetch base, like the immediates */
+			*pc += 2;
+			return 1;
+		case 4:	/* #imm */
+			*pc += (size == 4 ? 4 : 2);
+			return imm;
+		default: /* (d8,PC,Xn) */
+			return 0;
+	}
+}
+
+/* Check if the code at pc is an idle loop.
+ * An idle loop is a short run of instructions that only read memory and
+ * set data registers and flags, followed by a branch back to pc.
+ * Returns the address of the branch, or 0xFFFFFFFF if it isn't one.  (Gens)
+ */
+static uint m68ki_idle_loop_check(m68ki_cpu_core *m68k, uint pc)
+{
+	static const uint8 move_size[4] = {0, 1, 4, 2};
+	const uint end = pc + M68K_IDLE_LOOP_SIZE;
+	const uint start = pc;
+
+	while (pc < end)
+	{
+		const uint ir = m68k_read_immediate_16(m68k, pc);
+		const uint size = 1 << ((ir >> 6) & 3);	/* for size field 0-2 */
+		const uint opmode = (ir >> 6) & 7;
+		const uint op = pc;
+		uint target;
+
+		pc += 2;
+		switch (ir >> 12)
+		{
+			case 0x0:
+				if ((ir & 0xFF00) == 0x0C00 && size != 8)
+				{
+					/* CMPI #imm,<ea> */
+					pc += (size == 4 ? 4 : 2);
+					if (!m68ki_idle_ea_ok(m68k, &pc, ir, size, 0))
+						return 0xFFFFFFFF;
+				}
+				else if ((ir & 0xFF38) == 0x0200 && size != 8)
+				{
+					/* ANDI #imm,Dn */
+					pc += (size == 4 ? 4 : 2);
+				}
+				else if ((ir & 0xFFC0) == 0x0800)
+				{
+					/* BTST #n,<ea> */
+					pc += 2;
+					if (!m68ki_idle_ea_ok(m68k, &pc, ir, 1, 0))
+						return 0xFFFFFFFF;
+				}
+				else if ((ir & 0xF1C0) == 0x0100 && (ir & 0x38) != 0x08)
+				{
+					/* BTST Dn,<ea> (not MOVEP) */
+					if (!m68ki_idle_ea_ok(m68k, &pc, ir, ((ir & 0x38) ? 1 : 4), 1))
+						return 0xFFFFFFFF;
+				}
+				else
+					return 0xFFFFFFFF;
+				break;
+
+			case 0x1: case 0x2: case 0x3:
+				/* MOVE <ea>,Dn */
+				if ((ir & 0x01C0) != 0 ||
+				    !m68ki_idle_ea_ok(m68k, &pc, ir, move_size[ir >> 12], 1))
+					return 0xFFFFFFFF;
+				break;
+
+			case 0x4:
+				if (ir == 0x4E71)
+					break;	/* NOP */
+				/* TST <ea> */
+				if ((ir & 0xFF00) != 0x4A00 || size == 8 ||
+				    !m68ki_idle_ea_ok(m68k, &pc, ir, size, 0))
+					return 0xFFFFFFFF;
+				break;
+
+			case 0x6:
+				/* Bcc or BRA back to the start of the loop. (not BSR) */
+				if ((ir & 0x0F00) == 0x0100)
+					return 0xFFFFFFFF;
+				if (ir & 0xFF)
+					target = pc + MAKE_INT_8(ir);
+				else
+					target = pc + MAKE_INT_16(m68k_read_immediate_16(m68k, pc));
+				return (target == start ? op : 0xFFFFFFFF);
+
+			case 0xB:
+				/* CMP <ea>,Dn; CMPA <ea>,An (not EOR or CMPM) */
+				if (opmode < 3)
+				{
+					if (!m68ki_idle_ea_ok(m68k, &pc, ir, 1 << opmode, 1))
+						return 0xFFFFFFFF;
+				}
+				else if (opmode == 3 || opmode == 7)
+				{
+					if (!m68ki_idle_ea_ok(m68k, &pc, ir, (opmode == 3 ? 2 : 4), 1))
+						return 0xFFFFFFFF;
+				}
+				else
+					return 0xFFFFFFFF;
+				break;
+
+			case 0xC:
+				/* AND <ea>,Dn */
+				if (opmode >= 3 || !m68ki_idle_ea_ok(m68k, &pc, ir, 1 << opmode, 1))
+					return 0xFFFFFFFF;
+				break;
+
+			default:
+				return 0xFFFFFFFF;
+		}
+	}
+
+	return 0xFFFFFFFF;
+}
+
+/* Idle loop detection (Gens)
+ * Called at the start of an instruction after a backward branch or jump.
+ * Once an idle loop has run one full iteration from the same registers
+ * that it started the previous one with, and none of its reads can change
+ * until the end of the timeslice, every remaining iteration does exactly
+ * the same thing.  Those iterations are skipped by using up their cycles.
+ * The final partial iteration is still run normally.
+ */
+static void m68ki_idle_check(m68ki_cpu_core *m68k)
+{
+	cpu_idle_t *const poll = &m68k->poll;
+	const uint pc = REG_PC;
+	int cycles;
+
+	if (pc != poll->pc || REG_PPC != poll->branch)
+	{
+		/* New loop candidate.
+		 * Any other backward branch, including one from an
+		 * exception handler, ends the previous candidate. */
+		poll->pc = pc;
+		poll->branch = REG_PPC;
+		poll->detected = (REG_PPC - pc < M68K_IDLE_LOOP_SIZE ? M68K_IDLE_LOOP : M68K_IDLE_NO);
+		return;
+	}
+	if (poll->detected == M68K_IDLE_NO)
+		return;
+
+	/* The reads are checked every iteration, since the registers
+	 * used to address them may have changed. */
+	if (m68k->t1_flag || m68ki_idle_loop_check(m68k, pc) != poll->branch)
+	{
+		poll->detected = M68K_IDLE_NO;
+		return;
+	}
+
+	if (poll->detected == M68K_IDLE_ITER &&
+	    !memcmp(poll->dar, REG_DA, sizeof(poll->dar)) &&
+	    poll->sr == m68ki_get_sr(m68k))
+	{
+		/* Nothing changed in the last iteration. */
+		cycles = (int)poll->cycle - m68k->remaining_cycles;
+		if (cycles > 0 && m68k->remaining_cycles > cycles)
+		{
+			const int skip = ((m68k->remaining_cycles - 1) / cycles) * cycles;
+			m68k->remaining_cycles -= skip;
+			poll->skipped += skip;
+		}
+		poll->cycle = m68k->remaining_cycles;
+		return;
+	}
+
+	/* Save the registers at the start of this iteration. */
+	memcpy(poll->dar, REG_DA, sizeof(poll->dar));
+	poll->sr = m68ki_get_sr(m68k);
+	poll->cycle = m68k->remaining_cycles;
+	poll->detected = M68K_IDLE_ITER;
+}
+
+/* Read an instruction and call its handler.
+ * The handler and its base cycle count are looked up in the compact
+ * opcode table if it's enabled.  They're returned in *op so the
+ * instruction can be added to the block cache.  (Gens)
+ */
+INLINE void m68ki_dispatch(m68ki_cpu_core *m68k, m68k_bcache_op *op)
+{
+	op->pc = REG_PC;
+	op->ir = m68k->ir = m68ki_read_imm_16(m68k);
+	if (m68k->compact_dispatch)
+	{
+		const m68ki_opcode_handler *h = &m68ki_opcode_handlers[m68ki_opcode_index[m68k->ir]];
+		op->handler = h->handler;
+		op->cycles = h->cycles;
+	}
+	else
+	{
+		op->handler = m68ki_instruction_jump_table[m68k->ir];
+		op->cycles = m68k->cyc_instruction[m68k->ir];
+	}
+	op->handler(m68k);
+	m68k->remaining_cycles -= op->cycles;
+}
+
+/* Run the cached block for the current PC, if there is one.
+ * Cached blocks are replayed, or run as host code if they were translated.
+ * On a miss, the instruction at the PC is added to the block being
+ * recorded in *rec, or a new block is started for it.
+ * Returns 1 if a cached block was run.  (Gens)
+ */
+INLINE int m68ki_bcache_enter(m68ki_cpu_core *m68k, m68k_bcache_block **rec, uint *rec_flushes)
+{
+	m68k_bcache *const bc = m68k->bcache;
+	m68k_bcache_block *blk, *slot;
+	uint ram;
+
+	blk = m68ki_bcache_lookup(m68k, &slot);
+	if (blk)
+	{
+		*rec = NULL;
+
+		/* Translate hot blocks outside of RAM */
+		if (bc->jit && !blk->code && !blk->ram && ++blk->hits == M68K_JIT_HOT)
+			m68ki_jit_compile(m68k, blk);
+
+		/* Trace is only handled by the interpreter.
+		 * Translated blocks exit if an instruction sets T1. */
+		if (blk->code && !m68k->t1_flag)
+		{
+			if (bc->lockstep)
+				m68ki_jit_lockstep(m68k, blk);
+			else
+				blk->code(m68k);
+		}
+		else
+			m68ki_bcache_replay(m68k, blk);
+		return 1;
+	}
+
+	ram = (m68k->memory_map[(REG_PC >> 16) & 0xff].base == bc->ram);
+	if (*rec && (*rec)->ram != ram)
+		*rec = NULL;
+	if (!*rec)
+	{
+		/* Start a new block */
+		blk = slot;
+		blk->pc = REG_PC;
+		blk->ram = ram;
+		blk->gen = (ram ? bc->ram_gen : bc->rom_gen);
+		blk->count = 0;
+		blk->hits = 0;
+		blk->code = NULL;
+		*rec = blk;
+		*rec_flushes = bc->flushes;
+	}
+	return 0;
+}
+
+/* Add an instruction that was just run to the block being recorded.
+ * Recording stops when the PC leaves sequential flow, the block is
+ * full, or the instruction invalidated any cached blocks.  (Gens)
+ */
+INLINE void m68ki_bcache_record(m68ki_cpu_core *m68k, m68k_bcache_block **rec, uint rec_flushes, const m68k_bcache_op *op)
+{
+	m68k_bcache *const bc = m68k->bcache;
+	m68k_bcache_block *const blk = *rec;
+
+	if (bc->flushes != rec_flushes)
+	{
+		/* The instruction invalidated the block being recorded */
+		*rec = NULL;
+		return;
+	}
+
+	blk->op[blk->count++] = *op;
+	if (blk->ram)
+		bc->ram_code[(op->pc >> 8) & 0xff] = 1;
+
+	/* 68000 instructions are at most 10 bytes long.
+	 * Anything else is a branch, jump, or exception. */
+	if (blk->count == M68K_BCACHE_OPS || REG_PC <= op->pc || REG_PC - op->pc > 10)
+		*rec = NULL;
+}
+
 /* Execute some instructions until we use up cycles clock cycles */
 int m68k_execute(m68ki_cpu_core *m68k, unsigned int cycles)
 {
@@ -699,31 +1133,50 @@ int m68k_execute(m68ki_cpu_core *m68k, unsigned int cycles)
 	/* Set our pool of clock cycles available */
 	m68k->remaining_cycles = cycles;
 
+	/* Idle loops only last until the end of the timeslice (Gens) */
+	m68k->poll.pc = 0xFFFFFFFF;
+
 	/* See if interrupts came in */
 	m68ki_check_interrupts(m68k);
 
 	/* Make sure we're not stopped */
 	if(!m68k->stopped)
 	{
+		/* Block cache recording state (Gens) */
+		m68k_bcache_block *rec = NULL;
+		uint rec_flushes = 0;
+
 		/* Return point if we had an address error */
 		m68ki_set_address_error_trap(m68k); /* auto-disable (see m68kcpu.h) */
 
 		/* Main loop.  Keep going until we run out of clock cycles */
 		do
 		{
+			m68k_bcache_op op;
+
 			/* Set tracing accodring to T1. (T0 is done inside instruction) */
 			m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
 
+			/* Check for an idle loop after a backward branch (Gens) */
+			if (REG_PC <= REG_PPC && m68k->poll.read_ok)
+				m68ki_idle_check(m68k);
+
 			/* Record previous program counter */
 			REG_PPC = REG_PC;
 
+			/* Run a cached block if there is one (Gens) */
+			if (m68k->bcache && m68ki_bcache_enter(m68k, &rec, &rec_flushes))
+				continue;
+
 			/* Read an instruction and call its handler */
-			m68k->ir = m68ki_read_imm_16(m68k);
-			m68ki_instruction_jump_table[m68k->ir](m68k);
-			m68k->remaining_cycles -= m68k->cyc_instruction[m68k->ir];
+			m68ki_dispatch(m68k, &op);
 
 			/* Trace m68k_exception, if necessary */
 			m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+
+			/* Add the instruction to the block being recorded (Gens) */
+			if (rec)
+				m68ki_bcache_record(m68k, &rec, rec_flushes, &op);
 		} while (m68k->remaining_cycles > 0);
 
 		/* set previous PC to current PC for the next entry into the loop */
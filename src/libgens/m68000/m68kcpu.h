@@ -602,6 +602,12 @@ extern const UINT32   m68ki_shift_32_table[];
 extern const UINT8    m68ki_exception_cycle_table[][256];
 extern const UINT8    m68ki_ea_idx_cycle_table[];
 
+/* Translate a cached block into host code (m68kjit.c) */
+extern int m68ki_jit_compile(m68ki_cpu_core *m68k, m68k_bcache_block *blk);
+
+/* Run a translated block and check it against the interpreter (m68kjit.c) */
+extern void m68ki_jit_lockstep(m68ki_cpu_core *m68k, const m68k_bcache_block *blk);
+
 /* Read data immediately after the program counter */
 INLINE UINT32 m68ki_read_imm_16(m68ki_cpu_core *m68k);
 INLINE UINT32 m68ki_read_imm_32(m68ki_cpu_core *m68k);
@@ -850,7 +856,11 @@ INLINE void m68ki_write_8_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint v
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write8) (*temp->write8)(temp->param,address&0xFFFFFF,value);
-	else WRITE_BYTE(temp->base, (address) & 0xffff, value);
+	else
+	{
+		WRITE_BYTE(temp->base, (address) & 0xffff, value);
+		m68k_bcache_write(m68k, address);
+	}
 }
 
 INLINE void m68ki_write_16_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint value)
@@ -859,7 +869,11 @@ INLINE void m68ki_write_16_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,address&0xFFFFFF,value);
-	else *(uint16 *)(temp->base + ((address) & 0xffff)) = value;
+	else
+	{
+		*(uint16 *)(temp->base + ((address) & 0xffff)) = value;
+		m68k_bcache_write(m68k, address);
+	}
 }
 
 INLINE void m68ki_write_32_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint value)
@@ -868,11 +882,19 @@ INLINE void m68ki_write_32_fc(m68ki_cpu_core *m68k, uint address, uint fc, uint
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,address&0xFFFFFF,value>>16);
-	else *(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+	else
+	{
+		*(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+		m68k_bcache_write(m68k, address);
+	}
 
 	temp = &m68k->memory_map[((address + 2)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,(address+2)&0xFFFFFF,value&0xffff);
-	else *(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+	else
+	{
+		*(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+		m68k_bcache_write(m68k, address + 2);
+	}
 }
 
 /* Special call to simulate undocumented 68k behavior when move.l with a
@@ -886,11 +908,19 @@ INLINE void m68ki_write_32_pd_fc(m68ki_cpu_core *m68k, UINT32 address, UINT32 fc
 
 	temp = &m68k->memory_map[((address + 2)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,(address+2)&0xFFFFFF,value&0xffff);
-	else *(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+	else
+	{
+		*(uint16 *)(temp->base + ((address + 2) & 0xffff)) = value;
+		m68k_bcache_write(m68k, address + 2);
+	}
 
 	temp = &m68k->memory_map[((address)>>16)&0xff];
 	if (temp->write16) (*temp->write16)(temp->param,(address)&0xFFFFFF,value>>16);
-	else *(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+	else
+	{
+		*(uint16 *)(temp->base + ((address) & 0xffff)) = value >> 16;
+		m68k_bcache_write(m68k, address);
+	}
 }
 
 
@@ -1566,6 +1596,7 @@ INLINE void m68ki_exception_1010(m68ki_cpu_core *m68k)
 {
 	UINT32 sr;
 
+	m68k->illegal_cnt++;
 	sr = m68ki_init_exception(m68k);
 	m68ki_stack_frame_0000(m68k, REG_PPC, sr, EXCEPTION_1010);
 	m68ki_jump_vector(m68k, EXCEPTION_1010);
@@ -1579,6 +1610,7 @@ INLINE void m68ki_exception_1111(m68ki_cpu_core *m68k)
 {
 	UINT32 sr;
 
+	m68k->illegal_cnt++;
 	sr = m68ki_init_exception(m68k);
 	m68ki_stack_frame_0000(m68k, REG_PPC, sr, EXCEPTION_1111);
 	m68ki_jump_vector(m68k, EXCEPTION_1111);
@@ -1592,6 +1624,7 @@ INLINE void m68ki_exception_illegal(m68ki_cpu_core *m68k)
 {
 	UINT32 sr;
 
+	m68k->illegal_cnt++;
 	sr = m68ki_init_exception(m68k);
 
 #if M68K_EMULATE_ADDRESS_ERROR
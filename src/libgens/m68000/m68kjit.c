@@ -0,0 +1,871 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * m68kjit.c: 68000 dynamic recompiler. (x86-64)                           *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Hot blocks from the decoded block cache are translated into
+ * host code. Each instruction becomes a direct call to its Musashi
+ * opcode handler, followed by the cycle accounting and the same
+ * exit checks the block cache uses when replaying a block:
+ * - Cycles are subtracted after each instruction, so the odometer
+ *   is exact whenever a handler accesses the hardware.
+ * - The block is left if the timeslice is used up, if the PC
+ *   doesn't match the next instruction (branch, exception), or
+ *   if the memory map was changed.
+ * - The block is also left if an instruction that writes to SR
+ *   set T1, so the interpreter can trace the next instruction.
+ * Blocks in RAM are never translated, since they may be modified.
+ *
+ * Common 32-bit ALU instructions that only use registers (MOVEQ,
+ * ADD, SUB, CMP, logic ops, etc.) are translated into host code
+ * instead of calling their handlers, with the flags computed the
+ * same way. They can't branch or access memory, so only the cycle
+ * check is needed after them.
+ *
+ * The code buffer is never writable and executable at the same time.
+ * It's mapped read/write. After a block is translated, only the pages
+ * it was written to are switched to read/execute; the unused part of
+ * the buffer stays writable. The first page of the next block may
+ * already contain code, so it's switched back to read/write first.
+ *
+ * In lockstep mode, each translated block is checked against the
+ * interpreter. The block is run with its memory accesses logged, then
+ * the CPU state is rolled back and the block is run again with the
+ * interpreter's own opcode fetch and decoding. The second run doesn't
+ * access memory: reads return the logged values, writes are compared
+ * with the logged writes, and any changes the hardware made to the CPU
+ * during an access (stalls and interrupt lines) are applied again.
+ * The final states must be identical.
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "m68kconf.h"
+#include "m68kcpu.h"
+#include "m68kops.h"
+
+#if defined(__x86_64__) && !defined(_WIN32)
+/* System V AMD64 ABI. */
+#define M68K_JIT_X86_64 1
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef M68K_JIT_X86_64
+
+/* Size of the code buffer. */
+#define JIT_CODE_SIZE (2*1024*1024)
+
+/* Maximum size of a translated instruction and block. */
+#define JIT_MAX_OP_SIZE    192
+#define JIT_MAX_BLOCK_SIZE (32 + (M68K_BCACHE_OPS * JIT_MAX_OP_SIZE))
+
+/* Offsets in m68ki_cpu_core. */
+#define OFS_PC     offsetof(m68ki_cpu_core, pc)
+#define OFS_PPC    offsetof(m68ki_cpu_core, ppc)
+#define OFS_IR     offsetof(m68ki_cpu_core, ir)
+#define OFS_REM    offsetof(m68ki_cpu_core, remaining_cycles)
+#define OFS_BCACHE offsetof(m68ki_cpu_core, bcache)
+#define OFS_T1     offsetof(m68ki_cpu_core, t1_flag)
+#define OFS_D(n)   (offsetof(m68ki_cpu_core, dar) + ((n) * 4))
+#define OFS_A(n)   (offsetof(m68ki_cpu_core, dar) + (((n) + 8) * 4))
+#define OFS_X      offsetof(m68ki_cpu_core, x_flag)
+#define OFS_N      offsetof(m68ki_cpu_core, n_flag)
+#define OFS_Z      offsetof(m68ki_cpu_core, not_z_flag)
+#define OFS_V      offsetof(m68ki_cpu_core, v_flag)
+#define OFS_C      offsetof(m68ki_cpu_core, c_flag)
+
+/* x86 registers used by translated instructions. */
+#define EAX 0
+#define ECX 1
+#define EDX 2
+#define ESI 6
+#define EDI 7
+
+/* x86 opcodes: op r/m32, r32 */
+#define X86_ADD 0x01
+#define X86_OR  0x09
+#define X86_AND 0x21
+#define X86_SUB 0x29
+#define X86_XOR 0x31
+#define X86_MOV 0x89
+
+static inline void emit8(unsigned char **p, uint v)
+{
+	*(*p)++ = (unsigned char)v;
+}
+
+static inline void emit32(unsigned char **p, uint v)
+{
+	memcpy(*p, &v, 4);
+	*p += 4;
+}
+
+static inline void emit64(unsigned char **p, unsigned long long v)
+{
+	memcpy(*p, &v, 8);
+	*p += 8;
+}
+
+/* op dword [rbx+disp32], ...  (modrm: mod=10, rm=rbx) */
+static inline void emit_rbx_disp(unsigned char **p, uint opc, uint reg, uint disp)
+{
+	emit8(p, opc);
+	emit8(p, 0x83 | (reg << 3));
+	emit32(p, disp);
+}
+
+/* jcc rel32; returns the location of rel32 for fixups. */
+static inline unsigned char *emit_jcc(unsigned char **p, uint cc)
+{
+	unsigned char *rel;
+	emit8(p, 0x0F);
+	emit8(p, 0x80 | cc);
+	rel = *p;
+	emit32(p, 0);
+	return rel;
+}
+
+#define CC_NE 0x5
+#define CC_LE 0xE
+
+/* mov r32, dword [rbx+disp32] */
+static inline void emit_load(unsigned char **p, uint reg, uint disp)
+{
+	emit_rbx_disp(p, 0x8B, reg, disp);
+}
+
+/* mov dword [rbx+disp32], r32 */
+static inline void emit_store(unsigned char **p, uint reg, uint disp)
+{
+	emit_rbx_disp(p, 0x89, reg, disp);
+}
+
+/* mov dword [rbx+disp32], imm32 */
+static inline void emit_store_imm(unsigned char **p, uint disp, uint imm)
+{
+	emit_rbx_disp(p, 0xC7, 0, disp);
+	emit32(p, imm);
+}
+
+/* op dst, src (32-bit registers) */
+static inline void emit_rr(unsigned char **p, uint opc, uint dst, uint src)
+{
+	emit8(p, opc);
+	emit8(p, 0xC0 | (src << 3) | dst);
+}
+
+/* mov r32, imm32 */
+static inline void emit_mov_imm(unsigned char **p, uint reg, uint imm)
+{
+	emit8(p, 0xB8 | reg);
+	emit32(p, imm);
+}
+
+/* shr r32, imm8 */
+static inline void emit_shr(unsigned char **p, uint reg, uint n)
+{
+	emit8(p, 0xC1);
+	emit8(p, 0xE8 | reg);
+	emit8(p, n);
+}
+
+/* not r32 */
+static inline void emit_not(unsigned char **p, uint reg)
+{
+	emit8(p, 0xF7);
+	emit8(p, 0xD0 | reg);
+}
+
+/* Instructions translated into host code instead of calling
+ * their handlers.  They only use data and address registers,
+ * so they can't access memory, branch, or take an exception. */
+enum
+{
+	JIT_OP_MOVEQ,
+	JIT_OP_MOVE,
+	JIT_OP_TST,
+	JIT_OP_CLR,
+	JIT_OP_NOT,
+	JIT_OP_AND,
+	JIT_OP_OR,
+	JIT_OP_EOR,
+	JIT_OP_ADD,
+	JIT_OP_ADDQ,
+	JIT_OP_SUB,
+	JIT_OP_SUBQ,
+	JIT_OP_CMP,
+	JIT_OP_ADDQ_A,
+	JIT_OP_SUBQ_A
+};
+
+static const struct
+{
+	uint16 mask;
+	uint16 match;
+	uint type;
+} m68ki_jit_native_ops[] =
+{
+	{0xF100, 0x7000, JIT_OP_MOVEQ},		/* moveq #imm, Dx */
+	{0xF1F8, 0x2000, JIT_OP_MOVE},		/* move.l Dy, Dx */
+	{0xFFF8, 0x4A80, JIT_OP_TST},		/* tst.l Dy */
+	{0xFFF8, 0x4280, JIT_OP_CLR},		/* clr.l Dy */
+	{0xFFF8, 0x4680, JIT_OP_NOT},		/* not.l Dy */
+	{0xF1F8, 0xC080, JIT_OP_AND},		/* and.l Dy, Dx */
+	{0xF1F8, 0x8080, JIT_OP_OR},		/* or.l Dy, Dx */
+	{0xF1F8, 0xB180, JIT_OP_EOR},		/* eor.l Dx, Dy */
+	{0xF1F8, 0xD080, JIT_OP_ADD},		/* add.l Dy, Dx */
+	{0xF1F8, 0x5080, JIT_OP_ADDQ},		/* addq.l #q, Dy */
+	{0xF1F8, 0x9080, JIT_OP_SUB},		/* sub.l Dy, Dx */
+	{0xF1F8, 0x5180, JIT_OP_SUBQ},		/* subq.l #q, Dy */
+	{0xF1F8, 0xB080, JIT_OP_CMP},		/* cmp.l Dy, Dx */
+	{0xF1F8, 0x5048, JIT_OP_ADDQ_A},	/* addq.w #q, Ay */
+	{0xF1F8, 0x5088, JIT_OP_ADDQ_A},	/* addq.l #q, Ay */
+	{0xF1F8, 0x5148, JIT_OP_SUBQ_A},	/* subq.w #q, Ay */
+	{0xF1F8, 0x5188, JIT_OP_SUBQ_A},	/* subq.l #q, Ay */
+};
+
+/* N and Z for the result in eax; V and C are cleared.
+ * Same as the interpreter's NFLAG_32() and the result. */
+static void emit_flags_logic(unsigned char **p)
+{
+	emit_store(p, EAX, OFS_Z);
+	emit_rr(p, X86_MOV, ECX, EAX);
+	emit_shr(p, ECX, 24);
+	emit_store(p, ECX, OFS_N);
+	emit_store_imm(p, OFS_V, 0);
+	emit_store_imm(p, OFS_C, 0);
+}
+
+/* Flags for eax = edx + ecx or eax = edx - ecx.
+ * Same as the interpreter's VFLAG_ADD_32()/CFLAG_ADD_32() and
+ * VFLAG_SUB_32()/CFLAG_SUB_32().  Clobbers all three registers.
+ * X is only set if x is nonzero (not for CMP). */
+static void emit_flags_arith(unsigned char **p, int sub, int x)
+{
+	emit_store(p, EAX, OFS_Z);
+	emit_rr(p, X86_MOV, ESI, EAX);
+	emit_shr(p, ESI, 24);
+	emit_store(p, ESI, OFS_N);
+
+	/* V = ((S^R) & (D^R)) >> 24 for ADD; ((S^D) & (R^D)) >> 24 for SUB */
+	emit_rr(p, X86_MOV, ESI, ECX);
+	emit_rr(p, X86_XOR, ESI, sub ? EDX : EAX);
+	emit_rr(p, X86_MOV, EDI, sub ? EAX : EDX);
+	emit_rr(p, X86_XOR, EDI, sub ? EDX : EAX);
+	emit_rr(p, X86_AND, ESI, EDI);
+	emit_shr(p, ESI, 24);
+	emit_store(p, ESI, OFS_V);
+
+	/* C = ((S & D) | (~R & (S | D))) >> 23 for ADD;
+	 * ((S & R) | (~D & (S | R))) >> 23 for SUB */
+	emit_rr(p, X86_MOV, ESI, ECX);
+	emit_rr(p, X86_AND, ESI, sub ? EAX : EDX);
+	emit_rr(p, X86_OR, ECX, sub ? EAX : EDX);
+	emit_not(p, sub ? EDX : EAX);
+	emit_rr(p, X86_AND, ECX, sub ? EDX : EAX);
+	emit_rr(p, X86_OR, ESI, ECX);
+	emit_shr(p, ESI, 23);
+	emit_store(p, ESI, OFS_C);
+	if (x)
+		emit_store(p, ESI, OFS_X);
+}
+
+/* Translate an instruction into host code, if it's supported.
+ * Returns 1 if it was translated; 0 if the handler has to be called. */
+static int m68ki_jit_native(unsigned char **p, const m68k_bcache_op *op)
+{
+	const uint ir = op->ir;
+	const uint rx = (ir >> 9) & 7;
+	const uint ry = ir & 7;
+	const uint q = ((rx - 1) & 7) + 1;
+	uint i;
+
+	for (i = 0; i < sizeof(m68ki_jit_native_ops) / sizeof(m68ki_jit_native_ops[0]); i++)
+	{
+		/* Make sure the opcode is decoded the same way as the interpreter. */
+		if ((ir & m68ki_jit_native_ops[i].mask) == m68ki_jit_native_ops[i].match &&
+		    op->handler == m68ki_instruction_jump_table[m68ki_jit_native_ops[i].match])
+			break;
+	}
+	if (i == sizeof(m68ki_jit_native_ops) / sizeof(m68ki_jit_native_ops[0]))
+		return 0;
+
+	switch (m68ki_jit_native_ops[i].type)
+	{
+		case JIT_OP_MOVEQ:
+			emit_mov_imm(p, EAX, (uint)(int)(signed char)(ir & 0xFF));
+			emit_store(p, EAX, OFS_D(rx));
+			emit_flags_logic(p);
+			break;
+		case JIT_OP_MOVE:
+			emit_load(p, EAX, OFS_D(ry));
+			emit_store(p, EAX, OFS_D(rx));
+			emit_flags_logic(p);
+			break;
+		case JIT_OP_TST:
+			emit_load(p, EAX, OFS_D(ry));
+			emit_flags_logic(p);
+			break;
+		case JIT_OP_CLR:
+			emit_mov_imm(p, EAX, 0);
+			emit_store(p, EAX, OFS_D(ry));
+			emit_flags_logic(p);
+			break;
+		case JIT_OP_NOT:
+			emit_load(p, EAX, OFS_D(ry));
+			emit_not(p, EAX);
+			emit_store(p, EAX, OFS_D(ry));
+			emit_flags_logic(p);
+			break;
+		case JIT_OP_AND:
+		case JIT_OP_OR:
+			emit_load(p, EAX, OFS_D(rx));
+			emit_load(p, ECX, OFS_D(ry));
+			emit_rr(p, (m68ki_jit_native_ops[i].type == JIT_OP_AND ? X86_AND : X86_OR), EAX, ECX);
+			emit_store(p, EAX, OFS_D(rx));
+			emit_flags_logic(p);
+			break;
+		case JIT_OP_EOR:
+			emit_load(p, EAX, OFS_D(ry));
+			emit_load(p, ECX, OFS_D(rx));
+			emit_rr(p, X86_XOR, EAX, ECX);
+			emit_store(p, EAX, OFS_D(ry));
+			emit_flags_logic(p);
+			break;
+		case JIT_OP_ADD:
+		case JIT_OP_SUB:
+		case JIT_OP_CMP:
+			/* S = Dy, D = Dx */
+			emit_load(p, ECX, OFS_D(ry));
+			emit_load(p, EDX, OFS_D(rx));
+			emit_rr(p, X86_MOV, EAX, EDX);
+			emit_rr(p, (m68ki_jit_native_ops[i].type == JIT_OP_ADD ? X86_ADD : X86_SUB), EAX, ECX);
+			if (m68ki_jit_native_ops[i].type != JIT_OP_CMP)
+				emit_store(p, EAX, OFS_D(rx));
+			emit_flags_arith(p, (m68ki_jit_native_ops[i].type != JIT_OP_ADD),
+					 (m68ki_jit_native_ops[i].type != JIT_OP_CMP));
+			break;
+		case JIT_OP_ADDQ:
+		case JIT_OP_SUBQ:
+			/* S = q, D = Dy */
+			emit_mov_imm(p, ECX, q);
+			emit_load(p, EDX, OFS_D(ry));
+			emit_rr(p, X86_MOV, EAX, EDX);
+			emit_rr(p, (m68ki_jit_native_ops[i].type == JIT_OP_ADDQ ? X86_ADD : X86_SUB), EAX, ECX);
+			emit_store(p, EAX, OFS_D(ry));
+			emit_flags_arith(p, (m68ki_jit_native_ops[i].type == JIT_OP_SUBQ), 1);
+			break;
+		case JIT_OP_ADDQ_A:
+		case JIT_OP_SUBQ_A:
+			/* No flags are changed. */
+			emit_load(p, EAX, OFS_A(ry));
+			emit_mov_imm(p, ECX, q);
+			emit_rr(p, (m68ki_jit_native_ops[i].type == JIT_OP_ADDQ_A ? X86_ADD : X86_SUB), EAX, ECX);
+			emit_store(p, EAX, OFS_A(ry));
+			break;
+	}
+	return 1;
+}
+
+/* Instructions that can set T1 without changing the PC:
+ * ORI/ANDI/EORI to SR, MOVE to SR, STOP, and RTE. */
+static inline int m68ki_jit_writes_sr(uint ir)
+{
+	return (ir == 0x007C || ir == 0x027C || ir == 0x0A7C ||
+		(ir & 0xFFC0) == 0x46C0 || ir == 0x4E72 || ir == 0x4E73);
+}
+
+/* Make the pages containing [start, end) writable or executable. */
+static int m68ki_jit_protect(m68k_bcache *bc, uint start, uint end, int exec)
+{
+	static uint page_mask = 0;
+	if (page_mask == 0)
+		page_mask = (uint)sysconf(_SC_PAGESIZE) - 1;
+
+	start &= ~page_mask;
+	end = (end + page_mask) & ~page_mask;
+	if (end > bc->code_size)
+		end = bc->code_size;
+	return mprotect(bc->code_buf + start, end - start,
+			PROT_READ | (exec ? PROT_EXEC : PROT_WRITE));
+}
+
+/* Clear all translated blocks. */
+static void m68ki_jit_reset(m68k_bcache *bc)
+{
+	int i;
+	for (i = 0; i < M68K_BCACHE_BLOCKS; i++)
+		bc->block[i].code = NULL;
+	bc->code_used = 0;
+}
+
+/* Maximum number of memory accesses logged per block in lockstep mode. */
+#define JIT_LOCKSTEP_LOG 256
+
+enum
+{
+	JIT_READ_8,
+	JIT_READ_16,
+	JIT_WRITE_8,
+	JIT_WRITE_16
+};
+
+typedef struct
+{
+	uint type;		/* JIT_READ_* or JIT_WRITE_* */
+	uint address;
+	uint value;		/* value read or written */
+
+	/* CPU state changed by the hardware during the access */
+	int cycles;		/* cycles taken from the timeslice */
+	uint int_level;
+	uint virq_state;
+	uint nmi_pending;
+	uint rom_gen;
+} m68ki_jit_access;
+
+struct _m68k_jit_lockstep
+{
+	m68ki_cpu_core *m68k;
+	cpu_memory_map map[256];	/* CPU memory map while a block is checked */
+	m68ki_jit_access log[JIT_LOCKSTEP_LOG];
+	uint count;		/* number of logged accesses */
+	uint pos;		/* next access to replay */
+	uint replay;		/* replaying the log */
+	uint overflow;		/* too many accesses to check the block */
+	uint diverged;		/* replayed accesses don't match the log */
+
+	m68ki_cpu_core before;	/* state before the block */
+	m68ki_cpu_core after;	/* state after the translated block */
+
+	unsigned int checked;
+	unsigned int mismatches;
+};
+
+/* Handle a memory access while a block is checked.
+ * The memory map in the CPU is replaced with one that calls this
+ * function for all accesses.  The bank is part of the address. */
+static uint m68ki_jit_access_mem(m68k_jit_lockstep *ls, uint type, uint address, uint value)
+{
+	m68ki_cpu_core *const m68k = ls->m68k;
+	const cpu_memory_map *const map = &ls->map[(address >> 16) & 0xff];
+	m68ki_jit_access *a;
+	int cycles;
+
+	if (ls->replay)
+	{
+		if (ls->pos == ls->count)
+		{
+			ls->diverged = 1;
+			return 0;
+		}
+		a = &ls->log[ls->pos++];
+		if (a->type != type || a->address != address ||
+		    (type >= JIT_WRITE_8 && a->value != value))
+			ls->diverged = 1;
+
+		m68k->remaining_cycles -= a->cycles;
+		m68k->int_level = a->int_level;
+		m68k->virq_state = a->virq_state;
+		m68k->nmi_pending = a->nmi_pending;
+		m68k->bcache->rom_gen = a->rom_gen;
+		return a->value;
+	}
+
+	cycles = m68k->remaining_cycles;
+	switch (type)
+	{
+		case JIT_READ_8:
+			value = (map->read8 ? map->read8(map->param, address)
+				: READ_BYTE(map->base, address & 0xffff));
+			break;
+		case JIT_READ_16:
+			value = (map->read16 ? map->read16(map->param, address)
+				: *(uint16 *)(map->base + (address & 0xffff)));
+			break;
+		case JIT_WRITE_8:
+			if (map->write8)
+				map->write8(map->param, address, value);
+			else
+			{
+				WRITE_BYTE(map->base, address & 0xffff, value);
+				m68k_bcache_write(m68k, address);
+			}
+			break;
+		case JIT_WRITE_16:
+			if (map->write16)
+				map->write16(map->param, address, value);
+			else
+			{
+				*(uint16 *)(map->base + (address & 0xffff)) = value;
+				m68k_bcache_write(m68k, address);
+			}
+			break;
+	}
+
+	if (ls->count == JIT_LOCKSTEP_LOG)
+	{
+		ls->overflow = 1;
+		return value;
+	}
+	a = &ls->log[ls->count++];
+	a->type = type;
+	a->address = address;
+	a->value = value;
+	a->cycles = cycles - m68k->remaining_cycles;
+	a->int_level = m68k->int_level;
+	a->virq_state = m68k->virq_state;
+	a->nmi_pending = m68k->nmi_pending;
+	a->rom_gen = m68k->bcache->rom_gen;
+	return value;
+}
+
+static uint m68ki_jit_read_8(void *param, uint address)
+{
+	return m68ki_jit_access_mem((m68k_jit_lockstep*)param, JIT_READ_8, address, 0);
+}
+
+static uint m68ki_jit_read_16(void *param, uint address)
+{
+	return m68ki_jit_access_mem((m68k_jit_lockstep*)param, JIT_READ_16, address, 0);
+}
+
+static void m68ki_jit_write_8(void *param, uint address, uint data)
+{
+	m68ki_jit_access_mem((m68k_jit_lockstep*)param, JIT_WRITE_8, address, data);
+}
+
+static void m68ki_jit_write_16(void *param, uint address, uint data)
+{
+	m68ki_jit_access_mem((m68k_jit_lockstep*)param, JIT_WRITE_16, address, data);
+}
+
+/* Get the logging version of a memory map entry.
+ * Opcodes and immediate data are still fetched from the base. */
+static void m68ki_jit_log_map(m68k_jit_lockstep *ls, const cpu_memory_map *map, cpu_memory_map *log_map)
+{
+	log_map->param = ls;
+	log_map->base = map->base;
+	log_map->read8 = m68ki_jit_read_8;
+	log_map->read16 = m68ki_jit_read_16;
+	log_map->write8 = m68ki_jit_write_8;
+	log_map->write16 = m68ki_jit_write_16;
+}
+
+/* Run a block with the interpreter, exiting at the same points
+ * as the translated block.  Opcodes are fetched and decoded again
+ * instead of using the decoded block. */
+static void m68ki_jit_interpret(m68ki_cpu_core *m68k, const m68k_bcache_block *blk)
+{
+	uint i;
+
+	for (i = 0; i < blk->count; i++)
+	{
+		const uint ir = m68ki_read_imm_16(m68k);
+		m68k->ir = ir;
+		m68ki_instruction_jump_table[ir](m68k);
+		m68k->remaining_cycles -= m68k->cyc_instruction[ir];
+
+		if (i + 1 == blk->count)
+			break;
+		if (m68ki_jit_writes_sr(ir) && m68k->t1_flag)
+			break;
+		if (m68k->remaining_cycles <= 0 || REG_PC != blk->op[i + 1].pc ||
+		    m68k->bcache->rom_gen != blk->gen)
+			break;
+		REG_PPC = REG_PC;
+	}
+}
+
+#endif /* M68K_JIT_X86_64 */
+
+void m68ki_jit_lockstep(m68ki_cpu_core *m68k, const m68k_bcache_block *blk)
+{
+#ifdef M68K_JIT_X86_64
+	m68k_bcache *const bc = m68k->bcache;
+	m68k_jit_lockstep *const ls = bc->lockstep;
+	const uint rom_gen = bc->rom_gen;
+	cpu_memory_map log_map;
+	uint i, map_changed = 0, after_rom_gen;
+
+	/* Run the translated block with the memory accesses logged. */
+	ls->m68k = m68k;
+	ls->count = 0;
+	ls->overflow = 0;
+	ls->replay = 0;
+	memcpy(ls->map, m68k->memory_map, sizeof(ls->map));
+	for (i = 0; i < 256; i++)
+		m68ki_jit_log_map(ls, &ls->map[i], &m68k->memory_map[i]);
+	ls->before = *m68k;
+
+	blk->code(m68k);
+
+	/* Restore the memory map.  Entries that were changed by the
+	 * hardware (bank switching) are kept, but the accesses made
+	 * through the new entries weren't logged. */
+	for (i = 0; i < 256; i++)
+	{
+		m68ki_jit_log_map(ls, &ls->map[i], &log_map);
+		if (memcmp(&m68k->memory_map[i], &log_map, sizeof(log_map)) != 0)
+			map_changed = 1;
+		else
+			m68k->memory_map[i] = ls->map[i];
+	}
+	if (map_changed || ls->overflow)
+		return;
+	ls->after = *m68k;
+	after_rom_gen = bc->rom_gen;
+
+	/* Run the block again with the interpreter, replaying the log.
+	 * The saved state includes the logging memory map. */
+	*m68k = ls->before;
+	bc->rom_gen = rom_gen;
+	ls->pos = 0;
+	ls->diverged = 0;
+	ls->replay = 1;
+	m68ki_jit_interpret(m68k, blk);
+	ls->replay = 0;
+	if (ls->pos != ls->count)
+		ls->diverged = 1;
+
+	/* Compare the registers, flags, and cycle counters. */
+	ls->checked++;
+	if (ls->diverged || memcmp(&m68k->dar, &ls->after.dar,
+			sizeof(*m68k) - offsetof(m68ki_cpu_core, dar)) != 0)
+	{
+		ls->mismatches++;
+	}
+
+	/* Keep the translated block's results, since the
+	 * hardware saw its memory accesses. */
+	*m68k = ls->after;
+	bc->rom_gen = after_rom_gen;
+#else
+	(void)m68k;
+	(void)blk;
+#endif
+}
+
+int m68k_jit_available(void)
+{
+#ifdef M68K_JIT_X86_64
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+int m68k_set_jit(m68ki_cpu_core *m68k, int enable)
+{
+	m68k_bcache *bc = m68k->bcache;
+	if (!bc)
+		return (enable ? -EINVAL : 0);
+
+	if (!enable)
+	{
+		bc->jit = 0;
+#ifdef M68K_JIT_X86_64
+		m68ki_jit_reset(bc);
+#endif
+		return 0;
+	}
+
+#ifdef M68K_JIT_X86_64
+	if (!bc->code_buf)
+	{
+		void *buf = mmap(NULL, JIT_CODE_SIZE, PROT_READ | PROT_WRITE,
+				 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (buf == MAP_FAILED)
+			return -errno;
+		bc->code_buf = (unsigned char*)buf;
+		bc->code_size = JIT_CODE_SIZE;
+	}
+
+	m68ki_jit_reset(bc);
+	bc->jit = 1;
+	return 0;
+#else
+	return -ENOSYS;
+#endif
+}
+
+int m68k_set_jit_lockstep(m68k_bcache *bc, int enable)
+{
+	if (!enable)
+	{
+		free(bc->lockstep);
+		bc->lockstep = NULL;
+		return 0;
+	}
+
+#ifdef M68K_JIT_X86_64
+	if (!bc->lockstep)
+	{
+		bc->lockstep = (m68k_jit_lockstep*)calloc(1, sizeof(*bc->lockstep));
+		if (!bc->lockstep)
+			return -ENOMEM;
+	}
+	return 0;
+#else
+	return -ENOSYS;
+#endif
+}
+
+void m68k_jit_lockstep_stats(const m68k_bcache *bc, unsigned int *checked, unsigned int *mismatches)
+{
+#ifdef M68K_JIT_X86_64
+	if (bc->lockstep)
+	{
+		*checked = bc->lockstep->checked;
+		*mismatches = bc->lockstep->mismatches;
+		return;
+	}
+#endif
+	*checked = 0;
+	*mismatches = 0;
+}
+
+void m68k_jit_free(m68k_bcache *bc)
+{
+#ifdef M68K_JIT_X86_64
+	m68ki_jit_reset(bc);
+	if (bc->code_buf)
+		munmap(bc->code_buf, bc->code_size);
+#endif
+	free(bc->lockstep);
+	bc->lockstep = NULL;
+	bc->jit = 0;
+	bc->code_buf = NULL;
+	bc->code_size = 0;
+	bc->code_used = 0;
+}
+
+int m68ki_jit_compile(m68ki_cpu_core *m68k, m68k_bcache_block *blk)
+{
+#ifdef M68K_JIT_X86_64
+	m68k_bcache *bc = m68k->bcache;
+	unsigned char *exits[M68K_BCACHE_OPS * 4];
+	unsigned char *start, *p;
+	uint i, n_exits = 0;
+
+	if (!bc->code_buf || blk->ram || blk->count == 0)
+		return -1;
+
+	/* Start over if the code buffer is full. */
+	if (bc->code_size - bc->code_used < JIT_MAX_BLOCK_SIZE)
+		m68ki_jit_reset(bc);
+
+	if (m68ki_jit_protect(bc, bc->code_used, bc->code_used + JIT_MAX_BLOCK_SIZE, 0) != 0)
+		return -1;
+	start = p = bc->code_buf + bc->code_used;
+
+	/* push rbx; mov rbx, rdi */
+	emit8(&p, 0x53);
+	emit8(&p, 0x48); emit8(&p, 0x89); emit8(&p, 0xFB);
+
+	for (i = 0; i < blk->count; i++)
+	{
+		const m68k_bcache_op *op = &blk->op[i];
+		int native;
+
+		/* mov dword [rbx+ir], op->ir */
+		emit_store_imm(&p, OFS_IR, op->ir);
+		/* add dword [rbx+pc], 2 */
+		emit_rbx_disp(&p, 0x83, 0, OFS_PC);
+		emit8(&p, 2);
+		native = m68ki_jit_native(&p, op);
+		if (!native)
+		{
+			/* mov rdi, rbx; mov rax, handler; call rax */
+			emit8(&p, 0x48); emit8(&p, 0x89); emit8(&p, 0xDF);
+			emit8(&p, 0x48); emit8(&p, 0xB8);
+			emit64(&p, (unsigned long long)(size_t)op->handler);
+			emit8(&p, 0xFF); emit8(&p, 0xD0);
+		}
+		/* sub dword [rbx+remaining_cycles], op->cycles */
+		emit_rbx_disp(&p, 0x81, 5, OFS_REM);
+		emit32(&p, op->cycles);
+
+		if (i + 1 == blk->count)
+			break;
+
+		/* jle exit (uses the flags from the subtraction) */
+		exits[n_exits++] = emit_jcc(&p, CC_LE);
+
+		if (native)
+		{
+			/* The PC and the memory map can't have changed.
+			 * mov dword [rbx+ppc], next pc */
+			emit_store_imm(&p, OFS_PPC, op[1].pc);
+			continue;
+		}
+
+		if (m68ki_jit_writes_sr(op->ir))
+		{
+			/* cmp dword [rbx+t1_flag], 0; jne exit */
+			emit_rbx_disp(&p, 0x83, 7, OFS_T1);
+			emit8(&p, 0);
+			exits[n_exits++] = emit_jcc(&p, CC_NE);
+		}
+
+		/* cmp dword [rbx+pc], next pc; jne exit */
+		emit_rbx_disp(&p, 0x81, 7, OFS_PC);
+		emit32(&p, op[1].pc);
+		exits[n_exits++] = emit_jcc(&p, CC_NE);
+		/* mov rax, [rbx+bcache]; cmp dword [rax+rom_gen], gen; jne exit */
+		emit8(&p, 0x48);
+		emit_rbx_disp(&p, 0x8B, 0, OFS_BCACHE);
+		emit8(&p, 0x81); emit8(&p, 0xB8);
+		emit32(&p, offsetof(m68k_bcache, rom_gen));
+		emit32(&p, blk->gen);
+		exits[n_exits++] = emit_jcc(&p, CC_NE);
+		/* mov dword [rbx+ppc], next pc */
+		emit_store_imm(&p, OFS_PPC, op[1].pc);
+	}
+
+	/* exit: pop rbx; ret */
+	for (i = 0; i < n_exits; i++)
+	{
+		uint rel = (uint)(p - (exits[i] + 4));
+		memcpy(exits[i], &rel, 4);
+	}
+	emit8(&p, 0x5B);
+	emit8(&p, 0xC3);
+
+	/* Keep blocks 16-byte aligned. */
+	bc->code_used = ((uint)(p - bc->code_buf) + 15) & ~15;
+	if (m68ki_jit_protect(bc, (uint)(start - bc->code_buf), bc->code_used, 1) != 0)
+	{
+		/* None of the translated blocks can be run. */
+		m68ki_jit_reset(bc);
+		bc->jit = 0;
+		return -1;
+	}
+	blk->code = (void (*)(m68ki_cpu_core*))(void*)start;
+	return 0;
+#else
+	(void)m68k;
+	(void)blk;
+	return -1;
+#endif
+}
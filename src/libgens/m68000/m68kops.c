@@ -32208,6 +32208,7 @@ static void m68k_op_unpk_16_mm(m68ki_cpu_core *m68k)
 
 void  (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
 unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
+uint16 m68ki_opcode_index[0x10000]; /* compact opcode table (Gens) */
 
 /* This is used to generate the opcode handler jump table */
 typedef struct
@@ -34195,6 +34196,25 @@ static const opcode_handler_struct m68k_opcode_handler_table[] =
 	{0, 0, 0, {0, 0, 0, 0, 0}}
 };
 
+#define NUM_OPCODE_HANDLERS (sizeof(m68k_opcode_handler_table) / sizeof(m68k_opcode_handler_table[0]))
+
+/* Handlers for the compact opcode table.  (Gens)
+ * Handler i+1 is m68k_opcode_handler_table[i]; the terminator's
+ * slot is used for the illegal instruction handler at index 0.
+ */
+m68ki_opcode_handler m68ki_opcode_handlers[NUM_OPCODE_HANDLERS];
+
+/* Set an opcode's handler in the jump, cycle, and compact tables */
+static void m68ki_set_opcode(int instr, const opcode_handler_struct *ostruct)
+{
+	int k;
+
+	m68ki_instruction_jump_table[instr] = ostruct->opcode_handler;
+	for(k=0;k<NUM_CPU_TYPES;k++)
+		m68ki_cycles[k][instr] = ostruct->cycles[k];
+	m68ki_opcode_index[instr] = (uint16)(ostruct - m68k_opcode_handler_table + 1);
+}
+
 
 /* Build the opcode handler jump table */
 void m68ki_build_opcode_table(void)
@@ -34211,6 +34231,16 @@ void m68ki_build_opcode_table(void)
 		m68ki_instruction_jump_table[i] = m68k_op_illegal;
 		for(k=0;k<NUM_CPU_TYPES;k++)
 			m68ki_cycles[k][i] = 0;
+		m68ki_opcode_index[i] = 0;
+	}
+
+	/* The cycles for illegal instructions are added by the exception */
+	m68ki_opcode_handlers[0].handler = m68k_op_illegal;
+	m68ki_opcode_handlers[0].cycles = 0;
+	for(i = 1; i < (int)NUM_OPCODE_HANDLERS; i++)
+	{
+		m68ki_opcode_handlers[i].handler = m68k_opcode_handler_table[i-1].opcode_handler;
+		m68ki_opcode_handlers[i].cycles = m68k_opcode_handler_table[i-1].cycles[0];
 	}
 
 	ostruct = m68k_opcode_handler_table;
@@ -34220,9 +34250,7 @@ void m68ki_build_opcode_table(void)
 		{
 			if((i & ostruct->mask) == ostruct->match)
 			{
-				m68ki_instruction_jump_table[i] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][i] = ostruct->cycles[k];
+				m68ki_set_opcode(i, ostruct);
 			}
 		}
 		ostruct++;
@@ -34231,9 +34259,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0xff;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
+			m68ki_set_opcode(ostruct->match | i, ostruct);
 		}
 		ostruct++;
 	}
@@ -34244,9 +34270,7 @@ void m68ki_build_opcode_table(void)
 			for(j = 0;j < 8;j++)
 			{
 				instr = ostruct->match | (i << 9) | j;
-				m68ki_instruction_jump_table[instr] = ostruct->opcode_handler;
-				for(k=0;k<NUM_CPU_TYPES;k++)
-					m68ki_cycles[k][instr] = ostruct->cycles[k];
+				m68ki_set_opcode(instr, ostruct);
 			}
 		}
 		ostruct++;
@@ -34255,9 +34279,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x0f;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
+			m68ki_set_opcode(ostruct->match | i, ostruct);
 		}
 		ostruct++;
 	}
@@ -34265,9 +34287,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x07;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | (i << 9)] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | (i << 9)] = ostruct->cycles[k];
+			m68ki_set_opcode(ostruct->match | (i << 9), ostruct);
 		}
 		ostruct++;
 	}
@@ -34275,17 +34295,13 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x07;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
-			for(k=0;k<NUM_CPU_TYPES;k++)
-				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
+			m68ki_set_opcode(ostruct->match | i, ostruct);
 		}
 		ostruct++;
 	}
 	while(ostruct->mask == 0xffff)
 	{
-		m68ki_instruction_jump_table[ostruct->match] = ostruct->opcode_handler;
-		for(k=0;k<NUM_CPU_TYPES;k++)
-			m68ki_cycles[k][ostruct->match] = ostruct->cycles[k];
+		m68ki_set_opcode(ostruct->match, ostruct);
 		ostruct++;
 	}
 }
@@ -12,6 +12,20 @@ void m68ki_build_opcode_table(void);
 extern void (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *m68k); /* opcode handler jump table */
 extern unsigned char m68ki_cycles[][0x10000];
 
+/* Compact opcode table (Gens)
+ * Each opcode maps to a 16-bit index into a small array of handlers,
+ * with the 68000 cycle count stored next to each handler.
+ * Index 0 is the illegal instruction handler.
+ */
+typedef struct
+{
+	void (*handler)(m68ki_cpu_core *m68k); /* handler function */
+	uint cycles;                           /* 68000 cycles */
+} m68ki_opcode_handler;
+
+extern uint16 m68ki_opcode_index[0x10000];
+extern m68ki_opcode_handler m68ki_opcode_handlers[];
+
 
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
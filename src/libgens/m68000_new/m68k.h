@@ -30,6 +30,10 @@
 #ifndef M68K__HEADER
 #define M68K__HEADER
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 
 /* ======================================================================== */
 /* ============================= CONFIGURATION ============================ */
@@ -342,6 +346,52 @@ unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cp
 unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_type);
 
 
+/* ======================================================================== */
+/* ============================ GENS EXTENSIONS =========================== */
+/* ======================================================================== */
+
+/* 68k memory map structure.
+ * The address space is split into 256 banks of 64 KB.
+ * Banks without read or write handlers are accessed directly through base.
+ * NOTE: base must point to host-endian 16-bit words.
+ * The memory access functions are implemented in m68kgens.c.
+ */
+typedef struct
+{
+  void *param;
+  unsigned char *base;                             /* memory-based access (ROM, RAM) */
+  unsigned int (*read8)(void *param, unsigned int address);               /* I/O byte read access */
+  unsigned int (*read16)(void *param, unsigned int address);              /* I/O word read access */
+  void (*write8)(void *param, unsigned int address, unsigned int data);  /* I/O byte write access */
+  void (*write16)(void *param, unsigned int address, unsigned int data); /* I/O word write access */
+} cpu_memory_map;
+
+/* Use a cpu context as the current context, without copying it.
+ * The context must be m68k_context_size() bytes, and must remain valid
+ * while it's in use. If context is NULL, a default context is used.
+ */
+void m68k_set_context_ptr(void* context);
+
+/* Get the memory map (256 banks) of a cpu context.
+ * If context is NULL, the currently running CPU context will be used.
+ */
+cpu_memory_map *m68k_get_memory_map(void* context);
+
+/* Get the number of illegal, A-line, and F-line exceptions taken.
+ * If context is NULL, the currently running CPU context will be used.
+ */
+unsigned int m68k_get_illegal_count(void* context);
+
+/* Use up cycles from the current timeslice, e.g. for bus stalls. */
+void m68k_use_cycles(int cycles);
+
+/* Set the IPL0-IPL2 pins without checking for interrupts.
+ * Unlike m68k_set_irq(), the interrupt isn't taken until the next call to
+ * m68k_set_irq() or the next change to the SR.
+ */
+void m68k_set_irq_delayed(unsigned int int_level);
+
+
 /* ======================================================================== */
 /* ============================== MAME STUFF ============================== */
 /* ======================================================================== */
@@ -355,4 +405,8 @@ unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_
 /* ============================== END OF FILE ============================= */
 /* ======================================================================== */
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* M68K__HEADER */
@@ -63,6 +63,17 @@
 /* ============================= CONFIGURATION ============================ */
 /* ======================================================================== */
 
+/* Gens: The current CPU context and the timeslice are kept in globals,
+ * which are made thread-local so emulation contexts can run on different
+ * threads.
+ */
+#ifdef _MSC_VER
+#define M68K_THREAD_LOCAL __declspec(thread)
+#else
+#define M68K_THREAD_LOCAL __thread
+#endif
+
+
 /* Turn ON if you want to use the following M68K variants */
 #define M68K_EMULATE_010            OPT_OFF
 #define M68K_EMULATE_EC020          OPT_OFF
@@ -73,7 +84,8 @@
  * and m68k_read_pcrelative_xx() for PC-relative addressing.
  * If off, all read requests from the CPU will be redirected to m68k_read_xx()
  */
-#define M68K_SEPARATE_READS         OPT_OFF
+/* Gens: Instructions are fetched directly from memory_map[].base. */
+#define M68K_SEPARATE_READS         OPT_ON
 
 /* If ON, the CPU will call m68k_write_32_pd() when it executes move.l with a
  * predecrement destination EA mode instead of m68k_write_32().
@@ -87,7 +99,8 @@
  * If off, all interrupts will be autovectored and all interrupt requests will
  * auto-clear when the interrupt is serviced.
  */
-#define M68K_EMULATE_INT_ACK        OPT_OFF
+/* Gens: Needed to acknowledge VDP interrupts. */
+#define M68K_EMULATE_INT_ACK        OPT_ON
 #define M68K_INT_ACK_CALLBACK(A)    vdp_68k_irq_ack(A)
 
 
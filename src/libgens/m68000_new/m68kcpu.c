@@ -45,10 +45,10 @@
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
-int  m68ki_initial_cycles;
-int  m68ki_remaining_cycles = 0;                     /* Number of clocks remaining */
-uint m68ki_tracing = 0;
-uint m68ki_address_space;
+M68K_THREAD_LOCAL int  m68ki_initial_cycles;
+M68K_THREAD_LOCAL int  m68ki_remaining_cycles = 0;                     /* Number of clocks remaining */
+M68K_THREAD_LOCAL uint m68ki_tracing = 0;
+M68K_THREAD_LOCAL uint m68ki_address_space;
 
 #ifdef M68K_LOG_ENABLE
 char* m68ki_cpu_names[9] =
@@ -66,7 +66,9 @@ char* m68ki_cpu_names[9] =
 #endif /* M68K_LOG_ENABLE */
 
 /* The CPU core */
-m68ki_cpu_core m68ki_cpu = {0};
+/* Gens: m68ki_cpu refers to the current context. (see m68k_set_context_ptr()) */
+static m68ki_cpu_core m68ki_cpu_default = {0};
+M68K_THREAD_LOCAL m68ki_cpu_core *m68ki_cpu_p = &m68ki_cpu_default;
 
 #if M68K_EMULATE_ADDRESS_ERROR
 jmp_buf m68ki_aerr_trap;
@@ -816,6 +818,12 @@ void m68k_set_context(void* src)
 	if(src) m68ki_cpu = *(m68ki_cpu_core*)src;
 }
 
+/* Gens: Use a context without copying it. */
+void m68k_set_context_ptr(void* context)
+{
+	m68ki_cpu_p = (context != NULL) ? (m68ki_cpu_core*)context : &m68ki_cpu_default;
+}
+
 
 
 /* ======================================================================== */
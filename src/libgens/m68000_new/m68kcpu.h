@@ -798,17 +798,6 @@
 /* =============================== PROTOTYPES ============================= */
 /* ======================================================================== */
 
-/* 68k memory map structure */
-typedef struct 
-{
-  void *param;
-  unsigned char *base;                             /* memory-based access (ROM, RAM) */
-  unsigned int (*read8)(void *param, unsigned int address);               /* I/O byte read access */
-  unsigned int (*read16)(void *param, unsigned int address);              /* I/O word read access */
-  void (*write8)(void *param, unsigned int address, unsigned int data);  /* I/O byte write access */
-  void (*write16)(void *param, unsigned int address, unsigned int data); /* I/O word write access */
-} cpu_memory_map;
-
 /* 68k idle loop detection */
 typedef struct
 {
@@ -854,6 +843,7 @@ typedef struct
 	uint sr_mask;      /* Implemented status register bits */
 	uint instr_mode;   /* Stores whether we are in instruction mode or group 0/1 exception mode */
 	uint run_mode;     /* Stores whether we are processing a reset, bus error, address error, or something else */
+	uint illegal_cnt;  /* Illegal, A-line, and F-line exceptions taken (Gens) */
 
 	/* Clocks required for instructions / exceptions */
 	uint cyc_bcc_notake_b;
@@ -879,14 +869,15 @@ typedef struct
 } m68ki_cpu_core;
 
 
-extern m68ki_cpu_core m68ki_cpu;
-extern sint           m68ki_remaining_cycles;
-extern uint           m68ki_tracing;
+extern M68K_THREAD_LOCAL m68ki_cpu_core *m68ki_cpu_p;
+#define m68ki_cpu (*m68ki_cpu_p)
+extern M68K_THREAD_LOCAL sint m68ki_remaining_cycles;
+extern M68K_THREAD_LOCAL uint m68ki_tracing;
 extern uint8          m68ki_shift_8_table[];
 extern uint16         m68ki_shift_16_table[];
 extern uint           m68ki_shift_32_table[];
 extern uint8          m68ki_exception_cycle_table[][256];
-extern uint           m68ki_address_space;
+extern M68K_THREAD_LOCAL uint m68ki_address_space;
 extern uint8          m68ki_ea_idx_cycle_table[];
 
 extern uint           m68ki_aerr_address;
@@ -1828,6 +1819,7 @@ INLINE void m68ki_exception_1010(void)
 #endif
 
 	sr = m68ki_init_exception();
+	m68ki_cpu.illegal_cnt++;
 	m68ki_stack_frame_0000(REG_PPC, sr, EXCEPTION_1010);
 	m68ki_jump_vector(EXCEPTION_1010);
 
@@ -1847,6 +1839,7 @@ INLINE void m68ki_exception_1111(void)
 #endif
 
 	sr = m68ki_init_exception();
+	m68ki_cpu.illegal_cnt++;
 	m68ki_stack_frame_0000(REG_PPC, sr, EXCEPTION_1111);
 	m68ki_jump_vector(EXCEPTION_1111);
 
@@ -1864,6 +1857,7 @@ INLINE void m68ki_exception_illegal(void)
 				 m68ki_disassemble_quick(ADDRESS_68K(REG_PPC))));
 
 	sr = m68ki_init_exception();
+	m68ki_cpu.illegal_cnt++;
 
 	#if M68K_EMULATE_ADDRESS_ERROR == OPT_ON
 	if(CPU_TYPE_IS_000(CPU_TYPE))
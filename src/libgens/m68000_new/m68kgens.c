@@ -0,0 +1,163 @@
+/***************************************************************************
+ * libgens: Gens Emulation Library.                                        *
+ * m68kgens.c: Musashi 3.4 memory access and Gens extensions.              *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Musashi 3.4 calls external functions for all memory accesses.
+ * These are implemented using the same 64 KB bank memory map as
+ * the default 68000 core, so M68K_Mem's banking works unchanged:
+ * - Instructions and PC-relative operands are read from base.
+ * - Data is accessed through the bank's handlers if it has any,
+ *   or through base if it doesn't.
+ */
+
+#include "m68kcpu.h"
+#include "libcompat/byteorder.h"
+
+/* Banks contain host-endian 16-bit words. */
+#if SYS_IS_LIL_ENDIAN
+#define BANK_BYTE(address)	(((address) & 0xffff) ^ 1)
+#else
+#define BANK_BYTE(address)	((address) & 0xffff)
+#endif
+#define BANK_WORD(address)	((address) & 0xffff)
+
+#define BANK(address)	(&m68ki_cpu.memory_map[((address) >> 16) & 0xff])
+
+/* ------------------------------ Instructions ---------------------------- */
+
+unsigned int m68k_read_immediate_16(unsigned int address)
+{
+	return *(uint16*)(BANK(address)->base + BANK_WORD(address));
+}
+
+unsigned int m68k_read_immediate_32(unsigned int address)
+{
+	return (m68k_read_immediate_16(address) << 16) |
+		m68k_read_immediate_16(address + 2);
+}
+
+unsigned int m68k_read_pcrelative_8(unsigned int address)
+{
+	return BANK(address)->base[BANK_BYTE(address)];
+}
+
+unsigned int m68k_read_pcrelative_16(unsigned int address)
+{
+	return m68k_read_immediate_16(address);
+}
+
+unsigned int m68k_read_pcrelative_32(unsigned int address)
+{
+	return m68k_read_immediate_32(address);
+}
+
+unsigned int m68k_read_disassembler_8(unsigned int address)
+{
+	return m68k_read_pcrelative_8(address);
+}
+
+unsigned int m68k_read_disassembler_16(unsigned int address)
+{
+	return m68k_read_immediate_16(address);
+}
+
+unsigned int m68k_read_disassembler_32(unsigned int address)
+{
+	return m68k_read_immediate_32(address);
+}
+
+/* --------------------------------- Data --------------------------------- */
+
+unsigned int m68k_read_memory_8(unsigned int address)
+{
+	const cpu_memory_map *temp = BANK(address);
+	if (temp->read8)
+		return temp->read8(temp->param, address & 0xffffff);
+	return temp->base[BANK_BYTE(address)];
+}
+
+unsigned int m68k_read_memory_16(unsigned int address)
+{
+	const cpu_memory_map *temp = BANK(address);
+	if (temp->read16)
+		return temp->read16(temp->param, address & 0xffffff);
+	return *(uint16*)(temp->base + BANK_WORD(address));
+}
+
+unsigned int m68k_read_memory_32(unsigned int address)
+{
+	return (m68k_read_memory_16(address) << 16) |
+		m68k_read_memory_16(address + 2);
+}
+
+void m68k_write_memory_8(unsigned int address, unsigned int value)
+{
+	const cpu_memory_map *temp = BANK(address);
+	if (temp->write8)
+		temp->write8(temp->param, address & 0xffffff, value);
+	else
+		temp->base[BANK_BYTE(address)] = (unsigned char)value;
+}
+
+void m68k_write_memory_16(unsigned int address, unsigned int value)
+{
+	const cpu_memory_map *temp = BANK(address);
+	if (temp->write16)
+		temp->write16(temp->param, address & 0xffffff, value);
+	else
+		*(uint16*)(temp->base + BANK_WORD(address)) = (uint16)value;
+}
+
+void m68k_write_memory_32(unsigned int address, unsigned int value)
+{
+	m68k_write_memory_16(address, value >> 16);
+	m68k_write_memory_16(address + 2, value & 0xffff);
+}
+
+void m68k_write_memory_32_pd(unsigned int address, unsigned int value)
+{
+	m68k_write_memory_16(address + 2, value & 0xffff);
+	m68k_write_memory_16(address, value >> 16);
+}
+
+/* ---------------------------- Gens extensions --------------------------- */
+
+cpu_memory_map *m68k_get_memory_map(void* context)
+{
+	m68ki_cpu_core *cpu = (context != NULL) ? (m68ki_cpu_core*)context : &m68ki_cpu;
+	return cpu->memory_map;
+}
+
+unsigned int m68k_get_illegal_count(void* context)
+{
+	const m68ki_cpu_core *cpu = (context != NULL) ? (m68ki_cpu_core*)context : &m68ki_cpu;
+	return cpu->illegal_cnt;
+}
+
+void m68k_use_cycles(int cycles)
+{
+	USE_CYCLES(cycles);
+}
+
+void m68k_set_irq_delayed(unsigned int int_level)
+{
+	CPU_INT_LEVEL = int_level << 8;
+}
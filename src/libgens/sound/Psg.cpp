@@ -43,10 +43,6 @@
 
 // Sound Manager.
 #include "SoundMgr.hpp"
-#include "Vdp/Vdp.hpp"
-
-// TODO: Get rid of EmuContext.
-#include "EmuContext/EmuContext.hpp"
 
 /* Message logging. */
 #include "macros/log_msg.h"
@@ -82,6 +78,7 @@ PsgPrivate::PsgPrivate(Psg *q)
 	: q(q)
 	, writeLen(0)
 	, enabled(true)	// TODO: Make this customizable.
+	, soundMgr(nullptr)
 {
 	// TODO: Move this here?
 	// (It's currently initialized in the Psg constructors.)
@@ -408,6 +405,29 @@ void Psg::zomgRestore(const Zomg_PsgSave_t *state)
 	// TODO: Implement Game Gear stereo.
 }
 
+/**
+ * Copy the complete internal state of another PSG.
+ * Unlike ZOMG savestates, this includes the tone counters.
+ * @param other PSG to copy from.
+ */
+void Psg::copyStateFrom(const Psg &other)
+{
+	const PsgPrivate *const od = other.d;
+	d->curChan = od->curChan;
+	d->curReg = od->curReg;
+	memcpy(d->reg, od->reg, sizeof(d->reg));
+	memcpy(d->counter, od->counter, sizeof(d->counter));
+	memcpy(d->cntStep, od->cntStep, sizeof(d->cntStep));
+	memcpy(d->volume, od->volume, sizeof(d->volume));
+	d->lfsrMask = od->lfsrMask;
+	d->lfsr = od->lfsr;
+
+	// Lookup tables depend on the clock and sample rate.
+	memcpy(d->stepTable, od->stepTable, sizeof(d->stepTable));
+	memcpy(d->volumeTable, od->volumeTable, sizeof(d->volumeTable));
+	memcpy(d->noiseStepTable, od->noiseStepTable, sizeof(d->noiseStepTable));
+}
+
 /** Gens-specific code **/
 
 /**
@@ -419,22 +439,34 @@ void Psg::specialUpdate(void)
 		return;
 
 	// Update the sound buffer.
-	d->update(d->bufPtrL, d->bufPtrR, d->writeLen);
+	Profiler *const profiler = (d->soundMgr ? d->soundMgr->m_profiler : nullptr);
+	{
+		Profiler::Scope prof(profiler, Profiler::PROF_PSG);
+		d->update(d->bufPtrL, d->bufPtrR, d->writeLen);
+	}
+	if (profiler)
+		profiler->add(Profiler::CNT_PSG_SAMPLES, d->writeLen);
 	d->writeLen = 0;
 
-	// TODO: Don't use EmuContext here...
-	int line_num = 1;
-	EmuContext *context = EmuContext::Instance();
-	if (context != nullptr) {
-		line_num = (context->m_vdp->VDP_Lines.currentLine + 1);
-	}
+	if (!d->soundMgr)
+		return;
 
 	// Determine the new starting position.
-	int writePos = SoundMgr::GetWritePos(line_num);
+	const int writePos = d->soundMgr->nextWritePos();
 
 	// Update the PSG buffer pointers.
-	d->bufPtrL = &SoundMgr::ms_SegBufL[writePos];
-	d->bufPtrR = &SoundMgr::ms_SegBufR[writePos];
+	d->bufPtrL = &d->soundMgr->m_segBufL[writePos];
+	d->bufPtrR = &d->soundMgr->m_segBufR[writePos];
+}
+
+/**
+ * Set the Sound Manager that owns the output buffers.
+ * @param soundMgr Sound Manager. (May be nullptr.)
+ */
+void Psg::setSoundMgr(SoundMgr *soundMgr)
+{
+	d->soundMgr = soundMgr;
+	resetBufferPtrs();
 }
 
 /** PSG write length. **/
@@ -454,8 +486,13 @@ void Psg::clearWriteLen(void)
  */
 void Psg::resetBufferPtrs(void)
 {
-	d->bufPtrL = &SoundMgr::ms_SegBufL[0];
-	d->bufPtrR = &SoundMgr::ms_SegBufR[0];
+	if (d->soundMgr) {
+		d->bufPtrL = &d->soundMgr->m_segBufL[0];
+		d->bufPtrR = &d->soundMgr->m_segBufR[0];
+	} else {
+		d->bufPtrL = nullptr;
+		d->bufPtrR = nullptr;
+	}
 }
 
 // TODO: Eliminate the GSXv7 stuff.
@@ -34,6 +34,8 @@ struct _Zomg_PsgSave_t;
 
 namespace LibGens {
 
+class SoundMgr;
+
 class PsgPrivate;
 class Psg
 {
@@ -68,10 +70,23 @@ class Psg
 		/** ZOMG savestate functions. **/
 		void zomgSave(_Zomg_PsgSave_t *state);
 		void zomgRestore(const _Zomg_PsgSave_t *state);
+
+		/**
+		 * Copy the complete internal state of another PSG.
+		 * Unlike ZOMG savestates, this includes the tone counters.
+		 * @param other PSG to copy from.
+		 */
+		void copyStateFrom(const Psg &other);
 		
 		/** Gens-specific code. */
 		void specialUpdate(void);
 
+		/**
+		 * Set the Sound Manager that owns the output buffers.
+		 * @param soundMgr Sound Manager. (May be nullptr.)
+		 */
+		void setSoundMgr(SoundMgr *soundMgr);
+
 		/** FIXME: This sound mixing code needs to be totally redone. **/
 
 		// PSG write length.
@@ -117,6 +117,9 @@ class PsgPrivate
 		int writeLen;
 		bool enabled;
 
+		// Sound Manager that owns the output buffers.
+		SoundMgr *soundMgr;
+
 		// PSG buffer pointers.
 		// TODO: Figure out how to get rid of these!
 		int32_t *bufPtrL;
@@ -43,14 +43,15 @@
 #include "libcompat/aligned_malloc.h"
 
 #include "SoundMgr_p.hpp"
+
+// Needed for the current VDP line.
+#include "EmuContext/EmuContext.hpp"
+#include "Vdp/Vdp.hpp"
+
 namespace LibGens {
 
 /** SoundManagerPrivate **/
 
-// Audio settings.
-int SoundMgrPrivate::rate = 44100;
-bool SoundMgrPrivate::isPal = false;
-
 /**
  * Calculate the segment length.
  * @param rate Sound rate, in Hz.
@@ -79,28 +80,39 @@ int SoundMgrPrivate::CalcSegLength(int rate, bool isPal)
 
 /** SoundMgr **/
 
-// Segment buffer.
-// Stores up to 882 32-bit stereo samples.
-// (32-bit instead of 16-bit to handle oversaturation properly.)
-// TODO: Convert to interleaved stereo.
-// TODO: Make SoundMgr non-static and allocate this using aligned_malloc().
-int32_t ALIGN(16) SoundMgr::ms_SegBufL[MAX_SEGMENT_SIZE];
-int32_t ALIGN(16) SoundMgr::ms_SegBufR[MAX_SEGMENT_SIZE];
-
-// Audio ICs.
-Psg SoundMgr::ms_Psg;
-Ym2612 SoundMgr::ms_Ym2612;
+/**
+ * Initialize a Sound Manager.
+ * The PSG and YM2612 aren't initialized until reInit() is called.
+ * @param context Emulation context that owns this Sound Manager. (May be nullptr.)
+ */
+SoundMgr::SoundMgr(EmuContext *context)
+	: m_segBufL((int32_t*)aligned_malloc(16, MAX_SEGMENT_SIZE * sizeof(int32_t)))
+	, m_segBufR((int32_t*)aligned_malloc(16, MAX_SEGMENT_SIZE * sizeof(int32_t)))
+	, m_profiler(context ? context->profiler() : nullptr)
+	, m_context(context)
+	, m_rate(44100)
+	, m_isPal(false)
+	, m_segLength(0)
+{
+	memset(m_segBufL, 0x00, MAX_SEGMENT_SIZE * sizeof(int32_t));
+	memset(m_segBufR, 0x00, MAX_SEGMENT_SIZE * sizeof(int32_t));
+	memset(m_extrapol, 0x00, sizeof(m_extrapol));
 
-// Static variable initialization.
-int SoundMgr::ms_SegLength = 0;
+	// Audio ICs write to our segment buffers.
+	m_psg.setSoundMgr(this);
+	m_ym2612.setSoundMgr(this);
+}
 
-// Line extrapolation values. [312 + extra room to prevent overflows]
-// Index 0 == start; Index 1 == length
-unsigned int SoundMgr::ms_Extrapol[312+8][2];
+SoundMgr::~SoundMgr()
+{
+	aligned_free(m_segBufL);
+	aligned_free(m_segBufR);
+}
 
 void SoundMgr::Init(void)
 {
-	// TODO
+	// Initialize the YM2612 static tables.
+	Ym2612::Init();
 }
 
 void SoundMgr::End(void)
@@ -114,65 +126,79 @@ void SoundMgr::End(void)
  * @param isPal If true, system is PAL.
  * @param preserveState If true, save the PSG/YM state before reinitializing them.
  */
-void SoundMgr::ReInit(int rate, bool isPal, bool preserveState)
+void SoundMgr::reInit(int rate, bool isPal, bool preserveState)
 {
-	SoundMgrPrivate::rate = rate;
-	SoundMgrPrivate::isPal = isPal;
+	m_rate = rate;
+	m_isPal = isPal;
 
 	// Calculate the segment length.
-	ms_SegLength = SoundMgrPrivate::CalcSegLength(rate, isPal);
+	m_segLength = SoundMgrPrivate::CalcSegLength(rate, isPal);
 
 	// Build the sound extrapolation table.
 	const int lines = (isPal ? 312 : 262);
 	for (int i = 0; i < lines; i++) {
-		ms_Extrapol[i][0] = ((ms_SegLength * i) / lines);
-		ms_Extrapol[i][1] = (((ms_SegLength * (i+1)) / lines) - ms_Extrapol[i][0]);
+		m_extrapol[i][0] = ((m_segLength * i) / lines);
+		m_extrapol[i][1] = (((m_segLength * (i+1)) / lines) - m_extrapol[i][0]);
 	}
 	// Copy the last extrapolation value to 8 more lines.
 	// This may help at the end of the frame.
 	for (int i = lines; i < lines+8; i++) {
-		ms_Extrapol[i][0] = ms_Extrapol[lines-1][0];
-		ms_Extrapol[i][1] = ms_Extrapol[lines-1][1];
+		m_extrapol[i][0] = m_extrapol[lines-1][0];
+		m_extrapol[i][1] = m_extrapol[lines-1][1];
 	}
 
 	// Clear the segment buffers.
-	memset(ms_SegBufL, 0x00, sizeof(ms_SegBufL));
-	memset(ms_SegBufR, 0x00, sizeof(ms_SegBufR));
+	memset(m_segBufL, 0x00, MAX_SEGMENT_SIZE * sizeof(int32_t));
+	memset(m_segBufR, 0x00, MAX_SEGMENT_SIZE * sizeof(int32_t));
 
 	// If requested, save the PSG/YM state.
 	Zomg_PsgSave_t psgState;
 	Zomg_Ym2612Save_t ym2612State;
 	if (preserveState) {
-		ms_Psg.zomgSave(&psgState);
-		ms_Ym2612.zomgSave(&ym2612State);
+		m_psg.zomgSave(&psgState);
+		m_ym2612.zomgSave(&ym2612State);
 	}
 
 	// Initialize the PSG and YM2612.
 	if (isPal) {
-		ms_Psg.reInit((int)((double)CLOCK_PAL / 15.0), rate);
-		ms_Ym2612.reInit((int)((double)CLOCK_PAL / 7.0), rate);
+		m_psg.reInit((int)((double)CLOCK_PAL / 15.0), rate);
+		m_ym2612.reInit((int)((double)CLOCK_PAL / 7.0), rate);
 	} else {
-		ms_Psg.reInit((int)((double)CLOCK_NTSC / 15.0), rate);
-		ms_Ym2612.reInit((int)((double)CLOCK_NTSC / 7.0), rate);
+		m_psg.reInit((int)((double)CLOCK_NTSC / 15.0), rate);
+		m_ym2612.reInit((int)((double)CLOCK_NTSC / 7.0), rate);
 	}
 
 	// If requested, restore the PSG/YM state.
 	if (preserveState) {
-		ms_Psg.zomgRestore(&psgState);
-		ms_Ym2612.zomgRestore(&ym2612State);
+		m_psg.zomgRestore(&psgState);
+		m_ym2612.zomgRestore(&ym2612State);
 	}
 }
 
-/** ReInit() wrappers. **/
+/** reInit() wrappers. **/
+
+void SoundMgr::setRate(int rate, bool preserveState)
+{
+	reInit(rate, m_isPal, preserveState);
+}
 
-void SoundMgr::SetRate(int rate, bool preserveState)
+void SoundMgr::setRegion(bool isPal, bool preserveState)
 {
-	ReInit(rate, SoundMgrPrivate::isPal, preserveState);
+	reInit(m_rate, isPal, preserveState);
 }
 
-void SoundMgr::SetRegion(bool isPal, bool preserveState)
+/**
+ * Get the write position for the start of the next line.
+ * Used by the audio ICs' specialUpdate() functions.
+ * @return Write position.
+ */
+int SoundMgr::nextWritePos(void) const
 {
-	ReInit(SoundMgrPrivate::rate, isPal, preserveState);
+	int line_num = 1;
+	if (m_context != nullptr) {
+		line_num = (m_context->m_vdp->VDP_Lines.currentLine + 1);
+	}
+	return writePos(line_num);
 }
 
 }
@@ -35,23 +35,47 @@
 #include "../sound/Psg.hpp"
 #include "../sound/Ym2612.hpp"
 
+// Profiling counters.
+#include "../Util/Profiler.hpp"
+
 namespace LibGens {
 
+class EmuContext;
+
 class SoundMgr
 {
+	public:
+		SoundMgr(EmuContext *context = nullptr);
+		~SoundMgr();
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		SoundMgr(const SoundMgr &);
+		SoundMgr &operator=(const SoundMgr &);
+
 	public:
 		static void Init(void);
 		static void End(void);
 
-		static void ReInit(int rate, bool isPal, bool preserveState = false);
-		static void SetRate(int rate, bool preserveState = true);
-		static void SetRegion(bool isPal, bool preserveState = true);
+		void reInit(int rate, bool isPal, bool preserveState = false);
+		void setRate(int rate, bool preserveState = true);
+		void setRegion(bool isPal, bool preserveState = true);
 
-		static inline int GetSegLength(void);
+		inline int rate(void) const;
+		inline bool isPal(void) const;
+		inline int segLength(void) const;
 
 		// TODO: Bounds checking.
-		static inline int GetWritePos(int line);
-		static inline int GetWriteLen(int line);
+		inline int writePos(int line) const;
+		inline int writeLen(int line) const;
+
+		/**
+		 * Get the write position for the start of the next line.
+		 * Used by the audio ICs' specialUpdate() functions.
+		 * @return Write position.
+		 */
+		int nextWritePos(void) const;
 
 		// Maximum sampling rate and segment size.
 		static const int MAX_SAMPLING_RATE = 48000;
@@ -60,34 +84,38 @@ class SoundMgr
 		// Segment buffer.
 		// Stores up to MAX_SEGMENT_SIZE 16-bit stereo samples.
 		// (Samples are actually 32-bit in order to handle oversaturation properly.)
+		// Allocated with aligned_malloc() for the SSE2 write functions.
 		// TODO: Call the write functions from SoundMgr so this doesn't need to be public.
 		// TODO: Convert to interleaved stereo.
-		static int32_t ms_SegBufL[MAX_SEGMENT_SIZE];
-		static int32_t ms_SegBufR[MAX_SEGMENT_SIZE];
+		int32_t *const m_segBufL;
+		int32_t *const m_segBufR;
 
 		// Audio ICs.
 		// TODO: Add wrapper functions?
-		static Psg ms_Psg;
-		static Ym2612 ms_Ym2612;
+		Psg m_psg;
+		Ym2612 m_ym2612;
+
+		// Profiling counters from the emulation context. (May be nullptr.)
+		Profiler *const m_profiler;
 
 		/**
 		 * Reset buffer pointers and lengths.
 		 */
-		static inline void ResetPtrsAndLens(void)
+		inline void resetPtrsAndLens(void)
 		{
-			ms_Ym2612.resetBufferPtrs();
-			ms_Ym2612.clearWriteLen();
-			ms_Psg.resetBufferPtrs();
-			ms_Psg.clearWriteLen();
+			m_ym2612.resetBufferPtrs();
+			m_ym2612.clearWriteLen();
+			m_psg.resetBufferPtrs();
+			m_psg.clearWriteLen();
 		}
 
 		/**
 		 * Run the specialUpdate() functions.
 		 */
-		static inline void SpecialUpdate(void)
+		inline void specialUpdate(void)
 		{
-			ms_Psg.specialUpdate();
-			ms_Ym2612.specialUpdate();
+			m_psg.specialUpdate();
+			m_ym2612.specialUpdate();
 		}
 
 		/**
@@ -97,7 +125,7 @@ class SoundMgr
 		 * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
 		 * @return Number of samples written.
 		 */
-		static int writeStereo(int16_t *dest, int samples);
+		int writeStereo(int16_t *dest, int samples);
 
 		/**
 		 * Write monaural audio to a buffer.
@@ -106,45 +134,58 @@ class SoundMgr
 		 * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
 		 * @return Number of samples written.
 		 */
-		static int writeMono(int16_t *dest, int samples);
+		int writeMono(int16_t *dest, int samples);
 
 	protected:
 		// TODO: Move these into the private class.
 
+		// Emulation context that owns this Sound Manager. (May be nullptr.)
+		EmuContext *const m_context;
+
+		// Audio settings.
+		int m_rate;
+		bool m_isPal;
+
 		// Segment length.
-		static int ms_SegLength;
+		int m_segLength;
 
 		// Line extrapolation values. [312 + extra room to prevent overflows]
 		// Index 0 == start; Index 1 == length
-		static unsigned int ms_Extrapol[312+8][2];
-
-	private:
-		SoundMgr() { }
-		~SoundMgr() { }
+		unsigned int m_extrapol[312+8][2];
 };
 
 /** Inline functions **/
 
-inline int SoundMgr::GetSegLength(void)
+inline int SoundMgr::rate(void) const
+{
+	return m_rate;
+}
+
+inline bool SoundMgr::isPal(void) const
+{
+	return m_isPal;
+}
+
+inline int SoundMgr::segLength(void) const
 {
-	return ms_SegLength;
+	return m_segLength;
 }
 
 // TODO: Bounds checking.
-inline int SoundMgr::GetWritePos(int line)
+inline int SoundMgr::writePos(int line) const
 {
 	// NOTE: Line might be 263 or 313 at the end of the frame.
 	// TODO: Figure out why.
 	assert(line >= 0 && line <= 313);
-	return ms_Extrapol[line][0];
+	return m_extrapol[line][0];
 }
 
-inline int SoundMgr::GetWriteLen(int line)
+inline int SoundMgr::writeLen(int line) const
 {
 	// NOTE: Line might be 263 or 313 at the end of the frame.
 	// TODO: Figure out why.
 	assert(line >= 0 && line <= 313);
-	return ms_Extrapol[line][1];
+	return m_extrapol[line][1];
 }
 
 }
@@ -50,53 +50,62 @@ class SoundMgrPrivate
 		// Segment length.
 		static int CalcSegLength(int rate, bool isPal);
 
-		static int rate;
-		static bool isPal;
-
 	public:
 #ifdef SOUNDMGR_HAS_MMX
 		/**
 		 * Write stereo audio to a buffer. (SSE2-optimized)
 		 * @param dest Destination buffer.
+		 * @param srcL Left segment buffer.
+		 * @param srcR Right segment buffer.
 		 * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
 		 */
-		static void writeStereo_SSE2(int16_t *dest, int samples);
+		static void writeStereo_SSE2(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples);
 
 		/**
 		 * Write monaural audio to a buffer. (SSE2-optimized)
 		 * @param dest Destination buffer.
+		 * @param srcL Left segment buffer.
+		 * @param srcR Right segment buffer.
 		 * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
 		 */
-		static void writeMono_SSE2(int16_t *dest, int samples);
+		static void writeMono_SSE2(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples);
 
 		/**
 		 * Write stereo audio to a buffer. (MMX-optimized)
 		 * @param dest Destination buffer.
+		 * @param srcL Left segment buffer.
+		 * @param srcR Right segment buffer.
 		 * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
 		 */
-		static void writeStereo_MMX(int16_t *dest, int samples);
+		static void writeStereo_MMX(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples);
 
 		/**
 		 * Write monaural audio to a buffer. (MMX-optimized)
 		 * @param dest Destination buffer.
+		 * @param srcL Left segment buffer.
+		 * @param srcR Right segment buffer.
 		 * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
 		 */
-		static void writeMono_MMX(int16_t *dest, int samples);
+		static void writeMono_MMX(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples);
 #endif /* SOUNDMGR_HAS_MMX */
 
 		/**
 		 * Write stereo audio to a buffer.
 		 * @param dest Destination buffer.
+		 * @param srcL Left segment buffer.
+		 * @param srcR Right segment buffer.
 		 * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
 		 */
-		static void writeStereo_noasm(int16_t *dest, int samples);
+		static void writeStereo_noasm(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples);
 
 		/**
 		 * Write monaural audio to a buffer.
 		 * @param dest Destination buffer.
+		 * @param srcL Left segment buffer.
+		 * @param srcR Right segment buffer.
 		 * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
 		 */
-		static void writeMono_noasm(int16_t *dest, int samples);
+		static void writeMono_noasm(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples);
 };
 
 }
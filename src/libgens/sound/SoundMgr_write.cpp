@@ -57,17 +57,15 @@ static inline int16_t clamp(int32_t sample)
 /**
  * Write stereo audio to a buffer. (SSE2-optimized)
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
  */
-void SoundMgrPrivate::writeStereo_SSE2(int16_t *dest, int samples)
+void SoundMgrPrivate::writeStereo_SSE2(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples)
 {
-	// samples is clamped to std::min(samples, ms_SegLength)
+	// samples is clamped to std::min(samples, m_segLength)
 	// by writeStereo().
 
-	// Source buffer pointers.
-	const int32_t *srcL = &SoundMgr::ms_SegBufL[0];
-	const int32_t *srcR = &SoundMgr::ms_SegBufR[0];
-
 	// Write 8 samples at once using SSE2.
 	assert((uintptr_t)dest % 16 == 0);
 	int i = samples;
@@ -120,17 +118,15 @@ void SoundMgrPrivate::writeStereo_SSE2(int16_t *dest, int samples)
 /**
  * Write monaural audio to a buffer. (SSE2-optimized)
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
  */
-void SoundMgrPrivate::writeMono_SSE2(int16_t *dest, int samples)
+void SoundMgrPrivate::writeMono_SSE2(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples)
 {
-	// samples is clamped to std::min(samples, ms_SegLength)
+	// samples is clamped to std::min(samples, m_segLength)
 	// by writeStereo().
 
-	// Source buffer pointers.
-	const int32_t *srcL = &SoundMgr::ms_SegBufL[0];
-	const int32_t *srcR = &SoundMgr::ms_SegBufR[0];
-
 	// Write 8 samples at once using SSE2.
 	assert((uintptr_t)dest % 16 == 0);
 	int i = samples;
@@ -177,17 +173,15 @@ void SoundMgrPrivate::writeMono_SSE2(int16_t *dest, int samples)
 /**
  * Write stereo audio to a buffer. (MMX-optimized)
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
  */
-void SoundMgrPrivate::writeStereo_MMX(int16_t *dest, int samples)
+void SoundMgrPrivate::writeStereo_MMX(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples)
 {
-	// samples is clamped to std::min(samples, ms_SegLength)
+	// samples is clamped to std::min(samples, m_segLength)
 	// by writeStereo().
 
-	// Source buffer pointers.
-	const int32_t *srcL = &SoundMgr::ms_SegBufL[0];
-	const int32_t *srcR = &SoundMgr::ms_SegBufR[0];
-
 	// Write 4 samples at once using MMX.
 	int i = samples;
 	for (; i > 3; i -= 4, srcL += 4, srcR += 4, dest += 8) {
@@ -246,17 +240,15 @@ void SoundMgrPrivate::writeStereo_MMX(int16_t *dest, int samples)
 /**
  * Write monaural audio to a buffer. (MMX-optimized)
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
  */
-void SoundMgrPrivate::writeMono_MMX(int16_t *dest, int samples)
+void SoundMgrPrivate::writeMono_MMX(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples)
 {
-	// samples is clamped to std::min(samples, ms_SegLength)
+	// samples is clamped to std::min(samples, m_segLength)
 	// by writeMono().
 
-	// Source buffer pointers.
-	const int32_t *srcL = &SoundMgr::ms_SegBufL[0];
-	const int32_t *srcR = &SoundMgr::ms_SegBufR[0];
-
 	// Write 4 samples at once using MMX.
 	int i = samples;
 	for (; i > 3; i -= 4, srcL += 4, srcR += 4, dest += 4) {
@@ -303,17 +295,15 @@ void SoundMgrPrivate::writeMono_MMX(int16_t *dest, int samples)
 /**
  * Write stereo audio to a buffer.
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
  */
-void SoundMgrPrivate::writeStereo_noasm(int16_t *dest, int samples)
+void SoundMgrPrivate::writeStereo_noasm(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples)
 {
-	// samples is clamped to std::min(samples, ms_SegLength)
+	// samples is clamped to std::min(samples, m_segLength)
 	// by writeStereo().
 
-	// Source buffer pointers.
-	const int32_t *srcL = &SoundMgr::ms_SegBufL[0];
-	const int32_t *srcR = &SoundMgr::ms_SegBufR[0];
-
 	for (int i = samples; i > 0;
 	     i--, srcL++, srcR++, dest += 2)
 	{
@@ -325,17 +315,15 @@ void SoundMgrPrivate::writeStereo_noasm(int16_t *dest, int samples)
 /**
  * Write monaural audio to a buffer.
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
  */
-void SoundMgrPrivate::writeMono_noasm(int16_t *dest, int samples)
+void SoundMgrPrivate::writeMono_noasm(int16_t *dest, const int32_t *srcL, const int32_t *srcR, int samples)
 {
-	// samples is clamped to std::min(samples, ms_SegLength)
+	// samples is clamped to std::min(samples, m_segLength)
 	// by writeMono().
 
-	// Source buffer pointers.
-	const int32_t *srcL = &SoundMgr::ms_SegBufL[0];
-	const int32_t *srcR = &SoundMgr::ms_SegBufR[0];
-
 	for (int i = samples; i > 0;
 	     i--, srcL++, srcR++, dest++)
 	{
@@ -355,28 +343,30 @@ void SoundMgrPrivate::writeMono_noasm(int16_t *dest, int samples)
  * Write stereo audio to a buffer.
  * This clears the internal audio buffer.
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 4 bytes)
  * @return Number of samples written.
  */
 int SoundMgr::writeStereo(int16_t *dest, int samples)
 {
-	samples = std::min(samples, ms_SegLength);
+	samples = std::min(samples, m_segLength);
 #ifdef SOUNDMGR_HAS_MMX
 	if (CPU_Flags & MDP_CPUFLAG_X86_SSE2) {
-		SoundMgrPrivate::writeStereo_SSE2(dest, samples);
+		SoundMgrPrivate::writeStereo_SSE2(dest, m_segBufL, m_segBufR, samples);
 	} else if (CPU_Flags & MDP_CPUFLAG_X86_MMX) {
-		SoundMgrPrivate::writeStereo_MMX(dest, samples);
+		SoundMgrPrivate::writeStereo_MMX(dest, m_segBufL, m_segBufR, samples);
 	} else
 #endif /* SOUNDMGR_HAS_MMX */
 	{
-		SoundMgrPrivate::writeStereo_noasm(dest, samples);
+		SoundMgrPrivate::writeStereo_noasm(dest, m_segBufL, m_segBufR, samples);
 	}
 
 	// Clear the segment buffers.
 	// These buffers are additive, so if they aren't cleared,
 	// we'll end up with static.
-	memset(ms_SegBufL, 0, ms_SegLength * sizeof(ms_SegBufL[0]));
-	memset(ms_SegBufR, 0, ms_SegLength * sizeof(ms_SegBufL[0]));
+	memset(m_segBufL, 0, m_segLength * sizeof(m_segBufL[0]));
+	memset(m_segBufR, 0, m_segLength * sizeof(m_segBufR[0]));
 
 	return samples;
 }
@@ -385,28 +375,30 @@ int SoundMgr::writeStereo(int16_t *dest, int samples)
  * Write monaural audio to a buffer.
  * This clears the internal audio buffer.
  * @param dest Destination buffer.
+ * @param srcL Left segment buffer.
+ * @param srcR Right segment buffer.
  * @param samples Number of samples in the buffer. (1 sample == 2 bytes)
  * @return Number of samples written.
  */
 int SoundMgr::writeMono(int16_t *dest, int samples)
 {
-	samples = std::min(samples, ms_SegLength);
+	samples = std::min(samples, m_segLength);
 #ifdef SOUNDMGR_HAS_MMX
 	if (CPU_Flags & MDP_CPUFLAG_X86_SSE2) {
-		SoundMgrPrivate::writeMono_SSE2(dest, samples);
+		SoundMgrPrivate::writeMono_SSE2(dest, m_segBufL, m_segBufR, samples);
 	} else if (CPU_Flags & MDP_CPUFLAG_X86_MMX) {
-		SoundMgrPrivate::writeMono_MMX(dest, samples);
+		SoundMgrPrivate::writeMono_MMX(dest, m_segBufL, m_segBufR, samples);
 	} else
 #endif /* SOUNDMGR_HAS_MMX */
 	{
-		SoundMgrPrivate::writeMono_noasm(dest, samples);
+		SoundMgrPrivate::writeMono_noasm(dest, m_segBufL, m_segBufR, samples);
 	}
 
 	// Clear the segment buffers.
 	// These buffers are additive, so if they aren't cleared,
 	// we'll end up with static.
-	memset(ms_SegBufL, 0, ms_SegLength * sizeof(ms_SegBufL[0]));
-	memset(ms_SegBufR, 0, ms_SegLength * sizeof(ms_SegBufL[0]));
+	memset(m_segBufL, 0, m_segLength * sizeof(m_segBufL[0]));
+	memset(m_segBufR, 0, m_segLength * sizeof(m_segBufR[0]));
 
 	return samples;
 }
@@ -50,10 +50,6 @@
 
 // Sound Manager.
 #include "SoundMgr.hpp"
-#include "Vdp/Vdp.hpp"
-
-// TODO: Get rid of EmuContext.
-#include "EmuContext/EmuContext.hpp"
 
 #if 0
 // GSX v7 savestate functionality.
@@ -146,6 +142,7 @@ int Ym2612Private::LFO_FREQ_TAB[LFO_LENGTH];	// LFO FMS TABLE
 
 Ym2612Private::Ym2612Private(Ym2612 *q)
 	: q(q)
+	, int_cnt(0)
 {
 	if (!isInit) {
 		// Initialize the static tables.
@@ -154,6 +151,20 @@ Ym2612Private::Ym2612Private(Ym2612 *q)
 	}
 }
 
+/**
+ * Initialize the static tables.
+ * Called by SoundMgr::Init(). Tables are initialized on first
+ * use otherwise, which isn't safe if Ym2612 objects are
+ * created on multiple threads.
+ */
+void Ym2612::Init(void)
+{
+	if (!Ym2612Private::isInit) {
+		Ym2612Private::isInit = true;
+		Ym2612Private::doStaticInit();
+	}
+}
+
 void Ym2612Private::doStaticInit(void)
 {
 	// Sine table:
@@ -1485,6 +1496,9 @@ Ym2612::Ym2612()
 	m_enabled = true;	// TODO: Make this customizable.
 	m_dacEnabled = true;	// TODO: Make this customizable.
 	m_improved = true;	// TODO: Make this customizable.
+
+	m_soundMgr = nullptr;
+	resetBufferPtrs();
 }
 
 Ym2612::Ym2612(int clock, int rate)
@@ -1495,7 +1509,10 @@ Ym2612::Ym2612(int clock, int rate)
 	m_enabled = true;	// TODO: Make this customizable.
 	m_dacEnabled = true;	// TODO: Make this customizable.
 	m_improved = true;	// TODO: Make this customizable.
-	
+
+	m_soundMgr = nullptr;
+	resetBufferPtrs();
+
 	reInit(clock, rate);
 }
 
@@ -1520,6 +1537,7 @@ int Ym2612::reInit(int clock, int rate)
 
 	// Clear the state struct.
 	memset(&d->state, 0, sizeof(d->state));
+	d->int_cnt = 0;
 	d->state.Clock = clock;
 	d->state.Rate = rate;
 
@@ -1964,6 +1982,22 @@ void Ym2612::zomgRestore(const Zomg_Ym2612Save_t *state)
 	// TODO: Restore other counters and stuff!
 }
 
+/**
+ * Copy the complete internal state of another YM2612.
+ * Unlike ZOMG savestates, this includes the envelope,
+ * phase, LFO, and timer counters.
+ * @param other YM2612 to copy from.
+ */
+void Ym2612::copyStateFrom(const Ym2612 &other)
+{
+	// NOTE: The slot rate pointers in state_t point to the
+	// other YM2612's tables, so both YM2612s must use the
+	// same clock and rate, and the other YM2612 must not
+	// be deleted while this one is still using the state.
+	d->state = other.d->state;
+	d->int_cnt = other.d->int_cnt;
+}
+
 // TODO: Eliminate the GSXv7 stuff.
 // TODO: Add the YM timer state (and other important stuff) to the ZOMG save format.
 #if 0
@@ -2296,21 +2330,34 @@ void Ym2612::specialUpdate(void)
 		return;
 
 	// Update the sound buffer.
-	update(m_bufPtrL, m_bufPtrR, m_writeLen);
+	Profiler *const profiler = (m_soundMgr ? m_soundMgr->m_profiler : nullptr);
+	{
+		Profiler::Scope prof(profiler, Profiler::PROF_YM2612);
+		update(m_bufPtrL, m_bufPtrR, m_writeLen);
+	}
+	if (profiler)
+		profiler->add(Profiler::CNT_YM2612_SAMPLES, m_writeLen);
 	m_writeLen = 0;
 
-	// TODO: Don't use EmuContext here...
-	int line_num = 1;
-	EmuContext *context = EmuContext::Instance();
-	if (context != nullptr)
-		line_num = (context->m_vdp->VDP_Lines.currentLine + 1);
+	if (!m_soundMgr)
+		return;
 
 	// Determine the new starting position.
-	int writePos = SoundMgr::GetWritePos(line_num);
+	const int writePos = m_soundMgr->nextWritePos();
 
-	// Update the PSG buffer pointers.
-	m_bufPtrL = &SoundMgr::ms_SegBufL[writePos];
-	m_bufPtrR = &SoundMgr::ms_SegBufR[writePos];
+	// Update the YM2612 buffer pointers.
+	m_bufPtrL = &m_soundMgr->m_segBufL[writePos];
+	m_bufPtrR = &m_soundMgr->m_segBufR[writePos];
+}
+
+/**
+ * Set the Sound Manager that owns the output buffers.
+ * @param soundMgr Sound Manager. (May be nullptr.)
+ */
+void Ym2612::setSoundMgr(SoundMgr *soundMgr)
+{
+	m_soundMgr = soundMgr;
+	resetBufferPtrs();
 }
 
 /**
@@ -2331,8 +2378,13 @@ int Ym2612::getReg(int regID) const
  */
 void Ym2612::resetBufferPtrs(void)
 {
-	m_bufPtrL = &SoundMgr::ms_SegBufL[0];
-	m_bufPtrR = &SoundMgr::ms_SegBufR[0];
+	if (m_soundMgr) {
+		m_bufPtrL = &m_soundMgr->m_segBufL[0];
+		m_bufPtrR = &m_soundMgr->m_segBufR[0];
+	} else {
+		m_bufPtrL = nullptr;
+		m_bufPtrR = nullptr;
+	}
 }
 
 /* end */
@@ -30,6 +30,8 @@ struct _Zomg_Ym2612Save_t;
 
 namespace LibGens {
 
+class SoundMgr;
+
 class Ym2612Private;
 class Ym2612
 {
@@ -48,6 +50,14 @@ class Ym2612
 		Ym2612 &operator=(const Ym2612 &);
 
 	public:
+		/**
+		 * Initialize the static tables.
+		 * Called by SoundMgr::Init(). Tables are initialized on first
+		 * use otherwise, which isn't safe if Ym2612 objects are
+		 * created on multiple threads.
+		 */
+		static void Init(void);
+
 		int reInit(int clock, int rate);
 		void reset(void);
 
@@ -65,11 +75,25 @@ class Ym2612
 		void zomgSave(_Zomg_Ym2612Save_t *state) const;
 		void zomgRestore(const _Zomg_Ym2612Save_t *state);
 
+		/**
+		 * Copy the complete internal state of another YM2612.
+		 * Unlike ZOMG savestates, this includes the envelope,
+		 * phase, LFO, and timer counters.
+		 * @param other YM2612 to copy from.
+		 */
+		void copyStateFrom(const Ym2612 &other);
+
 		/** Gens-specific code. **/
 		void updateDacAndTimers(int32_t *bufL, int32_t *bufR, int length);
 		void specialUpdate(void);
 		int getReg(int regID) const;
 
+		/**
+		 * Set the Sound Manager that owns the output buffers.
+		 * @param soundMgr Sound Manager. (May be nullptr.)
+		 */
+		void setSoundMgr(SoundMgr *soundMgr);
+
 		// YM write length.
 		inline void addWriteLen(int len)
 			{ m_writeLen += len; }
@@ -86,6 +110,9 @@ class Ym2612
 		bool m_dacEnabled;	// DAC Enabled
 		bool m_improved;	// YM2612 Improved
 		
+		// Sound Manager that owns the output buffers.
+		SoundMgr *m_soundMgr;
+
 		// YM buffer pointers.
 		// TODO: Figure out how to get rid of these!
 		int32_t *m_bufPtrL;
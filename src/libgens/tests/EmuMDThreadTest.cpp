@@ -0,0 +1,171 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * EmuMDThreadTest.cpp: Concurrent emulation context test.                 *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Runs several EmuMD contexts at once, one per thread, and checks
+ * that each one produces the same frames as when the contexts are
+ * run one after another. Any state shared between contexts (static
+ * tables, globals in the CPU cores or the VDP) shows up here as a
+ * framebuffer checksum mismatch.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// zlib
+#include <zlib.h>
+
+// C includes. (C++ namespace)
+#include <cstdio>
+
+// C++ includes.
+#include <atomic>
+#include <thread>
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+// Number of frames to run in each context.
+#define THREAD_TEST_FRAMES 300
+
+// Scenario masks, one per context. (See EmuMD_benchmark_data.h.)
+// Scenarios are repeated so that some contexts run the exact
+// same code at the same time.
+static const uint16_t masks[] = {
+	0x0000, 0x0001, 0x0002, 0x0004,
+	0x0008, 0x000F, 0x000F, 0x0003,
+};
+#define THREAD_TEST_CONTEXTS ((int)(sizeof(masks) / sizeof(masks[0])))
+
+class EmuMDThreadTest : public ::testing::Test
+{
+	protected:
+		EmuMDThreadTest() { }
+		virtual ~EmuMDThreadTest() { }
+
+		/**
+		 * Run one context and checksum its frames.
+		 * @param mask		[in] Scenario mask.
+		 * @param frameCrc	[out] Framebuffer checksum for each frame.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		static int runContext(uint16_t mask, vector<uint32_t> &frameCrc);
+};
+
+/**
+ * Run one context and checksum its frames.
+ * @param mask		[in] Scenario mask.
+ * @param frameCrc	[out] Framebuffer checksum for each frame.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int EmuMDThreadTest::runContext(uint16_t mask, vector<uint32_t> &frameCrc)
+{
+	TestContext test;
+	int ret = test.openBenchmark(mask);
+	if (ret != 0)
+		return ret;
+
+	EmuMD *context = test.context();
+	const MdFb *fb = context->m_vdp->MD_Screen;
+	const size_t fbSize = fb->pxPitch() * fb->numLines() * sizeof(uint32_t);
+
+	frameCrc.resize(THREAD_TEST_FRAMES);
+	for (int i = 0; i < THREAD_TEST_FRAMES; i++) {
+		context->execFrame();
+		frameCrc[i] = crc32(0, (const Bytef*)fb->fb32(), fbSize);
+	}
+	return 0;
+}
+
+/**
+ * Run all contexts concurrently and compare every frame
+ * with a sequential run of the same contexts.
+ */
+TEST_F(EmuMDThreadTest, concurrentMatchesSequential)
+{
+	// Sequential reference run.
+	vector<vector<uint32_t> > expected(THREAD_TEST_CONTEXTS);
+	for (int i = 0; i < THREAD_TEST_CONTEXTS; i++) {
+		ASSERT_EQ(0, runContext(masks[i], expected[i]))
+			<< "Emulation context " << i << " failed to initialize.";
+	}
+
+	// Concurrent run. The threads wait for each other before
+	// creating their contexts so that context initialization
+	// overlaps, too.
+	vector<vector<uint32_t> > actual(THREAD_TEST_CONTEXTS);
+	vector<int> ret(THREAD_TEST_CONTEXTS, -1);
+	std::atomic<int> ready(0);
+	vector<std::thread> threads;
+	threads.reserve(THREAD_TEST_CONTEXTS);
+	for (int i = 0; i < THREAD_TEST_CONTEXTS; i++) {
+		threads.push_back(std::thread([i, &ready, &ret, &actual]() {
+			ready++;
+			while (ready.load() < THREAD_TEST_CONTEXTS) {
+				std::this_thread::yield();
+			}
+			ret[i] = runContext(masks[i], actual[i]);
+		}));
+	}
+	for (int i = 0; i < THREAD_TEST_CONTEXTS; i++) {
+		threads[i].join();
+	}
+
+	for (int i = 0; i < THREAD_TEST_CONTEXTS; i++) {
+		ASSERT_EQ(0, ret[i]) << "Emulation context " << i << " failed to initialize.";
+		ASSERT_EQ(expected[i].size(), actual[i].size());
+		for (int frame = 0; frame < THREAD_TEST_FRAMES; frame++) {
+			if (expected[i][frame] == actual[i][frame])
+				continue;
+			ADD_FAILURE() << "Context " << i << " (mask 0x" << std::hex << masks[i]
+				<< "): framebuffer checksum 0x" << actual[i][frame]
+				<< " doesn't match the sequential run (0x" << expected[i][frame]
+				<< ") at frame " << std::dec << (frame + 1) << '.';
+			break;
+		}
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: Concurrent emulation contexts.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
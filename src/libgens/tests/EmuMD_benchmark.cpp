@@ -0,0 +1,232 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * EmuMD_benchmark.cpp: Per-subsystem frame throughput benchmark.          *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Runs the bundled frame benchmark ROM in several scenarios and
+ * reports frames per second. If libgens was built with
+ * ENABLE_LIBGENS_PROFILER, the time spent in each subsystem
+ * and the per-frame profiling counters are reported as well.
+ *
+ * Results are printed to stdout as one "key=value" line per
+ * scenario, and are also recorded as gtest properties, so
+ * --gtest_output=xml:FILE can be used for machine-readable output.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Util/Timing.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <string>
+#include <sstream>
+
+namespace LibGens { namespace Tests {
+
+struct EmuMD_benchmark_scenario
+{
+	const char *name;
+	uint16_t mask;	// Scenario mask. (See EmuMD_benchmark_data.h.)
+	bool deferred;	// Enable deferred rendering.
+
+	EmuMD_benchmark_scenario(const char *name, uint16_t mask, bool deferred = false)
+		: name(name)
+		, mask(mask)
+		, deferred(deferred) { }
+};
+
+/**
+ * Formatting function for EmuMD_benchmark_scenario.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const EmuMD_benchmark_scenario& scenario)
+{
+	return os << scenario.name;
+};
+
+class EmuMD_benchmark : public ::testing::TestWithParam<EmuMD_benchmark_scenario>
+{
+	protected:
+		EmuMD_benchmark()
+			: ::testing::TestWithParam<EmuMD_benchmark_scenario>()
+			, m_context(nullptr) { }
+		virtual ~EmuMD_benchmark() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+	protected:
+		// Number of frames to run before timing starts.
+		static const int WARMUP_FRAMES = 60;
+		// Number of frames to time.
+		static const int BENCHMARK_FRAMES = 600;
+
+		TestContext m_test;
+		EmuMD *m_context;
+};
+
+/**
+ * Load the benchmark ROM and create the emulation context.
+ */
+void EmuMD_benchmark::SetUp(void)
+{
+	const EmuMD_benchmark_scenario &scenario = GetParam();
+
+	ASSERT_EQ(0, m_test.openBenchmark(scenario.mask)) << "Emulation context failed to initialize.";
+	m_context = m_test.context();
+	m_context->m_vdp->setDeferredRender(scenario.deferred);
+}
+
+/**
+ * Tear down the emulation context.
+ */
+void EmuMD_benchmark::TearDown(void)
+{
+	m_context = nullptr;
+	m_test.close();
+}
+
+/**
+ * Run the benchmark ROM and report the frame rate
+ * and the time spent in each subsystem.
+ */
+TEST_P(EmuMD_benchmark, execFrame)
+{
+	const EmuMD_benchmark_scenario &scenario = GetParam();
+
+	for (int i = 0; i < WARMUP_FRAMES; i++) {
+		m_context->execFrame();
+	}
+
+	// Per-section totals, in nanoseconds.
+	// These are only filled in if the profiler is enabled.
+	uint64_t sectionNs[Profiler::PROF_MAX];
+	memset(sectionNs, 0, sizeof(sectionNs));
+	uint64_t counters[Profiler::CNT_MAX];
+	memset(counters, 0, sizeof(counters));
+	uint64_t profiledNs = 0;
+
+	Timing timing;
+	const uint64_t start = timing.getTimeNs();
+	for (int i = 0; i < BENCHMARK_FRAMES; i++) {
+		m_context->execFrame();
+		if (Profiler::IsEnabled) {
+			profiledNs += m_context->profiler()->frameTime();
+			for (int s = 0; s < Profiler::PROF_MAX; s++) {
+				sectionNs[s] += m_context->profiler()->sectionTime((Profiler::Section)s);
+			}
+			for (int c = 0; c < Profiler::CNT_MAX; c++) {
+				counters[c] += m_context->profiler()->counter((Profiler::Counter)c);
+			}
+		}
+	}
+	const uint64_t totalNs = timing.getTimeNs() - start;
+	ASSERT_GT(totalNs, 0ULL);
+
+	// Report the results.
+	const double fps = (double)BENCHMARK_FRAMES * 1000000000.0 / (double)totalNs;
+	char buf[64];
+	std::ostringstream oss;
+	oss << "benchmark=EmuMD scenario=" << scenario.name
+	    << " frames=" << BENCHMARK_FRAMES
+	    << " total_ns=" << totalNs;
+	snprintf(buf, sizeof(buf), "%.2f", fps);
+	oss << " fps=" << buf;
+	RecordProperty("frames", BENCHMARK_FRAMES);
+	RecordProperty("fps", buf);
+
+	if (Profiler::IsEnabled) {
+		// Per-frame averages for each section.
+		// "other" is everything that isn't in a section,
+		// e.g. frame setup and sound buffer management.
+		uint64_t sectionTotal = 0;
+		for (int s = 0; s < Profiler::PROF_MAX; s++) {
+			const char *name = Profiler::SectionName((Profiler::Section)s);
+			const uint64_t avg = sectionNs[s] / BENCHMARK_FRAMES;
+			sectionTotal += sectionNs[s];
+			oss << ' ' << name << "_ns_per_frame=" << avg;
+			RecordProperty(std::string(name) + "_ns_per_frame", (int)avg);
+		}
+		const uint64_t other = (profiledNs > sectionTotal
+					? (profiledNs - sectionTotal) / BENCHMARK_FRAMES
+					: 0);
+		oss << " other_ns_per_frame=" << other;
+		RecordProperty("other_ns_per_frame", (int)other);
+
+		// Per-frame averages for each counter.
+		for (int c = 0; c < Profiler::CNT_MAX; c++) {
+			const char *name = Profiler::CounterName((Profiler::Counter)c);
+			const uint64_t avg = counters[c] / BENCHMARK_FRAMES;
+			oss << ' ' << name << "_per_frame=" << avg;
+			RecordProperty(std::string(name) + "_per_frame", (int)avg);
+		}
+	} else {
+		// Reconfigure with -DENABLE_LIBGENS_PROFILER=ON to enable them.
+		oss << " sections=disabled profiler_option=ENABLE_LIBGENS_PROFILER";
+	}
+
+	printf("%s\n", oss.str().c_str());
+	fflush(stdout);
+}
+
+// Test cases.
+INSTANTIATE_TEST_CASE_P(EmuMD_benchmark, EmuMD_benchmark,
+	::testing::Values(
+		EmuMD_benchmark_scenario("idle", 0x0000),
+		EmuMD_benchmark_scenario("dma", 0x0001),
+		EmuMD_benchmark_scenario("sprites", 0x0002),
+		EmuMD_benchmark_scenario("hint", 0x0004),
+		EmuMD_benchmark_scenario("fm", 0x0008),
+		EmuMD_benchmark_scenario("all", 0x000F),
+		EmuMD_benchmark_scenario("sprites_deferred", 0x0002, true),
+		EmuMD_benchmark_scenario("all_deferred", 0x000F, true)
+		));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: EmuMD frame benchmark.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	if (!LibGens::Profiler::IsEnabled) {
+		fprintf(stderr, "NOTE: Per-subsystem times are disabled. Reconfigure with\n"
+			"-DENABLE_LIBGENS_PROFILER=ON and rebuild libgens to enable them.\n\n");
+	}
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
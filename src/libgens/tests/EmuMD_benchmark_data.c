@@ -0,0 +1,1269 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * EmuMD_benchmark_data.c: Frame benchmark ROM.                            *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "EmuMD_benchmark_data.h"
+
+/**
+ * Frame benchmark ROM for EmuMD_benchmark.
+ * 16 KB, uncompressed.
+ *
+ * The word at $0001FC selects which subsystems are stressed:
+ * - Bit 0: 68K->VRAM DMA, VRAM fill, and CRAM DMA every VBlank.
+ * - Bit 1: 80 moving 32x32 sprites, rewritten every VBlank.
+ * - Bit 2: HInt on every line, writing CRAM and VSRAM.
+ * - Bit 3: Z80 drives the YM2612 (3 FM channels and the DAC).
+ * With no bits set, the 68K and Z80 run busy loops
+ * over a static, fully-populated display.
+ */
+const uint8_t test_emumd_benchmark_rom[16384] = {
+	// $000000: Vectors. ($70: HInt, $78: VInt; all others point to an RTE.)
+	0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x02, 0xCA, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x02, 0xDE, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+	0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96, 0x00, 0x00, 0x03, 0x96,
+
+	// $000100: ROM header.
+	// NOTE: Scenario mask is located at $0001FC.
+	0x53, 0x45, 0x47, 0x41, 0x20, 0x4D, 0x45, 0x47, 0x41, 0x20, 0x44, 0x52, 0x49, 0x56, 0x45, 0x20,
+	0x28, 0x43, 0x29, 0x47, 0x45, 0x4E, 0x53, 0x20, 0x32, 0x30, 0x31, 0x35, 0x2E, 0x4A, 0x41, 0x4E,
+	0x45, 0x4D, 0x55, 0x4D, 0x44, 0x20, 0x46, 0x52, 0x41, 0x4D, 0x45, 0x20, 0x42, 0x45, 0x4E, 0x43,
+	0x48, 0x4D, 0x41, 0x52, 0x4B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x45, 0x4D, 0x55, 0x4D, 0x44, 0x20, 0x46, 0x52, 0x41, 0x4D, 0x45, 0x20, 0x42, 0x45, 0x4E, 0x43,
+	0x48, 0x4D, 0x41, 0x52, 0x4B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x47, 0x4D, 0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2D, 0x30, 0x30, 0x00, 0x00,
+	0x4A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+	0x4A, 0x55, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00,
+
+	// $000200: start
+	0x46, 0xFC, 0x27, 0x00,                         // move.w  #$2700,sr
+	0x3E, 0x39, 0x00, 0x00, 0x01, 0xFC,             // move.w  (ScenarioMask).l,d7
+	0x49, 0xF9, 0x00, 0xC0, 0x00, 0x04,             // lea     ($C00004).l,a4
+	0x4B, 0xF9, 0x00, 0xC0, 0x00, 0x00,             // lea     ($C00000).l,a5
+	0x7C, 0x00,                                     // moveq   #0,d6
+	0x7A, 0x00,                                     // moveq   #0,d5
+	0x78, 0x00,                                     // moveq   #0,d4
+	0x33, 0xFC, 0x01, 0x00, 0x00, 0xA1, 0x11, 0x00, // move.w  #$0100,($A11100).l	; Z80 BUSREQ
+	0x33, 0xFC, 0x01, 0x00, 0x00, 0xA1, 0x12, 0x00, // move.w  #$0100,($A11200).l	; Z80 /RESET high
+	0x41, 0xFA, 0x02, 0x08,                         // lea     Z80Program(pc),a0
+	0x43, 0xF9, 0x00, 0xA0, 0x00, 0x00,             // lea     ($A00000).l,a1
+	0x30, 0x3C, 0x01, 0x05,                         // move.w  #Z80ProgramSize-1,d0
+
+	// $00023A: zcopy
+	0x12, 0xD8,                                     // move.b  (a0)+,(a1)+
+	0x51, 0xC8, 0xFF, 0xFC,                         // dbf     d0,.zcopy
+	0x70, 0x00,                                     // moveq   #0,d0
+	0x08, 0x07, 0x00, 0x03,                         // btst    #3,d7			; FM scenario?
+	0x67, 0x02,                                     // beq.s   .nofm
+	0x70, 0x01,                                     // moveq   #1,d0
+
+	// $00024A: nofm
+	0x13, 0xC0, 0x00, 0xA0, 0x1F, 0xF0,             // move.b  d0,($A01FF0).l	; Z80 FM enable flag
+	0x33, 0xFC, 0x00, 0x00, 0x00, 0xA1, 0x12, 0x00, // move.w  #$0000,($A11200).l	; Z80 /RESET low
+	0x33, 0xFC, 0x00, 0x00, 0x00, 0xA1, 0x11, 0x00, // move.w  #$0000,($A11100).l	; release Z80 bus
+	0x33, 0xFC, 0x01, 0x00, 0x00, 0xA1, 0x12, 0x00, // move.w  #$0100,($A11200).l	; Z80 /RESET high
+	0x41, 0xFA, 0x01, 0x2E,                         // lea     VdpRegs(pc),a0
+	0x70, 0x0E,                                     // moveq   #VdpRegCount-1,d0
+
+	// $00026E: regs
+	0x38, 0x98,                                     // move.w  (a0)+,(a4)
+	0x51, 0xC8, 0xFF, 0xFC,                         // dbf     d0,.regs
+	0x08, 0x07, 0x00, 0x02,                         // btst    #2,d7			; HInt scenario?
+	0x67, 0x04,                                     // beq.s   .nohint
+	0x38, 0xBC, 0x80, 0x14,                         // move.w  #$8014,(a4)		; enable HInt
+
+	// $00027E: nohint
+	0x28, 0xBC, 0xC0, 0x00, 0x00, 0x00,             // move.l  #$C0000000,(a4)	; CRAM write $00
+	0x70, 0x3F,                                     // moveq   #63,d0
+	0x72, 0x00,                                     // moveq   #0,d1
+
+	// $000288: cram
+	0x3A, 0x81,                                     // move.w  d1,(a5)
+	0x06, 0x41, 0x02, 0x46,                         // addi.w  #$0246,d1
+	0x51, 0xC8, 0xFF, 0xF8,                         // dbf     d0,.cram
+	0x28, 0xBC, 0x40, 0x00, 0x00, 0x00,             // move.l  #$40000000,(a4)	; VRAM write $0000
+	0x30, 0x3C, 0x77, 0xFF,                         // move.w  #$77FF,d0
+	0x72, 0x00,                                     // moveq   #0,d1
+
+	// $00029E: vram
+	0x3A, 0x81,                                     // move.w  d1,(a5)
+	0x06, 0x41, 0x1D, 0x03,                         // addi.w  #$1D03,d1
+	0x51, 0xC8, 0xFF, 0xF8,                         // dbf     d0,.vram
+	0x30, 0x3C, 0x07, 0xFF,                         // move.w  #$07FF,d0
+
+	// $0002AC: vram2
+	0x3A, 0x86,                                     // move.w  d6,(a5)
+	0x51, 0xC8, 0xFF, 0xFC,                         // dbf     d0,.vram2
+	0x46, 0xFC, 0x20, 0x00,                         // move.w  #$2000,sr
+
+	// $0002B6: main
+	0x52, 0x79, 0x00, 0xFF, 0x00, 0x00,             // addq.w  #1,($FF0000).l
+	0x30, 0x39, 0x00, 0xFF, 0x00, 0x00,             // move.w  ($FF0000).l,d0
+	0xD1, 0x79, 0x00, 0xFF, 0x00, 0x02,             // add.w   d0,($FF0002).l
+	0x60, 0xEC,                                     // bra.s   .main
+
+	// $0002CA: hint
+	0x28, 0xBC, 0xC0, 0x00, 0x00, 0x00,             // move.l  #$C0000000,(a4)	; CRAM write $00
+	0x54, 0x44,                                     // addq.w  #2,d4
+	0x3A, 0x84,                                     // move.w  d4,(a5)		; raster color
+	0x28, 0xBC, 0x40, 0x00, 0x00, 0x10,             // move.l  #$40000010,(a4)	; VSRAM write $00
+	0x3A, 0x84,                                     // move.w  d4,(a5)		; raster scroll
+	0x4E, 0x73,                                     // rte
+
+	// $0002DE: vint
+	0x48, 0xE7, 0xF0, 0x00,                         // movem.l d0-d3,-(sp)
+	0x52, 0x45,                                     // addq.w  #1,d5			; frame counter
+	0x08, 0x07, 0x00, 0x00,                         // btst    #0,d7			; DMA scenario?
+	0x67, 0x58,                                     // beq.s   .nodma
+	0x38, 0xBC, 0x93, 0x00,                         // move.w  #$9300,(a4)		; DMA length: $1000 words
+	0x38, 0xBC, 0x94, 0x10,                         // move.w  #$9410,(a4)
+	0x38, 0xBC, 0x95, 0x00,                         // move.w  #$9500,(a4)		; DMA source: $000000
+	0x38, 0xBC, 0x96, 0x00,                         // move.w  #$9600,(a4)
+	0x38, 0xBC, 0x97, 0x00,                         // move.w  #$9700,(a4)		; 68K->VDP
+	0x28, 0xBC, 0x40, 0x00, 0x00, 0x80,             // move.l  #$40000080,(a4)	; VRAM DMA $0000
+	0x38, 0xBC, 0x8F, 0x01,                         // move.w  #$8F01,(a4)		; auto-increment 1
+	0x38, 0xBC, 0x93, 0x00,                         // move.w  #$9300,(a4)		; DMA length: $800 bytes
+	0x38, 0xBC, 0x94, 0x08,                         // move.w  #$9408,(a4)
+	0x38, 0xBC, 0x97, 0x80,                         // move.w  #$9780,(a4)		; VRAM fill
+	0x28, 0xBC, 0x40, 0x00, 0x00, 0x82,             // move.l  #$40000082,(a4)	; VRAM DMA $8000
+	0x3A, 0x85,                                     // move.w  d5,(a5)		; fill value
+
+	// $00031C: dmawait
+	0x30, 0x14,                                     // move.w  (a4),d0
+	0x08, 0x00, 0x00, 0x01,                         // btst    #1,d0			; DMA busy?
+	0x66, 0xF8,                                     // bne.s   .dmawait
+	0x38, 0xBC, 0x8F, 0x02,                         // move.w  #$8F02,(a4)		; auto-increment 2
+	0x38, 0xBC, 0x93, 0x40,                         // move.w  #$9340,(a4)		; DMA length: $40 words
+	0x38, 0xBC, 0x94, 0x00,                         // move.w  #$9400,(a4)
+	0x38, 0xBC, 0x95, 0xDB,                         // move.w  #$95xx,(a4)		; DMA source: Palette
+	0x38, 0xBC, 0x96, 0x01,                         // move.w  #$96xx,(a4)
+	0x38, 0xBC, 0x97, 0x00,                         // move.w  #$97xx,(a4)
+	0x28, 0xBC, 0xC0, 0x00, 0x00, 0x80,             // move.l  #$C0000080,(a4)	; CRAM DMA $00
+
+	// $000342: nodma
+	0x08, 0x07, 0x00, 0x01,                         // btst    #1,d7			; Sprite scenario?
+	0x67, 0x4A,                                     // beq.s   .nospr
+	0x28, 0xBC, 0x70, 0x00, 0x00, 0x03,             // move.l  #$70000003,(a4)	; VRAM write $F000
+	0x72, 0x00,                                     // moveq   #0,d1
+
+	// $000350: spr
+	0x30, 0x01,                                     // move.w  d1,d0			; Y = 128 + ((n*4 + frame) & 0xFF)
+	0xE5, 0x48,                                     // lsl.w   #2,d0
+	0xD0, 0x45,                                     // add.w   d5,d0
+	0x02, 0x40, 0x00, 0xFF,                         // andi.w  #$00FF,d0
+	0x06, 0x40, 0x00, 0x80,                         // addi.w  #$0080,d0
+	0x3A, 0x80,                                     // move.w  d0,(a5)
+	0x30, 0x01,                                     // move.w  d1,d0			; 4x4 cells, link = n+1
+	0x52, 0x40,                                     // addq.w  #1,d0
+	0x0C, 0x40, 0x00, 0x50,                         // cmpi.w  #80,d0
+	0x66, 0x02,                                     // bne.s   .link
+	0x70, 0x00,                                     // moveq   #0,d0
+
+	// $00036C: link
+	0x00, 0x40, 0x0F, 0x00,                         // ori.w   #$0F00,d0
+	0x3A, 0x80,                                     // move.w  d0,(a5)
+	0x30, 0x01,                                     // move.w  d1,d0			; tile = n*16, priority every other sprite
+	0xE9, 0x48,                                     // lsl.w   #4,d0
+	0x3A, 0x80,                                     // move.w  d0,(a5)
+	0x30, 0x01,                                     // move.w  d1,d0			; X = 128 + ((n*5 - frame) & 0x1FF)
+	0xE5, 0x48,                                     // lsl.w   #2,d0
+	0xD0, 0x41,                                     // add.w   d1,d0
+	0x90, 0x45,                                     // sub.w   d5,d0
+	0x02, 0x40, 0x01, 0xFF,                         // andi.w  #$01FF,d0
+	0x06, 0x40, 0x00, 0x80,                         // addi.w  #$0080,d0
+	0x3A, 0x80,                                     // move.w  d0,(a5)
+	0x52, 0x41,                                     // addq.w  #1,d1
+	0x0C, 0x41, 0x00, 0x50,                         // cmpi.w  #80,d1
+	0x66, 0xBE,                                     // bne.s   .spr
+
+	// $000392: nospr
+	0x4C, 0xDF, 0x00, 0x0F,                         // movem.l (sp)+,d0-d3
+
+	// $000396: rte
+	0x4E, 0x73,                                     // rte
+
+	// $000398: vdpregs
+	0x80, 0x04,                                     // dc.w    $8004		; HInt off, HV counter enabled
+	0x81, 0x74,                                     // dc.w    $8174		; display on, VInt on, DMA on, Mode 5
+	0x82, 0x30,                                     // dc.w    $8230		; Scroll A: $C000
+	0x83, 0x34,                                     // dc.w    $8334		; Window: $D000
+	0x84, 0x07,                                     // dc.w    $8407		; Scroll B: $E000
+	0x85, 0x78,                                     // dc.w    $8578		; Sprites: $F000
+	0x87, 0x00,                                     // dc.w    $8700		; background color
+	0x8A, 0x00,                                     // dc.w    $8A00		; HInt every line
+	0x8B, 0x00,                                     // dc.w    $8B00		; full-screen scrolling
+	0x8C, 0x81,                                     // dc.w    $8C81		; H40
+	0x8D, 0x3F,                                     // dc.w    $8D3F		; H scroll: $FC00
+	0x8F, 0x02,                                     // dc.w    $8F02		; auto-increment 2
+	0x90, 0x01,                                     // dc.w    $9001		; scroll size: 64x32
+	0x91, 0x00,                                     // dc.w    $9100		; window H
+	0x92, 0x00,                                     // dc.w    $9200		; window V
+
+	// $0003B6: vdpregs_end
+
+	// $0003B6: palette
+	0x0A, 0x4A, 0x0A, 0x68, 0x08, 0x0C, 0x08, 0x22, 0x0E, 0xC6, 0x0E, 0xE4, 0x0C, 0x88, 0x0C, 0xAE,// dc.w    $0A4A,$0A68,$080C,$0822,$0EC6,$0EE4,$0C88,$0CAE
+	0x02, 0x42, 0x00, 0x60, 0x00, 0x04, 0x06, 0xCA, 0x06, 0xEE, 0x04, 0x8C, 0x04, 0xA0, 0x0A, 0x46,// dc.w    $0242,$0060,$0004,$06CA,$06EE,$048C,$04A0,$0A46
+	0x08, 0x6A, 0x08, 0x08, 0x0E, 0x2C, 0x0E, 0xC2, 0x0C, 0xE6, 0x0C, 0x84, 0x02, 0x48, 0x00, 0x6E,// dc.w    $086A,$0808,$0E2C,$0EC2,$0CE6,$0C84,$0248,$006E
+	0x00, 0x02, 0x06, 0x20, 0x06, 0xC4, 0x04, 0xEA, 0x04, 0x8E, 0x0A, 0xAC, 0x08, 0x40, 0x08, 0x66,// dc.w    $0002,$0620,$06C4,$04EA,$048E,$0AAC,$0840,$0866
+	0x0E, 0x2A, 0x0E, 0xC8, 0x0C, 0xEC, 0x0C, 0x82, 0x02, 0xA6, 0x00, 0x44, 0x00, 0x68, 0x06, 0x0E,// dc.w    $0E2A,$0EC8,$0CEC,$0C82,$02A6,$0044,$0068,$060E
+	0x06, 0x22, 0x04, 0xC0, 0x04, 0xE4, 0x0A, 0xAA, 0x08, 0x4E, 0x08, 0x6C, 0x0E, 0x00, 0x0E, 0x26,// dc.w    $0622,$04C0,$04E4,$0AAA,$084E,$086C,$0E00,$0E26
+	0x0C, 0xCA, 0x0C, 0xE8, 0x02, 0x8C, 0x02, 0xA2, 0x00, 0x46, 0x06, 0x64, 0x06, 0x28, 0x04, 0xCE,// dc.w    $0CCA,$0CE8,$028C,$02A2,$0046,$0664,$0628,$04CE
+	0x04, 0xE2, 0x0A, 0x80, 0x0A, 0xA4, 0x08, 0x4A, 0x0E, 0x6E, 0x0E, 0x0C, 0x0C, 0x20, 0x0C, 0xC6,// dc.w    $04E2,$0A80,$0AA4,$084A,$0E6E,$0E0C,$0C20,$0CC6
+
+	// $000436: z80prog
+
+	// $000436: Z80 program. (copied to Z80 RAM $0000)
+	0xF3,                                           // di
+	0x31, 0x00, 0x20,                               // ld    sp,$2000
+	// Z80 $0004: wait
+	0x3A, 0xF0, 0x1F,                               // ld    a,($1FF0)		; FM enable flag
+	0xB7,                                           // or    a
+	0x28, 0xFA,                                     // jr    z,.wait
+	0x21, 0x57, 0x00,                               // ld    hl,YmInitTable
+	// Z80 $000D: init
+	0x7E,                                           // ld    a,(hl)
+	0xFE, 0xFF,                                     // cp    $FF
+	0x28, 0x0B,                                     // jr    z,.play
+	0x32, 0x00, 0x40,                               // ld    ($4000),a
+	0x23,                                           // inc   hl
+	0x7E,                                           // ld    a,(hl)
+	0x32, 0x01, 0x40,                               // ld    ($4001),a
+	0x23,                                           // inc   hl
+	0x18, 0xF0,                                     // jr    .init
+	// Z80 $001D: play
+	0x3E, 0xB6,                                     // ld    a,$B6			; channel 6 panning
+	0x32, 0x02, 0x40,                               // ld    ($4002),a
+	0x3E, 0xC0,                                     // ld    a,$C0
+	0x32, 0x03, 0x40,                               // ld    ($4003),a
+	0x0E, 0xF0,                                     // ld    c,$F0			; key on
+	// Z80 $0029: keys
+	0x3E, 0x28,                                     // ld    a,$28
+	0x32, 0x00, 0x40,                               // ld    ($4000),a
+	0x79,                                           // ld    a,c
+	0x32, 0x01, 0x40,                               // ld    ($4001),a		; channel 1
+	0x3C,                                           // inc   a
+	0x32, 0x01, 0x40,                               // ld    ($4001),a		; channel 2
+	0x3C,                                           // inc   a
+	0x32, 0x01, 0x40,                               // ld    ($4001),a		; channel 3
+	0x79,                                           // ld    a,c
+	0xEE, 0xF0,                                     // xor   $F0
+	0x4F,                                           // ld    c,a
+	0x3E, 0xA0,                                     // ld    a,$A0			; channel 1 frequency
+	0x32, 0x00, 0x40,                               // ld    ($4000),a
+	0x78,                                           // ld    a,b
+	0x32, 0x01, 0x40,                               // ld    ($4001),a
+	0x3E, 0x2A,                                     // ld    a,$2A			; DAC data
+	0x32, 0x00, 0x40,                               // ld    ($4000),a
+	// Z80 $004C: dac
+	0x78,                                           // ld    a,b
+	0x32, 0x01, 0x40,                               // ld    ($4001),a
+	0xC6, 0x05,                                     // add   a,5
+	0x47,                                           // ld    b,a
+	0x20, 0xF7,                                     // jr    nz,.dac
+	0x18, 0xD2,                                     // jr    .keys
+	// Z80 $0057: ymtbl
+	// db ...
+	0x22, 0x00, 0x27, 0x00, 0x2B, 0x80, 0xB0, 0x07, 0xB4, 0xC0, 0xA4, 0x22, 0xA0, 0x69, 0x30, 0x01,
+	// db ...
+	0x40, 0x10, 0x50, 0x1F, 0x60, 0x05, 0x70, 0x02, 0x80, 0x2F, 0x34, 0x01, 0x44, 0x10, 0x54, 0x1F,
+	// db ...
+	0x64, 0x05, 0x74, 0x02, 0x84, 0x2F, 0x38, 0x01, 0x48, 0x10, 0x58, 0x1F, 0x68, 0x05, 0x78, 0x02,
+	// db ...
+	0x88, 0x2F, 0x3C, 0x01, 0x4C, 0x10, 0x5C, 0x1F, 0x6C, 0x05, 0x7C, 0x02, 0x8C, 0x2F, 0xB1, 0x07,
+	// db ...
+	0xB5, 0xC0, 0xA5, 0x23, 0xA1, 0x69, 0x31, 0x01, 0x41, 0x10, 0x51, 0x1F, 0x61, 0x05, 0x71, 0x02,
+	// db ...
+	0x81, 0x2F, 0x35, 0x01, 0x45, 0x10, 0x55, 0x1F, 0x65, 0x05, 0x75, 0x02, 0x85, 0x2F, 0x39, 0x01,
+	// db ...
+	0x49, 0x10, 0x59, 0x1F, 0x69, 0x05, 0x79, 0x02, 0x89, 0x2F, 0x3D, 0x01, 0x4D, 0x10, 0x5D, 0x1F,
+	// db ...
+	0x6D, 0x05, 0x7D, 0x02, 0x8D, 0x2F, 0xB2, 0x07, 0xB6, 0xC0, 0xA6, 0x24, 0xA2, 0x69, 0x32, 0x01,
+	// db ...
+	0x42, 0x10, 0x52, 0x1F, 0x62, 0x05, 0x72, 0x02, 0x82, 0x2F, 0x36, 0x01, 0x46, 0x10, 0x56, 0x1F,
+	// db ...
+	0x66, 0x05, 0x76, 0x02, 0x86, 0x2F, 0x3A, 0x01, 0x4A, 0x10, 0x5A, 0x1F, 0x6A, 0x05, 0x7A, 0x02,
+	// db ...
+	0x8A, 0x2F, 0x3E, 0x01, 0x4E, 0x10, 0x5E, 0x1F, 0x6E, 0x05, 0x7E, 0x02, 0x8E, 0x2F, 0xFF,
+
+	// $00053C: z80end
+
+	// $00053C-$003FFF: Pattern data for the DMA source.
+	0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC,
+	0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C,
+	0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C,
+	0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC,
+	0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C,
+	0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C,
+	0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC,
+	0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C,
+	0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C,
+	0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC,
+	0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC,
+	0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C,
+	0x71, 0x96, 0xBB, 0xE0, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D,
+	0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED,
+	0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D,
+	0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D,
+	0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD,
+	0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D,
+	0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D,
+	0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD,
+	0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D,
+	0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D,
+	0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD,
+	0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D,
+	0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D,
+	0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD,
+	0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD,
+	0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D,
+	0x72, 0x97, 0xBC, 0xE1, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E,
+	0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE,
+	0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E,
+	0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E,
+	0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE,
+	0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E,
+	0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E,
+	0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE,
+	0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E,
+	0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E,
+	0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE,
+	0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E,
+	0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E,
+	0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE,
+	0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE,
+	0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E,
+	0x73, 0x98, 0xBD, 0xE2, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F,
+	0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF,
+	0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F,
+	0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F,
+	0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF,
+	0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F,
+	0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F,
+	0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF,
+	0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F,
+	0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F,
+	0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF,
+	0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F,
+	0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F,
+	0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF,
+	0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF,
+	0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F,
+	0x74, 0x99, 0xBE, 0xE3, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0,
+	0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0,
+	0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40,
+	0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90,
+	0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0,
+	0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30,
+	0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80,
+	0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0,
+	0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20,
+	0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70,
+	0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0,
+	0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10,
+	0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60,
+	0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0,
+	0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00,
+	0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50,
+	0x75, 0x9A, 0xBF, 0xE4, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1,
+	0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1,
+	0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41,
+	0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91,
+	0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1,
+	0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31,
+	0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81,
+	0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1,
+	0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21,
+	0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71,
+	0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1,
+	0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11,
+	0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61,
+	0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1,
+	0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01,
+	0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51,
+	0x76, 0x9B, 0xC0, 0xE5, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2,
+	0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2,
+	0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42,
+	0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92,
+	0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2,
+	0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32,
+	0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82,
+	0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2,
+	0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22,
+	0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72,
+	0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2,
+	0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12,
+	0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62,
+	0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2,
+	0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02,
+	0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52,
+	0x77, 0x9C, 0xC1, 0xE6, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3,
+	0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3,
+	0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43,
+	0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93,
+	0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3,
+	0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33,
+	0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83,
+	0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3,
+	0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23,
+	0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73,
+	0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3,
+	0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13,
+	0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63,
+	0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3,
+	0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03,
+	0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53,
+	0x78, 0x9D, 0xC2, 0xE7, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4,
+	0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4,
+	0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44,
+	0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94,
+	0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4,
+	0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34,
+	0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84,
+	0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4,
+	0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24,
+	0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74,
+	0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4,
+	0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14,
+	0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64,
+	0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4,
+	0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04,
+	0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54,
+	0x79, 0x9E, 0xC3, 0xE8, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5,
+	0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5,
+	0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45,
+	0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95,
+	0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5,
+	0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35,
+	0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85,
+	0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5,
+	0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25,
+	0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75,
+	0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5,
+	0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15,
+	0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65,
+	0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5,
+	0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05,
+	0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55,
+	0x7A, 0x9F, 0xC4, 0xE9, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6,
+	0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6,
+	0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46,
+	0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96,
+	0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6,
+	0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36,
+	0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86,
+	0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6,
+	0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26,
+	0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76,
+	0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6,
+	0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16,
+	0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66,
+	0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6,
+	0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06,
+	0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56,
+	0x7B, 0xA0, 0xC5, 0xEA, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7,
+	0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7,
+	0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47,
+	0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97,
+	0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7,
+	0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37,
+	0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87,
+	0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7,
+	0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27,
+	0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77,
+	0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7,
+	0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17,
+	0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67,
+	0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7,
+	0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07,
+	0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57,
+	0x7C, 0xA1, 0xC6, 0xEB, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8,
+	0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8,
+	0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48,
+	0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98,
+	0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8,
+	0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38,
+	0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88,
+	0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8,
+	0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28,
+	0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78,
+	0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8,
+	0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18,
+	0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68,
+	0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8,
+	0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08,
+	0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58,
+	0x7D, 0xA2, 0xC7, 0xEC, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9,
+	0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9,
+	0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49,
+	0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99,
+	0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9,
+	0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39,
+	0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89,
+	0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9,
+	0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29,
+	0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79,
+	0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9,
+	0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19,
+	0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69,
+	0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9,
+	0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09,
+	0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59,
+	0x7E, 0xA3, 0xC8, 0xED, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA,
+	0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA,
+	0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A,
+	0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A,
+	0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA,
+	0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A,
+	0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A,
+	0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA,
+	0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A,
+	0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A,
+	0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA,
+	0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A,
+	0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A,
+	0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA,
+	0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A,
+	0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A,
+	0x7F, 0xA4, 0xC9, 0xEE, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB,
+	0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB,
+	0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B,
+	0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B,
+	0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB,
+	0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B,
+	0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B,
+	0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB,
+	0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B,
+	0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B,
+	0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB,
+	0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B,
+	0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B,
+	0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB,
+	0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B,
+	0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B,
+	0x80, 0xA5, 0xCA, 0xEF, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC,
+	0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC,
+	0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C,
+	0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C,
+	0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC,
+	0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C,
+	0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C,
+	0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC,
+	0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C,
+	0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C,
+	0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC,
+	0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C,
+	0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C,
+	0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC,
+	0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C,
+	0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C,
+	0x81, 0xA6, 0xCB, 0xF0, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD,
+	0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD,
+	0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D,
+	0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D,
+	0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED,
+	0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D,
+	0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D,
+	0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD,
+	0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D,
+	0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D,
+	0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD,
+	0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D,
+	0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D,
+	0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD,
+	0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D,
+	0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D,
+	0x82, 0xA7, 0xCC, 0xF1, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE,
+	0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE,
+	0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E,
+	0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E,
+	0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE,
+	0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E,
+	0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E,
+	0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE,
+	0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E,
+	0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E,
+	0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE,
+	0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E,
+	0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E,
+	0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE,
+	0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E,
+	0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E,
+	0x83, 0xA8, 0xCD, 0xF2, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF,
+	0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF,
+	0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F,
+	0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F,
+	0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF,
+	0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F,
+	0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F,
+	0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF,
+	0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F,
+	0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F,
+	0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF,
+	0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F,
+	0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F,
+	0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF,
+	0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F,
+	0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F,
+	0x84, 0xA9, 0xCE, 0xF3, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0,
+	0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00,
+	0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50,
+	0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0,
+	0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0,
+	0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40,
+	0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90,
+	0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0,
+	0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30,
+	0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80,
+	0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0,
+	0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20,
+	0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70,
+	0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0,
+	0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10,
+	0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60,
+	0x85, 0xAA, 0xCF, 0xF4, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1,
+	0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01,
+	0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51,
+	0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1,
+	0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1,
+	0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41,
+	0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91,
+	0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1,
+	0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31,
+	0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81,
+	0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1,
+	0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21,
+	0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71,
+	0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1,
+	0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11,
+	0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61,
+	0x86, 0xAB, 0xD0, 0xF5, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2,
+	0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02,
+	0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52,
+	0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2,
+	0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2,
+	0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42,
+	0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92,
+	0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2,
+	0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32,
+	0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82,
+	0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2,
+	0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22,
+	0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72,
+	0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2,
+	0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12,
+	0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62,
+	0x87, 0xAC, 0xD1, 0xF6, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3,
+	0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03,
+	0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53,
+	0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3,
+	0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3,
+	0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43,
+	0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93,
+	0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3,
+	0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33,
+	0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83,
+	0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3,
+	0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23,
+	0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73,
+	0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3,
+	0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13,
+	0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63,
+	0x88, 0xAD, 0xD2, 0xF7, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4,
+	0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04,
+	0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54,
+	0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4,
+	0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4,
+	0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44,
+	0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94,
+	0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4,
+	0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34,
+	0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84,
+	0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4,
+	0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24,
+	0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74,
+	0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4,
+	0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14,
+	0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64,
+	0x89, 0xAE, 0xD3, 0xF8, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5,
+	0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05,
+	0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55,
+	0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5,
+	0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5,
+	0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45,
+	0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95,
+	0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5,
+	0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35,
+	0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85,
+	0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5,
+	0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25,
+	0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75,
+	0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5,
+	0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15,
+	0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65,
+	0x8A, 0xAF, 0xD4, 0xF9, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6,
+	0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06,
+	0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56,
+	0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6,
+	0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6,
+	0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46,
+	0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96,
+	0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6,
+	0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36,
+	0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86,
+	0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6,
+	0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26,
+	0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76,
+	0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6,
+	0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16,
+	0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66,
+	0x8B, 0xB0, 0xD5, 0xFA, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7,
+	0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07,
+	0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57,
+	0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7,
+	0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7,
+	0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47,
+	0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97,
+	0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7,
+	0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37,
+	0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87,
+	0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7,
+	0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27,
+	0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77,
+	0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7,
+	0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17,
+	0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67,
+	0x8C, 0xB1, 0xD6, 0xFB, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8,
+	0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08,
+	0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58,
+	0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8,
+	0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8,
+	0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48,
+	0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98,
+	0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8,
+	0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38,
+	0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88,
+	0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8,
+	0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28,
+	0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78,
+	0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8,
+	0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18,
+	0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68,
+	0x8D, 0xB2, 0xD7, 0xFC, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9,
+	0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09,
+	0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59,
+	0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9,
+	0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9,
+	0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49,
+	0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99,
+	0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9,
+	0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39,
+	0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89,
+	0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9,
+	0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29,
+	0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79,
+	0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9,
+	0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19,
+	0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69,
+	0x8E, 0xB3, 0xD8, 0xFD, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA,
+	0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A,
+	0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A,
+	0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA,
+	0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA,
+	0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A,
+	0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A,
+	0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA,
+	0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A,
+	0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A,
+	0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA,
+	0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A,
+	0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A,
+	0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA,
+	0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A,
+	0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A,
+	0x8F, 0xB4, 0xD9, 0xFE, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB,
+	0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B,
+	0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B,
+	0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB,
+	0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB,
+	0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B,
+	0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B,
+	0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB,
+	0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B,
+	0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B,
+	0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB,
+	0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B,
+	0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B,
+	0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB,
+	0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B,
+	0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B,
+	0x90, 0xB5, 0xDA, 0xFF, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC,
+	0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C,
+	0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C,
+	0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC,
+	0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC,
+	0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C,
+	0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C,
+	0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC,
+	0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C,
+	0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C,
+	0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC,
+	0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C,
+	0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C,
+	0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC,
+	0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C,
+	0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C,
+	0x91, 0xB6, 0xDB, 0x00, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD,
+	0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D,
+	0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D,
+	0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD,
+	0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD,
+	0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D,
+	0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D,
+	0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED,
+	0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D,
+	0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D,
+	0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD,
+	0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D,
+	0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D,
+	0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD,
+	0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D,
+	0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D,
+	0x92, 0xB7, 0xDC, 0x01, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE,
+	0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E,
+	0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E,
+	0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE,
+	0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE,
+	0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E,
+	0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E,
+	0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE,
+	0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E,
+	0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E,
+	0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE,
+	0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E,
+	0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E,
+	0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE,
+	0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E,
+	0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E,
+	0x93, 0xB8, 0xDD, 0x02, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF,
+	0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F,
+	0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F,
+	0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF,
+	0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF,
+	0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F,
+	0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F,
+	0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF,
+	0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F,
+	0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F,
+	0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF,
+	0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F,
+	0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F,
+	0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF,
+	0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F,
+	0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F,
+	0x94, 0xB9, 0xDE, 0x03, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0,
+	0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10,
+	0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60,
+	0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0,
+	0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00,
+	0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50,
+	0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0,
+	0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0,
+	0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40,
+	0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90,
+	0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0,
+	0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30,
+	0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80,
+	0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0,
+	0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20,
+	0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70,
+	0x95, 0xBA, 0xDF, 0x04, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1,
+	0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11,
+	0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61,
+	0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1,
+	0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01,
+	0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51,
+	0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1,
+	0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1,
+	0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41,
+	0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91,
+	0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1,
+	0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31,
+	0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81,
+	0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1,
+	0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21,
+	0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71,
+	0x96, 0xBB, 0xE0, 0x05, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2,
+	0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12,
+	0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62,
+	0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2,
+	0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02,
+	0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52,
+	0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2,
+	0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2,
+	0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42,
+	0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92,
+	0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2,
+	0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32,
+	0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82,
+	0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2,
+	0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22,
+	0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72,
+	0x97, 0xBC, 0xE1, 0x06, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3,
+	0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13,
+	0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63,
+	0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3,
+	0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03,
+	0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53,
+	0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3,
+	0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3,
+	0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43,
+	0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93,
+	0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3,
+	0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33,
+	0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83,
+	0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3,
+	0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23,
+	0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73,
+	0x98, 0xBD, 0xE2, 0x07, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4,
+	0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14,
+	0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64,
+	0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4,
+	0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04,
+	0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54,
+	0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4,
+	0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4,
+	0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44,
+	0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94,
+	0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4,
+	0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34,
+	0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84,
+	0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4,
+	0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24,
+	0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74,
+	0x99, 0xBE, 0xE3, 0x08, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5,
+	0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15,
+	0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65,
+	0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5,
+	0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05,
+	0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55,
+	0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5,
+	0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5,
+	0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45,
+	0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95,
+	0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5,
+	0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35,
+	0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85,
+	0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5,
+	0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25,
+	0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75,
+	0x9A, 0xBF, 0xE4, 0x09, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6,
+	0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16,
+	0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66,
+	0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6,
+	0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06,
+	0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56,
+	0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6,
+	0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6,
+	0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46,
+	0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96,
+	0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6,
+	0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36,
+	0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86,
+	0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6,
+	0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26,
+	0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76,
+	0x9B, 0xC0, 0xE5, 0x0A, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7,
+	0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17,
+	0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67,
+	0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7,
+	0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07,
+	0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57,
+	0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7,
+	0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7,
+	0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47,
+	0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97,
+	0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7,
+	0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37,
+	0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87,
+	0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7,
+	0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27,
+	0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77,
+	0x9C, 0xC1, 0xE6, 0x0B, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8,
+	0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18,
+	0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68,
+	0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8,
+	0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08,
+	0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58,
+	0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8,
+	0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8,
+	0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48,
+	0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98,
+	0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8,
+	0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38,
+	0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88,
+	0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8,
+	0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28,
+	0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78,
+	0x9D, 0xC2, 0xE7, 0x0C, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9,
+	0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19,
+	0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69,
+	0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9,
+	0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09,
+	0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59,
+	0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9,
+	0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9,
+	0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49,
+	0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99,
+	0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9,
+	0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39,
+	0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89,
+	0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9,
+	0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29,
+	0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79,
+	0x9E, 0xC3, 0xE8, 0x0D, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA,
+	0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A,
+	0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A,
+	0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA,
+	0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A,
+	0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A,
+	0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA,
+	0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA,
+	0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A,
+	0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A,
+	0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA,
+	0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A,
+	0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A,
+	0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA,
+	0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A,
+	0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A,
+	0x9F, 0xC4, 0xE9, 0x0E, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB,
+	0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B,
+	0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B,
+	0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB,
+	0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B,
+	0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B,
+	0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB,
+	0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB,
+	0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B,
+	0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B,
+	0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB,
+	0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B,
+	0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B,
+	0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB,
+	0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B,
+	0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B,
+	0xA0, 0xC5, 0xEA, 0x0F, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC,
+	0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C,
+	0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C,
+	0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC,
+	0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C,
+	0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C,
+	0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC,
+	0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC,
+	0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C,
+	0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C,
+	0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC,
+	0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C,
+	0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C,
+	0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC,
+	0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C,
+	0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C,
+	0xA1, 0xC6, 0xEB, 0x10, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD,
+	0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D,
+	0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D,
+	0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD,
+	0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D,
+	0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D,
+	0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD,
+	0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD,
+	0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D,
+	0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D,
+	0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED,
+	0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D,
+	0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D,
+	0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD,
+	0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D,
+	0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D,
+	0xA2, 0xC7, 0xEC, 0x11, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE,
+	0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E,
+	0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E,
+	0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE,
+	0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E,
+	0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E,
+	0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE,
+	0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE,
+	0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E,
+	0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E,
+	0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE,
+	0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E,
+	0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E,
+	0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE,
+	0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E,
+	0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E,
+	0xA3, 0xC8, 0xED, 0x12, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF,
+	0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F,
+	0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F,
+	0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF,
+	0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F,
+	0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F,
+	0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF,
+	0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF,
+	0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F,
+	0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F,
+	0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF,
+	0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F,
+	0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F,
+	0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF,
+	0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F,
+	0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F,
+	0xA4, 0xC9, 0xEE, 0x13, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0,
+	0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20,
+	0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70,
+	0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0,
+	0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10,
+	0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60,
+	0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0,
+	0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00,
+	0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50,
+	0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0,
+	0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0,
+	0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40,
+	0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90,
+	0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0,
+	0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30,
+	0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80,
+	0xA5, 0xCA, 0xEF, 0x14, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1,
+	0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21,
+	0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71,
+	0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1,
+	0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11,
+	0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61,
+	0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1,
+	0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01,
+	0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51,
+	0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1,
+	0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1,
+	0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41,
+	0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91,
+	0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1,
+	0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31,
+	0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81,
+	0xA6, 0xCB, 0xF0, 0x15, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2,
+	0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22,
+	0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72,
+	0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2,
+	0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12,
+	0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62,
+	0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2,
+	0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02,
+	0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52,
+	0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2,
+	0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2,
+	0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42,
+	0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92,
+	0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2,
+	0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32,
+	0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82,
+	0xA7, 0xCC, 0xF1, 0x16, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3,
+	0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23,
+	0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73,
+	0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3,
+	0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13,
+	0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63,
+	0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3,
+	0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03,
+	0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53,
+	0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3,
+	0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3,
+	0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43,
+	0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93,
+	0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3,
+	0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33,
+	0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83,
+	0xA8, 0xCD, 0xF2, 0x17, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4,
+	0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24,
+	0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74,
+	0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4,
+	0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14,
+	0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5, 0x1A, 0x3F, 0x64,
+	0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4,
+	0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04,
+	0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54,
+	0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4,
+	0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4,
+	0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44,
+	0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94,
+	0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4,
+	0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34,
+	0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84,
+	0xA9, 0xCE, 0xF3, 0x18, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66, 0x8B, 0xB0, 0xD5,
+	0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6, 0xDB, 0x00, 0x25,
+	0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06, 0x2B, 0x50, 0x75,
+	0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56, 0x7B, 0xA0, 0xC5,
+	0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6, 0xCB, 0xF0, 0x15,
+	0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6, 0x1B, 0x40, 0x65,
+	0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46, 0x6B, 0x90, 0xB5,
+	0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96, 0xBB, 0xE0, 0x05,
+	0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6, 0x0B, 0x30, 0x55,
+	0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36, 0x5B, 0x80, 0xA5,
+	0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86, 0xAB, 0xD0, 0xF5,
+	0x1A, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6, 0xFB, 0x20, 0x45,
+	0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26, 0x4B, 0x70, 0x95,
+	0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76, 0x9B, 0xC0, 0xE5,
+	0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6, 0xEB, 0x10, 0x35,
+	0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16, 0x3B, 0x60, 0x85,
+	0xAA, 0xCF, 0xF4, 0x19, 0x3F, 0x64, 0x89, 0xAE, 0xD3, 0xF8, 0x1D, 0x42, 0x67, 0x8C, 0xB1, 0xD6,
+	0xFB, 0x20, 0x45, 0x6A, 0x8F, 0xB4, 0xD9, 0xFE, 0x23, 0x48, 0x6D, 0x92, 0xB7, 0xDC, 0x01, 0x26,
+	0x4B, 0x70, 0x95, 0xBA, 0xDF, 0x04, 0x29, 0x4E, 0x73, 0x98, 0xBD, 0xE2, 0x07, 0x2C, 0x51, 0x76,
+	0x9B, 0xC0, 0xE5, 0x0A, 0x2F, 0x54, 0x79, 0x9E, 0xC3, 0xE8, 0x0D, 0x32, 0x57, 0x7C, 0xA1, 0xC6,
+	0xEB, 0x10, 0x35, 0x5A, 0x7F, 0xA4, 0xC9, 0xEE, 0x13, 0x38, 0x5D, 0x82, 0xA7, 0xCC, 0xF1, 0x16,
+	0x3B, 0x60, 0x85, 0xAA, 0xCF, 0xF4, 0x19, 0x3E, 0x63, 0x88, 0xAD, 0xD2, 0xF7, 0x1C, 0x41, 0x66,
+	0x8B, 0xB0, 0xD5, 0xFA, 0x1F, 0x44, 0x69, 0x8E, 0xB3, 0xD8, 0xFD, 0x22, 0x47, 0x6C, 0x91, 0xB6,
+	0xDB, 0x00, 0x25, 0x4A, 0x6F, 0x94, 0xB9, 0xDE, 0x03, 0x28, 0x4D, 0x72, 0x97, 0xBC, 0xE1, 0x06,
+	0x2B, 0x50, 0x75, 0x9A, 0xBF, 0xE4, 0x09, 0x2E, 0x53, 0x78, 0x9D, 0xC2, 0xE7, 0x0C, 0x31, 0x56,
+	0x7B, 0xA0, 0xC5, 0xEA, 0x0F, 0x34, 0x59, 0x7E, 0xA3, 0xC8, 0xED, 0x12, 0x37, 0x5C, 0x81, 0xA6,
+	0xCB, 0xF0, 0x15, 0x3A, 0x5F, 0x84, 0xA9, 0xCE, 0xF3, 0x18, 0x3D, 0x62, 0x87, 0xAC, 0xD1, 0xF6,
+	0x1B, 0x40, 0x65, 0x8A, 0xAF, 0xD4, 0xF9, 0x1E, 0x43, 0x68, 0x8D, 0xB2, 0xD7, 0xFC, 0x21, 0x46,
+	0x6B, 0x90, 0xB5, 0xDA, 0xFF, 0x24, 0x49, 0x6E, 0x93, 0xB8, 0xDD, 0x02, 0x27, 0x4C, 0x71, 0x96,
+	0xBB, 0xE0, 0x05, 0x2A, 0x4F, 0x74, 0x99, 0xBE, 0xE3, 0x08, 0x2D, 0x52, 0x77, 0x9C, 0xC1, 0xE6,
+	0x0B, 0x30, 0x55, 0x7A, 0x9F, 0xC4, 0xE9, 0x0E, 0x33, 0x58, 0x7D, 0xA2, 0xC7, 0xEC, 0x11, 0x36,
+	0x5B, 0x80, 0xA5, 0xCA, 0xEF, 0x14, 0x39, 0x5E, 0x83, 0xA8, 0xCD, 0xF2, 0x17, 0x3C, 0x61, 0x86,
+	0xAB, 0xD0, 0xF5, 0x1A,
+};
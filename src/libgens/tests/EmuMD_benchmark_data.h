@@ -0,0 +1,53 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * EmuMD_benchmark_data.h: Frame benchmark ROM.                            *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_TESTS_EMUMD_BENCHMARK_DATA_H__
+#define __LIBGENS_TESTS_EMUMD_BENCHMARK_DATA_H__
+
+// C includes.
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Frame benchmark ROM for EmuMD_benchmark.
+ * 16 KB, uncompressed.
+ *
+ * The word at $0001FC selects which subsystems are stressed:
+ * - Bit 0: 68K->VRAM DMA, VRAM fill, and CRAM DMA every VBlank.
+ * - Bit 1: 80 moving 32x32 sprites, rewritten every VBlank.
+ * - Bit 2: HInt on every line, writing CRAM and VSRAM.
+ * - Bit 3: Z80 drives the YM2612 (3 FM channels and the DAC).
+ * With no bits set, the 68K and Z80 run busy loops
+ * over a static, fully-populated display.
+ */
+extern const uint8_t test_emumd_benchmark_rom[16384];
+
+// Scenario mask location.
+#define TEST_EMUMD_BENCHMARK_MASK_ADDR	0x0001FC
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LIBGENS_TESTS_EMUMD_BENCHMARK_DATA_H__ */
@@ -0,0 +1,304 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * EmuMD_savestate.cpp: In-memory savestate tests.                         *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Verifies that saveStateToBuffer() and loadStateFromBuffer()
+ * restore the emulation state exactly. The frame benchmark ROM
+ * is used, since it exercises DMA, sprites, HInt, and the YM2612.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+
+// LibZomg
+#include "libzomg/Zomg.hpp"
+#include "libzomg/zomg_vdp.h"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class EmuMD_savestate : public ::testing::TestWithParam<uint16_t>
+{
+	protected:
+		EmuMD_savestate()
+			: ::testing::TestWithParam<uint16_t>()
+			, m_context(nullptr) { }
+		virtual ~EmuMD_savestate() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * Run the emulator for the specified number of frames.
+		 * @param frames Number of frames.
+		 */
+		void runFrames(int frames);
+
+		/**
+		 * Save the current state.
+		 * @param state Buffer for the state.
+		 */
+		void saveState(vector<uint8_t> &state);
+
+		/**
+		 * Copy the current framebuffer.
+		 * @param fb Buffer for the framebuffer.
+		 */
+		void copyFb(vector<uint32_t> &fb);
+
+	protected:
+		TestContext m_test;
+		EmuMD *m_context;
+};
+
+/**
+ * Load the benchmark ROM and create the emulation context.
+ */
+void EmuMD_savestate::SetUp(void)
+{
+	ASSERT_EQ(0, m_test.openBenchmark(GetParam())) << "Emulation context failed to initialize.";
+	m_context = m_test.context();
+}
+
+/**
+ * Tear down the emulation context.
+ */
+void EmuMD_savestate::TearDown(void)
+{
+	m_context = nullptr;
+	m_test.close();
+}
+
+/**
+ * Run the emulator for the specified number of frames.
+ * @param frames Number of frames.
+ */
+void EmuMD_savestate::runFrames(int frames)
+{
+	for (; frames > 0; frames--) {
+		m_context->execFrame();
+	}
+}
+
+/**
+ * Save the current state.
+ * @param state Buffer for the state.
+ */
+void EmuMD_savestate::saveState(vector<uint8_t> &state)
+{
+	ASSERT_EQ(0, TestContext::saveState(m_context, state));
+}
+
+/**
+ * Copy the current framebuffer.
+ * @param fb Buffer for the framebuffer.
+ */
+void EmuMD_savestate::copyFb(vector<uint32_t> &fb)
+{
+	const MdFb *mdfb = m_context->m_vdp->MD_Screen;
+	const uint32_t *src = mdfb->fb32();
+	fb.assign(src, src + (mdfb->pxPitch() * mdfb->numLines()));
+}
+
+/**
+ * Verify that a buffer that's too small is rejected.
+ */
+TEST_P(EmuMD_savestate, bufferTooSmall)
+{
+	runFrames(10);
+	const int size = m_context->saveStateToBuffer(nullptr, 0);
+	ASSERT_GT(size, 0);
+
+	vector<uint8_t> state(size - 1);
+	EXPECT_EQ(-ENOSPC, m_context->saveStateToBuffer(state.data(), state.size()));
+
+	// The state size is constant for a given ROM.
+	runFrames(10);
+	EXPECT_EQ(size, m_context->saveStateToBuffer(nullptr, 0));
+}
+
+/**
+ * Verify that a buffer without a valid header is rejected.
+ */
+TEST_P(EmuMD_savestate, invalidBuffer)
+{
+	vector<uint8_t> state(1024, 0x55);
+	EXPECT_EQ(-EINVAL, m_context->loadStateFromBuffer(state.data(), state.size()));
+	EXPECT_EQ(-EINVAL, m_context->loadStateFromBuffer(nullptr, 0));
+
+	// The header has a little-endian format version after the magic.
+	// Savestates with a different version must be rejected.
+	ASSERT_NO_FATAL_FAILURE(saveState(state));
+	ASSERT_GE(state.size(), 12U);
+	EXPECT_EQ(0, memcmp(state.data(), "ZOMGMEM\0", 8));
+	EXPECT_EQ(1, state[8]);
+	EXPECT_EQ(0, state[9] | state[10] | state[11]);
+	state[8]++;
+	EXPECT_EQ(-EINVAL, m_context->loadStateFromBuffer(state.data(), state.size()));
+}
+
+/**
+ * Save a state, run some frames, restore the state,
+ * and run the same frames again. Both runs must be identical.
+ */
+TEST_P(EmuMD_savestate, roundTrip)
+{
+	static const int FRAMES_BEFORE = 60;
+	static const int FRAMES_AFTER = 30;
+
+	runFrames(FRAMES_BEFORE);
+	vector<uint8_t> state0;
+	ASSERT_NO_FATAL_FAILURE(saveState(state0));
+
+	// First run, without restoring.
+	runFrames(FRAMES_AFTER);
+	vector<uint8_t> state1;
+	ASSERT_NO_FATAL_FAILURE(saveState(state1));
+	vector<uint32_t> fb1;
+	copyFb(fb1);
+
+	// Restore the state. Saving it again must produce the same buffer.
+	ASSERT_EQ(0, m_context->loadStateFromBuffer(state0.data(), state0.size()));
+	vector<uint8_t> stateRestored;
+	ASSERT_NO_FATAL_FAILURE(saveState(stateRestored));
+	EXPECT_TRUE(state0 == stateRestored) << "Restored state doesn't match the saved state.";
+
+	// Second run.
+	runFrames(FRAMES_AFTER);
+	vector<uint8_t> state2;
+	ASSERT_NO_FATAL_FAILURE(saveState(state2));
+	vector<uint32_t> fb2;
+	copyFb(fb2);
+
+	// Third run. Restoring the same state twice must be deterministic.
+	ASSERT_EQ(0, m_context->loadStateFromBuffer(state0.data(), state0.size()));
+	runFrames(FRAMES_AFTER);
+	vector<uint8_t> state3;
+	ASSERT_NO_FATAL_FAILURE(saveState(state3));
+	vector<uint32_t> fb3;
+	copyFb(fb3);
+
+	EXPECT_TRUE(state2 == state3) << "Emulation state diverged after restoring twice.";
+	EXPECT_TRUE(fb2 == fb3) << "Framebuffer diverged after restoring twice.";
+
+	// TODO: ZOMG doesn't save the YM2612 timers yet, so if the
+	// YM2612 is in use, the restored run can't match the original.
+	if (!(GetParam() & 0x0008)) {
+		EXPECT_TRUE(state1 == state2) << "Emulation state diverged after restoring.";
+		EXPECT_TRUE(fb1 == fb2) << "Framebuffer diverged after restoring.";
+	}
+}
+
+/**
+ * Pending FIFO entries must survive a savestate round trip.
+ * The savestate only has the VDP registers and control state,
+ * with two pending VRam writes.
+ */
+TEST_P(EmuMD_savestate, pendingFifo)
+{
+	static const uint16_t fifo[4] = {0x1111, 0x2222, 0x3333, 0x4444};
+
+	runFrames(1);
+	Vdp *const vdp = m_context->m_vdp;
+	uint8_t vdp_reg[24];
+	for (int i = 0; i < 24; i++) {
+		ASSERT_EQ(0, vdp->dbg_getReg(i, &vdp_reg[i]));
+	}
+
+	Zomg_VDP_ctrl_16_t ctrl;
+	memset(&ctrl, 0, sizeof(ctrl));
+	ctrl.header = ZOMG_VDPCTRL_16_HEADER;
+	ctrl.code = 0x01;	// VRam write
+	memcpy(ctrl.data_fifo, fifo, sizeof(ctrl.data_fifo));
+	ctrl.data_fifo_index = 2;
+	ctrl.data_fifo_count = 2;
+
+	vector<uint8_t> buf(65536);
+	LibZomg::Zomg zs(buf.data(), buf.size(), LibZomg::Zomg::ZOMG_SAVE);
+	ASSERT_TRUE(zs.isOpen());
+	zs.saveVdpReg(vdp_reg, sizeof(vdp_reg));
+	zs.saveVdpCtrl_16(&ctrl);
+	const size_t used = zs.bufferUsed();
+	zs.close();
+	ASSERT_LE(used, buf.size());
+
+	LibZomg::Zomg zl(buf.data(), used, LibZomg::Zomg::ZOMG_LOAD);
+	ASSERT_TRUE(zl.isOpen());
+	vdp->zomgRestoreMD(&zl);
+	zl.close();
+	EXPECT_FALSE(vdp->isStatusStable()) << "Pending FIFO entries were discarded.";
+
+	// Saving the state again must keep the pending entries.
+	vector<uint8_t> buf2(1048576);
+	LibZomg::Zomg zs2(buf2.data(), buf2.size(), LibZomg::Zomg::ZOMG_SAVE);
+	ASSERT_TRUE(zs2.isOpen());
+	vdp->zomgSaveMD(&zs2);
+	const size_t used2 = zs2.bufferUsed();
+	zs2.close();
+	ASSERT_LE(used2, buf2.size());
+
+	LibZomg::Zomg zl2(buf2.data(), used2, LibZomg::Zomg::ZOMG_LOAD);
+	ASSERT_TRUE(zl2.isOpen());
+	Zomg_VDP_ctrl_16_t ctrl2;
+	ASSERT_GT(zl2.loadVdpCtrl_16(&ctrl2), 0);
+	zl2.close();
+	EXPECT_EQ(2, ctrl2.data_fifo_index);
+	EXPECT_EQ(2, ctrl2.data_fifo_count);
+	EXPECT_EQ(0, memcmp(fifo, ctrl2.data_fifo, sizeof(fifo)));
+}
+
+// Test cases.
+// Scenario masks are the same as EmuMD_benchmark.
+INSTANTIATE_TEST_CASE_P(EmuMD_savestate, EmuMD_savestate,
+	::testing::Values(0x0000, 0x0001, 0x0002, 0x0004, 0x0008, 0x000F));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: EmuMD in-memory savestates.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
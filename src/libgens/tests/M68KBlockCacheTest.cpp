@@ -0,0 +1,406 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * M68KBlockCacheTest.cpp: M68K decoded block cache tests.                 *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Verifies that the M68K decoded block cache and the dynamic
+ * recompiler don't change the emulation, including code that
+ * modifies itself in RAM, and reports the frame rate of each
+ * with a program that only uses the CPU.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "cpu/M68K.hpp"
+#include "Util/Timing.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class M68KBlockCacheTest : public ::testing::Test
+{
+	protected:
+		M68KBlockCacheTest()
+			: ::testing::Test() { }
+		virtual ~M68KBlockCacheTest() { }
+
+		/**
+		 * M68K execution backends.
+		 */
+		enum Backend {
+			BACKEND_INTERPRETER,	// Plain interpreter.
+			BACKEND_BLOCK_CACHE,	// Decoded block cache.
+			BACKEND_JIT,		// Dynamic recompiler.
+
+			BACKEND_MAX
+		};
+
+		/**
+		 * Get a backend's name.
+		 * @param backend Backend.
+		 * @return Name.
+		 */
+		static const char *backendName(Backend backend);
+
+		/**
+		 * Is a backend supported by the 68000 core and the host?
+		 * @param backend Backend.
+		 * @return True if supported; false if not.
+		 */
+		static bool isBackendAvailable(Backend backend);
+
+		/**
+		 * Select the M68K execution backend.
+		 * @param context Emulation context.
+		 * @param backend M68K execution backend.
+		 * @return True on success; false on error.
+		 */
+		static bool setBackend(EmuMD *context, Backend backend);
+
+		/**
+		 * Save the current state.
+		 * @param context Emulation context.
+		 * @param state Buffer for the state.
+		 */
+		static void saveState(EmuContext *context, vector<uint8_t> &state);
+};
+
+/**
+ * Get a backend's name.
+ * @param backend Backend.
+ * @return Name.
+ */
+const char *M68KBlockCacheTest::backendName(Backend backend)
+{
+	switch (backend) {
+		case BACKEND_INTERPRETER:	return "interpreter";
+		case BACKEND_BLOCK_CACHE:	return "block cache";
+		case BACKEND_JIT:		return "JIT";
+		default:			return "unknown";
+	}
+}
+
+/**
+ * Is a backend supported by the 68000 core and the host?
+ * @param backend Backend.
+ * @return True if supported; false if not.
+ */
+bool M68KBlockCacheTest::isBackendAvailable(Backend backend)
+{
+	switch (backend) {
+		case BACKEND_INTERPRETER:	return true;
+		case BACKEND_BLOCK_CACHE:	return M68K::isBlockCacheAvailable();
+		case BACKEND_JIT:		return M68K::isJitAvailable();
+		default:			return false;
+	}
+}
+
+/**
+ * Select the M68K execution backend.
+ * @param context Emulation context.
+ * @param backend M68K execution backend.
+ * @return True on success; false on error.
+ */
+bool M68KBlockCacheTest::setBackend(EmuMD *context, Backend backend)
+{
+	M68K *const m68k = context->m_m68k;
+	m68k->setBlockCache(backend != BACKEND_INTERPRETER);
+	if (backend == BACKEND_JIT && m68k->setJit(true) != 0)
+		return false;
+	return true;
+}
+
+/**
+ * Save the current state.
+ * @param context Emulation context.
+ * @param state Buffer for the state.
+ */
+void M68KBlockCacheTest::saveState(EmuContext *context, vector<uint8_t> &state)
+{
+	ASSERT_EQ(0, TestContext::saveState(context, state));
+}
+
+/**
+ * Test ROM program.
+ * A subroutine is copied to RAM and called, then patched
+ * through RAM and through a RAM mirror and called again.
+ * Each version adds a different value to d0.
+ */
+static const uint8_t test_prg[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x41,0xF9,0x00,0xFF,0x00,0x00,		// 0x204: lea	$FF0000, a0
+	0x70,0x00,				// 0x20A: moveq	#0, d0
+	0x20,0xBC,0x52,0x80,0x4E,0x75,		// 0x20C: move.l	#$52804E75, (a0)	; addq.l #1, d0; rts
+	0x4E,0xB9,0x00,0xFF,0x00,0x00,		// 0x212: jsr	$FF0000		; d0 = 1
+	0x4E,0xB9,0x00,0xFF,0x00,0x00,		// 0x218: jsr	$FF0000		; d0 = 2
+	0x30,0xBC,0x54,0x80,			// 0x21E: move.w	#$5480, (a0)	; addq.l #2, d0
+	0x4E,0xB9,0x00,0xFF,0x00,0x00,		// 0x222: jsr	$FF0000		; d0 = 4
+	0x33,0xFC,0x56,0x80,0x00,0xE0,0x00,0x00,// 0x228: move.w	#$5680, $E00000	; addq.l #3, d0
+	0x4E,0xB9,0x00,0xFF,0x00,0x00,		// 0x230: jsr	$FF0000		; d0 = 7
+	0x4E,0xB9,0x00,0xFF,0x00,0x00,		// 0x236: jsr	$FF0000		; d0 = 10
+	0x60,0xFE,				// 0x23C: bra.s	*
+};
+
+/**
+ * Code modified in RAM must not be run from stale cached blocks.
+ */
+TEST_F(M68KBlockCacheTest, selfModifyingCode)
+{
+	TestContext test;
+	for (int i = 0; i < BACKEND_MAX; i++) {
+		const Backend backend = (Backend)i;
+		if (!isBackendAvailable(backend))
+			continue;
+
+		ASSERT_EQ(0, test.openProgram(test_prg, sizeof(test_prg))) << "Emulation context failed to initialize.";
+		EmuMD *const context = test.context();
+		ASSERT_TRUE(setBackend(context, backend)) << "Backend: " << backendName(backend);
+		EXPECT_EQ((backend != BACKEND_INTERPRETER), context->m_m68k->isBlockCacheEnabled());
+		EXPECT_EQ((backend == BACKEND_JIT), context->m_m68k->isJitEnabled());
+		context->execFrame();
+
+		Zomg_M68KRegSave_t reg;
+		context->m_m68k->zomgSaveReg(&reg);
+		EXPECT_EQ(10U, reg.dreg[0]) << "Backend: " << backendName(backend);
+		EXPECT_EQ(0x23CU, reg.pc);
+	}
+}
+
+/**
+ * The block cache and the recompiler must not change the emulation.
+ * The benchmark ROM is run in lockstep with each backend and with the
+ * interpreter, and the state and framebuffer are compared after each frame.
+ */
+TEST_F(M68KBlockCacheTest, matchesInterpreter)
+{
+	static const int FRAMES = 60;
+	static const uint16_t masks[] = {0x0000, 0x0001, 0x0008, 0x000F};
+
+	TestContext test[BACKEND_MAX];
+	for (unsigned int m = 0; m < sizeof(masks)/sizeof(masks[0]); m++) {
+		// Context 0 is the reference interpreter.
+		EmuMD *context[BACKEND_MAX];
+		int count = 0;
+		for (int j = 0; j < BACKEND_MAX; j++) {
+			if (!isBackendAvailable((Backend)j))
+				continue;
+			ASSERT_EQ(0, test[count].openBenchmark(masks[m])) << "Backend: " << backendName((Backend)j);
+			context[count] = test[count].context();
+			ASSERT_TRUE(setBackend(context[count], (Backend)j)) << "Backend: " << backendName((Backend)j);
+			count++;
+		}
+
+		vector<uint8_t> state[BACKEND_MAX];
+		for (int i = 0; i < FRAMES; i++) {
+			for (int j = 0; j < count; j++) {
+				context[j]->execFrame();
+				ASSERT_NO_FATAL_FAILURE(saveState(context[j], state[j]));
+			}
+
+			const MdFb *fb0 = context[0]->m_vdp->MD_Screen;
+			const size_t fbSize = fb0->pxPitch() * fb0->numLines() * sizeof(uint32_t);
+			for (int j = 1; j < count; j++) {
+				ASSERT_TRUE(state[0] == state[j]) << "State diverged at frame " << i
+					<< " with scenario mask 0x" << std::hex << masks[m]
+					<< " (backend: " << backendName((Backend)j) << ").";
+				const MdFb *fb = context[j]->m_vdp->MD_Screen;
+				ASSERT_EQ(0, memcmp(fb0->fb32(), fb->fb32(), fbSize)) << "Frame " << i
+					<< " diverged with scenario mask 0x" << std::hex << masks[m]
+					<< " (backend: " << backendName((Backend)j) << ").";
+			}
+		}
+	}
+}
+
+/**
+ * ALU test program.
+ * Runs each instruction that the recompiler translates into
+ * host code instead of calling its handler, with values that
+ * cover the carry, overflow, zero, and negative flags.
+ */
+static const uint8_t alu_prg[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x70,0x00,				// 0x204: moveq	#0, d0
+	0x72,0x01,				// 0x206: moveq	#1, d1
+	0x74,0xFF,				// 0x208: moveq	#-1, d2
+	0xD2,0x82,				// 0x20A: add.l	d2, d1
+	0x5E,0x82,				// 0x20C: addq.l	#7, d2
+	0x26,0x01,				// 0x20E: move.l	d1, d3
+	0x96,0x82,				// 0x210: sub.l	d2, d3
+	0xB6,0x81,				// 0x212: cmp.l	d1, d3
+	0x57,0x83,				// 0x214: subq.l	#3, d3
+	0xC6,0x81,				// 0x216: and.l	d1, d3
+	0x86,0x82,				// 0x218: or.l	d2, d3
+	0xB7,0x80,				// 0x21A: eor.l	d3, d0
+	0x46,0x83,				// 0x21C: not.l	d3
+	0x4A,0x83,				// 0x21E: tst.l	d3
+	0x52,0x48,				// 0x220: addq.w	#1, a0
+	0x55,0x89,				// 0x222: subq.l	#2, a1
+	0x50,0x89,				// 0x224: addq.l	#8, a1
+	0x42,0x84,				// 0x226: clr.l	d4
+	0x78,0x80,				// 0x228: moveq	#-128, d4
+	0xD0,0x80,				// 0x22A: add.l	d0, d0
+	0x60,0xDC,				// 0x22C: bra.s	$20A
+};
+
+/**
+ * Lockstep mode must check translated blocks against the interpreter
+ * without changing the emulation. The benchmark ROM and the ALU test
+ * program are run with the recompiler in lockstep mode and with the
+ * interpreter, and the state is compared after each frame.
+ */
+TEST_F(M68KBlockCacheTest, jitLockstep)
+{
+	static const int FRAMES = 60;
+	static const uint16_t masks[] = {0x0000, 0x0001, 0x0008, 0x000F};
+	// Benchmark ROM scenarios, followed by the ALU test program.
+	static const unsigned int RUNS = (sizeof(masks)/sizeof(masks[0])) + 1;
+
+	if (!isBackendAvailable(BACKEND_JIT))
+		return;
+
+	for (unsigned int m = 0; m < RUNS; m++) {
+		char desc[32];
+		TestContext test[2];
+		for (int j = 0; j < 2; j++) {
+			if (m < RUNS - 1) {
+				snprintf(desc, sizeof(desc), "scenario mask 0x%04X", masks[m]);
+				ASSERT_EQ(0, test[j].openBenchmark(masks[m]));
+			} else {
+				snprintf(desc, sizeof(desc), "ALU test program");
+				ASSERT_EQ(0, test[j].openProgram(alu_prg, sizeof(alu_prg)));
+			}
+		}
+		EmuMD *const ref = test[0].context();
+		EmuMD *const jit = test[1].context();
+		ASSERT_TRUE(setBackend(jit, BACKEND_JIT));
+		ASSERT_EQ(0, jit->m_m68k->setJitLockstep(true));
+
+		vector<uint8_t> refState, jitState;
+		for (int i = 0; i < FRAMES; i++) {
+			ref->execFrame();
+			jit->execFrame();
+			ASSERT_NO_FATAL_FAILURE(saveState(ref, refState));
+			ASSERT_NO_FATAL_FAILURE(saveState(jit, jitState));
+			ASSERT_TRUE(refState == jitState) << "State diverged at frame " << i
+				<< " with " << desc << '.';
+		}
+
+		unsigned int checked, mismatches;
+		jit->m_m68k->jitLockstepStats(&checked, &mismatches);
+		EXPECT_GT(checked, 0U) << "With " << desc << '.';
+		EXPECT_EQ(0U, mismatches) << "With " << desc << '.';
+	}
+}
+
+/**
+ * Benchmark program.
+ * A loop of register-only ALU instructions, so the frame rate
+ * mostly depends on the 68000 core and not on the VDP.
+ */
+static const uint8_t bench_prg[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x70,0x00,				// 0x204: moveq	#0, d0
+	0x72,0x00,				// 0x206: moveq	#0, d1
+	0xD0,0x81,				// 0x208: add.l	d1, d0
+	0x52,0x81,				// 0x20A: addq.l	#1, d1
+	0xB3,0x80,				// 0x20C: eor.l	d1, d0
+	0xE3,0x88,				// 0x20E: lsl.l	#1, d0
+	0xD2,0x40,				// 0x210: add.w	d0, d1
+	0x90,0x81,				// 0x212: sub.l	d1, d0
+	0xE6,0x59,				// 0x214: ror.w	#3, d1
+	0x46,0x80,				// 0x216: not.l	d0
+	0x60,0xEE,				// 0x218: bra.s	$208
+};
+
+/**
+ * Report the frame rate of each backend with a program that
+ * only uses the CPU. All backends must produce the same registers.
+ */
+TEST_F(M68KBlockCacheTest, benchmark)
+{
+	static const int FRAMES = 1200;
+
+	TestContext test;
+	Zomg_M68KRegSave_t ref;
+	Timing timing;
+	for (int i = 0; i < BACKEND_MAX; i++) {
+		const Backend backend = (Backend)i;
+		if (!isBackendAvailable(backend))
+			continue;
+
+		ASSERT_EQ(0, test.openProgram(bench_prg, sizeof(bench_prg))) << "Emulation context failed to initialize.";
+		EmuMD *const context = test.context();
+		ASSERT_TRUE(setBackend(context, backend)) << "Backend: " << backendName(backend);
+
+		const uint64_t start = timing.getTimeNs();
+		for (int j = 0; j < FRAMES; j++) {
+			context->execFrame();
+		}
+		const uint64_t totalNs = timing.getTimeNs() - start;
+		ASSERT_GT(totalNs, 0ULL);
+
+		Zomg_M68KRegSave_t reg;
+		context->m_m68k->zomgSaveReg(&reg);
+		if (backend == BACKEND_INTERPRETER) {
+			ref = reg;
+		} else {
+			EXPECT_EQ(0, memcmp(ref.dreg, reg.dreg, sizeof(reg.dreg))) << "Backend: " << backendName(backend);
+			EXPECT_EQ(ref.pc, reg.pc) << "Backend: " << backendName(backend);
+		}
+
+		printf("benchmark=M68KBlockCache backend=\"%s\" frames=%d total_ns=%llu fps=%.2f\n",
+			backendName(backend), FRAMES, (unsigned long long)totalNs,
+			(double)FRAMES * 1000000000.0 / (double)totalNs);
+		fflush(stdout);
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: M68K block cache.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -0,0 +1,248 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * M68KCoreBenchmark.cpp: 68000 core throughput and accuracy benchmark.    *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Runs the bundled frame benchmark ROM on the 68000 core libgens
+ * was built with, and reports its frame rate and how closely its
+ * output matches the default core.
+ *
+ * The 68000 core is selected at build time (ENABLE_M68000_NEW),
+ * so the cores are compared by running this benchmark from each
+ * build. Each scenario prints one "key=value" line:
+ * - fps: Frames per second, excluding the accuracy checks.
+ * - video_frames: Number of frames whose framebuffer matches
+ *   the default core. This is checked every M68K_CHECKPOINT_FRAMES
+ *   frames.
+ *
+ * The reference checksums were recorded with the default core,
+ * so they must match exactly if it's the one being tested.
+ * Only the framebuffer is checksummed, so the references don't
+ * depend on the savestate format.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "cpu/M68K.hpp"
+#include "Util/Timing.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// zlib
+#include <zlib.h>
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <sstream>
+
+namespace LibGens { namespace Tests {
+
+// Number of frames to run.
+#define M68K_BENCHMARK_FRAMES 600
+// Number of frames between accuracy checkpoints.
+#define M68K_CHECKPOINT_FRAMES 120
+#define M68K_CHECKPOINTS (M68K_BENCHMARK_FRAMES / M68K_CHECKPOINT_FRAMES)
+
+struct M68KCoreBenchmark_scenario
+{
+	const char *name;
+	uint16_t mask;	// Scenario mask. (See EmuMD_benchmark_data.h.)
+
+	// Reference framebuffer checksums from the default core,
+	// one for each checkpoint.
+	uint32_t videoCrc[M68K_CHECKPOINTS];
+};
+
+/**
+ * Accuracy tracking for one checksum.
+ */
+struct M68KCoreBenchmark_accuracy
+{
+	uint32_t crc;		// Checksum of all frames so far.
+	int matchingFrames;	// Frames that match the reference.
+	bool matching;		// True if all checkpoints matched so far.
+
+	M68KCoreBenchmark_accuracy()
+		: crc(0)
+		, matchingFrames(0)
+		, matching(true) { }
+
+	/**
+	 * Check a checkpoint.
+	 * @param frames Number of frames run.
+	 * @param ref Reference checksum.
+	 * @return True if the checkpoint matches; false if it doesn't.
+	 */
+	bool check(int frames, uint32_t ref)
+	{
+		if (crc != ref) {
+			matching = false;
+			return false;
+		}
+		if (matching)
+			matchingFrames = frames;
+		return true;
+	}
+};
+
+/**
+ * Formatting function for M68KCoreBenchmark_scenario.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const M68KCoreBenchmark_scenario& scenario)
+{
+	return os << scenario.name;
+};
+
+class M68KCoreBenchmark : public ::testing::TestWithParam<M68KCoreBenchmark_scenario>
+{
+	protected:
+		M68KCoreBenchmark()
+			: ::testing::TestWithParam<M68KCoreBenchmark_scenario>()
+			, m_context(nullptr) { }
+		virtual ~M68KCoreBenchmark() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+	protected:
+		TestContext m_test;
+		EmuMD *m_context;
+};
+
+/**
+ * Load the benchmark ROM and create the emulation context.
+ */
+void M68KCoreBenchmark::SetUp(void)
+{
+	const M68KCoreBenchmark_scenario &scenario = GetParam();
+
+	ASSERT_EQ(0, m_test.openBenchmark(scenario.mask)) << "Emulation context failed to initialize.";
+	m_context = m_test.context();
+}
+
+/**
+ * Tear down the emulation context.
+ */
+void M68KCoreBenchmark::TearDown(void)
+{
+	m_context = nullptr;
+	m_test.close();
+}
+
+/**
+ * Run the benchmark ROM and report the frame rate
+ * and the number of frames that match the default core.
+ */
+TEST_P(M68KCoreBenchmark, execFrame)
+{
+	const M68KCoreBenchmark_scenario &scenario = GetParam();
+	const MdFb *fb = m_context->m_vdp->MD_Screen;
+	const size_t fbSize = fb->pxPitch() * fb->numLines() * sizeof(uint32_t);
+
+	Timing timing;
+	uint64_t totalNs = 0;
+	M68KCoreBenchmark_accuracy video;
+	for (int i = 0; i < M68K_BENCHMARK_FRAMES; i++) {
+		const uint64_t start = timing.getTimeNs();
+		m_context->execFrame();
+		totalNs += timing.getTimeNs() - start;
+
+		// Checksum the framebuffer.
+		video.crc = crc32(video.crc, (const Bytef*)fb->fb32(), fbSize);
+
+		if (((i + 1) % M68K_CHECKPOINT_FRAMES) != 0)
+			continue;
+
+		const int checkpoint = (i / M68K_CHECKPOINT_FRAMES);
+		const bool videoOK = video.check(i + 1, scenario.videoCrc[checkpoint]);
+#ifndef LIBGENS_M68000_NEW
+		// The reference checksums are from this core.
+		EXPECT_TRUE(videoOK) << "Framebuffer checksum 0x" << std::hex << video.crc
+			<< " doesn't match the reference at frame " << std::dec << (i + 1) << '.';
+#else
+		((void)videoOK);
+#endif
+	}
+	ASSERT_GT(totalNs, 0ULL);
+
+	// Report the results.
+	const double fps = (double)M68K_BENCHMARK_FRAMES * 1000000000.0 / (double)totalNs;
+	char buf[64];
+	std::ostringstream oss;
+	oss << "benchmark=M68KCore core=\"" << M68K::coreName() << '"'
+	    << " scenario=" << scenario.name
+	    << " frames=" << M68K_BENCHMARK_FRAMES
+	    << " total_ns=" << totalNs;
+	snprintf(buf, sizeof(buf), "%.2f", fps);
+	oss << " fps=" << buf
+	    << " video_frames=" << video.matchingFrames;
+	RecordProperty("core", M68K::coreName());
+	RecordProperty("frames", M68K_BENCHMARK_FRAMES);
+	RecordProperty("fps", buf);
+	RecordProperty("video_frames", video.matchingFrames);
+
+	printf("%s\n", oss.str().c_str());
+	fflush(stdout);
+}
+
+// Test cases.
+static const M68KCoreBenchmark_scenario scenarios[] = {
+	{"idle", 0x0000,
+		{0x3F3DB4C7, 0xDBA8D145, 0x8A6B0179, 0xF8AE9903, 0xCCA20A88}},
+	{"dma", 0x0001,
+		{0xC7058812, 0xD7AFCE23, 0x1344FA3E, 0x98FC9915, 0xBFDB4D85}},
+	{"sprites", 0x0002,
+		{0xE7643EC5, 0xC2BA0C51, 0x6F9E6CA2, 0x5A26E0AA, 0x08226406}},
+	{"hint", 0x0004,
+		{0xB76F95EE, 0x917DD163, 0x159F4413, 0x7F533684, 0x686F3525}},
+	{"fm", 0x0008,
+		{0x3F3DB4C7, 0xDBA8D145, 0x8A6B0179, 0xF8AE9903, 0xCCA20A88}},
+	{"all", 0x000F,
+		{0x45C1FF1E, 0x805B7202, 0x0B4F236A, 0x1DFE6497, 0x7AE6CF81}},
+};
+
+INSTANTIATE_TEST_CASE_P(M68KCoreBenchmark, M68KCoreBenchmark,
+	::testing::ValuesIn(scenarios));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: 68000 core benchmark.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n68000 core: %s\n\n", LibGens::M68K::coreName());
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
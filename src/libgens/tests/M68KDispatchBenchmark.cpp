@@ -0,0 +1,395 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * M68KDispatchBenchmark.cpp: 68000 opcode dispatch benchmark.             *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Compares the full opcode tables (a 512 KB handler table and a
+ * 64 KB cycle table) with the compact opcode table (16-bit handler
+ * indexes) by running the benchmark ROM with each of them.
+ *
+ * The block cache is disabled, since replayed blocks don't use
+ * the opcode tables. Each scenario prints one "key=value" line
+ * per dispatch mode:
+ * - fps: Frames per second.
+ * - cache_misses: Cache misses, as counted by the CPU.
+ * - l1d_misses: L1 data cache read misses.
+ * The cache counters are only available on Linux, and only if
+ * perf events are allowed; otherwise, they're reported as "n/a".
+ *
+ * Both modes must produce the same framebuffer and savestate.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "cpu/M68K.hpp"
+#include "Util/Timing.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// zlib
+#include <zlib.h>
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+// perf events.
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// C++ includes.
+#include <sstream>
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+// Number of frames to run.
+#define M68K_DISPATCH_FRAMES 300
+
+struct M68KDispatchBenchmark_scenario
+{
+	const char *name;
+	uint16_t mask;	// Scenario mask. (See EmuMD_benchmark_data.h.)
+};
+
+/**
+ * Formatting function for M68KDispatchBenchmark_scenario.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const M68KDispatchBenchmark_scenario& scenario)
+{
+	return os << scenario.name;
+};
+
+/**
+ * Hardware event counter for the current thread.
+ * Only user-mode events are counted.
+ */
+class PerfCounter
+{
+	public:
+		/**
+		 * Open a counter.
+		 * @param type perf_event_attr type.
+		 * @param config perf_event_attr config.
+		 */
+		PerfCounter(uint32_t type, uint64_t config);
+		~PerfCounter();
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		// TODO: Add LibGens-specific version of Q_DISABLE_COPY().
+		PerfCounter(const PerfCounter &);
+		PerfCounter &operator=(const PerfCounter &);
+
+	public:
+		/**
+		 * Is the counter available?
+		 * @return True if available; false if not.
+		 */
+		inline bool isOpen(void) const { return (m_fd >= 0); }
+
+		/**
+		 * Start counting.
+		 */
+		void start(void);
+
+		/**
+		 * Stop counting.
+		 */
+		void stop(void);
+
+		/**
+		 * Get the number of events counted so far.
+		 * @return Number of events.
+		 */
+		uint64_t value(void) const;
+
+	private:
+		int m_fd;
+};
+
+PerfCounter::PerfCounter(uint32_t type, uint64_t config)
+	: m_fd(-1)
+{
+#ifdef __linux__
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	m_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+	if (m_fd >= 0) {
+		ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+	}
+#else
+	((void)type);
+	((void)config);
+#endif
+}
+
+PerfCounter::~PerfCounter()
+{
+#ifdef __linux__
+	if (m_fd >= 0) {
+		close(m_fd);
+	}
+#endif
+}
+
+void PerfCounter::start(void)
+{
+#ifdef __linux__
+	if (m_fd >= 0) {
+		ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+	}
+#endif
+}
+
+void PerfCounter::stop(void)
+{
+#ifdef __linux__
+	if (m_fd >= 0) {
+		ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+	}
+#endif
+}
+
+uint64_t PerfCounter::value(void) const
+{
+	uint64_t count = 0;
+#ifdef __linux__
+	if (m_fd >= 0) {
+		if (read(m_fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) {
+			count = 0;
+		}
+	}
+#endif
+	return count;
+}
+
+#ifndef __linux__
+// Dummy event IDs.
+#define PERF_TYPE_HARDWARE 0
+#define PERF_TYPE_HW_CACHE 3
+#define PERF_COUNT_HW_CACHE_MISSES 3
+#define PERF_COUNT_HW_CACHE_L1D 0
+#define PERF_COUNT_HW_CACHE_OP_READ 0
+#define PERF_COUNT_HW_CACHE_RESULT_MISS 1
+#endif
+
+class M68KDispatchBenchmark : public ::testing::TestWithParam<M68KDispatchBenchmark_scenario>
+{
+	protected:
+		M68KDispatchBenchmark()
+			: ::testing::TestWithParam<M68KDispatchBenchmark_scenario>() { }
+		virtual ~M68KDispatchBenchmark() { }
+
+		virtual void TearDown(void) override;
+
+		/**
+		 * Benchmark results for one dispatch mode.
+		 */
+		struct Result {
+			uint64_t totalNs;
+			uint64_t cacheMisses;
+			uint64_t l1dMisses;
+			bool hasCounters;
+			uint32_t videoCrc;
+			uint32_t stateCrc;
+		};
+
+		/**
+		 * Run the benchmark ROM.
+		 * @param compact If true, use the compact opcode table.
+		 * @param result [out] Results.
+		 */
+		void run(bool compact, Result *result);
+
+		/**
+		 * Print the results for one dispatch mode.
+		 * @param compact If true, the compact opcode table was used.
+		 * @param result Results.
+		 */
+		void report(bool compact, const Result &result);
+
+	protected:
+		TestContext m_test;
+};
+
+/**
+ * Delete the emulation context.
+ */
+void M68KDispatchBenchmark::TearDown(void)
+{
+	m_test.close();
+}
+
+/**
+ * Run the benchmark ROM.
+ * @param compact If true, use the compact opcode table.
+ * @param result [out] Results.
+ */
+void M68KDispatchBenchmark::run(bool compact, Result *result)
+{
+	memset(result, 0, sizeof(*result));
+
+	// Each dispatch mode starts from power-on.
+	const M68KDispatchBenchmark_scenario &scenario = GetParam();
+	ASSERT_EQ(0, m_test.openBenchmark(scenario.mask)) << "Emulation context failed to initialize.";
+	EmuMD *const context = m_test.context();
+
+	// Replayed blocks don't use the opcode tables.
+	M68K *const m68k = context->m_m68k;
+	m68k->setBlockCache(false);
+	m68k->setCompactDispatch(compact);
+
+	const MdFb *fb = context->m_vdp->MD_Screen;
+	const size_t fbSize = fb->pxPitch() * fb->numLines() * sizeof(uint32_t);
+	vector<uint8_t> state;
+
+	PerfCounter cacheMisses(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+	PerfCounter l1dMisses(PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+		(PERF_COUNT_HW_CACHE_OP_READ << 8) |
+		(PERF_COUNT_HW_CACHE_RESULT_MISS << 16));
+	result->hasCounters = (cacheMisses.isOpen() && l1dMisses.isOpen());
+
+	Timing timing;
+	for (int i = 0; i < M68K_DISPATCH_FRAMES; i++) {
+		const uint64_t start = timing.getTimeNs();
+		cacheMisses.start();
+		l1dMisses.start();
+		context->execFrame();
+		l1dMisses.stop();
+		cacheMisses.stop();
+		result->totalNs += timing.getTimeNs() - start;
+
+		// Checksum the framebuffer and the savestate.
+		result->videoCrc = crc32(result->videoCrc, (const Bytef*)fb->fb32(), fbSize);
+		ASSERT_EQ(0, TestContext::saveState(context, state));
+		result->stateCrc = crc32(result->stateCrc, state.data(), state.size());
+	}
+	result->cacheMisses = cacheMisses.value();
+	result->l1dMisses = l1dMisses.value();
+}
+
+/**
+ * Print the results for one dispatch mode.
+ * @param compact If true, the compact opcode table was used.
+ * @param result Results.
+ */
+void M68KDispatchBenchmark::report(bool compact, const Result &result)
+{
+	const M68KDispatchBenchmark_scenario &scenario = GetParam();
+	const double fps = (double)M68K_DISPATCH_FRAMES * 1000000000.0 / (double)result.totalNs;
+	const char *const mode = (compact ? "compact" : "full");
+	char buf[64];
+
+	std::ostringstream oss;
+	oss << "benchmark=M68KDispatch dispatch=" << mode
+	    << " scenario=" << scenario.name
+	    << " frames=" << M68K_DISPATCH_FRAMES
+	    << " total_ns=" << result.totalNs;
+	snprintf(buf, sizeof(buf), "%.2f", fps);
+	oss << " fps=" << buf;
+	if (result.hasCounters) {
+		oss << " cache_misses=" << result.cacheMisses
+		    << " l1d_misses=" << result.l1dMisses;
+	} else {
+		oss << " cache_misses=n/a l1d_misses=n/a";
+	}
+
+	const std::string prefix = std::string(mode) + '_';
+	RecordProperty(prefix + "fps", buf);
+	if (result.hasCounters) {
+		RecordProperty(prefix + "cache_misses", (int)result.cacheMisses);
+		RecordProperty(prefix + "l1d_misses", (int)result.l1dMisses);
+	}
+
+	printf("%s\n", oss.str().c_str());
+	fflush(stdout);
+}
+
+/**
+ * Run the benchmark ROM with each dispatch mode.
+ * Both modes must produce the same results.
+ */
+TEST_P(M68KDispatchBenchmark, execFrame)
+{
+#ifdef LIBGENS_M68000_NEW
+	// The Musashi 3.4 core doesn't have the compact opcode table.
+	return;
+#endif
+
+	Result full, compact;
+	ASSERT_NO_FATAL_FAILURE(run(false, &full));
+	ASSERT_NO_FATAL_FAILURE(run(true, &compact));
+	ASSERT_GT(full.totalNs, 0ULL);
+	ASSERT_GT(compact.totalNs, 0ULL);
+
+	EXPECT_EQ(full.videoCrc, compact.videoCrc) << "Framebuffers differ between the dispatch modes.";
+	EXPECT_EQ(full.stateCrc, compact.stateCrc) << "Savestates differ between the dispatch modes.";
+
+	report(false, full);
+	report(true, compact);
+}
+
+// Test cases.
+static const M68KDispatchBenchmark_scenario scenarios[] = {
+	{"idle", 0x0000},
+	{"dma", 0x0001},
+	{"sprites", 0x0002},
+	{"hint", 0x0004},
+	{"fm", 0x0008},
+	{"all", 0x000F},
+};
+
+INSTANTIATE_TEST_CASE_P(M68KDispatchBenchmark, M68KDispatchBenchmark,
+	::testing::ValuesIn(scenarios));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: 68000 opcode dispatch benchmark.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
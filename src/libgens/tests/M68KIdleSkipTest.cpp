@@ -0,0 +1,404 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * M68KIdleSkipTest.cpp: M68K idle loop skipping tests.                    *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Verifies that 68000 idle loop skipping only skips loops that
+ * can't change anything, and that it doesn't change the emulation.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "cpu/M68K.hpp"
+#include "cpu/M68K_Mem.hpp"
+#include "Cartridge/RomCartridgeMD.hpp"
+#include "Util/Timing.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class M68KIdleSkipTest : public ::testing::Test
+{
+	protected:
+		M68KIdleSkipTest()
+			: ::testing::Test() { }
+		virtual ~M68KIdleSkipTest() { }
+
+		/**
+		 * M68K execution backends.
+		 */
+		enum Backend {
+			BACKEND_INTERPRETER,	// Plain interpreter.
+			BACKEND_COMPACT,	// Compact opcode table.
+			BACKEND_BLOCK_CACHE,	// Decoded block cache.
+
+			BACKEND_MAX
+		};
+
+		/**
+		 * Get a backend's name.
+		 * @param backend Backend.
+		 * @return Name.
+		 */
+		static const char *backendName(Backend backend);
+
+		/**
+		 * Select the M68K execution backend.
+		 * @param context Emulation context.
+		 * @param backend M68K execution backend.
+		 * @param idleSkip If true, enable idle loop skipping.
+		 */
+		static void setBackend(EmuMD *context, Backend backend, bool idleSkip);
+
+		/**
+		 * Run a test program for a few frames.
+		 * @param prg Program.
+		 * @param size Size of the program.
+		 * @param idleSkip If true, enable idle loop skipping.
+		 * @param reg [out] 68000 registers.
+		 * @return Number of cycles skipped.
+		 */
+		static unsigned int runProgram(const uint8_t *prg, unsigned int size,
+			bool idleSkip, Zomg_M68KRegSave_t *reg);
+
+		/**
+		 * Save the current state.
+		 * @param context Emulation context.
+		 * @param state Buffer for the state.
+		 */
+		static void saveState(EmuContext *context, vector<uint8_t> &state);
+
+		// Number of frames to run test programs for.
+		static const int PRG_FRAMES = 4;
+};
+
+/**
+ * Get a backend's name.
+ * @param backend Backend.
+ * @return Name.
+ */
+const char *M68KIdleSkipTest::backendName(Backend backend)
+{
+	switch (backend) {
+		case BACKEND_INTERPRETER:	return "interpreter";
+		case BACKEND_COMPACT:		return "compact";
+		case BACKEND_BLOCK_CACHE:	return "block cache";
+		default:			return "unknown";
+	}
+}
+
+/**
+ * Select the M68K execution backend.
+ * @param context Emulation context.
+ * @param backend M68K execution backend.
+ * @param idleSkip If true, enable idle loop skipping.
+ */
+void M68KIdleSkipTest::setBackend(EmuMD *context, Backend backend, bool idleSkip)
+{
+	M68K *const m68k = context->m_m68k;
+	m68k->setBlockCache(backend == BACKEND_BLOCK_CACHE);
+	m68k->setCompactDispatch(backend == BACKEND_COMPACT);
+	m68k->setIdleSkip(idleSkip);
+}
+
+/**
+ * Run a test program for a few frames.
+ * @param prg Program.
+ * @param size Size of the program.
+ * @param idleSkip If true, enable idle loop skipping.
+ * @param reg [out] 68000 registers.
+ * @return Number of cycles skipped.
+ */
+unsigned int M68KIdleSkipTest::runProgram(const uint8_t *prg, unsigned int size,
+	bool idleSkip, Zomg_M68KRegSave_t *reg)
+{
+	TestContext test;
+	EXPECT_EQ(0, test.openProgram(prg, size)) << "Emulation context failed to initialize.";
+	EmuMD *const context = test.context();
+	if (!context)
+		return 0;
+	setBackend(context, BACKEND_INTERPRETER, idleSkip);
+	EXPECT_EQ(idleSkip && M68K::isIdleSkipAvailable(), context->m_m68k->isIdleSkipEnabled());
+
+	for (int i = 0; i < PRG_FRAMES; i++) {
+		context->execFrame();
+	}
+	context->m_m68k->zomgSaveReg(reg);
+	return context->m_m68k->idleCyclesSkipped();
+}
+
+/**
+ * Save the current state.
+ * @param context Emulation context.
+ * @param state Buffer for the state.
+ */
+void M68KIdleSkipTest::saveState(EmuContext *context, vector<uint8_t> &state)
+{
+	ASSERT_EQ(0, TestContext::saveState(context, state));
+}
+
+/**
+ * Test program: Wait for a RAM flag that's never set.
+ */
+static const uint8_t test_prg_ram[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x70,0x05,				// 0x204: moveq	#5, d0
+	0x4A,0x79,0x00,0xFF,0x00,0x00,		// 0x206: tst.w	$FF0000
+	0x67,0xF8,				// 0x20C: beq.s	$206
+	0x60,0xFE,				// 0x20E: bra.s	*
+};
+
+/**
+ * Test program: Wait for VBlank in the VDP status register.
+ */
+static const uint8_t test_prg_vblank[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x33,0xFC,0x81,0x44,0x00,0xC0,0x00,0x04,// 0x204: move.w	#$8144, $C00004	; display on
+	0x70,0x00,				// 0x20C: moveq	#0, d0
+	0x08,0x39,0x00,0x03,0x00,0xC0,0x00,0x05,// 0x20E: btst	#3, $C00005
+	0x66,0xF6,				// 0x216: bne.s	$20E	; wait for active display
+	0x08,0x39,0x00,0x03,0x00,0xC0,0x00,0x05,// 0x218: btst	#3, $C00005
+	0x67,0xF6,				// 0x220: beq.s	$218	; wait for VBlank
+	0x52,0x80,				// 0x222: addq.l	#1, d0
+	0x60,0xE8,				// 0x224: bra.s	$20E
+};
+
+/**
+ * Test program: Loop that writes to RAM.
+ */
+static const uint8_t test_prg_write[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x70,0x05,				// 0x204: moveq	#5, d0
+	0x33,0xC0,0x00,0xFF,0x00,0x00,		// 0x206: move.w	d0, $FF0000
+	0x60,0xF8,				// 0x20C: bra.s	$206
+};
+
+/**
+ * Test program: Loop that reads the HV counter.
+ */
+static const uint8_t test_prg_hv[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x30,0x39,0x00,0xC0,0x00,0x08,		// 0x204: move.w	$C00008, d0
+	0x60,0xF8,				// 0x20A: bra.s	$204
+};
+
+/**
+ * Test program: Loop that counts.
+ */
+static const uint8_t test_prg_count[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x52,0x80,				// 0x204: addq.l	#1, d0
+	0x4A,0x79,0x00,0xFF,0x00,0x00,		// 0x206: tst.w	$FF0000
+	0x67,0xF6,				// 0x20C: beq.s	$204
+};
+
+/**
+ * Polling loops that can't change anything are skipped,
+ * and the result is the same as running them.
+ */
+TEST_F(M68KIdleSkipTest, idleLoopsSkipped)
+{
+	if (!M68K::isIdleSkipAvailable()) {
+		// Idle loop skipping isn't supported by this core.
+		printf("Skipping: not supported by the %s core.\n", M68K::coreName());
+		return;
+	}
+
+	Zomg_M68KRegSave_t reg, ref;
+
+	// RAM flag.
+	EXPECT_GT(runProgram(test_prg_ram, sizeof(test_prg_ram), true, &reg), 0U);
+	EXPECT_EQ(0U, runProgram(test_prg_ram, sizeof(test_prg_ram), false, &ref));
+	EXPECT_EQ(0, memcmp(&ref, &reg, sizeof(reg)));
+	EXPECT_EQ(5U, reg.dreg[0]);
+
+	// VDP status register.
+	EXPECT_GT(runProgram(test_prg_vblank, sizeof(test_prg_vblank), true, &reg), 0U);
+	EXPECT_EQ(0U, runProgram(test_prg_vblank, sizeof(test_prg_vblank), false, &ref));
+	EXPECT_EQ(0, memcmp(&ref, &reg, sizeof(reg)));
+	EXPECT_GE(reg.dreg[0], (unsigned int)PRG_FRAMES - 1);
+}
+
+/**
+ * Loops that write to memory, read memory that changes on its own,
+ * or change registers are not skipped.
+ */
+TEST_F(M68KIdleSkipTest, busyLoopsNotSkipped)
+{
+	Zomg_M68KRegSave_t reg;
+
+	EXPECT_EQ(0U, runProgram(test_prg_write, sizeof(test_prg_write), true, &reg));
+	EXPECT_EQ(0U, runProgram(test_prg_hv, sizeof(test_prg_hv), true, &reg));
+	EXPECT_EQ(0U, runProgram(test_prg_count, sizeof(test_prg_count), true, &reg));
+}
+
+/**
+ * Idle loop skipping is enabled by default,
+ * unless the ROM fixups disable it.
+ */
+TEST_F(M68KIdleSkipTest, enabledByDefault)
+{
+	TestContext test;
+	ASSERT_EQ(0, test.openProgram(test_prg_ram, sizeof(test_prg_ram))) << "Emulation context failed to initialize.";
+	EmuMD *const context = test.context();
+	EXPECT_TRUE(context->m_m68kMem->m_romCartridge->isIdleSkipAllowed());
+	EXPECT_EQ(M68K::isIdleSkipAvailable(), context->m_m68k->isIdleSkipEnabled());
+
+	// Disabling it stops skipping.
+	context->m_m68k->setIdleSkip(false);
+	EXPECT_FALSE(context->m_m68k->isIdleSkipEnabled());
+	context->execFrame();
+	EXPECT_EQ(0U, context->m_m68k->idleCyclesSkipped());
+}
+
+/**
+ * The EmuContext::IdleSkip() setting disables idle loop skipping
+ * for new contexts, and updateIdleSkip() applies it to existing ones.
+ */
+TEST_F(M68KIdleSkipTest, userSetting)
+{
+	TestContext test;
+	EmuContext::SetIdleSkip(false);
+	ASSERT_EQ(0, test.openProgram(test_prg_ram, sizeof(test_prg_ram))) << "Emulation context failed to initialize.";
+	EmuMD *const context = test.context();
+	EXPECT_FALSE(context->m_m68k->isIdleSkipEnabled());
+	context->execFrame();
+	EXPECT_EQ(0U, context->m_m68k->idleCyclesSkipped());
+
+	EmuContext::SetIdleSkip(true);
+	context->updateIdleSkip();
+	EXPECT_EQ(M68K::isIdleSkipAvailable(), context->m_m68k->isIdleSkipEnabled());
+}
+
+/**
+ * Idle loop skipping must not change the emulation.
+ * The benchmark ROM is run in lockstep with each backend with skipping,
+ * and with the interpreter without skipping, and the state and
+ * framebuffer are compared after each frame.
+ */
+TEST_F(M68KIdleSkipTest, matchesNoSkip)
+{
+	static const int FRAMES = 120;
+	static const uint16_t masks[] = {0x0000, 0x0001, 0x0004, 0x000F};
+
+	TestContext test[BACKEND_MAX+1];
+	for (unsigned int m = 0; m < sizeof(masks)/sizeof(masks[0]); m++) {
+		// Context 0 is the reference: the interpreter without skipping.
+		EmuMD *context[BACKEND_MAX+1];
+		ASSERT_EQ(0, test[0].openBenchmark(masks[m]));
+		context[0] = test[0].context();
+		setBackend(context[0], BACKEND_INTERPRETER, false);
+		for (int j = 0; j < BACKEND_MAX; j++) {
+			ASSERT_EQ(0, test[j+1].openBenchmark(masks[m])) << "Backend: " << backendName((Backend)j);
+			context[j+1] = test[j+1].context();
+			setBackend(context[j+1], (Backend)j, true);
+		}
+
+		vector<uint8_t> state[BACKEND_MAX+1];
+		for (int i = 0; i < FRAMES; i++) {
+			for (int j = 0; j <= BACKEND_MAX; j++) {
+				context[j]->execFrame();
+				ASSERT_NO_FATAL_FAILURE(saveState(context[j], state[j]));
+			}
+
+			const MdFb *fb0 = context[0]->m_vdp->MD_Screen;
+			const size_t fbSize = fb0->pxPitch() * fb0->numLines() * sizeof(uint32_t);
+			for (int j = 1; j <= BACKEND_MAX; j++) {
+				ASSERT_TRUE(state[0] == state[j]) << "State diverged at frame " << i
+					<< " with scenario mask 0x" << std::hex << masks[m]
+					<< " (backend: " << backendName((Backend)(j-1)) << ").";
+				const MdFb *fb = context[j]->m_vdp->MD_Screen;
+				ASSERT_EQ(0, memcmp(fb0->fb32(), fb->fb32(), fbSize)) << "Frame " << i
+					<< " diverged with scenario mask 0x" << std::hex << masks[m]
+					<< " (backend: " << backendName((Backend)(j-1)) << ").";
+			}
+		}
+
+		EXPECT_EQ(0U, context[0]->m_m68k->idleCyclesSkipped());
+	}
+}
+
+/**
+ * Report the frame rate of a program that waits for VBlank
+ * with and without skipping.
+ * NOTE: The benchmark ROM's scenarios run busy loops that
+ * write to RAM, so they don't have any idle loops to skip.
+ */
+TEST_F(M68KIdleSkipTest, benchmark)
+{
+	static const int FRAMES = 300;
+
+	TestContext test;
+	Timing timing;
+	double fps[2];
+	unsigned int skipped = 0;
+	for (int s = 0; s < 2; s++) {
+		ASSERT_EQ(0, test.openProgram(test_prg_vblank, sizeof(test_prg_vblank)));
+		EmuMD *const context = test.context();
+		setBackend(context, BACKEND_BLOCK_CACHE, (s != 0));
+
+		const uint64_t start = timing.getTimeNs();
+		for (int i = 0; i < FRAMES; i++) {
+			context->execFrame();
+		}
+		const uint64_t totalNs = timing.getTimeNs() - start;
+		ASSERT_GT(totalNs, 0ULL);
+		fps[s] = (double)FRAMES * 1000000000.0 / (double)totalNs;
+		if (s != 0)
+			skipped = context->m_m68k->idleCyclesSkipped();
+	}
+
+	printf("benchmark=M68KIdleSkip core=\"%s\" scenario=vblank_wait frames=%d"
+		" fps_noskip=%.2f fps_skip=%.2f skipped_cycles=%u\n",
+		M68K::coreName(), FRAMES, fps[0], fps[1], skipped);
+	fflush(stdout);
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: M68K idle loop skipping.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -0,0 +1,285 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * MdFbLineDiffTest.cpp: MdFb line change detection tests.                 *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Rom.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Util/MdFb.hpp"
+#include "Util/MdFbLineDiff.hpp"
+#include "Effects/FastBlur.hpp"
+
+// Test ROM data.
+#include "EmuMD_benchmark_data.h"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class MdFbLineDiffTest : public ::testing::Test
+{
+	protected:
+		MdFbLineDiffTest()
+			: ::testing::Test() { }
+		virtual ~MdFbLineDiffTest() { }
+
+		// Number of frames to render.
+		static const int FRAMES = 90;
+
+		/**
+		 * Get a copy of a framebuffer line.
+		 * @param fb Framebuffer.
+		 * @param line Line number.
+		 * @return Visible pixels of the line.
+		 */
+		static vector<uint8_t> copyLine(const MdFb *fb, int line);
+
+		/**
+		 * Render frames of the EmuMD benchmark ROM and
+		 * check the line hashes against the pixel data.
+		 * @param bpp Color depth.
+		 * @param deferred If true, enable deferred rendering.
+		 */
+		static void checkFrames(MdFb::ColorDepth bpp, bool deferred);
+};
+
+/**
+ * Get a copy of a framebuffer line.
+ * @param fb Framebuffer.
+ * @param line Line number.
+ * @return Visible pixels of the line.
+ */
+vector<uint8_t> MdFbLineDiffTest::copyLine(const MdFb *fb, int line)
+{
+	const uint8_t *px;
+	int bytes;
+	if (fb->bpp() == MdFb::BPP_32) {
+		px = (const uint8_t*)fb->lineBuf32(line);
+		bytes = fb->pxPerLine() * 4;
+	} else {
+		px = (const uint8_t*)fb->lineBuf16(line);
+		bytes = fb->pxPerLine() * 2;
+	}
+	return vector<uint8_t>(px, px + bytes);
+}
+
+/**
+ * Render frames of the EmuMD benchmark ROM and
+ * check the line hashes against the pixel data.
+ * @param bpp Color depth.
+ * @param deferred If true, enable deferred rendering.
+ */
+void MdFbLineDiffTest::checkFrames(MdFb::ColorDepth bpp, bool deferred)
+{
+	// Enable all scenarios.
+	uint8_t *romData = (uint8_t*)malloc(sizeof(test_emumd_benchmark_rom));
+	memcpy(romData, test_emumd_benchmark_rom, sizeof(test_emumd_benchmark_rom));
+	romData[TEST_EMUMD_BENCHMARK_MASK_ADDR] = 0x00;
+	romData[TEST_EMUMD_BENCHMARK_MASK_ADDR+1] = 0x0F;
+
+	Rom *rom = new Rom(romData, sizeof(test_emumd_benchmark_rom));
+	EmuMD *context = new EmuMD(rom);
+	rom->close();	// TODO: Let EmuMD handle this...
+	ASSERT_TRUE(context->isRomOpened());
+
+	Vdp *const vdp = context->m_vdp;
+	MdFb *const fb = vdp->MD_Screen;
+	fb->setBpp(bpp);
+	vdp->setDeferredRender(deferred);
+
+	MdFbLineDiff lineDiff;
+	vector<vector<uint8_t> > prevLines(fb->numLines());
+	int totalChanged = 0;
+
+	for (int i = 0; i < FRAMES; i++) {
+		context->execFrame();
+		const int changed = lineDiff.update(fb);
+		totalChanged += changed;
+
+		int count = 0;
+		for (int line = 0; line < fb->numLines(); line++) {
+			// Every line is hashed when it's rendered.
+			ASSERT_NE(MdFb::LINE_HASH_INVALID, fb->lineHash(line))
+				<< "frame " << i << ", line " << line;
+
+			// A line is reported as changed if and only if
+			// its pixels differ from the previous frame.
+			vector<uint8_t> cur = copyLine(fb, line);
+			const bool pxChanged = (i == 0 || cur != prevLines[line]);
+			ASSERT_EQ(pxChanged, lineDiff.isLineChanged(line))
+				<< "frame " << i << ", line " << line;
+			if (pxChanged)
+				count++;
+			prevLines[line].swap(cur);
+		}
+		ASSERT_EQ(count, changed) << "frame " << i;
+
+		// The runs must cover exactly the changed lines.
+		int runLines = 0;
+		int line = 0, run;
+		while ((run = lineDiff.nextRun(&line)) > 0) {
+			for (int j = line; j < line + run; j++) {
+				ASSERT_TRUE(lineDiff.isLineChanged(j)) << "frame " << i << ", line " << j;
+			}
+			if (line > 0) {
+				ASSERT_FALSE(lineDiff.isLineChanged(line - 1)) << "frame " << i;
+			}
+			runLines += run;
+			line += run;
+		}
+		ASSERT_EQ(changed, runLines) << "frame " << i;
+	}
+
+	// The benchmark ROM is animated, but it doesn't
+	// redraw the entire screen every frame.
+	EXPECT_GT(totalChanged, fb->numLines());
+	EXPECT_LT(totalChanged, fb->numLines() * FRAMES);
+
+	delete context;
+	delete rom;
+	free(romData);
+}
+
+/**
+ * Line hashes must match the pixel data. (16-bit color)
+ */
+TEST_F(MdFbLineDiffTest, emuMD_16bit)
+{
+	checkFrames(MdFb::BPP_16, false);
+}
+
+/**
+ * Line hashes must match the pixel data. (32-bit color)
+ */
+TEST_F(MdFbLineDiffTest, emuMD_32bit)
+{
+	checkFrames(MdFb::BPP_32, false);
+}
+
+/**
+ * Line hashes must match the pixel data with deferred rendering.
+ */
+TEST_F(MdFbLineDiffTest, emuMD_deferred)
+{
+	checkFrames(MdFb::BPP_32, true);
+}
+
+/**
+ * Changing the framebuffer reports all lines as changed.
+ */
+TEST_F(MdFbLineDiffTest, invalidate)
+{
+	MdFb *fb = new MdFb();
+	fb->setBpp(MdFb::BPP_32);
+	fb->updateLineHashes();
+
+	MdFbLineDiff lineDiff;
+	EXPECT_EQ(fb->numLines(), lineDiff.update(fb));
+	EXPECT_EQ(0, lineDiff.update(fb));
+
+	// Modify a single line.
+	fb->lineBuf32(100)[5] = 0x123456;
+	fb->updateLineHash(100);
+	EXPECT_EQ(1, lineDiff.update(fb));
+	EXPECT_TRUE(lineDiff.isLineChanged(100));
+
+	// Invalidated lines are always reported as changed.
+	fb->invalidateLineHashes();
+	EXPECT_EQ(fb->numLines(), lineDiff.update(fb));
+	fb->updateLineHashes();
+	EXPECT_EQ(fb->numLines(), lineDiff.update(fb));
+	EXPECT_EQ(0, lineDiff.update(fb));
+
+	// Resetting the line diff reports all lines as changed.
+	lineDiff.reset();
+	EXPECT_EQ(fb->numLines(), lineDiff.update(fb));
+
+	fb->unref();
+}
+
+/**
+ * Fast Blur on a range of lines must match a full Fast Blur.
+ */
+TEST_F(MdFbLineDiffTest, fastBlurRange)
+{
+	static const MdFb::ColorDepth bpps[] = {MdFb::BPP_16, MdFb::BPP_32};
+	for (int b = 0; b < 2; b++) {
+		MdFb *src = new MdFb();
+		MdFb *full = new MdFb();
+		MdFb *range = new MdFb();
+		src->setBpp(bpps[b]);
+		full->setBpp(bpps[b]);
+		range->setBpp(bpps[b]);
+
+		srand(0x4642);
+		for (int line = 0; line < src->numLines(); line++) {
+			for (int x = 0; x < src->pxPerLine(); x++) {
+				if (bpps[b] == MdFb::BPP_32)
+					src->lineBuf32(line)[x] = (uint32_t)(rand() ^ (rand() << 16));
+				else
+					src->lineBuf16(line)[x] = (uint16_t)rand();
+			}
+		}
+
+		FastBlur::DoFastBlur(full, src);
+		FastBlur::DoFastBlur(range, src, 0, 10);
+		FastBlur::DoFastBlur(range, src, 10, 1);
+		FastBlur::DoFastBlur(range, src, 11, src->numLines() - 11);
+
+		for (int line = 0; line < src->numLines(); line++) {
+			ASSERT_TRUE(copyLine(full, line) == copyLine(range, line))
+				<< "bpp index " << b << ", line " << line;
+		}
+
+		src->unref();
+		full->unref();
+		range->unref();
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: MdFb line change detection.\n\n");
+	LibGens::Init();
+	fflush(nullptr);
+
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
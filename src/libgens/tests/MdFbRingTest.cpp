@@ -0,0 +1,265 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * MdFbRingTest.cpp: Triple-buffered MdFb ring tests.                      *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Rom.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Util/MdFb.hpp"
+#include "Util/MdFbRing.hpp"
+
+// Test ROM data.
+#include "EmuMD_benchmark_data.h"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstring>
+#include <cstdlib>
+
+// C++ includes.
+#include <thread>
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class MdFbRingTest : public ::testing::Test
+{
+	protected:
+		MdFbRingTest() { }
+		virtual ~MdFbRingTest() { }
+
+		/**
+		 * Fill a framebuffer with a single value.
+		 * @param fb MdFb.
+		 * @param value Value.
+		 */
+		static void fillFb(MdFb *fb, uint32_t value);
+
+		/**
+		 * Check if a framebuffer is filled with a single value.
+		 * @param fb MdFb.
+		 * @param value Value. (from the first pixel)
+		 * @return True if all pixels are the same.
+		 */
+		static bool checkFb(const MdFb *fb, uint32_t *value);
+};
+
+/**
+ * Fill a framebuffer with a single value.
+ * @param fb MdFb.
+ * @param value Value.
+ */
+void MdFbRingTest::fillFb(MdFb *fb, uint32_t value)
+{
+	uint32_t *px = fb->fb32();
+	const int count = fb->pxPitch() * fb->numLines() - fb->pxStart();
+	for (int i = 0; i < count; i++) {
+		px[i] = value;
+	}
+}
+
+/**
+ * Check if a framebuffer is filled with a single value.
+ * @param fb MdFb.
+ * @param value Value. (from the first pixel)
+ * @return True if all pixels are the same.
+ */
+bool MdFbRingTest::checkFb(const MdFb *fb, uint32_t *value)
+{
+	const uint32_t *px = fb->fb32();
+	const int count = fb->pxPitch() * fb->numLines() - fb->pxStart();
+	*value = px[0];
+	for (int i = 1; i < count; i++) {
+		if (px[i] != *value)
+			return false;
+	}
+	return true;
+}
+
+/**
+ * The three buffers must be distinct, and acquire()
+ * must return the most recently published buffer.
+ */
+TEST_F(MdFbRingTest, publishAcquire)
+{
+	MdFbRing ring;
+	MdFb *const front = ring.readFb();
+	EXPECT_NE(front, ring.writeFb());
+	EXPECT_FALSE(ring.hasNewFrame());
+
+	// No new frame: acquire() returns the same buffer.
+	EXPECT_EQ(front, ring.acquire());
+
+	// Publish one frame.
+	MdFb *const frame1 = ring.writeFb();
+	ring.publish();
+	EXPECT_TRUE(ring.hasNewFrame());
+	EXPECT_NE(frame1, ring.writeFb());
+	EXPECT_NE(front, ring.writeFb());
+	EXPECT_EQ(frame1, ring.acquire());
+	EXPECT_FALSE(ring.hasNewFrame());
+	EXPECT_EQ(frame1, ring.readFb());
+
+	// Publish two frames without acquiring.
+	// The older frame is dropped.
+	MdFb *const frame2 = ring.writeFb();
+	ring.publish();
+	MdFb *const frame3 = ring.writeFb();
+	EXPECT_NE(frame1, frame3);
+	ring.publish();
+	EXPECT_EQ(frame2, ring.writeFb());
+	EXPECT_EQ(frame3, ring.acquire());
+	EXPECT_NE(frame3, ring.writeFb());
+}
+
+/**
+ * Concurrent writer and reader.
+ * Each frame is filled with its frame number; the reader
+ * must never see a partially-written frame, and frame
+ * numbers must never go backwards.
+ */
+TEST_F(MdFbRingTest, threaded)
+{
+	static const uint32_t FRAMES = 2000;
+	MdFbRing ring;
+	fillFb(ring.readFb(), 0);
+
+	std::thread writer([&ring]() {
+		for (uint32_t frame = 1; frame <= FRAMES; frame++) {
+			fillFb(ring.writeFb(), frame);
+			ring.publish();
+		}
+	});
+
+	uint32_t last = 0;
+	int torn = 0, backwards = 0;
+	while (last < FRAMES) {
+		uint32_t value;
+		if (!checkFb(ring.acquire(), &value))
+			torn++;
+		if (value < last)
+			backwards++;
+		last = value;
+	}
+	writer.join();
+
+	EXPECT_EQ(0, torn);
+	EXPECT_EQ(0, backwards);
+}
+
+/**
+ * Rendering through a ring must produce the same frames
+ * as rendering into a single MdFb, and MD_Screen must be
+ * the most recently rendered frame between frames.
+ */
+TEST_F(MdFbRingTest, emuMD)
+{
+	static const int FRAMES = 120;
+	MdFbRing ring;
+
+	// Context 0 uses the ring; context 1 doesn't.
+	Rom *rom[2];
+	EmuMD *context[2];
+	for (int i = 0; i < 2; i++) {
+		rom[i] = new Rom(test_emumd_benchmark_rom, sizeof(test_emumd_benchmark_rom));
+		ASSERT_TRUE(rom[i]->isOpen());
+		context[i] = new EmuMD(rom[i]);
+		rom[i]->close();	// TODO: Let EmuMD handle this...
+		ASSERT_TRUE(context[i]->isRomOpened()) << "Emulation context failed to initialize.";
+		context[i]->m_vdp->MD_Screen->setBpp(MdFb::BPP_32);
+	}
+	context[0]->m_vdp->setFbRing(&ring);
+
+	// MD_Screen is always the back buffer.
+	EXPECT_EQ(ring.writeFb(), context[0]->m_vdp->MD_Screen);
+
+	const MdFb *lastFb = nullptr;
+	for (int frame = 0; frame < FRAMES; frame++) {
+		// Every fourth frame is a fast frame.
+		const bool fast = ((frame & 3) == 3);
+		const MdFb *const backFb = context[0]->m_vdp->MD_Screen;
+		for (int i = 0; i < 2; i++) {
+			if (fast)
+				context[i]->execFrameFast();
+			else
+				context[i]->execFrame();
+		}
+
+		// The emulation thread never keeps a published frame.
+		EXPECT_EQ(ring.writeFb(), context[0]->m_vdp->MD_Screen);
+		if (fast) {
+			// Fast frames don't switch buffers.
+			EXPECT_EQ(backFb, context[0]->m_vdp->MD_Screen);
+			EXPECT_FALSE(ring.hasNewFrame());
+			continue;
+		}
+
+		ASSERT_TRUE(ring.hasNewFrame());
+		const MdFb *fb0 = ring.acquire();
+		const MdFb *fb1 = context[1]->m_vdp->MD_Screen;
+		EXPECT_EQ(backFb, fb0);
+		EXPECT_NE(fb0, context[0]->m_vdp->MD_Screen);
+		EXPECT_NE(lastFb, fb0);
+		EXPECT_EQ(fb1->bpp(), fb0->bpp());
+		EXPECT_EQ(fb1->imgWidth(), fb0->imgWidth());
+		EXPECT_EQ(fb1->imgXStart(), fb0->imgXStart());
+		EXPECT_EQ(0, memcmp(fb0->fb32(), fb1->fb32(),
+			(fb0->pxPitch() * fb0->numLines() - fb0->pxStart()) * sizeof(uint32_t)))
+			<< "Frame " << frame << " differs.";
+		lastFb = fb0;
+	}
+
+	// Resetting the VDP clears MD_Screen.
+	// The frame owned by the reader must not be modified.
+	const MdFb *readFb = ring.readFb();
+	const size_t px = readFb->pxPitch() * readFb->numLines() - readFb->pxStart();
+	const vector<uint32_t> frame(readFb->fb32(), readFb->fb32() + px);
+	context[0]->hardReset();
+	EXPECT_EQ(0, memcmp(frame.data(), readFb->fb32(), px * sizeof(uint32_t)));
+
+	context[0]->m_vdp->setFbRing(nullptr);
+	for (int i = 0; i < 2; i++) {
+		delete context[i];
+		delete rom[i];
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: MdFbRing.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
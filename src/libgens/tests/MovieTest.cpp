@@ -0,0 +1,301 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * MovieTest.cpp: Input movie tests.                                       *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Records a movie on the benchmark ROM, then plays it back
+ * in a new emulation context. Playback must restore the
+ * controller inputs and match every state hash, and a
+ * modified state must be reported as a desync.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "IO/IoManager.hpp"
+#include "cpu/M68K_Mem.hpp"
+#include "Util/Movie.hpp"
+#include "macros/common.h"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstdio>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class MovieTest : public ::testing::TestWithParam<uint16_t>
+{
+	protected:
+		MovieTest()
+			: ::testing::TestWithParam<uint16_t>()
+			, m_context(nullptr)
+		{ }
+		virtual ~MovieTest() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * (Re-)create the emulation context.
+		 */
+		void createContext(void);
+
+		/**
+		 * Record a movie to MOVIE_FILENAME.
+		 * Controller 1's buttons change every few frames.
+		 * @param buttons Buttons for each frame. (output)
+		 */
+		void recordMovie(vector<uint32_t> &buttons);
+
+		/**
+		 * Buttons for a given frame.
+		 * @param frame Frame number.
+		 * @return Buttons. (active low)
+		 */
+		static inline uint32_t framePad(int frame)
+		{
+			return ~(uint32_t)((frame / 7) * 0x25 & 0xFFF);
+		}
+
+		static const char MOVIE_FILENAME[];
+		static const int FRAMES = 120;
+		static const int HASH_INTERVAL = 10;
+
+	protected:
+		TestContext m_test;
+		EmuMD *m_context;
+};
+
+const char MovieTest::MOVIE_FILENAME[] = "MovieTest.gsmv";
+const int MovieTest::FRAMES;
+const int MovieTest::HASH_INTERVAL;
+
+/**
+ * Load the benchmark ROM and create the emulation context.
+ */
+void MovieTest::SetUp(void)
+{
+	ASSERT_EQ(0, m_test.openBenchmark(GetParam())) << "Emulation context failed to initialize.";
+	m_context = m_test.context();
+}
+
+/**
+ * Tear down the emulation context.
+ */
+void MovieTest::TearDown(void)
+{
+	m_context = nullptr;
+	m_test.close();
+	remove(MOVIE_FILENAME);
+}
+
+/**
+ * (Re-)create the emulation context.
+ */
+void MovieTest::createContext(void)
+{
+	m_context = nullptr;
+	ASSERT_EQ(0, m_test.restart()) << "Emulation context failed to initialize.";
+	m_context = m_test.context();
+}
+
+/**
+ * Record a movie to MOVIE_FILENAME.
+ * Recording starts at power-on.
+ * Controller 1's buttons change every few frames.
+ * @param buttons Buttons for each frame. (output)
+ */
+void MovieTest::recordMovie(vector<uint32_t> &buttons)
+{
+	// Controller 1 is a 6-button controller.
+	// Playback must set this up again.
+	m_context->m_ioManager->setDevType(IoManager::VIRTPORT_1, IoManager::IOT_6BTN);
+
+	Movie movie;
+	ASSERT_EQ(0, movie.startRecording(m_context, HASH_INTERVAL));
+	buttons.clear();
+	for (int i = 0; i < FRAMES; i++) {
+		m_context->m_ioManager->update(IoManager::VIRTPORT_1, framePad(i));
+		buttons.push_back(m_context->m_ioManager->buttons(IoManager::VIRTPORT_1));
+		m_context->execFrame();
+		ASSERT_EQ(0, movie.recordFrame(m_context));
+	}
+	EXPECT_EQ(FRAMES, movie.frameCount());
+	ASSERT_EQ(0, movie.save(MOVIE_FILENAME));
+}
+
+/**
+ * Playback must match the recording.
+ */
+TEST_P(MovieTest, playback)
+{
+	vector<uint32_t> buttons;
+	ASSERT_NO_FATAL_FAILURE(recordMovie(buttons));
+	ASSERT_NO_FATAL_FAILURE(createContext());
+
+	Movie movie;
+	ASSERT_EQ(0, movie.load(MOVIE_FILENAME));
+	EXPECT_EQ(FRAMES, movie.frameCount());
+	EXPECT_EQ(HASH_INTERVAL, movie.hashInterval());
+	ASSERT_EQ(0, movie.startPlayback(m_context));
+	EXPECT_EQ(IoManager::IOT_6BTN, m_context->m_ioManager->devType(IoManager::VIRTPORT_1));
+
+	// Frames are played back without rendering.
+	for (int i = 0; i < FRAMES; i++) {
+		ASSERT_EQ(0, movie.playFrame(m_context));
+		EXPECT_EQ(buttons[i], m_context->m_ioManager->buttons(IoManager::VIRTPORT_1))
+			<< "Buttons don't match at frame " << i << ".";
+		m_context->execFrameFast();
+		ASSERT_EQ(0, movie.verifyFrame(m_context)) << "Desync at frame " << i << ".";
+	}
+
+	EXPECT_EQ(-1, movie.desyncFrame());
+	EXPECT_EQ(FRAMES, movie.frame());
+	EXPECT_EQ(-ENOENT, movie.playFrame(m_context));
+	EXPECT_EQ(-ENOENT, movie.verifyFrame(m_context));
+}
+
+/**
+ * A changed state must be reported as a desync.
+ */
+TEST_P(MovieTest, desync)
+{
+	vector<uint32_t> buttons;
+	ASSERT_NO_FATAL_FAILURE(recordMovie(buttons));
+	ASSERT_NO_FATAL_FAILURE(createContext());
+
+	Movie movie;
+	ASSERT_EQ(0, movie.load(MOVIE_FILENAME));
+	ASSERT_EQ(0, movie.startPlayback(m_context));
+
+	static const int DESYNC_FRAME = 45;
+	int firstError = -1;
+	for (int i = 0; i < FRAMES; i++) {
+		ASSERT_EQ(0, movie.playFrame(m_context));
+		m_context->execFrameFast();
+		if (i == DESYNC_FRAME) {
+			// Change a byte of 68K RAM that the ROM doesn't use.
+			m_context->m_m68kMem->Ram_68k.u8[0xFFF0] ^= 0x5A;
+		}
+		int ret = movie.verifyFrame(m_context);
+		if (ret != 0 && firstError < 0) {
+			EXPECT_EQ(-EILSEQ, ret);
+			firstError = i;
+		}
+	}
+
+	// The desync is detected on the next hashed frame.
+	const int expected = ((DESYNC_FRAME / HASH_INTERVAL) + 1) * HASH_INTERVAL - 1;
+	EXPECT_EQ(expected, firstError);
+	EXPECT_EQ(expected, movie.desyncFrame());
+}
+
+/**
+ * Invalid movie files must be rejected.
+ */
+TEST_P(MovieTest, invalidFile)
+{
+	Movie movie;
+	remove(MOVIE_FILENAME);
+	EXPECT_EQ(-ENOENT, movie.load(MOVIE_FILENAME));
+
+	// Nothing has been recorded.
+	EXPECT_EQ(-ENOENT, movie.save(MOVIE_FILENAME));
+	EXPECT_EQ(-ENOENT, movie.startPlayback(m_context));
+
+	// Not a movie file.
+	FILE *f = fopen(MOVIE_FILENAME, "wb");
+	ASSERT_TRUE(f != nullptr);
+	static const char junk[] = "This is not a movie file. This is not a movie file.\n"
+				   "This is not a movie file. This is not a movie file.\n";
+	fwrite(junk, 1, sizeof(junk), f);
+	fclose(f);
+	EXPECT_EQ(-EINVAL, movie.load(MOVIE_FILENAME));
+	EXPECT_EQ(0, movie.frameCount());
+
+	// Truncated movie file.
+	vector<uint32_t> buttons;
+	ASSERT_NO_FATAL_FAILURE(recordMovie(buttons));
+	f = fopen(MOVIE_FILENAME, "rb");
+	ASSERT_TRUE(f != nullptr);
+	vector<uint8_t> data(1024*1024);
+	data.resize(fread(data.data(), 1, data.size(), f));
+	fclose(f);
+	ASSERT_GT(data.size(), 64U);
+	f = fopen(MOVIE_FILENAME, "wb");
+	ASSERT_TRUE(f != nullptr);
+	fwrite(data.data(), 1, data.size() - 8, f);
+	fclose(f);
+	EXPECT_EQ(-EINVAL, movie.load(MOVIE_FILENAME));
+
+	// Header fields: hashInterval, frameCount, and hashCount. (LE32)
+	// Large frame counts must not be trusted before the inputs are decoded,
+	// and large hash counts must not be trusted if the file is too small.
+	static const uint32_t crafted[][3] = {
+		{0x7FFFFFFF, 0x7FFFFFFF, 1},
+		{1, 0x7FFFFFFF, 0x7FFFFFFF},
+	};
+	for (int i = 0; i < ARRAY_SIZE(crafted); i++) {
+		vector<uint8_t> bad(data);
+		for (int j = 0; j < 4; j++) {
+			bad[16+j] = (crafted[i][0] >> (j * 8)) & 0xFF;
+			bad[20+j] = (crafted[i][1] >> (j * 8)) & 0xFF;
+			bad[32+j] = (crafted[i][2] >> (j * 8)) & 0xFF;
+		}
+		f = fopen(MOVIE_FILENAME, "wb");
+		ASSERT_TRUE(f != nullptr);
+		fwrite(bad.data(), 1, bad.size(), f);
+		fclose(f);
+		EXPECT_EQ(-EINVAL, movie.load(MOVIE_FILENAME));
+		EXPECT_EQ(0, movie.frameCount());
+	}
+}
+
+// Test cases.
+// Scenario masks are the same as EmuMD_benchmark.
+INSTANTIATE_TEST_CASE_P(MovieTest, MovieTest,
+	::testing::Values(0x0000, 0x000F));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: Movie.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -0,0 +1,277 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * RewindBufferTest.cpp: Rewind buffer tests.                              *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Verifies that RewindBuffer restores the exact states
+ * that were captured, in reverse order, including after
+ * old snapshots have been discarded to stay within budget.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Util/RewindBuffer.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cerrno>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class RewindBufferTest : public ::testing::TestWithParam<uint16_t>
+{
+	protected:
+		RewindBufferTest()
+			: ::testing::TestWithParam<uint16_t>()
+			, m_context(nullptr) { }
+		virtual ~RewindBufferTest() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * Save the current state.
+		 * @param state Buffer for the state.
+		 */
+		void saveState(vector<uint8_t> &state);
+
+		/**
+		 * Run frames, capturing each one.
+		 * @param rewind Rewind buffer.
+		 * @param frames Number of frames.
+		 * @param states If not nullptr, the state after each frame is appended here.
+		 */
+		void runAndCapture(RewindBuffer *rewind, int frames, vector<vector<uint8_t> > *states);
+
+	protected:
+		TestContext m_test;
+		EmuMD *m_context;
+};
+
+/**
+ * Load the benchmark ROM and create the emulation context.
+ */
+void RewindBufferTest::SetUp(void)
+{
+	ASSERT_EQ(0, m_test.openBenchmark(GetParam())) << "Emulation context failed to initialize.";
+	m_context = m_test.context();
+}
+
+/**
+ * Tear down the emulation context.
+ */
+void RewindBufferTest::TearDown(void)
+{
+	m_context = nullptr;
+	m_test.close();
+}
+
+/**
+ * Save the current state.
+ * @param state Buffer for the state.
+ */
+void RewindBufferTest::saveState(vector<uint8_t> &state)
+{
+	ASSERT_EQ(0, TestContext::saveState(m_context, state));
+}
+
+/**
+ * Run frames, capturing each one.
+ * @param rewind Rewind buffer.
+ * @param frames Number of frames.
+ * @param states If not nullptr, the state after each frame is appended here.
+ */
+void RewindBufferTest::runAndCapture(RewindBuffer *rewind, int frames, vector<vector<uint8_t> > *states)
+{
+	for (; frames > 0; frames--) {
+		m_context->execFrame();
+		ASSERT_LE(0, rewind->capture(m_context));
+		if (states) {
+			states->resize(states->size() + 1);
+			ASSERT_NO_FATAL_FAILURE(saveState(states->back()));
+		}
+	}
+}
+
+/**
+ * Rewinding an empty buffer must fail without touching the context.
+ */
+TEST_P(RewindBufferTest, empty)
+{
+	RewindBuffer rewind(8*1024*1024);
+	EXPECT_TRUE(rewind.isEmpty());
+	EXPECT_EQ(-ENOENT, rewind.rewind(m_context));
+
+	ASSERT_NO_FATAL_FAILURE(runAndCapture(&rewind, 1, nullptr));
+	EXPECT_EQ(1, rewind.count());
+	EXPECT_EQ(0, rewind.rewind(m_context));
+	EXPECT_TRUE(rewind.isEmpty());
+	EXPECT_EQ(0U, rewind.bytesUsed());
+	EXPECT_EQ(-ENOENT, rewind.rewind(m_context));
+}
+
+/**
+ * Rewinding must restore every captured state, newest first.
+ * Several keyframes are used.
+ */
+TEST_P(RewindBufferTest, rewindAll)
+{
+	static const int FRAMES = 100;
+	RewindBuffer rewind(32*1024*1024, 1, 16);
+	vector<vector<uint8_t> > states;
+	ASSERT_NO_FATAL_FAILURE(runAndCapture(&rewind, FRAMES, &states));
+	ASSERT_EQ(FRAMES, rewind.count());
+
+	vector<uint8_t> state;
+	for (int i = FRAMES - 1; i >= 0; i--) {
+		ASSERT_EQ(0, rewind.rewind(m_context));
+		ASSERT_NO_FATAL_FAILURE(saveState(state));
+		ASSERT_TRUE(state == states[i]) << "Rewound state " << i << " doesn't match.";
+	}
+	EXPECT_TRUE(rewind.isEmpty());
+}
+
+/**
+ * Capturing again after a partial rewind must continue
+ * from the restored state.
+ */
+TEST_P(RewindBufferTest, rewindAndContinue)
+{
+	RewindBuffer rewind(32*1024*1024, 1, 8);
+	vector<vector<uint8_t> > states;
+	ASSERT_NO_FATAL_FAILURE(runAndCapture(&rewind, 30, &states));
+
+	// Rewind past a keyframe.
+	for (int i = 0; i < 12; i++) {
+		ASSERT_EQ(0, rewind.rewind(m_context));
+	}
+	states.resize(states.size() - 12);
+	ASSERT_NO_FATAL_FAILURE(runAndCapture(&rewind, 20, &states));
+	ASSERT_EQ((int)states.size(), rewind.count());
+
+	vector<uint8_t> state;
+	for (int i = (int)states.size() - 1; i >= 0; i--) {
+		ASSERT_EQ(0, rewind.rewind(m_context));
+		ASSERT_NO_FATAL_FAILURE(saveState(state));
+		ASSERT_TRUE(state == states[i]) << "Rewound state " << i << " doesn't match.";
+	}
+}
+
+/**
+ * Each step must go back one frame, including the first step.
+ * The frame that's run after each step to redraw the screen
+ * is the one after the restored state.
+ * Rewinding must hold at the oldest snapshot.
+ */
+TEST_P(RewindBufferTest, step)
+{
+	static const int FRAMES = 20;
+	RewindBuffer rewind(32*1024*1024, 1, 8);
+	vector<vector<uint8_t> > states;
+	ASSERT_NO_FATAL_FAILURE(runAndCapture(&rewind, FRAMES, &states));
+
+	// The current frame is FRAMES-1.
+	vector<uint8_t> state;
+	for (int i = FRAMES - 2; i >= 1; i--) {
+		ASSERT_EQ(0, rewind.step(m_context));
+		ASSERT_NO_FATAL_FAILURE(saveState(state));
+		ASSERT_TRUE(state == states[i-1]) << "Step to frame " << i << " doesn't match.";
+		m_context->execFrame();
+	}
+
+	// Oldest snapshot.
+	EXPECT_EQ(1, rewind.count());
+	ASSERT_EQ(0, rewind.step(m_context));
+	ASSERT_NO_FATAL_FAILURE(saveState(state));
+	EXPECT_TRUE(state == states[0]);
+	EXPECT_EQ(1, rewind.count());
+}
+
+/**
+ * Snapshots must only be taken every interval frames.
+ */
+TEST_P(RewindBufferTest, interval)
+{
+	RewindBuffer rewind(32*1024*1024, 4);
+	EXPECT_EQ(4, rewind.interval());
+	ASSERT_NO_FATAL_FAILURE(runAndCapture(&rewind, 41, nullptr));
+	EXPECT_EQ(10, rewind.count());
+}
+
+/**
+ * A small budget must discard the oldest snapshots.
+ * The remaining snapshots must still be restored exactly.
+ */
+TEST_P(RewindBufferTest, budget)
+{
+	static const int FRAMES = 300;
+	vector<uint8_t> state;
+	ASSERT_NO_FATAL_FAILURE(saveState(state));
+	const size_t budget = state.size() * 3;
+
+	RewindBuffer rewind(budget, 1, 10);
+	vector<vector<uint8_t> > states;
+	ASSERT_NO_FATAL_FAILURE(runAndCapture(&rewind, FRAMES, &states));
+	EXPECT_LE(rewind.bytesUsed(), budget);
+	const int count = rewind.count();
+	ASSERT_GT(count, 0);
+	ASSERT_LT(count, FRAMES);
+
+	for (int i = FRAMES - 1; i >= FRAMES - count; i--) {
+		ASSERT_EQ(0, rewind.rewind(m_context));
+		ASSERT_NO_FATAL_FAILURE(saveState(state));
+		ASSERT_TRUE(state == states[i]) << "Rewound state " << i << " doesn't match.";
+	}
+	EXPECT_EQ(-ENOENT, rewind.rewind(m_context));
+}
+
+// Test cases.
+// Scenario masks are the same as EmuMD_benchmark.
+INSTANTIATE_TEST_CASE_P(RewindBufferTest, RewindBufferTest,
+	::testing::Values(0x0000, 0x000F));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: RewindBuffer.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -0,0 +1,251 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * RunAheadTest.cpp: Run-ahead tests.                                      *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Verifies that run-ahead doesn't change the emulation:
+ * the state and audio after each frame must match a
+ * normal run, and the displayed frame must match the
+ * normal run's frame from frames() frames later.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "sound/SoundMgr.hpp"
+#include "Util/RunAhead.hpp"
+
+// aligned_malloc()
+#include "libcompat/aligned_malloc.h"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class RunAheadTest : public ::testing::TestWithParam<uint16_t>
+{
+	protected:
+		RunAheadTest()
+			: ::testing::TestWithParam<uint16_t>()
+			, m_audioBuf(nullptr)
+		{
+			m_context[0] = nullptr;
+			m_context[1] = nullptr;
+		}
+		virtual ~RunAheadTest() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * Save the current state.
+		 * @param context Emulation context.
+		 * @param state Buffer for the state.
+		 */
+		void saveState(EmuContext *context, vector<uint8_t> &state);
+
+		/**
+		 * Copy the current framebuffer.
+		 * @param context Emulation context.
+		 * @param fb Buffer for the framebuffer.
+		 */
+		static void copyFb(EmuContext *context, vector<uint32_t> &fb);
+
+		/**
+		 * Copy the audio for the last frame.
+		 * This clears the Sound Manager's buffer.
+		 * @param context Emulation context.
+		 * @param audio Buffer for the audio.
+		 */
+		void copyAudio(EmuContext *context, vector<int16_t> &audio);
+
+	protected:
+		int16_t *m_audioBuf;
+
+		// Context 0 uses run-ahead; context 1 doesn't.
+		TestContext m_test[2];
+		EmuMD *m_context[2];
+};
+
+/**
+ * Load the benchmark ROM and create the emulation contexts.
+ */
+void RunAheadTest::SetUp(void)
+{
+	for (int i = 0; i < 2; i++) {
+		ASSERT_EQ(0, m_test[i].openBenchmark(GetParam())) << "Emulation context failed to initialize.";
+		m_context[i] = m_test[i].context();
+	}
+
+	// NOTE: SoundMgr::writeStereo() requires a 16-byte
+	// aligned destination buffer for SSE2.
+	m_audioBuf = (int16_t*)aligned_malloc(16, SoundMgr::MAX_SEGMENT_SIZE * 4);
+	ASSERT_TRUE(m_audioBuf != nullptr);
+}
+
+/**
+ * Tear down the emulation contexts.
+ */
+void RunAheadTest::TearDown(void)
+{
+	for (int i = 0; i < 2; i++) {
+		m_context[i] = nullptr;
+		m_test[i].close();
+	}
+	aligned_free(m_audioBuf);
+	m_audioBuf = nullptr;
+}
+
+/**
+ * Save the current state.
+ * @param context Emulation context.
+ * @param state Buffer for the state.
+ */
+void RunAheadTest::saveState(EmuContext *context, vector<uint8_t> &state)
+{
+	ASSERT_EQ(0, TestContext::saveState(context, state));
+}
+
+/**
+ * Copy the current framebuffer.
+ * @param context Emulation context.
+ * @param fb Buffer for the framebuffer.
+ */
+void RunAheadTest::copyFb(EmuContext *context, vector<uint32_t> &fb)
+{
+	const MdFb *mdfb = context->m_vdp->MD_Screen;
+	const uint32_t *src = mdfb->fb32();
+	fb.assign(src, src + (mdfb->pxPitch() * mdfb->numLines()));
+}
+
+/**
+ * Copy the audio for the last frame.
+ * This clears the Sound Manager's buffer.
+ * @param context Emulation context.
+ * @param audio Buffer for the audio.
+ */
+void RunAheadTest::copyAudio(EmuContext *context, vector<int16_t> &audio)
+{
+	SoundMgr *soundMgr = context->m_soundMgr;
+	const int samples = soundMgr->writeStereo(m_audioBuf, soundMgr->segLength());
+	audio.assign(m_audioBuf, m_audioBuf + (samples * 2));
+}
+
+/**
+ * Run-ahead must not change the emulation or the audio,
+ * and must display the frame from frames() frames later.
+ */
+TEST_P(RunAheadTest, matchesNormalRun)
+{
+	static const int FRAMES = 60;
+	static const int AHEAD = 2;
+
+	// Normal run. Keep the extra frames for the run-ahead comparison.
+	vector<vector<uint8_t> > states(FRAMES);
+	vector<vector<int16_t> > audio(FRAMES);
+	vector<vector<uint32_t> > fbs(FRAMES + AHEAD);
+	for (int i = 0; i < FRAMES + AHEAD; i++) {
+		m_context[1]->execFrame();
+		copyFb(m_context[1], fbs[i]);
+		if (i < FRAMES) {
+			ASSERT_NO_FATAL_FAILURE(saveState(m_context[1], states[i]));
+			copyAudio(m_context[1], audio[i]);
+		} else {
+			vector<int16_t> tmp;
+			copyAudio(m_context[1], tmp);
+		}
+	}
+
+	// Run-ahead run.
+	RunAhead runAhead(AHEAD);
+	ASSERT_EQ(AHEAD, runAhead.frames());
+	vector<uint8_t> state;
+	vector<int16_t> frameAudio;
+	vector<uint32_t> fb;
+	for (int i = 0; i < FRAMES; i++) {
+		ASSERT_EQ(0, runAhead.execFrame(m_context[0]));
+		ASSERT_NO_FATAL_FAILURE(saveState(m_context[0], state));
+		copyAudio(m_context[0], frameAudio);
+		copyFb(m_context[0], fb);
+
+		ASSERT_TRUE(state == states[i]) << "State diverged at frame " << i << ".";
+		ASSERT_TRUE(frameAudio == audio[i]) << "Audio diverged at frame " << i << ".";
+		ASSERT_TRUE(fb == fbs[i + AHEAD]) << "Displayed frame " << i << " doesn't match frame " << (i + AHEAD) << ".";
+	}
+
+	EXPECT_EQ((unsigned int)FRAMES, runAhead.totalFrames());
+	EXPECT_GT(runAhead.totalFrameTime(), 0ULL);
+	EXPECT_GT(runAhead.totalRunAheadTime(), 0ULL);
+}
+
+/**
+ * With run-ahead disabled, frames must be run normally.
+ */
+TEST_P(RunAheadTest, disabled)
+{
+	RunAhead runAhead(0);
+	vector<uint8_t> state0, state1;
+	vector<uint32_t> fb0, fb1;
+	for (int i = 0; i < 10; i++) {
+		ASSERT_EQ(0, runAhead.execFrame(m_context[0]));
+		m_context[1]->execFrame();
+	}
+	ASSERT_NO_FATAL_FAILURE(saveState(m_context[0], state0));
+	ASSERT_NO_FATAL_FAILURE(saveState(m_context[1], state1));
+	copyFb(m_context[0], fb0);
+	copyFb(m_context[1], fb1);
+	EXPECT_TRUE(state0 == state1);
+	EXPECT_TRUE(fb0 == fb1);
+	EXPECT_EQ(0ULL, runAhead.totalRunAheadTime());
+}
+
+// Test cases.
+// Scenario masks are the same as EmuMD_benchmark.
+INSTANTIATE_TEST_CASE_P(RunAheadTest, RunAheadTest,
+	::testing::Values(0x0000, 0x0001, 0x0008, 0x000F));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: RunAhead.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
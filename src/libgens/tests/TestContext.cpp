@@ -0,0 +1,178 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * TestContext.cpp: Emulation context helper for the test suites.          *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "TestContext.hpp"
+
+// LibGens
+#include "EmuContext/EmuMD.hpp"
+#include "Rom.hpp"
+#include "Vdp/Vdp.hpp"
+
+// Test ROM data.
+#include "EmuMD_benchmark_data.h"
+
+// C includes. (C++ namespace)
+#include <cerrno>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+const unsigned int TestContext::PROGRAM_ROM_SIZE;
+
+TestContext::TestContext()
+	: m_rom(nullptr)
+	, m_context(nullptr)
+{ }
+
+TestContext::~TestContext()
+{
+	close();
+}
+
+/**
+ * Load the frame benchmark ROM and create the emulation context.
+ * The scenario mask is patched into the copy of the ROM.
+ * @param mask Scenario mask. (See EmuMD_benchmark_data.h.)
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int TestContext::openBenchmark(uint16_t mask)
+{
+	close();
+	m_romData.assign(test_emumd_benchmark_rom,
+		test_emumd_benchmark_rom + sizeof(test_emumd_benchmark_rom));
+	m_romData[TEST_EMUMD_BENCHMARK_MASK_ADDR] = (mask >> 8);
+	m_romData[TEST_EMUMD_BENCHMARK_MASK_ADDR+1] = (mask & 0xFF);
+	return restart();
+}
+
+/**
+ * Load a ROM image and create the emulation context.
+ * @param romData ROM image. (copied)
+ * @param romSize Size of the ROM image.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int TestContext::open(const uint8_t *romData, size_t romSize)
+{
+	close();
+	if (!romData || romSize == 0)
+		return -EINVAL;
+	m_romData.assign(romData, romData + romSize);
+	return restart();
+}
+
+/**
+ * Build a ROM image for a 68000 test program
+ * and create the emulation context.
+ * The program is copied to $000200, and the stack
+ * pointer is initialized to $00FFFE00.
+ * @param prg Program.
+ * @param size Size of the program.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int TestContext::openProgram(const uint8_t *prg, size_t size)
+{
+	close();
+	if (!prg || size == 0 || size > PROGRAM_ROM_SIZE - 0x200)
+		return -EINVAL;
+
+	m_romData.assign(PROGRAM_ROM_SIZE, 0);
+	// Initial SP: $00FFFE00; initial PC: $00000200
+	static const uint8_t vectors[8] = {0x00,0xFF,0xFE,0x00, 0x00,0x00,0x02,0x00};
+	memcpy(&m_romData[0], vectors, sizeof(vectors));
+	memcpy(&m_romData[0x100], "SEGA MEGA DRIVE ", 16);
+	memcpy(&m_romData[0x200], prg, size);
+	return restart();
+}
+
+/**
+ * Re-create the emulation context from the loaded ROM image.
+ * The new context starts at power-on.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int TestContext::restart(void)
+{
+	delete m_context;
+	m_context = nullptr;
+	delete m_rom;
+	m_rom = nullptr;
+	if (m_romData.empty())
+		return -EBADF;
+
+	// NOTE: Rom doesn't take ownership of the buffer.
+	m_rom = new Rom(m_romData.data(), (unsigned int)m_romData.size());
+	if (!m_rom->isOpen()) {
+		delete m_rom;
+		m_rom = nullptr;
+		return -EIO;
+	}
+
+	m_context = new EmuMD(m_rom);
+	m_rom->close();	// TODO: Let EmuMD handle this...
+	if (!m_context->isRomOpened()) {
+		// Emulation context failed to initialize.
+		delete m_context;
+		m_context = nullptr;
+		delete m_rom;
+		m_rom = nullptr;
+		return -EIO;
+	}
+
+	m_context->m_vdp->MD_Screen->setBpp(MdFb::BPP_32);
+	return 0;
+}
+
+/**
+ * Delete the emulation context and the ROM image.
+ */
+void TestContext::close(void)
+{
+	// The context must be deleted before the Rom.
+	delete m_context;
+	m_context = nullptr;
+	delete m_rom;
+	m_rom = nullptr;
+	m_romData.clear();
+}
+
+/**
+ * Save the current state to a buffer.
+ * The buffer is resized to fit the state.
+ * @param context Emulation context.
+ * @param state Buffer for the state.
+ * @return 0 on success; negative POSIX error code on error.
+ */
+int TestContext::saveState(EmuContext *context, vector<uint8_t> &state)
+{
+	const int size = context->saveStateToBuffer(nullptr, 0);
+	if (size <= 0)
+		return (size < 0 ? size : -EIO);
+	state.resize(size);
+	const int ret = context->saveStateToBuffer(state.data(), state.size());
+	if (ret != size)
+		return (ret < 0 ? ret : -EIO);
+	return 0;
+}
+
+} }
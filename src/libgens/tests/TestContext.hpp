@@ -0,0 +1,127 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * TestContext.hpp: Emulation context helper for the test suites.          *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_TESTS_TESTCONTEXT_HPP__
+#define __LIBGENS_TESTS_TESTCONTEXT_HPP__
+
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cstddef>
+
+// C++ includes.
+#include <vector>
+
+namespace LibGens {
+
+class Rom;
+class EmuContext;
+class EmuMD;
+
+namespace Tests {
+
+/**
+ * Emulation context for a test ROM image.
+ * This owns a copy of the ROM image, the Rom object,
+ * and the emulation context, since Rom doesn't take
+ * ownership of the buffer and must outlive the context.
+ * The framebuffer is set to 32-bit color.
+ */
+class TestContext
+{
+	public:
+		TestContext();
+		~TestContext();
+
+	private:
+		// Q_DISABLE_COPY() equivalent.
+		TestContext(const TestContext &);
+		TestContext &operator=(const TestContext &);
+
+	public:
+		/**
+		 * Load the frame benchmark ROM and create the emulation context.
+		 * The scenario mask is patched into the copy of the ROM.
+		 * @param mask Scenario mask. (See EmuMD_benchmark_data.h.)
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int openBenchmark(uint16_t mask);
+
+		/**
+		 * Load a ROM image and create the emulation context.
+		 * @param romData ROM image. (copied)
+		 * @param romSize Size of the ROM image.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int open(const uint8_t *romData, size_t romSize);
+
+		/**
+		 * Build a ROM image for a 68000 test program
+		 * and create the emulation context.
+		 * The program is copied to $000200, and the stack
+		 * pointer is initialized to $00FFFE00.
+		 * @param prg Program.
+		 * @param size Size of the program.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int openProgram(const uint8_t *prg, size_t size);
+
+		// Size of ROM images built by openProgram().
+		static const unsigned int PROGRAM_ROM_SIZE = 8192;
+
+		/**
+		 * Re-create the emulation context from the loaded ROM image.
+		 * The new context starts at power-on.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		int restart(void);
+
+		/**
+		 * Delete the emulation context and the ROM image.
+		 */
+		void close(void);
+
+		/**
+		 * Get the emulation context.
+		 * @return Emulation context, or nullptr if not open.
+		 */
+		inline EmuMD *context(void) const
+			{ return m_context; }
+
+		/**
+		 * Save the current state to a buffer.
+		 * The buffer is resized to fit the state.
+		 * @param context Emulation context.
+		 * @param state Buffer for the state.
+		 * @return 0 on success; negative POSIX error code on error.
+		 */
+		static int saveState(EmuContext *context, std::vector<uint8_t> &state);
+
+	private:
+		std::vector<uint8_t> m_romData;
+		Rom *m_rom;
+		EmuMD *m_context;
+};
+
+} }
+
+#endif /* __LIBGENS_TESTS_TESTCONTEXT_HPP__ */
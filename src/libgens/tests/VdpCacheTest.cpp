@@ -0,0 +1,176 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpCacheTest.cpp: VDP pattern cache tests.                              *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "macros/common.h"
+#include "Vdp/VdpCache.hpp"
+#include "Vdp/VdpTypes.hpp"
+using LibGens::VdpTypes::VRam_t;
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+
+namespace LibGens { namespace Tests {
+
+class VdpCacheTest : public ::testing::Test
+{
+	protected:
+		VdpCacheTest()
+			: m_cache(nullptr)
+			, m_vram(nullptr) { }
+		virtual ~VdpCacheTest() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * Get a pixel from a Mode 5 pattern line.
+		 * @param line Pattern line, in VRam_t::u32[] layout.
+		 * @param x Pixel number. (0-7)
+		 * @return Pixel value.
+		 */
+		static unsigned int pixel(uint32_t line, int x);
+
+	protected:
+		VdpCache *m_cache;
+		VRam_t *m_vram;
+};
+
+/**
+ * Set up the pattern cache with random VRAM contents.
+ */
+void VdpCacheTest::SetUp(void)
+{
+	m_vram = new VRam_t;
+	srand(0x5E6A);
+	for (unsigned int i = 0; i < ARRAY_SIZE(m_vram->u16); i++) {
+		m_vram->u16[i] = (uint16_t)(rand() & 0xFFFF);
+	}
+
+	m_cache = new VdpCache();
+	m_cache->invalidate();
+	EXPECT_TRUE(m_cache->isDirty());
+	m_cache->update_m5(m_vram);
+	EXPECT_FALSE(m_cache->isDirty());
+}
+
+void VdpCacheTest::TearDown(void)
+{
+	delete m_cache;
+	delete m_vram;
+}
+
+/**
+ * Get a pixel from a Mode 5 pattern line.
+ * @param line Pattern line, in VRam_t::u32[] layout.
+ * @param x Pixel number. (0-7)
+ * @return Pixel value.
+ */
+unsigned int VdpCacheTest::pixel(uint32_t line, int x)
+{
+	// Each 16-bit word has four pixels, starting at the high nybble.
+	union {
+		uint32_t u32;
+		uint16_t u16[2];
+	} tmp;
+	tmp.u32 = line;
+	return (tmp.u16[x >> 2] >> (12 - ((x & 3) * 4))) & 0x0F;
+}
+
+/**
+ * Unflipped patterns must match VRAM exactly.
+ */
+TEST_F(VdpCacheTest, m5_normal)
+{
+	for (uint32_t address = 0; address < sizeof(m_vram->u8); address += 4) {
+		ASSERT_EQ(m_vram->u32[address >> 2], m_cache->pattern_line_m5_addr(0, address))
+			<< "VRAM address 0x" << std::hex << address;
+	}
+}
+
+/**
+ * H-flipped patterns must have their pixels reversed.
+ */
+TEST_F(VdpCacheTest, m5_hflip)
+{
+	for (uint32_t address = 0; address < sizeof(m_vram->u8); address += 4) {
+		const uint32_t normal = m_vram->u32[address >> 2];
+		const uint32_t hflip = m_cache->pattern_line_m5_addr(1, address);
+		for (int x = 0; x < 8; x++) {
+			ASSERT_EQ(pixel(normal, 7 - x), pixel(hflip, x))
+				<< "VRAM address 0x" << std::hex << address << ", pixel " << x;
+		}
+	}
+}
+
+/**
+ * Only lines marked as dirty are updated.
+ */
+TEST_F(VdpCacheTest, markDirty)
+{
+	// Tile 0x123, line 5, and tile 0x7FF, line 7.
+	static const uint32_t addr1 = (0x123 << 5) | (5 << 2);
+	static const uint32_t addr2 = (0x7FF << 5) | (7 << 2);
+	const uint32_t old1 = m_vram->u32[addr1 >> 2];
+	const uint32_t old2 = m_vram->u32[addr2 >> 2];
+	m_vram->u32[addr1 >> 2] = ~old1;
+	m_vram->u32[addr2 >> 2] = ~old2;
+
+	// Only mark the first line as dirty.
+	// The second line is intentionally left stale.
+	m_cache->markDirty(addr1 + 1);
+	EXPECT_TRUE(m_cache->isDirty());
+	m_cache->update_m5(m_vram);
+	EXPECT_FALSE(m_cache->isDirty());
+
+	EXPECT_EQ(~old1, m_cache->pattern_line_m5_addr(0, addr1));
+	EXPECT_EQ(old2, m_cache->pattern_line_m5_addr(0, addr2));
+
+	// Mark the second line as dirty.
+	m_cache->markDirty(addr2);
+	m_cache->update_m5(m_vram);
+	EXPECT_EQ(~old2, m_cache->pattern_line_m5_addr(0, addr2));
+	for (int x = 0; x < 8; x++) {
+		EXPECT_EQ(pixel(~old2, 7 - x), pixel(m_cache->pattern_line_m5_addr(1, addr2), x));
+	}
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: VdpCache.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -0,0 +1,372 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpDmaBulkTest.cpp: VDP bulk DMA transfer test.                         *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Compares 68000-to-VDP DMA transfers done in bulk with the
+ * same transfers done by the word-by-word loop.
+ * (VdpEmuOptions_t::bulkDMA)
+ *
+ * Two identical contexts run each transfer, one with bulk DMA
+ * enabled and one with it disabled. Afterwards:
+ * - The savestates must match. This covers VRAM, CRAM, VSRAM,
+ *   the VDP address register, and the last four words in the FIFO.
+ * - The next frame must match. This covers the pattern cache
+ *   dirty ranges and the Sprite Attribute Table cache, which
+ *   aren't saved.
+ *
+ * Transfers that the bulk path can't handle (odd address,
+ * address or source wraparound, auto-increment other than 2)
+ * are included to check that they fall back to the word loop.
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Vdp/Vdp.hpp"
+#include "cpu/M68K_Mem.hpp"
+#include "Util/MdFb.hpp"
+
+// Test ROM and emulation context.
+#include "TestContext.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+// VDP control codes for DMA transfers. (CD5 set)
+#define DMA_CD_VRAM	0x21
+#define DMA_CD_CRAM	0x23
+#define DMA_CD_VSRAM	0x25
+
+// Sprite Attribute Table address. (H40)
+#define TEST_SAT_ADDR	0xF000
+
+struct VdpDmaBulkTest_mode
+{
+	const char *name;
+	uint8_t cd;		// Control code.
+	uint32_t src;		// Source address. (68000)
+	uint16_t address;	// Destination address.
+	unsigned int length;	// Length, in words.
+	uint8_t autoInc;	// Auto-increment.
+};
+
+/**
+ * Formatting function for VdpDmaBulkTest_mode.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const VdpDmaBulkTest_mode& mode)
+{
+	return os << mode.name;
+};
+
+class VdpDmaBulkTest : public ::testing::TestWithParam<VdpDmaBulkTest_mode>
+{
+	protected:
+		VdpDmaBulkTest()
+			: ::testing::TestWithParam<VdpDmaBulkTest_mode>() { }
+		virtual ~VdpDmaBulkTest() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * Fill a buffer with test data.
+		 * Every 8 bytes form a valid sprite entry, and sprites
+		 * are linked in order, so the data is displayed both as
+		 * patterns and as sprites.
+		 * @param buf Buffer.
+		 * @param words Number of words.
+		 */
+		static void fillTestData(uint16_t *buf, unsigned int words);
+
+		/**
+		 * Initialize a context's VDP and 68000 RAM.
+		 * @param context Emulation context.
+		 */
+		static void initContext(EmuMD *context);
+
+		/**
+		 * Run a DMA transfer.
+		 * @param context Emulation context.
+		 * @param mode DMA transfer.
+		 */
+		static void runDma(EmuMD *context, const VdpDmaBulkTest_mode &mode);
+
+		/**
+		 * Compare the savestates of both contexts.
+		 * @param when Description for failure messages.
+		 */
+		void compareStates(const char *when);
+
+	protected:
+		TestContext m_bulk;	// Bulk DMA enabled.
+		TestContext m_loop;	// Bulk DMA disabled.
+};
+
+/**
+ * Test program: Disable interrupts and loop forever.
+ * The transfers are started from the test itself.
+ */
+static const uint8_t test_prg[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x60,0xFE,				// 0x204: bra.s	*
+};
+
+/**
+ * Create both emulation contexts.
+ */
+void VdpDmaBulkTest::SetUp(void)
+{
+	ASSERT_EQ(0, m_bulk.openProgram(test_prg, sizeof(test_prg)));
+	ASSERT_EQ(0, m_loop.openProgram(test_prg, sizeof(test_prg)));
+	ASSERT_TRUE(m_bulk.context()->m_vdp->options.bulkDMA);
+	m_loop.context()->m_vdp->options.bulkDMA = false;
+
+	initContext(m_bulk.context());
+	initContext(m_loop.context());
+	compareStates("before the transfer");
+}
+
+/**
+ * Tear down both emulation contexts.
+ */
+void VdpDmaBulkTest::TearDown(void)
+{
+	m_bulk.close();
+	m_loop.close();
+}
+
+/**
+ * Fill a buffer with test data.
+ * Every 8 bytes form a valid sprite entry, and sprites
+ * are linked in order, so the data is displayed both as
+ * patterns and as sprites.
+ * @param buf Buffer.
+ * @param words Number of words.
+ */
+void VdpDmaBulkTest::fillTestData(uint16_t *buf, unsigned int words)
+{
+	for (unsigned int i = 0; i < words; i++) {
+		const uint16_t r = (uint16_t)(rand() & 0xFFFF);
+		switch (i & 3) {
+			case 0:
+				// Y position.
+				buf[i] = 0x80 + (r % 240);
+				break;
+			case 1:
+				// Size and link.
+				buf[i] = (r & 0x0F00) | (((i >> 2) + 1) % 80);
+				break;
+			case 2:
+				// Pattern attributes.
+				buf[i] = r;
+				break;
+			case 3:
+				// X position.
+				buf[i] = 0x80 + (r % 320);
+				break;
+		}
+	}
+}
+
+/**
+ * Initialize a context's VDP and 68000 RAM.
+ * @param context Emulation context.
+ */
+void VdpDmaBulkTest::initContext(EmuMD *context)
+{
+	Vdp *const vdp = context->m_vdp;
+	static const uint16_t regs[] = {
+		0x8004,		// HINT off
+		0x8154,		// Display on, DMA on, M5
+		0x8230,		// Scroll A: $C000
+		0x8338,		// Window: $E000
+		0x8407,		// Scroll B: $E000
+		0x8578,		// Sprite Attribute Table: $F000
+		0x8700,		// BG color 0
+		0x8B00,		// Full-screen scrolling
+		0x8C81,		// H40
+		0x8D3F,		// HScroll: $FC00
+		0x8F02,		// Auto-increment: 2
+		0x9001,		// 64x32 planes
+	};
+	for (unsigned int i = 0; i < sizeof(regs)/sizeof(regs[0]); i++) {
+		vdp->writeCtrlMD(regs[i]);
+	}
+
+	// Same seed for both contexts.
+	srand(0xD4A0);
+	vector<uint16_t> buf(0x8000);
+	fillTestData(buf.data(), 0x8000);
+	ASSERT_EQ(0, vdp->dbg_writeVRam_16(0, buf.data(), 0x10000));
+	fillTestData(buf.data(), 64);
+	ASSERT_EQ(0, vdp->dbg_writeCRam_16(0, buf.data(), 0x80));
+	for (int i = 0; i < 40; i++) {
+		buf[i] = (uint16_t)(rand() & 0x3FF);
+	}
+	ASSERT_EQ(0, vdp->dbg_writeVSRam_16(0, buf.data(), 0x50));
+
+	M68K_Mem *const m68kMem = context->m_m68kMem;
+	fillTestData(m68kMem->Ram_68k.u16, 0x8000);
+
+	// Render a frame so the caches are up to date.
+	context->execFrame();
+}
+
+/**
+ * Run a DMA transfer.
+ * @param context Emulation context.
+ * @param mode DMA transfer.
+ */
+void VdpDmaBulkTest::runDma(EmuMD *context, const VdpDmaBulkTest_mode &mode)
+{
+	Vdp *const vdp = context->m_vdp;
+	const uint32_t src = (mode.src >> 1);
+	vdp->writeCtrlMD(0x8F00 | mode.autoInc);
+	vdp->writeCtrlMD(0x9300 | (mode.length & 0xFF));
+	vdp->writeCtrlMD(0x9400 | ((mode.length >> 8) & 0xFF));
+	vdp->writeCtrlMD(0x9500 | (src & 0xFF));
+	vdp->writeCtrlMD(0x9600 | ((src >> 8) & 0xFF));
+	vdp->writeCtrlMD(0x9700 | ((src >> 16) & 0x7F));
+
+	// Start the transfer.
+	vdp->writeCtrlMD(((mode.cd & 0x03) << 14) | (mode.address & 0x3FFF));
+	vdp->writeCtrlMD(((mode.cd & 0x3C) << 2) | (mode.address >> 14));
+
+	// Restore the auto-increment for the next frame.
+	vdp->writeCtrlMD(0x8F02);
+}
+
+/**
+ * Compare the savestates of both contexts.
+ * @param when Description for failure messages.
+ */
+void VdpDmaBulkTest::compareStates(const char *when)
+{
+	vector<uint8_t> bulkState, loopState;
+	ASSERT_EQ(0, TestContext::saveState(m_bulk.context(), bulkState));
+	ASSERT_EQ(0, TestContext::saveState(m_loop.context(), loopState));
+	ASSERT_EQ(loopState.size(), bulkState.size());
+
+	for (size_t i = 0; i < bulkState.size(); i++) {
+		if (bulkState[i] == loopState[i])
+			continue;
+		ADD_FAILURE() << "Savestates differ " << when << " at offset 0x"
+			<< std::hex << i << ": bulk 0x" << (int)bulkState[i]
+			<< ", word loop 0x" << (int)loopState[i] << '.';
+		return;
+	}
+}
+
+/**
+ * Bulk DMA must have the same results as the word loop.
+ */
+TEST_P(VdpDmaBulkTest, matchesWordLoop)
+{
+	const VdpDmaBulkTest_mode &mode = GetParam();
+
+	runDma(m_bulk.context(), mode);
+	runDma(m_loop.context(), mode);
+	compareStates("after the transfer");
+
+	// The caches are only checked by rendering.
+	m_bulk.context()->execFrame();
+	m_loop.context()->execFrame();
+	const MdFb *bulkFb = m_bulk.context()->m_vdp->MD_Screen;
+	const MdFb *loopFb = m_loop.context()->m_vdp->MD_Screen;
+	for (int line = 0; line < bulkFb->numLines(); line++) {
+		const uint32_t *bulkPx = bulkFb->lineBuf32(line);
+		const uint32_t *loopPx = loopFb->lineBuf32(line);
+		ASSERT_EQ(0, memcmp(bulkPx, loopPx, bulkFb->pxPitch() * sizeof(uint32_t)))
+			<< "Line " << line << " doesn't match after the transfer.";
+	}
+	compareStates("after the next frame");
+}
+
+// Test cases.
+static const VdpDmaBulkTest_mode modes[] = {
+	// VRAM
+	{"vram",		DMA_CD_VRAM, 0xFF0000, 0x1000, 0x400, 2},
+	{"vram_rom",		DMA_CD_VRAM, 0x000200, 0x2000, 0x800, 2},
+	{"vram_short",		DMA_CD_VRAM, 0xFF0010, 0x1000, 3, 2},
+	{"vram_fifo_5",		DMA_CD_VRAM, 0xFF0020, 0x1000, 5, 2},
+	{"vram_fifo_6",		DMA_CD_VRAM, 0xFF0020, 0x1000, 6, 2},
+	{"vram_fifo_7",		DMA_CD_VRAM, 0xFF0020, 0x1000, 7, 2},
+	{"vram_sat_start",	DMA_CD_VRAM, 0xFF4000, TEST_SAT_ADDR - 0x100, 0x100, 2},
+	{"vram_sat_inside",	DMA_CD_VRAM, 0xFF4008, TEST_SAT_ADDR + 0x108, 0x40, 2},
+	{"vram_sat_end",	DMA_CD_VRAM, 0xFF4000, TEST_SAT_ADDR + 0x200, 0x200, 2},
+	{"vram_sat_all",	DMA_CD_VRAM, 0xFF6000, TEST_SAT_ADDR - 0x1000, 0x1000, 2},
+	{"vram_end",		DMA_CD_VRAM, 0xFF0000, 0xFE00, 0x100, 2},
+	// VRAM fallbacks
+	{"vram_odd",		DMA_CD_VRAM, 0xFF0000, 0x1001, 0x40, 2},
+	{"vram_wrap",		DMA_CD_VRAM, 0xFF0000, 0xFF00, 0x100, 2},
+	{"vram_inc_4",		DMA_CD_VRAM, 0xFF0000, 0x1000, 0x100, 4},
+	{"vram_inc_1",		DMA_CD_VRAM, 0xFF0000, 0x1000, 0x100, 1},
+	{"vram_inc_0",		DMA_CD_VRAM, 0xFF0000, TEST_SAT_ADDR, 0x10, 0},
+	{"vram_src_wrap",	DMA_CD_VRAM, 0xFFFF00, 0x1000, 0x100, 2},
+
+	// CRAM
+	{"cram",		DMA_CD_CRAM, 0xFF0100, 0x00, 64, 2},
+	{"cram_partial",	DMA_CD_CRAM, 0xFF0100, 0x22, 7, 2},
+	{"cram_odd",		DMA_CD_CRAM, 0xFF0100, 0x23, 7, 2},
+	// CRAM fallbacks
+	{"cram_past_end",	DMA_CD_CRAM, 0xFF0100, 0x70, 16, 2},
+	{"cram_inc_4",		DMA_CD_CRAM, 0xFF0100, 0x00, 32, 4},
+	{"cram_src_wrap",	DMA_CD_CRAM, 0xFFFFF0, 0x00, 32, 2},
+
+	// VSRAM
+	{"vsram",		DMA_CD_VSRAM, 0xFF0200, 0x00, 40, 2},
+	{"vsram_partial",	DMA_CD_VSRAM, 0xFF0200, 0x10, 9, 2},
+	// VSRAM fallbacks
+	{"vsram_odd",		DMA_CD_VSRAM, 0xFF0200, 0x11, 9, 2},
+	{"vsram_past_end",	DMA_CD_VSRAM, 0xFF0200, 0x70, 16, 2},
+	{"vsram_inc_4",		DMA_CD_VSRAM, 0xFF0200, 0x00, 20, 4},
+};
+
+INSTANTIATE_TEST_CASE_P(VdpDmaBulkTest, VdpDmaBulkTest,
+	::testing::ValuesIn(modes));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: VDP bulk DMA transfers.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -0,0 +1,304 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpLineBufTest.cpp: VdpLineBuf tests.                                   *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "VdpLineBufTest.hpp"
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "libcompat/cpuflags.h"
+#include "Vdp/VdpLineBuf.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Rom.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Util/MdFb.hpp"
+
+// Test ROM data.
+#include "EmuMD_benchmark_data.h"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class VdpLineBufTest : public ::testing::TestWithParam<VdpLineBufTest_flags>
+{
+	protected:
+		VdpLineBufTest()
+			: ::testing::TestWithParam<VdpLineBufTest_flags>()
+			, supported(false) { }
+		virtual ~VdpLineBufTest() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * Initialize the line buffer and palettes.
+		 * Every palette index is used at least once.
+		 */
+		void initLineBuf(void);
+
+		/**
+		 * Render frames of the EmuMD benchmark ROM.
+		 * @param bpp Color depth.
+		 * @param frames Number of frames.
+		 * @param cpuFlags CPU flags to use.
+		 * @return Concatenated framebuffers.
+		 */
+		static vector<uint8_t> renderFrames(MdFb::ColorDepth bpp, int frames, uint32_t cpuFlags);
+
+	protected:
+		// Line buffer. (H40 plus one extra pattern)
+		uint16_t lineBuf[328];
+
+		// Palettes. (257 entries are required for AVX2.)
+		uint16_t palette16[257];
+		uint32_t palette32[256];
+
+		// True if the CPU supports the flags for this test.
+		bool supported;
+
+		// Previous CPU flags.
+		uint32_t cpuFlags_old;
+};
+
+/**
+ * Set up the test.
+ */
+void VdpLineBufTest::SetUp(void)
+{
+	const VdpLineBufTest_flags &flags = GetParam();
+	supported = ((CPU_Flags & flags.cpuFlags) == flags.cpuFlags);
+	if (!supported) {
+		printf("CPU does not support the required flags for this test. Skipping.\n");
+	}
+
+	cpuFlags_old = CPU_Flags;
+	CPU_Flags = flags.cpuFlags;
+	initLineBuf();
+}
+
+/**
+ * Tear down the test.
+ */
+void VdpLineBufTest::TearDown(void)
+{
+	CPU_Flags = cpuFlags_old;
+}
+
+/**
+ * Initialize the line buffer and palettes.
+ * Every palette index is used at least once.
+ */
+void VdpLineBufTest::initLineBuf(void)
+{
+	srand(0x4C42);
+	for (int i = 0; i < (int)(sizeof(lineBuf)/sizeof(lineBuf[0])); i++) {
+		// High byte is layer information, which must be ignored.
+		const uint8_t layer = (uint8_t)(rand() & 0xFF);
+		const uint8_t pixel = (i < 256 ? (uint8_t)i : (uint8_t)(rand() & 0xFF));
+		lineBuf[i] = (layer << 8) | pixel;
+	}
+
+	for (int i = 0; i < 256; i++) {
+		palette16[i] = (uint16_t)(0x8000 | (i * 0x0101));
+		palette32[i] = (0xFF000000 | (i << 16) | ((i ^ 0x5A) << 8) | (255 - i));
+	}
+	palette16[256] = 0xDEAD;
+}
+
+/**
+ * Render frames of the EmuMD benchmark ROM.
+ * @param bpp Color depth.
+ * @param frames Number of frames.
+ * @param cpuFlags CPU flags to use.
+ * @return Concatenated framebuffers.
+ */
+vector<uint8_t> VdpLineBufTest::renderFrames(MdFb::ColorDepth bpp, int frames, uint32_t cpuFlags)
+{
+	vector<uint8_t> out;
+	const uint32_t cpuFlags_old = CPU_Flags;
+	CPU_Flags = cpuFlags;
+
+	// Enable all scenarios.
+	uint8_t *romData = (uint8_t*)malloc(sizeof(test_emumd_benchmark_rom));
+	memcpy(romData, test_emumd_benchmark_rom, sizeof(test_emumd_benchmark_rom));
+	romData[TEST_EMUMD_BENCHMARK_MASK_ADDR] = 0x00;
+	romData[TEST_EMUMD_BENCHMARK_MASK_ADDR+1] = 0x0F;
+
+	Rom *rom = new Rom(romData, sizeof(test_emumd_benchmark_rom));
+	EmuMD *context = new EmuMD(rom);
+	rom->close();	// TODO: Let EmuMD handle this...
+	if (context->isRomOpened()) {
+		MdFb *fb = context->m_vdp->MD_Screen;
+		fb->setBpp(bpp);
+		const int bytes = (fb->pxPitch() * fb->numLines() - fb->pxStart()) *
+			(bpp == MdFb::BPP_32 ? 4 : 2);
+		for (int i = 0; i < frames; i++) {
+			context->execFrame();
+			const uint8_t *px = (bpp == MdFb::BPP_32
+				? (const uint8_t*)fb->fb32()
+				: (const uint8_t*)fb->fb16());
+			out.insert(out.end(), px, px + bytes);
+		}
+	}
+
+	delete context;
+	delete rom;
+	free(romData);
+	CPU_Flags = cpuFlags_old;
+	return out;
+}
+
+/**
+ * Resolve a line at 16bpp. (15bpp uses the same code.)
+ */
+TEST_P(VdpLineBufTest, resolve16)
+{
+	if (!supported)
+		return;
+
+	static const int counts[] = {256, 320, 8, 24};
+	for (int c = 0; c < 4; c++) {
+		const int count = counts[c];
+		uint16_t dest[328+8];
+		memset(dest, 0xCC, sizeof(dest));
+		VdpLineBuf::resolve(dest, lineBuf, count, palette16);
+		for (int i = 0; i < count; i++) {
+			ASSERT_EQ(palette16[lineBuf[i] & 0xFF], dest[i])
+				<< "count " << count << ", pixel " << i;
+		}
+		// Make sure nothing was written past the end.
+		ASSERT_EQ(0xCCCC, dest[count]) << "count " << count;
+	}
+}
+
+/**
+ * Resolve a line at 32bpp.
+ */
+TEST_P(VdpLineBufTest, resolve32)
+{
+	if (!supported)
+		return;
+
+	static const int counts[] = {256, 320, 8, 24};
+	for (int c = 0; c < 4; c++) {
+		const int count = counts[c];
+		uint32_t dest[328+8];
+		memset(dest, 0xCC, sizeof(dest));
+		VdpLineBuf::resolve(dest, lineBuf, count, palette32);
+		for (int i = 0; i < count; i++) {
+			ASSERT_EQ(palette32[lineBuf[i] & 0xFF], dest[i])
+				<< "count " << count << ", pixel " << i;
+		}
+		// Make sure nothing was written past the end.
+		ASSERT_EQ(0xCCCCCCCC, dest[count]) << "count " << count;
+	}
+}
+
+/**
+ * Fill borders at 16bpp and 32bpp.
+ */
+TEST_P(VdpLineBufTest, fill)
+{
+	if (!supported)
+		return;
+
+	// H32 borders are 32px; test a few other sizes too.
+	static const int counts[] = {32, 8, 16, 40};
+	for (int c = 0; c < 4; c++) {
+		const int count = counts[c];
+		uint16_t dest16[48];
+		uint32_t dest32[48];
+		memset(dest16, 0xCC, sizeof(dest16));
+		memset(dest32, 0xCC, sizeof(dest32));
+		VdpLineBuf::fill(&dest16[1], count, 0x1234);
+		VdpLineBuf::fill(&dest32[1], count, 0x12345678);
+
+		EXPECT_EQ(0xCCCC, dest16[0]);
+		EXPECT_EQ(0xCCCCCCCC, dest32[0]);
+		for (int i = 1; i <= count; i++) {
+			ASSERT_EQ(0x1234, dest16[i]) << "count " << count << ", pixel " << i;
+			ASSERT_EQ(0x12345678U, dest32[i]) << "count " << count << ", pixel " << i;
+		}
+		EXPECT_EQ(0xCCCC, dest16[count+1]);
+		EXPECT_EQ(0xCCCCCCCC, dest32[count+1]);
+	}
+}
+
+/**
+ * Rendered frames must match the generic implementation.
+ */
+TEST_P(VdpLineBufTest, emuMD)
+{
+	if (!supported)
+		return;
+
+	static const int FRAMES = 60;
+	static const MdFb::ColorDepth bpps[] = {MdFb::BPP_16, MdFb::BPP_32};
+	for (int b = 0; b < 2; b++) {
+		const vector<uint8_t> golden = renderFrames(bpps[b], FRAMES, 0);
+		const vector<uint8_t> test = renderFrames(bpps[b], FRAMES, GetParam().cpuFlags);
+		ASSERT_FALSE(golden.empty());
+		ASSERT_EQ(golden.size(), test.size());
+		EXPECT_TRUE(golden == test) << "Frames differ at bpp index " << b;
+	}
+}
+
+// Test cases.
+INSTANTIATE_TEST_CASE_P(VdpLineBufTest_NoFlags, VdpLineBufTest,
+	::testing::Values(VdpLineBufTest_flags("NoFlags", 0)
+));
+
+#if defined(__i386__) || defined(__amd64__) || defined(__x86_64__)
+INSTANTIATE_TEST_CASE_P(VdpLineBufTest_SSE2, VdpLineBufTest,
+	::testing::Values(VdpLineBufTest_flags("SSE2", MDP_CPUFLAG_X86_SSE2)
+));
+INSTANTIATE_TEST_CASE_P(VdpLineBufTest_AVX2, VdpLineBufTest,
+	::testing::Values(VdpLineBufTest_flags("AVX2", MDP_CPUFLAG_X86_AVX2)
+));
+#endif
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: VdpLineBuf.\n\n");
+	LibGens::Init();
+	fflush(nullptr);
+
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
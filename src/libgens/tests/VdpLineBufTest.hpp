@@ -0,0 +1,52 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpLineBufTest.hpp: VdpLineBuf tests. (Common header)                   *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#ifndef __LIBGENS_TESTS_VDPLINEBUFTEST_HPP__
+#define __LIBGENS_TESTS_VDPLINEBUFTEST_HPP__
+
+// C includes.
+#include <stdint.h>
+
+// C++ includes.
+#include <ostream>
+
+namespace LibGens { namespace Tests {
+
+struct VdpLineBufTest_flags {
+	const char *name;
+	uint32_t cpuFlags;
+
+	VdpLineBufTest_flags(const char *name, uint32_t cpuFlags)
+		: name(name)
+		, cpuFlags(cpuFlags) { }
+};
+
+/**
+ * Formatting function for VdpLineBufTest_flags.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const VdpLineBufTest_flags& flags)
+{
+	return os << flags.name;
+};
+
+} }
+
+#endif /* __LIBGENS_TESTS_VDPLINEBUFTEST_HPP__ */
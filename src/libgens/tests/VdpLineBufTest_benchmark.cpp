@@ -0,0 +1,188 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpLineBufTest_benchmark.cpp: VdpLineBuf benchmark.                     *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+#include "VdpLineBufTest.hpp"
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "libcompat/cpuflags.h"
+#include "Vdp/VdpLineBuf.hpp"
+#include "Util/Timing.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+
+namespace LibGens { namespace Tests {
+
+class VdpLineBufTest_benchmark : public ::testing::TestWithParam<VdpLineBufTest_flags>
+{
+	protected:
+		VdpLineBufTest_benchmark()
+			: ::testing::TestWithParam<VdpLineBufTest_flags>()
+			, supported(false) { }
+		virtual ~VdpLineBufTest_benchmark() { }
+
+		virtual void SetUp(void) override;
+		virtual void TearDown(void) override;
+
+		/**
+		 * Report the benchmark results.
+		 * @param test Test name.
+		 * @param totalNs Total time, in nanoseconds.
+		 */
+		void report(const char *test, uint64_t totalNs);
+
+	protected:
+		// Number of H40 frames to render. (224 lines each)
+		static const int FRAMES = 10000;
+		static const int LINES = FRAMES * 224;
+
+		// Line buffer. (H40)
+		uint16_t lineBuf[320];
+
+		// Destination lines.
+		uint16_t dest16[336];
+		uint32_t dest32[336];
+
+		// Palettes. (257 entries are required for AVX2.)
+		uint16_t palette16[257];
+		uint32_t palette32[256];
+
+		// True if the CPU supports the flags for this test.
+		bool supported;
+
+		// Previous CPU flags.
+		uint32_t cpuFlags_old;
+};
+
+/**
+ * Set up the benchmark.
+ */
+void VdpLineBufTest_benchmark::SetUp(void)
+{
+	const VdpLineBufTest_flags &flags = GetParam();
+	supported = ((CPU_Flags & flags.cpuFlags) == flags.cpuFlags);
+	if (!supported) {
+		printf("CPU does not support the required flags for this test. Skipping.\n");
+	}
+
+	cpuFlags_old = CPU_Flags;
+	CPU_Flags = flags.cpuFlags;
+
+	srand(0x4C42);
+	for (int i = 0; i < 320; i++) {
+		lineBuf[i] = (uint16_t)(rand() & 0xFFFF);
+	}
+	for (int i = 0; i < 256; i++) {
+		palette16[i] = (uint16_t)(i * 0x0101);
+		palette32[i] = ((uint32_t)i * 0x01010101);
+	}
+	palette16[256] = 0;
+}
+
+/**
+ * Tear down the benchmark.
+ */
+void VdpLineBufTest_benchmark::TearDown(void)
+{
+	CPU_Flags = cpuFlags_old;
+}
+
+/**
+ * Report the benchmark results.
+ * @param test Test name.
+ * @param totalNs Total time, in nanoseconds.
+ */
+void VdpLineBufTest_benchmark::report(const char *test, uint64_t totalNs)
+{
+	printf("benchmark=VdpLineBuf test=%s flags=%s lines=%d total_ns=%llu ns_per_line=%.2f\n",
+		test, GetParam().name, LINES, (unsigned long long)totalNs,
+		(double)totalNs / (double)LINES);
+	fflush(stdout);
+}
+
+/**
+ * Benchmark an H40 line at 16bpp.
+ */
+TEST_P(VdpLineBufTest_benchmark, resolve16_H40)
+{
+	if (!supported)
+		return;
+
+	Timing timing;
+	const uint64_t start = timing.getTimeNs();
+	for (int i = LINES; i > 0; i--) {
+		VdpLineBuf::resolve(&dest16[8], lineBuf, 320, palette16);
+	}
+	report("resolve16_H40", timing.getTimeNs() - start);
+}
+
+/**
+ * Benchmark an H40 line at 32bpp.
+ */
+TEST_P(VdpLineBufTest_benchmark, resolve32_H40)
+{
+	if (!supported)
+		return;
+
+	Timing timing;
+	const uint64_t start = timing.getTimeNs();
+	for (int i = LINES; i > 0; i--) {
+		VdpLineBuf::resolve(&dest32[8], lineBuf, 320, palette32);
+	}
+	report("resolve32_H40", timing.getTimeNs() - start);
+}
+
+/**
+ * Benchmark H32 borders at 32bpp.
+ */
+TEST_P(VdpLineBufTest_benchmark, fill32_H32)
+{
+	if (!supported)
+		return;
+
+	Timing timing;
+	const uint64_t start = timing.getTimeNs();
+	for (int i = LINES; i > 0; i--) {
+		VdpLineBuf::fill(&dest32[0], 32, (uint32_t)i);
+		VdpLineBuf::fill(&dest32[288], 32, (uint32_t)i);
+	}
+	report("fill32_H32", timing.getTimeNs() - start);
+}
+
+INSTANTIATE_TEST_CASE_P(VdpLineBufTest_benchmark_NoFlags, VdpLineBufTest_benchmark,
+	::testing::Values(VdpLineBufTest_flags("NoFlags", 0)
+));
+
+#if defined(__i386__) || defined(__amd64__) || defined(__x86_64__)
+INSTANTIATE_TEST_CASE_P(VdpLineBufTest_benchmark_SSE2, VdpLineBufTest_benchmark,
+	::testing::Values(VdpLineBufTest_flags("SSE2", MDP_CPUFLAG_X86_SSE2)
+));
+INSTANTIATE_TEST_CASE_P(VdpLineBufTest_benchmark_AVX2, VdpLineBufTest_benchmark,
+	::testing::Values(VdpLineBufTest_flags("AVX2", MDP_CPUFLAG_X86_AVX2)
+));
+#endif
+
+} }
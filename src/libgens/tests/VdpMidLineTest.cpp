@@ -0,0 +1,229 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpMidLineTest.cpp: VDP mid-line write tests.                           *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Rom.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Util/MdFb.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace LibGens { namespace Tests {
+
+class VdpMidLineTest : public ::testing::Test
+{
+	protected:
+		VdpMidLineTest()
+			: ::testing::Test() { }
+		virtual ~VdpMidLineTest() { }
+
+		// Line statistics for the last rendered frame.
+		struct LineStats {
+			int splitLines;		// Lines with a single color change.
+			int solidLines;		// Lines with a single color.
+			int otherLines;		// Anything else.
+			int minColumn;		// Leftmost color change.
+			int maxColumn;		// Rightmost color change.
+			uint32_t leftColor;	// Color to the left of the change.
+			uint32_t rightColor;	// Color to the right of the change.
+		};
+
+		/**
+		 * Run the test ROM.
+		 * @param midLineWrites If true, enable mid-line writes.
+		 * @param deferred If true, enable deferred rendering.
+		 * @param stats [out] Line statistics.
+		 */
+		static void runRom(bool midLineWrites, bool deferred, LineStats *stats);
+};
+
+/**
+ * Test ROM program.
+ * The background color is changed from red to blue when the
+ * H counter is between 0x40 and 0x4F, and back to red after
+ * the active display.
+ */
+static const uint8_t test_prg[] = {
+	0x46,0xFC,0x27,0x00,			// 0x200: move.w	#$2700, sr
+	0x41,0xF9,0x00,0xC0,0x00,0x04,		// 0x204: lea	$C00004, a0
+	0x43,0xF9,0x00,0xC0,0x00,0x00,		// 0x20A: lea	$C00000, a1
+	0x30,0xBC,0x80,0x04,			// 0x210: move.w	#$8004, (a0)
+	0x30,0xBC,0x81,0x44,			// 0x214: move.w	#$8144, (a0)	; Display on, M5
+	0x30,0xBC,0x8C,0x81,			// 0x218: move.w	#$8C81, (a0)	; H40
+	0x30,0xBC,0x8F,0x02,			// 0x21C: move.w	#$8F02, (a0)
+	0x30,0xBC,0x87,0x00,			// 0x220: move.w	#$8700, (a0)	; BG color 0
+	0x20,0xBC,0xC0,0x00,0x00,0x00,		// 0x224: move.l	#$C0000000, (a0)
+	0x32,0xBC,0x00,0x0E,			// 0x22A: move.w	#$000E, (a1)	; Red
+	// wait1:
+	0x10,0x39,0x00,0xC0,0x00,0x09,		// 0x22E: move.b	$C00009, d0	; H counter
+	0x0C,0x00,0x00,0x40,			// 0x234: cmpi.b	#$40, d0
+	0x65,0xF4,				// 0x238: bcs.s	wait1
+	0x0C,0x00,0x00,0x50,			// 0x23A: cmpi.b	#$50, d0
+	0x64,0xEE,				// 0x23E: bcc.s	wait1
+	0x20,0xBC,0xC0,0x00,0x00,0x00,		// 0x240: move.l	#$C0000000, (a0)
+	0x32,0xBC,0x0E,0x00,			// 0x246: move.w	#$0E00, (a1)	; Blue
+	// wait2:
+	0x10,0x39,0x00,0xC0,0x00,0x09,		// 0x24A: move.b	$C00009, d0	; H counter
+	0x0C,0x00,0x00,0xA0,			// 0x250: cmpi.b	#$A0, d0
+	0x65,0xF4,				// 0x254: bcs.s	wait2
+	0x20,0xBC,0xC0,0x00,0x00,0x00,		// 0x256: move.l	#$C0000000, (a0)
+	0x32,0xBC,0x00,0x0E,			// 0x25C: move.w	#$000E, (a1)	; Red
+	0x60,0xCC,				// 0x260: bra.s	wait1
+};
+
+/**
+ * Run the test ROM.
+ * @param midLineWrites If true, enable mid-line writes.
+ * @param deferred If true, enable deferred rendering.
+ * @param stats [out] Line statistics.
+ */
+void VdpMidLineTest::runRom(bool midLineWrites, bool deferred, LineStats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	stats->minColumn = 320;
+
+	// Build the ROM image.
+	static const unsigned int ROM_SIZE = 8192;
+	uint8_t *romData = (uint8_t*)calloc(1, ROM_SIZE);
+	// Initial SP: $00FFFE00; initial PC: $00000200
+	static const uint8_t vectors[8] = {0x00,0xFF,0xFE,0x00, 0x00,0x00,0x02,0x00};
+	memcpy(&romData[0], vectors, sizeof(vectors));
+	memcpy(&romData[0x100], "SEGA MEGA DRIVE ", 16);
+	memcpy(&romData[0x200], test_prg, sizeof(test_prg));
+
+	Rom *rom = new Rom(romData, ROM_SIZE);
+	EmuMD *context = new EmuMD(rom);
+	rom->close();	// TODO: Let EmuMD handle this...
+	ASSERT_TRUE(context->isRomOpened());
+
+	Vdp *const vdp = context->m_vdp;
+	MdFb *const fb = vdp->MD_Screen;
+	fb->setBpp(MdFb::BPP_32);
+	vdp->options.midLineWrites = midLineWrites;
+	vdp->setDeferredRender(deferred);
+
+	for (int i = 0; i < 4; i++) {
+		context->execFrame();
+	}
+	vdp->setDeferredRender(false);
+
+	// Check the active display.
+	const int lineStart = vdp->VDP_Lines.Border.borderSize;
+	for (int line = lineStart; line < lineStart + 224; line++) {
+		const uint32_t *px = fb->lineBuf32(line);
+		int changes = 0, column = 0;
+		for (int x = 1; x < 320; x++) {
+			if (px[x] != px[x-1]) {
+				changes++;
+				column = x;
+			}
+		}
+
+		if (changes == 0) {
+			stats->solidLines++;
+		} else if (changes == 1) {
+			if (stats->splitLines == 0) {
+				stats->leftColor = px[0];
+				stats->rightColor = px[319];
+			}
+			EXPECT_EQ(stats->leftColor, px[0]) << "line " << line;
+			EXPECT_EQ(stats->rightColor, px[319]) << "line " << line;
+			stats->splitLines++;
+			if (column < stats->minColumn)
+				stats->minColumn = column;
+			if (column > stats->maxColumn)
+				stats->maxColumn = column;
+		} else {
+			stats->otherLines++;
+		}
+	}
+
+	delete context;
+	delete rom;
+	free(romData);
+}
+
+/**
+ * Without mid-line writes, each line has a single color.
+ */
+TEST_F(VdpMidLineTest, disabled)
+{
+	LineStats stats;
+	ASSERT_NO_FATAL_FAILURE(runRom(false, false, &stats));
+	EXPECT_EQ(224, stats.solidLines);
+	EXPECT_EQ(0, stats.splitLines);
+	EXPECT_EQ(0, stats.otherLines);
+}
+
+/**
+ * With mid-line writes, the color changes at the H counter
+ * where the write occurred. (0x40-0x4F: pixels 128-159)
+ * The polling loop and the control word write add up to
+ * about 100 pixels of latency.
+ */
+TEST_F(VdpMidLineTest, enabled)
+{
+	LineStats stats;
+	ASSERT_NO_FATAL_FAILURE(runRom(true, false, &stats));
+	EXPECT_EQ(224, stats.splitLines);
+	EXPECT_EQ(0, stats.otherLines);
+	EXPECT_NE(stats.leftColor, stats.rightColor);
+	EXPECT_GE(stats.minColumn, 128);
+	EXPECT_LT(stats.maxColumn, 256);
+}
+
+/**
+ * Mid-line writes aren't split with deferred rendering.
+ */
+TEST_F(VdpMidLineTest, deferred)
+{
+	LineStats stats;
+	ASSERT_NO_FATAL_FAILURE(runRom(true, true, &stats));
+	EXPECT_EQ(224, stats.solidLines);
+	EXPECT_EQ(0, stats.splitLines);
+	EXPECT_EQ(0, stats.otherLines);
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: VDP mid-line writes.\n\n");
+	LibGens::Init();
+	fflush(nullptr);
+
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
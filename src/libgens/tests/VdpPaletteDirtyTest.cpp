@@ -0,0 +1,274 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpPaletteDirtyTest.cpp: VdpPalette incremental update test.            *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+/**
+ * Checks that VdpPalette::update() gives the same active palette
+ * when only the dirty CRam words are recalculated as when the
+ * whole palette is recalculated.
+ *
+ * The renderer calls update() once per line, so each simulated
+ * frame has a few CRam writes between each update(), along with
+ * occasional background color and Shadow/Highlight changes.
+ * After every update(), the active palette is compared to a
+ * second VdpPalette with the same CRam that always does a full
+ * recalculation. (zomgRestoreCRam() marks the whole palette dirty.)
+ */
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "Vdp/VdpPalette.hpp"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace LibGens { namespace Tests {
+
+// Number of frames and lines to simulate.
+#define PALETTE_TEST_FRAMES	8
+#define PALETTE_TEST_LINES	262
+
+struct VdpPaletteDirtyTest_mode
+{
+	const char *name;
+	VdpPalette::PalMode_t palMode;
+	uint8_t m5m4bits;
+	MdFb::ColorDepth bpp;
+	bool shadowHighlight;	// Allow Shadow/Highlight. (MD only)
+};
+
+/**
+ * Formatting function for VdpPaletteDirtyTest_mode.
+ */
+inline ::std::ostream& operator<<(::std::ostream& os, const VdpPaletteDirtyTest_mode& mode)
+{
+	return os << mode.name;
+};
+
+class VdpPaletteDirtyTest : public ::testing::TestWithParam<VdpPaletteDirtyTest_mode>
+{
+	protected:
+		VdpPaletteDirtyTest()
+			: ::testing::TestWithParam<VdpPaletteDirtyTest_mode>() { }
+		virtual ~VdpPaletteDirtyTest() { }
+
+		virtual void SetUp(void) override;
+
+		/**
+		 * Recalculate the reference palette from scratch
+		 * and compare it to the incremental palette.
+		 * @param frame Frame number.
+		 * @param line Line number.
+		 */
+		void check(int frame, int line);
+
+		/**
+		 * Get the number of active palette entries used
+		 * in the current mode.
+		 * @return Number of active palette entries.
+		 */
+		int activeEntries(void) const;
+
+	protected:
+		VdpPalette m_palette;	// Incremental updates.
+		VdpPalette m_ref;	// Full recalculation.
+};
+
+/**
+ * Set up both palettes with the same mode and random CRam.
+ */
+void VdpPaletteDirtyTest::SetUp(void)
+{
+	const VdpPaletteDirtyTest_mode &mode = GetParam();
+	VdpPalette *const pal[2] = {&m_palette, &m_ref};
+	for (int i = 0; i < 2; i++) {
+		pal[i]->setBpp(mode.bpp);
+		pal[i]->setPalMode(mode.palMode);
+		pal[i]->setM5M4bits(mode.m5m4bits);
+		pal[i]->setMdShadowHighlight(mode.shadowHighlight);
+		pal[i]->setBgColorIdx(0x00);
+	}
+
+	srand(0x9A1E);
+	for (int i = 0; i < 0x80; i += 2) {
+		m_palette.writeCRam_16(i, (uint16_t)(rand() & 0xFFFF));
+	}
+	m_palette.update();
+	check(0, -1);
+}
+
+/**
+ * Get the number of active palette entries used
+ * in the current mode.
+ * @return Number of active palette entries.
+ */
+int VdpPaletteDirtyTest::activeEntries(void) const
+{
+	switch (m_palette.palMode()) {
+		case VdpPalette::PALMODE_MD:
+		case VdpPalette::PALMODE_32X:
+			if ((m_palette.m5m4bits() & 0x03) == 0x01) {
+				// Mode 4 on MD.
+				return 32;
+			}
+			// Shadow/Highlight adds shadow, highlight,
+			// and normal (both S and H) copies.
+			return (m_palette.mdShadowHighlight() ? 256 : 64);
+
+		default:
+			return 32;
+	}
+}
+
+/**
+ * Recalculate the reference palette from scratch
+ * and compare it to the incremental palette.
+ * @param frame Frame number.
+ * @param line Line number.
+ */
+void VdpPaletteDirtyTest::check(int frame, int line)
+{
+	// Copy CRam and the properties that don't
+	// mark the palette dirty by themselves.
+	Zomg_CRam_t cram;
+	m_palette.zomgSaveCRam(&cram);
+	m_ref.zomgRestoreCRam(&cram);
+	m_ref.setBgColorIdx(m_palette.bgColorIdx());
+	m_ref.setMdShadowHighlight(m_palette.mdShadowHighlight());
+	if (m_palette.palMode() == VdpPalette::PALMODE_32X) {
+		// 32X CRam isn't included in Zomg_CRam_t.
+		for (int i = 0; i < 0x200; i += 2) {
+			m_ref.writeCRam32X_16(i, m_palette.readCRam32X_16(i));
+		}
+	}
+	m_ref.update();
+
+	const int entries = activeEntries();
+	const bool is32 = (m_palette.bpp() == MdFb::BPP_32);
+	for (int i = 0; i < entries; i++) {
+		const uint32_t actual = (is32 ? m_palette.m_palActive.u32[i] : m_palette.m_palActive.u16[i]);
+		const uint32_t expected = (is32 ? m_ref.m_palActive.u32[i] : m_ref.m_palActive.u16[i]);
+		ASSERT_EQ(expected, actual) << "Active palette entry " << i
+			<< " doesn't match a full recalculation at frame " << frame
+			<< ", line " << line << '.';
+	}
+
+	if (m_palette.palMode() == VdpPalette::PALMODE_32X) {
+		for (int i = 0; i < 0x100; i++) {
+			const uint32_t actual = (is32 ? m_palette.m_palActive32X.u32[i] : m_palette.m_palActive32X.u16[i]);
+			const uint32_t expected = (is32 ? m_ref.m_palActive32X.u32[i] : m_ref.m_palActive32X.u16[i]);
+			ASSERT_EQ(expected, actual) << "Active 32X palette entry " << i
+				<< " doesn't match a full recalculation at frame " << frame
+				<< ", line " << line << '.';
+		}
+	}
+}
+
+/**
+ * Incremental updates must match a full recalculation
+ * after every line.
+ */
+TEST_P(VdpPaletteDirtyTest, matchesFullRecalc)
+{
+	const VdpPaletteDirtyTest_mode &mode = GetParam();
+	const bool is32X = (mode.palMode == VdpPalette::PALMODE_32X);
+
+	for (int frame = 0; frame < PALETTE_TEST_FRAMES; frame++) {
+		for (int line = 0; line < PALETTE_TEST_LINES; line++) {
+			// Mid-frame CRam writes.
+			// Most lines don't have any, like most games.
+			const int r = rand();
+			int writes = 0;
+			if ((r & 7) == 0) {
+				writes = 1 + ((r >> 3) & 3);
+			} else if ((r & 0xFF) == 1) {
+				// Whole palette, e.g. a fade.
+				writes = 64;
+			}
+			for (int i = 0; i < writes; i++) {
+				const uint8_t address = (writes == 64 ? (i * 2) : (rand() & 0x7E));
+				if (!is32X && (rand() & 7) == 0) {
+					m_palette.writeCRam_8(address | (rand() & 1), (uint8_t)(rand() & 0xFF));
+				} else {
+					m_palette.writeCRam_16(address, (uint16_t)(rand() & 0xFFFF));
+				}
+			}
+			if (is32X && (r & 0x3F00) == 0) {
+				m_palette.writeCRam32X_16((rand() & 0xFF) * 2, (uint16_t)(rand() & 0xFFFF));
+			}
+
+			// Background color changes.
+			if ((r & 0xF800) == 0) {
+				m_palette.setBgColorIdx((uint8_t)(rand() & 0x3F));
+			}
+
+			// Shadow/Highlight changes.
+			// NOTE: Only a full recalculation is needed when
+			// S/H is enabled; disabling it keeps the normal colors.
+			if (mode.shadowHighlight && (r & 0x1F0000) == 0) {
+				m_palette.setMdShadowHighlight(!m_palette.mdShadowHighlight());
+			}
+
+			m_palette.update();
+			ASSERT_NO_FATAL_FAILURE(check(frame, line));
+		}
+	}
+}
+
+// Test cases.
+#define MD_MODES(bpp, suffix) \
+	{"md" suffix,		VdpPalette::PALMODE_MD, 0x03, MdFb::bpp, false}, \
+	{"md_sh" suffix,	VdpPalette::PALMODE_MD, 0x03, MdFb::bpp, true}, \
+	{"md_psel0" suffix,	VdpPalette::PALMODE_MD, 0x02, MdFb::bpp, true}, \
+	{"md_m4" suffix,	VdpPalette::PALMODE_MD, 0x01, MdFb::bpp, false}, \
+	{"sms" suffix,		VdpPalette::PALMODE_SMS, 0x01, MdFb::bpp, false}, \
+	{"gg" suffix,		VdpPalette::PALMODE_GG, 0x01, MdFb::bpp, false}, \
+	{"32x" suffix,		VdpPalette::PALMODE_32X, 0x03, MdFb::bpp, true}
+
+static const VdpPaletteDirtyTest_mode modes[] = {
+	MD_MODES(BPP_15, "_15"),
+	MD_MODES(BPP_16, "_16"),
+	MD_MODES(BPP_32, "_32"),
+};
+
+INSTANTIATE_TEST_CASE_P(VdpPaletteDirtyTest, VdpPaletteDirtyTest,
+	::testing::ValuesIn(modes));
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: VdpPalette incremental updates.\n\n");
+	::testing::InitGoogleTest(&argc, argv);
+	LibGens::Init();
+	fprintf(stderr, "\n");
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -0,0 +1,233 @@
+/***************************************************************************
+ * libgens/tests: Gens Emulation Library. (Test Suite)                     *
+ * VdpRendThreadTest.cpp: Deferred VDP rendering tests.                    *
+ *                                                                         *
+ * Copyright (c) 2015-2016 by David Korth.                                 *
+ *                                                                         *
+ * This program is free software; you can redistribute it and/or modify it *
+ * under the terms of the GNU General Public License as published by the   *
+ * Free Software Foundation; either version 2 of the License, or (at your  *
+ * option) any later version.                                              *
+ *                                                                         *
+ * This program is distributed in the hope that it will be useful, but     *
+ * WITHOUT ANY WARRANTY; without even the implied warranty of              *
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the           *
+ * GNU General Public License for more details.                            *
+ *                                                                         *
+ * You should have received a copy of the GNU General Public License along *
+ * with this program; if not, write to the Free Software Foundation, Inc., *
+ * 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.           *
+ ***************************************************************************/
+
+// Google Test
+#include "gtest/gtest.h"
+
+// LibGens
+#include "lg_main.hpp"
+#include "EmuContext/EmuMD.hpp"
+#include "Rom.hpp"
+#include "Vdp/Vdp.hpp"
+#include "Util/MdFb.hpp"
+#include "Util/MdFbRing.hpp"
+
+// Test ROM data.
+#include "EmuMD_benchmark_data.h"
+
+// C includes. (C++ namespace)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// C++ includes.
+#include <vector>
+using std::vector;
+
+namespace LibGens { namespace Tests {
+
+class VdpRendThreadTest : public ::testing::Test
+{
+	protected:
+		VdpRendThreadTest()
+			: ::testing::Test() { }
+		virtual ~VdpRendThreadTest() { }
+
+	public:
+		// Event that occurs partway through the run.
+		enum Event_t {
+			EVENT_NONE,		// Nothing.
+			EVENT_TOGGLE,		// Deferred rendering is toggled.
+			EVENT_LOAD_STATE,	// An earlier savestate is loaded.
+			EVENT_HARD_RESET,	// The system is reset.
+			EVENT_FB_RING,		// A framebuffer ring is used.
+		};
+
+	protected:
+		// Number of frames to render.
+		static const int FRAMES = 90;
+
+		/**
+		 * Render frames of the EmuMD benchmark ROM.
+		 * @param bpp Color depth.
+		 * @param deferred If true, enable deferred rendering.
+		 * @param event Event that occurs partway through the run.
+		 * @return Concatenated framebuffers.
+		 */
+		static vector<uint8_t> renderFrames(MdFb::ColorDepth bpp, bool deferred, Event_t event);
+
+		/**
+		 * Compare a deferred run to an immediate run.
+		 * @param event Event that occurs partway through the run.
+		 */
+		static void compareRuns(Event_t event);
+};
+
+/**
+ * Render frames of the EmuMD benchmark ROM.
+ * @param bpp Color depth.
+ * @param deferred If true, enable deferred rendering.
+ * @param event Event that occurs partway through the run.
+ * @return Concatenated framebuffers.
+ */
+vector<uint8_t> VdpRendThreadTest::renderFrames(MdFb::ColorDepth bpp, bool deferred, Event_t event)
+{
+	vector<uint8_t> out;
+
+	// Enable all scenarios.
+	uint8_t *romData = (uint8_t*)malloc(sizeof(test_emumd_benchmark_rom));
+	memcpy(romData, test_emumd_benchmark_rom, sizeof(test_emumd_benchmark_rom));
+	romData[TEST_EMUMD_BENCHMARK_MASK_ADDR] = 0x00;
+	romData[TEST_EMUMD_BENCHMARK_MASK_ADDR+1] = 0x0F;
+
+	Rom *rom = new Rom(romData, sizeof(test_emumd_benchmark_rom));
+	EmuMD *context = new EmuMD(rom);
+	rom->close();	// TODO: Let EmuMD handle this...
+	MdFbRing *fbRing = nullptr;
+	vector<uint8_t> state;
+
+	if (context->isRomOpened()) {
+		Vdp *const vdp = context->m_vdp;
+		vdp->MD_Screen->setBpp(bpp);
+		vdp->setDeferredRender(deferred);
+		if (event == EVENT_FB_RING) {
+			fbRing = new MdFbRing();
+			vdp->setFbRing(fbRing);
+		}
+
+		for (int i = 0; i < FRAMES; i++) {
+			switch (event) {
+				case EVENT_TOGGLE:
+					if (i == FRAMES / 3 || i == (FRAMES * 2) / 3)
+						vdp->setDeferredRender(!vdp->isDeferredRender());
+					break;
+				case EVENT_LOAD_STATE:
+					if (i == FRAMES / 3) {
+						state.resize(context->saveStateToBuffer(nullptr, 0));
+						context->saveStateToBuffer(state.data(), state.size());
+					} else if (i == (FRAMES * 2) / 3) {
+						context->loadStateFromBuffer(state.data(), state.size());
+					}
+					break;
+				case EVENT_HARD_RESET:
+					if (i == FRAMES / 2)
+						context->hardReset();
+					break;
+				default:
+					break;
+			}
+
+			context->execFrame();
+
+			// NOTE: With a framebuffer ring, MD_Screen
+			// is the back buffer for the next frame.
+			const MdFb *fb = (fbRing ? fbRing->acquire() : vdp->MD_Screen);
+			const int bytes = (fb->pxPitch() * fb->numLines() - fb->pxStart()) *
+				(bpp == MdFb::BPP_32 ? 4 : 2);
+			const uint8_t *px = (bpp == MdFb::BPP_32
+				? (const uint8_t*)fb->fb32()
+				: (const uint8_t*)fb->fb16());
+			out.insert(out.end(), px, px + bytes);
+		}
+
+		vdp->setFbRing(nullptr);
+	}
+
+	delete context;
+	delete fbRing;
+	delete rom;
+	free(romData);
+	return out;
+}
+
+/**
+ * Compare a deferred run to an immediate run.
+ * @param event Event that occurs partway through the run.
+ */
+void VdpRendThreadTest::compareRuns(Event_t event)
+{
+	static const MdFb::ColorDepth bpps[] = {MdFb::BPP_16, MdFb::BPP_32};
+	for (int b = 0; b < 2; b++) {
+		const vector<uint8_t> golden = renderFrames(bpps[b], false, event);
+		const vector<uint8_t> test = renderFrames(bpps[b], true, event);
+		ASSERT_FALSE(golden.empty());
+		ASSERT_EQ(golden.size(), test.size());
+		EXPECT_TRUE(golden == test) << "Frames differ at bpp index " << b;
+	}
+}
+
+/**
+ * Deferred rendering must match immediate rendering.
+ */
+TEST_F(VdpRendThreadTest, emuMD)
+{
+	compareRuns(EVENT_NONE);
+}
+
+/**
+ * Deferred rendering can be toggled between frames.
+ */
+TEST_F(VdpRendThreadTest, toggle)
+{
+	compareRuns(EVENT_TOGGLE);
+}
+
+/**
+ * Loading a savestate resynchronizes the render thread.
+ */
+TEST_F(VdpRendThreadTest, loadState)
+{
+	compareRuns(EVENT_LOAD_STATE);
+}
+
+/**
+ * Resetting the system resynchronizes the render thread.
+ */
+TEST_F(VdpRendThreadTest, hardReset)
+{
+	compareRuns(EVENT_HARD_RESET);
+}
+
+/**
+ * Deferred rendering follows MD_Screen when a framebuffer ring is used.
+ */
+TEST_F(VdpRendThreadTest, fbRing)
+{
+	compareRuns(EVENT_FB_RING);
+}
+
+} }
+
+/**
+ * Test suite main function.
+ * Called by gtest_main.inc.cpp's main().
+ */
+static int test_main(int argc, char *argv[])
+{
+	fprintf(stderr, "LibGens test suite: VdpRendThread.\n\n");
+	LibGens::Init();
+	fflush(nullptr);
+
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
+
+#include "libcompat/tests/gtest_main.inc.cpp"
@@ -228,7 +228,7 @@ int Archive::checkMagic(const uint8_t *magic, size_t siz)
 	rewind(m_file);
 	size_t szread = fread(header, 1, siz, m_file);
 	if (szread == siz) {
-		if (!memcmp(header, magic, sizeof(siz))) {
+		if (!memcmp(header, magic, siz)) {
 			// Header matches.
 			ret = 0;
 		} else {
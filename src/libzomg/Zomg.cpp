@@ -32,6 +32,7 @@
 #include "libcompat/reentrant.h"
 
 #include "Zomg.hpp"
+#include "libcompat/byteswap.h"
 
 #ifdef _WIN32
 // Win32 Unicode Translation Layer.
@@ -63,8 +64,15 @@ ZomgPrivate::ZomgPrivate(Zomg *q)
 	: q(q)
 	, unz(nullptr)	// TODO: Combine with zip into a union?
 	, zip(nullptr)	// Need to double-check all users.
+	, isMem(false)
+	, mem(nullptr)
+	, memSize(0)
+	, memPos(0)
 { }
 
+// In-memory savestate header magic.
+const uint8_t ZomgPrivate::MemMagic[8] = {'Z','O','M','G','M','E','M',0};
+
 ZomgPrivate::~ZomgPrivate()
 {
 	// FIXME: Move ZomgBase stuff here,
@@ -153,6 +161,55 @@ int ZomgPrivate::initZomgSave(const char *filename)
 	return 0;
 }
 
+/**
+ * Initialize the Zomg class for an in-memory savestate.
+ * @param buf Memory buffer.
+ * @param size Size of buf.
+ * @param mode File mode.
+ * @return 0 on success; non-zero on error.
+ */
+int ZomgPrivate::initZomgMem(void *buf, size_t size, ZomgBase::ZomgFileMode mode)
+{
+	switch (mode) {
+		case ZomgBase::ZOMG_LOAD: {
+			// Verify the header.
+			if (!buf || size < sizeof(MemHeader))
+				return -EINVAL;
+			MemHeader header;
+			memcpy(&header, buf, sizeof(header));
+			if (memcmp(header.magic, MemMagic, sizeof(MemMagic)) != 0)
+				return -EINVAL;
+			if (le32_to_cpu(header.version) != MemVersion) {
+				// Unsupported format version.
+				return -EINVAL;
+			}
+			break;
+		}
+
+		case ZomgBase::ZOMG_SAVE:
+			// Write the header.
+			// If buf is nullptr, we're only calculating the size.
+			if (buf) {
+				if (size < sizeof(MemHeader))
+					return -ENOSPC;
+				MemHeader header;
+				memcpy(header.magic, MemMagic, sizeof(MemMagic));
+				header.version = cpu_to_le32(MemVersion);
+				memcpy(buf, &header, sizeof(header));
+			}
+			break;
+
+		default:
+			return -EINVAL;
+	}
+
+	this->isMem = true;
+	this->mem = (uint8_t*)buf;
+	this->memSize = (buf ? size : 0);
+	this->memPos = sizeof(MemHeader);
+	return 0;
+}
+
 /** Zomg **/
 
 /**
@@ -199,6 +256,26 @@ Zomg::Zomg(const char *filename, ZomgFileMode mode)
 	m_filename = string(filename);
 }
 
+/**
+ * Open an in-memory ZOMG savestate.
+ * @param buf Memory buffer. (Must remain valid until close() is called.)
+ * @param size Size of buf.
+ * @param mode File mode.
+ */
+Zomg::Zomg(void *buf, size_t size, ZomgFileMode mode)
+	: ZomgBase(nullptr, mode)
+	, d(new ZomgPrivate(this))
+{
+	int ret = d->initZomgMem(buf, size, mode);
+	if (ret != 0) {
+		m_lastError = ret;
+		return;
+	}
+
+	// Savestate buffer is open.
+	m_mode = mode;
+}
+
 /**
  * Close the ZOMG savestate file.
  */
@@ -223,6 +300,10 @@ void Zomg::close(void)
 		d->zip = nullptr;
 	}
 
+	// NOTE: memPos is kept so bufferUsed() works after close().
+	d->mem = nullptr;
+	d->memSize = 0;
+
 	m_mode = ZOMG_CLOSED;
 	m_lastError = 0;
 }
@@ -258,4 +339,15 @@ bool Zomg::DetectFormat(const char *filename)
 	return (!memcmp(header, zip_magic, sizeof(header)));
 }
 
+/**
+ * Get the number of bytes used in an in-memory savestate.
+ * When saving, this may be larger than the buffer size;
+ * if so, the savestate was truncated. (lastError() == -ENOSPC)
+ * @return Number of bytes used, or 0 if this isn't an in-memory savestate.
+ */
+size_t Zomg::bufferUsed(void) const
+{
+	return d->memPos;
+}
+
 }
@@ -38,6 +38,23 @@ class Zomg : public ZomgBase
 {
 	public:
 		Zomg(const char *filename, ZomgFileMode mode);
+
+		/**
+		 * Open an in-memory ZOMG savestate.
+		 *
+		 * In-memory savestates contain the same sections as ZOMG files,
+		 * but they're stored uncompressed in a caller-supplied buffer.
+		 * ZOMG.ini and the preview image are not supported.
+		 *
+		 * When saving, buf may be nullptr; in that case, nothing is
+		 * written, and bufferUsed() returns the required buffer size.
+		 *
+		 * @param buf Memory buffer. (Must remain valid until close() is called.)
+		 * @param size Size of buf.
+		 * @param mode File mode.
+		 */
+		Zomg(void *buf, size_t size, ZomgFileMode mode);
+
 		virtual ~Zomg(void);
 
 	protected:
@@ -59,6 +76,14 @@ class Zomg : public ZomgBase
 		 */
 		static bool DetectFormat(const char *filename);
 
+		/**
+		 * Get the number of bytes used in an in-memory savestate.
+		 * When saving, this may be larger than the buffer size;
+		 * if so, the savestate was truncated. (lastError() == -ENOSPC)
+		 * @return Number of bytes used, or 0 if this isn't an in-memory savestate.
+		 */
+		size_t bufferUsed(void) const;
+
 		/**
 		 * Load savestate functions.
 		 * @param siz Number of bytes to read.
@@ -67,7 +67,11 @@ namespace LibZomg {
  */
 int ZomgPrivate::loadFromZomg(const char *filename, void *buf, int len)
 {
-	if (q->m_mode != ZomgBase::ZOMG_LOAD || !this->unz)
+	if (q->m_mode != ZomgBase::ZOMG_LOAD)
+		return -EBADF;
+	if (this->isMem)
+		return loadFromMem(filename, buf, len);
+	if (!this->unz)
 		return -EBADF;
 
 	// Locate the file in the ZOMG file.
@@ -92,6 +96,67 @@ int ZomgPrivate::loadFromZomg(const char *filename, void *buf, int len)
 	return ret;
 }
 
+/**
+ * Load a section from an in-memory savestate.
+ * Sections are usually loaded in the same order they were
+ * saved, so the search starts at the previous section.
+ * @param filename Section name.
+ * @param buf Buffer to store the section in.
+ * @param len Length of the buffer.
+ * @return Length of section loaded, or negative number on error.
+ */
+int ZomgPrivate::loadFromMem(const char *filename, void *buf, int len)
+{
+	const size_t nameLen = strlen(filename);
+	const size_t start = this->memPos;
+	size_t pos = start;
+	bool wrapped = false;
+
+	while (true) {
+		if (pos + sizeof(MemSection) > this->memSize) {
+			// End of buffer.
+			if (wrapped || start == sizeof(MemHeader))
+				break;
+			// Search from the beginning.
+			pos = sizeof(MemHeader);
+			wrapped = true;
+			continue;
+		} else if (wrapped && pos >= start) {
+			// Searched the entire buffer.
+			break;
+		}
+
+		MemSection section;
+		memcpy(&section, &this->mem[pos], sizeof(section));
+		section.nameLen = le32_to_cpu(section.nameLen);
+		section.dataLen = le32_to_cpu(section.dataLen);
+		const size_t dataPos = pos + sizeof(section) + section.nameLen;
+		if (dataPos < pos || dataPos + section.dataLen < dataPos ||
+		    dataPos + section.dataLen > this->memSize)
+		{
+			// Section is out of range. The buffer is corrupted.
+			return -EIO;
+		}
+
+		if (section.nameLen == nameLen &&
+		    !memcmp(&this->mem[pos + sizeof(section)], filename, nameLen))
+		{
+			// Found the section.
+			// Like unzReadCurrentFile(), read up to len bytes.
+			const size_t toRead = ((size_t)len < section.dataLen ? (size_t)len : section.dataLen);
+			memcpy(buf, &this->mem[dataPos], toRead);
+			this->memPos = dataPos + section.dataLen;
+			return (int)toRead;
+		}
+
+		// Next section.
+		pos = dataPos + section.dataLen;
+	}
+
+	// File not found.
+	return -ENOENT;
+}
+
 /**
  * Load savestate functions.
  * @param siz Number of bytes to read.
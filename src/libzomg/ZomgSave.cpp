@@ -99,7 +99,11 @@ namespace LibZomg {
 int ZomgPrivate::saveToZomg(const char *filename, const void *buf, int len,
 			    ZomgZipFileType_t fileType)
 {
-	if (q->m_mode != ZomgBase::ZOMG_SAVE || !this->zip)
+	if (q->m_mode != ZomgBase::ZOMG_SAVE)
+		return -EBADF;
+	if (this->isMem)
+		return saveToMem(filename, buf, len);
+	if (!this->zip)
 		return -EBADF;
 
 	// Open the new file in the ZOMG file.
@@ -146,6 +150,43 @@ int ZomgPrivate::saveToZomg(const char *filename, const void *buf, int len,
 	return 0;
 }
 
+/**
+ * Save a section to an in-memory savestate.
+ * If the buffer is too small (or nullptr), nothing is written,
+ * but memPos is still updated so the required size is known.
+ * @param filename     [in] Section name.
+ * @param buf          [in] Buffer containing the section contents.
+ * @param len          [in] Length of the buffer.
+ * @return 0 on success; non-zero on error.
+ */
+int ZomgPrivate::saveToMem(const char *filename, const void *buf, int len)
+{
+	if (len < 0)
+		return -EINVAL;
+
+	const uint32_t nameLen = (uint32_t)strlen(filename);
+	const uint32_t dataLen = (uint32_t)len;
+	const size_t pos = this->memPos;
+	this->memPos += sizeof(MemSection) + nameLen + dataLen;
+
+	if (!this->mem) {
+		// Calculating the size only.
+		return 0;
+	} else if (this->memPos > this->memSize) {
+		// Buffer is too small.
+		q->m_lastError = -ENOSPC;
+		return -ENOSPC;
+	}
+
+	MemSection section;
+	section.nameLen = cpu_to_le32(nameLen);
+	section.dataLen = cpu_to_le32(dataLen);
+	memcpy(&this->mem[pos], &section, sizeof(section));
+	memcpy(&this->mem[pos + sizeof(section)], filename, nameLen);
+	memcpy(&this->mem[pos + sizeof(section) + nameLen], buf, dataLen);
+	return 0;
+}
+
 /**
  * Save savestate functions.
  * @param siz Number of bytes to write.
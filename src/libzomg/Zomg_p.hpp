@@ -26,6 +26,12 @@
 #include "minizip/zip.h"
 #include "minizip/unzip.h"
 
+// C includes.
+#include <stdint.h>
+
+// C includes. (C++ namespace)
+#include <cstddef>
+
 namespace LibZomg {
 
 class Zomg;
@@ -68,6 +74,45 @@ class ZomgPrivate
 		int loadFromZomg(const char *filename, void *buf, int len);
 		int saveToZomg(const char *filename, const void *buf, int len,
 			       ZomgZipFileType_t fileType = ZOMG_FILE_BINARY);
+
+		/** In-memory savestates. **/
+
+		/**
+		 * In-memory savestate buffer.
+		 * If mem is nullptr when saving, only memPos is updated,
+		 * which allows the caller to determine the required size.
+		 *
+		 * Format: MemHeader, followed by sections.
+		 * Each section has a MemSection header, followed by
+		 * the section name (not NULL-terminated), followed by
+		 * the section data. Header fields are little-endian,
+		 * and section data uses the same byte order as ZOMG
+		 * files, so in-memory savestates are portable and can
+		 * be written to disk, e.g. as a movie's initial state.
+		 */
+		bool isMem;
+		uint8_t *mem;
+		size_t memSize;
+		size_t memPos;
+
+		// Header magic: "ZOMGMEM\0"
+		static const uint8_t MemMagic[8];
+		// Current in-memory savestate format version.
+		static const uint32_t MemVersion = 1;
+
+		struct MemHeader {
+			uint8_t magic[8];	// MemMagic
+			uint32_t version;	// MemVersion (LE32)
+		};
+
+		struct MemSection {
+			uint32_t nameLen;	// Length of the section name. (LE32)
+			uint32_t dataLen;	// Length of the section data. (LE32)
+		};
+
+		int initZomgMem(void *buf, size_t size, ZomgBase::ZomgFileMode mode);
+		int loadFromMem(const char *filename, void *buf, int len);
+		int saveToMem(const char *filename, const void *buf, int len);
 };
 
 }